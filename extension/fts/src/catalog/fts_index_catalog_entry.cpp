@@ -5,8 +5,9 @@ namespace fts_extension {
 
 std::unique_ptr<catalog::IndexCatalogEntry> FTSIndexCatalogEntry::copy() const {
     auto other = std::make_unique<FTSIndexCatalogEntry>();
-    other->numDocs = numDocs;
-    other->avgDocLen = avgDocLen;
+    other->config = config;
+    other->stopWords = stopWords;
+    other->postingIndex = postingIndex;
     other->copyFrom(*this);
     return other;
 }
@@ -17,6 +17,11 @@ void FTSExtension::load(main::ClientContext* context) {
     ADD_GDS_FUNC(QFTSFunction);
     db.addStandaloneCallFunction(CreateFTSFunction::name, CreateFTSFunction::getFunctionSet());
     db.addStandaloneCallFunction(DropFTSFunction::name, DropFTSFunction::getFunctionSet());
+    db.addStandaloneCallFunction(BuildFTSFunction::name, BuildFTSFunction::getFunctionSet());
+    db.addTableFunction(FTSIndexDocsFunction::name, FTSIndexDocsFunction::getFunctionSet());
+    db.addTableFunction(FTSIndexTermsFunction::name, FTSIndexTermsFunction::getFunctionSet());
+    db.addTableFunction(FTSIndexAppearsInFunction::name,
+        FTSIndexAppearsInFunction::getFunctionSet());
 }
 
 } // namespace fts_extension
@@ -2,12 +2,15 @@
 
 #include "binder/expression/expression_util.h"
 #include "catalog/catalog.h"
+#include "catalog/fts_index_catalog_entry.h"
 #include "common/exception/binder.h"
 #include "fts_extension.h"
 #include "function/fts_bind_data.h"
 #include "function/fts_utils.h"
 #include "function/table/bind_input.h"
 #include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
 
 namespace kuzu {
 namespace fts_extension {
@@ -27,9 +30,27 @@ static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
         binder::expression_vector{});
 }
 
-std::string dropFTSIndexQuery(ClientContext& /*context*/, const TableFuncBindData& bindData) {
+// The stop words table is shared by all FTS indexes, so it is dropped with the last one.
+static bool isLastFTSIndex(const ClientContext& context, const FTSBindData& bindData) {
+    for (auto indexEntry : context.getCatalog()->getIndexEntries(context.getTx())) {
+        if (dynamic_cast<FTSIndexCatalogEntry*>(indexEntry) == nullptr) {
+            continue;
+        }
+        if (indexEntry->getTableID() != bindData.tableID ||
+            indexEntry->getIndexName() != bindData.indexName) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string dropFTSIndexQuery(ClientContext& context, const TableFuncBindData& bindData) {
     auto ftsBindData = bindData.constPtrCast<FTSBindData>();
-    std::string query = common::stringFormat("DROP TABLE `{}`;", FTSUtils::getStopWordsTableName());
+    std::string query = "";
+    if (isLastFTSIndex(context, *ftsBindData) &&
+        context.getCatalog()->containsTable(context.getTx(), FTSUtils::getStopWordsTableName())) {
+        query += common::stringFormat("DROP TABLE `{}`;", FTSUtils::getStopWordsTableName());
+    }
     query += common::stringFormat("DROP TABLE `{}`;",
         FTSUtils::getAppearsInTableName(ftsBindData->tableID, ftsBindData->indexName));
     query += common::stringFormat("DROP TABLE `{}`;",
@@ -44,6 +65,10 @@ static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& /*outp
     auto& context = *input.context;
     context.clientContext->getCatalog()->dropIndex(input.context->clientContext->getTx(),
         ftsBindData.tableID, ftsBindData.indexName);
+    context.clientContext->getStorageManager()
+        ->getTable(ftsBindData.tableID)
+        ->cast<storage::NodeTable>()
+        .removeWriteListener(ftsBindData.indexName);
     return 0;
 }
 
@@ -39,6 +39,12 @@ void B::validate(double value) {
     }
 }
 
+void TopK::validate(int64_t value) {
+    if (value <= 0) {
+        throw common::BinderException{"top must be a positive integer."};
+    }
+}
+
 QueryFTSConfig::QueryFTSConfig(const function::optional_params_t& optionalParams) {
     for (auto& [name, value] : optionalParams) {
         auto lowerCaseName = common::StringUtils::getLower(name);
@@ -53,6 +59,10 @@ QueryFTSConfig::QueryFTSConfig(const function::optional_params_t& optionalParams
         } else if (Conjunctive::NAME == lowerCaseName) {
             value.validateType(Conjunctive::TYPE);
             isConjunctive = value.getValue<bool>();
+        } else if (TopK::NAME == lowerCaseName) {
+            value.validateType(TopK::TYPE);
+            TopK::validate(value.getValue<int64_t>());
+            topK = value.getValue<int64_t>();
         } else {
             throw common::BinderException{"Unrecognized optional parameter: " + name};
         }
@@ -0,0 +1,180 @@
+#include <algorithm>
+
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/fts_index_catalog_entry.h"
+#include "function/create_fts_index.h"
+#include "function/fts_bind_data.h"
+#include "function/fts_utils.h"
+#include "function/table/bind_input.h"
+
+namespace kuzu {
+namespace fts_extension {
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::function;
+
+// The rows of the docs, terms and appears_in tables of an index in output order. They point into
+// the postings, which do not change until CREATE_FTS_INDEX starts maintaining the index.
+struct FTSIndexRows {
+    // Docs with at least one term.
+    std::vector<offset_t> docs;
+    std::vector<const std::string*> terms;
+    std::vector<const PostingList*> postingLists;
+    // The appears_in row of the first posting of each term, followed by the number of rows.
+    std::vector<uint64_t> postingOffsets;
+};
+
+struct FTSIndexRowsBindData final : public FTSBindData {
+    std::shared_ptr<FTSPostingIndex> postingIndex;
+    std::shared_ptr<const FTSIndexRows> rows;
+
+    FTSIndexRowsBindData(std::string tableName, table_id_t tableID, std::string indexName,
+        binder::expression_vector columns, std::shared_ptr<FTSPostingIndex> postingIndex,
+        std::shared_ptr<const FTSIndexRows> rows, offset_t numRows)
+        : FTSBindData{std::move(tableName), tableID, std::move(indexName), std::move(columns)},
+          postingIndex{std::move(postingIndex)}, rows{std::move(rows)} {
+        maxOffset = numRows;
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<FTSIndexRowsBindData>(*this);
+    }
+};
+
+enum class FTSIndexTable : uint8_t { DOCS = 0, TERMS = 1, APPEARS_IN = 2 };
+
+template<FTSIndexTable TABLE>
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    auto indexName = input->getLiteralVal<std::string>(1);
+    auto& tableEntry = FTSUtils::bindTable(input->getLiteralVal<std::string>(0), context,
+        indexName, FTSUtils::IndexOperation::QUERY);
+    FTSUtils::validateIndexExistence(*context, tableEntry.getTableID(), indexName);
+    auto postingIndex = context->getCatalog()
+                            ->getIndex(context->getTx(), tableEntry.getTableID(), indexName)
+                            ->constCast<FTSIndexCatalogEntry>()
+                            .getPostingIndex();
+    auto rows = std::make_shared<FTSIndexRows>();
+    std::vector<std::string> columnNames;
+    std::vector<LogicalType> columnTypes;
+    offset_t numRows = 0;
+    if constexpr (TABLE == FTSIndexTable::DOCS) {
+        auto& docLens = postingIndex->getDocLens();
+        for (auto doc = 0u; doc < docLens.size(); doc++) {
+            if (docLens[doc] > 0) {
+                rows->docs.push_back(doc);
+            }
+        }
+        numRows = rows->docs.size();
+        columnNames = {CreateFTSFunction::DOC_ID_PROP_NAME, CreateFTSFunction::DOC_LEN_PROP_NAME};
+        columnTypes.push_back(LogicalType::INT64());
+        columnTypes.push_back(LogicalType::UINT64());
+    } else {
+        for (auto& [term, postingList] : postingIndex->getPostingLists()) {
+            rows->terms.push_back(&term);
+            rows->postingLists.push_back(&postingList);
+            rows->postingOffsets.push_back(numRows);
+            numRows += TABLE == FTSIndexTable::TERMS ? 1 : postingList.getDF();
+        }
+        rows->postingOffsets.push_back(numRows);
+        if constexpr (TABLE == FTSIndexTable::TERMS) {
+            columnNames = {CreateFTSFunction::TERM_PROP_NAME, CreateFTSFunction::DF_PROP_NAME};
+            columnTypes.push_back(LogicalType::STRING());
+            columnTypes.push_back(LogicalType::UINT64());
+        } else {
+            columnNames = {CreateFTSFunction::TERM_PROP_NAME, CreateFTSFunction::DOC_ID_PROP_NAME,
+                CreateFTSFunction::TF_PROP_NAME};
+            columnTypes.push_back(LogicalType::STRING());
+            columnTypes.push_back(LogicalType::INT64());
+            columnTypes.push_back(LogicalType::UINT64());
+        }
+    }
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    return std::make_unique<FTSIndexRowsBindData>(tableEntry.getName(), tableEntry.getTableID(),
+        indexName, std::move(columns), std::move(postingIndex), std::move(rows), numRows);
+}
+
+static offset_t docsTableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto morsel = input.sharedState->ptrCast<SimpleTableFuncSharedState>()->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto& bindData = *input.bindData->constPtrCast<FTSIndexRowsBindData>();
+    auto& docLens = bindData.postingIndex->getDocLens();
+    auto& dataChunk = output.dataChunk;
+    for (auto i = 0u; i < morsel.endOffset - morsel.startOffset; i++) {
+        auto doc = bindData.rows->docs[morsel.startOffset + i];
+        dataChunk.getValueVectorMutable(0).setValue<int64_t>(i, doc);
+        dataChunk.getValueVectorMutable(1).setValue<uint64_t>(i, docLens[doc]);
+    }
+    return morsel.endOffset - morsel.startOffset;
+}
+
+static offset_t termsTableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto morsel = input.sharedState->ptrCast<SimpleTableFuncSharedState>()->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto& rows = *input.bindData->constPtrCast<FTSIndexRowsBindData>()->rows;
+    auto& dataChunk = output.dataChunk;
+    for (auto i = 0u; i < morsel.endOffset - morsel.startOffset; i++) {
+        auto termIdx = morsel.startOffset + i;
+        dataChunk.getValueVectorMutable(0).setValue(i, *rows.terms[termIdx]);
+        dataChunk.getValueVectorMutable(1).setValue<uint64_t>(i,
+            rows.postingLists[termIdx]->getDF());
+    }
+    return morsel.endOffset - morsel.startOffset;
+}
+
+static offset_t appearsInTableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto morsel = input.sharedState->ptrCast<SimpleTableFuncSharedState>()->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto& rows = *input.bindData->constPtrCast<FTSIndexRowsBindData>()->rows;
+    auto& dataChunk = output.dataChunk;
+    // Find the term of the first posting of the morsel.
+    auto termIdx = std::upper_bound(rows.postingOffsets.begin(), rows.postingOffsets.end(),
+                       morsel.startOffset) -
+                   rows.postingOffsets.begin() - 1;
+    auto postingIdx = morsel.startOffset - rows.postingOffsets[termIdx];
+    for (auto i = 0u; i < morsel.endOffset - morsel.startOffset; i++) {
+        while (postingIdx == rows.postingLists[termIdx]->getDF()) {
+            termIdx++;
+            postingIdx = 0;
+        }
+        auto& postingList = *rows.postingLists[termIdx];
+        dataChunk.getValueVectorMutable(0).setValue(i, *rows.terms[termIdx]);
+        dataChunk.getValueVectorMutable(1).setValue<int64_t>(i, postingList.docs[postingIdx]);
+        dataChunk.getValueVectorMutable(2).setValue<uint64_t>(i, postingList.tfs[postingIdx]);
+        postingIdx++;
+    }
+    return morsel.endOffset - morsel.startOffset;
+}
+
+static function_set getFunctionSet(const char* name, table_func_t tableFunc,
+    table_func_bind_t bindFunc) {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        SimpleTableFunction::initSharedState, SimpleTableFunction::initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+function_set FTSIndexDocsFunction::getFunctionSet() {
+    return fts_extension::getFunctionSet(name, docsTableFunc, bindFunc<FTSIndexTable::DOCS>);
+}
+
+function_set FTSIndexTermsFunction::getFunctionSet() {
+    return fts_extension::getFunctionSet(name, termsTableFunc, bindFunc<FTSIndexTable::TERMS>);
+}
+
+function_set FTSIndexAppearsInFunction::getFunctionSet() {
+    return fts_extension::getFunctionSet(name, appearsInTableFunc,
+        bindFunc<FTSIndexTable::APPEARS_IN>);
+}
+
+} // namespace fts_extension
+} // namespace kuzu
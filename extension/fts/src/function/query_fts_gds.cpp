@@ -14,6 +14,7 @@
 #include "function/gds/gds_utils.h"
 #include "function/stem.h"
 #include "graph/on_disk_graph.h"
+#include "index/fts_posting_index.h"
 #include "libstemmer.h"
 #include "processor/execution_context.h"
 #include "processor/result/factorized_table.h"
@@ -33,16 +34,19 @@ struct QFTSGDSBindData final : public function::GDSBindData {
     double_t avgDocLen;
     QueryFTSConfig config;
     common::table_id_t outputTableID;
+    std::shared_ptr<FTSPostingIndex> postingIndex;
 
     QFTSGDSBindData(std::vector<std::string> terms, graph::GraphEntry graphEntry,
         std::shared_ptr<binder::Expression> docs, uint64_t numDocs, double_t avgDocLen,
-        QueryFTSConfig config)
+        QueryFTSConfig config, std::shared_ptr<FTSPostingIndex> postingIndex)
         : GDSBindData{std::move(graphEntry), std::move(docs)}, terms{std::move(terms)},
           numDocs{numDocs}, avgDocLen{avgDocLen}, config{std::move(config)},
-          outputTableID{nodeOutput->constCast<NodeExpression>().getSingleEntry()->getTableID()} {}
+          outputTableID{nodeOutput->constCast<NodeExpression>().getSingleEntry()->getTableID()},
+          postingIndex{std::move(postingIndex)} {}
     QFTSGDSBindData(const QFTSGDSBindData& other)
         : GDSBindData{other}, terms{other.terms}, numDocs{other.numDocs},
-          avgDocLen{other.avgDocLen}, config{other.config}, outputTableID{other.outputTableID} {}
+          avgDocLen{other.avgDocLen}, config{other.config}, outputTableID{other.outputTableID},
+          postingIndex{other.postingIndex} {}
 
     bool hasNodeInput() const override { return false; }
 
@@ -192,8 +196,6 @@ void QFTSOutputWriter::write(processor::FactorizedTable& scoreFT, nodeID_t docNo
     bool hasScore = qFTSOutput->scores.contains(docNodeID);
     docsVector.setNull(pos, !hasScore);
     scoreVector.setNull(pos, !hasScore);
-    auto k = bindData.config.k;
-    auto b = bindData.config.b;
     if (hasScore) {
         auto scoreInfo = qFTSOutput->scores.at(docNodeID);
         double score = 0;
@@ -203,13 +205,9 @@ void QFTSOutputWriter::write(processor::FactorizedTable& scoreFT, nodeID_t docNo
             scoreInfo.scoreData.size() != bindData.getNumUniqueTerms()) {
             return;
         }
+        auto bm25 = BM25{bindData.numDocs, bindData.avgDocLen, bindData.config};
         for (auto& scoreData : scoreInfo.scoreData) {
-            auto numDocs = bindData.numDocs;
-            auto avgDocLen = bindData.avgDocLen;
-            auto df = scoreData.df;
-            auto tf = scoreData.tf;
-            score += log10((numDocs - df + 0.5) / (df + 0.5) + 1) *
-                     ((tf * (k + 1) / (tf + k * (1 - b + b * (len / avgDocLen)))));
+            score += bm25.computeScore(scoreData.df, scoreData.tf, len);
         }
         docsVector.setValue(pos, nodeID_t{(common::offset_t)docsID, bindData.outputTableID});
         scoreVector.setValue(pos, score);
@@ -288,7 +286,36 @@ void QFTSVertexCompute::vertexCompute(const graph::VertexScanState::Chunk& chunk
     }
 }
 
+// Evaluates a top-k query over the in-memory postings instead of scoring every matching doc.
+static void execTopK(processor::ExecutionContext* executionContext,
+    processor::GDSCallSharedState& sharedState, const QFTSGDSBindData& bindData) {
+    auto result =
+        bindData.postingIndex->searchTopK(executionContext->clientContext->getTx()->getID(),
+            bindData.terms, bindData.config.topK, bindData.config);
+    auto mm = executionContext->clientContext->getMemoryManager();
+    ValueVector docsVector{LogicalType::INTERNAL_ID(), mm};
+    ValueVector scoreVector{LogicalType::DOUBLE(), mm};
+    auto state = DataChunkState::getSingleValueDataChunkState();
+    auto pos = state->getSelVector()[0];
+    docsVector.setState(state);
+    scoreVector.setState(state);
+    std::vector<ValueVector*> vectors{&docsVector, &scoreVector};
+    auto table = sharedState.claimLocalTable(mm);
+    for (auto& [docID, score] : result) {
+        docsVector.setValue(pos, nodeID_t{(common::offset_t)docID, bindData.outputTableID});
+        scoreVector.setValue(pos, score);
+        table->append(vectors);
+    }
+    sharedState.returnLocalTable(table);
+    sharedState.mergeLocalTables();
+}
+
 void QFTSAlgorithm::exec(processor::ExecutionContext* executionContext) {
+    auto& qftsBindData = *bindData->ptrCast<QFTSGDSBindData>();
+    if (qftsBindData.config.topK > 0) {
+        execTopK(executionContext, *sharedState, qftsBindData);
+        return;
+    }
     auto termsTableID = sharedState->graph->getNodeTableIDs()[0];
     auto output = std::make_unique<QFTSOutput>();
 
@@ -394,9 +421,12 @@ void QFTSAlgorithm::bind(const GDSBindInput& input, main::ClientContext& context
     auto appearsInEntry = context.getCatalog()->getTableCatalogEntry(context.getTx(),
         FTSUtils::getAppearsInTableName(tableEntry.getTableID(), indexName));
     auto graphEntry = graph::GraphEntry({termsEntry, docsEntry}, {appearsInEntry});
+    auto postingIndex = ftsIndexEntry.getPostingIndex();
+    auto transactionID = context.getTx()->getID();
     bindData = std::make_unique<QFTSGDSBindData>(std::move(terms), std::move(graphEntry),
-        nodeOutput, ftsIndexEntry.getNumDocs(), ftsIndexEntry.getAvgDocLen(),
-        QueryFTSConfig{input.optionalParams});
+        nodeOutput, postingIndex->getNumDocs(transactionID),
+        postingIndex->getAvgDocLen(transactionID), QueryFTSConfig{input.optionalParams},
+        std::move(postingIndex));
 }
 
 function::function_set QFTSFunction::getFunctionSet() {
@@ -25,32 +25,45 @@ std::string getStemmerList() {
     return result;
 }
 
-struct Stem {
-    static void operation(common::ku_string_t& word, common::ku_string_t& stemmer,
-        common::ku_string_t& result, common::ValueVector& resultVector);
-};
-
-void Stem::operation(common::ku_string_t& word, common::ku_string_t& stemmer,
-    common::ku_string_t& result, common::ValueVector& resultVector) {
-    if (stemmer.getAsString() == "none") {
-        StringVector::addString(&resultVector, result, word);
+SnowballStemmer::SnowballStemmer(const std::string& language) : sbStemmer{nullptr} {
+    if (language == "none") {
         return;
     }
-
-    struct sb_stemmer* sbStemmer =
-        sb_stemmer_new(reinterpret_cast<const char*>(stemmer.getData()), "UTF_8");
+    sbStemmer = sb_stemmer_new(reinterpret_cast<const char*>(language.c_str()), "UTF_8");
     if (sbStemmer == nullptr) {
         throw common::RuntimeException(
             common::stringFormat("Unrecognized stemmer '{}'. Supported stemmers are: ['{}'], or "
                                  "use 'none' for no stemming.",
-                stemmer.getAsString(), getStemmerList()));
+                language, getStemmerList()));
     }
+}
 
-    auto stemData =
-        sb_stemmer_stem(sbStemmer, reinterpret_cast<const sb_symbol*>(word.getData()), word.len);
-    common::StringVector::addString(&resultVector, result, reinterpret_cast<const char*>(stemData),
-        sb_stemmer_length(sbStemmer));
-    sb_stemmer_delete(sbStemmer);
+SnowballStemmer::~SnowballStemmer() {
+    if (sbStemmer != nullptr) {
+        sb_stemmer_delete(sbStemmer);
+    }
+}
+
+std::string_view SnowballStemmer::stem(std::string_view word) {
+    if (sbStemmer == nullptr) {
+        return word;
+    }
+    auto stemData = sb_stemmer_stem(sbStemmer, reinterpret_cast<const sb_symbol*>(word.data()),
+        word.length());
+    return std::string_view{reinterpret_cast<const char*>(stemData),
+        static_cast<size_t>(sb_stemmer_length(sbStemmer))};
+}
+
+struct Stem {
+    static void operation(common::ku_string_t& word, common::ku_string_t& stemmer,
+        common::ku_string_t& result, common::ValueVector& resultVector);
+};
+
+void Stem::operation(common::ku_string_t& word, common::ku_string_t& stemmer,
+    common::ku_string_t& result, common::ValueVector& resultVector) {
+    SnowballStemmer sbStemmer{stemmer.getAsString()};
+    auto stemData = sbStemmer.stem(word.getAsStringView());
+    common::StringVector::addString(&resultVector, result, stemData.data(), stemData.length());
 }
 
 function::function_set StemFunction::getFunctionSet() {
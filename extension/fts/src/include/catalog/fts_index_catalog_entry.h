@@ -2,6 +2,8 @@
 
 #include "catalog/catalog_entry/index_catalog_entry.h"
 #include "function/fts_config.h"
+#include "index/fts_posting_index.h"
+#include "index/fts_tokenizer.h"
 
 namespace kuzu {
 namespace fts_extension {
@@ -12,17 +14,22 @@ public:
     // constructors
     //===--------------------------------------------------------------------===//
     FTSIndexCatalogEntry() = default;
-    FTSIndexCatalogEntry(common::table_id_t tableID, std::string indexName, common::idx_t numDocs,
-        double avgDocLen, const FTSConfig& config)
-        : catalog::IndexCatalogEntry{tableID, std::move(indexName)}, numDocs{numDocs},
-          avgDocLen{avgDocLen}, config{std::move(config)} {}
+    FTSIndexCatalogEntry(common::table_id_t tableID, std::string indexName,
+        const FTSConfig& config, std::shared_ptr<const stop_words_t> stopWords,
+        std::shared_ptr<FTSPostingIndex> postingIndex)
+        : catalog::IndexCatalogEntry{tableID, std::move(indexName)}, config{std::move(config)},
+          stopWords{std::move(stopWords)}, postingIndex{std::move(postingIndex)} {}
 
     //===--------------------------------------------------------------------===//
     // getters & setters
     //===--------------------------------------------------------------------===//
-    common::idx_t getNumDocs() const { return numDocs; }
-    double getAvgDocLen() const { return avgDocLen; }
     const FTSConfig& getFTSConfig() const { return config; }
+    // The stop words read from the stop-words table when the index was built. Docs added later are
+    // tokenized with the same stop words.
+    std::shared_ptr<const stop_words_t> getStopWords() const { return stopWords; }
+    // The postings are shared by all copies of the entry. The number of docs and their average
+    // length are tracked by the postings, as they change with the indexed docs.
+    std::shared_ptr<FTSPostingIndex> getPostingIndex() const { return postingIndex; }
 
     //===--------------------------------------------------------------------===//
     // serialization & deserialization
@@ -30,9 +37,9 @@ public:
     std::unique_ptr<catalog::IndexCatalogEntry> copy() const override;
 
 private:
-    common::idx_t numDocs = 0;
-    double avgDocLen = 0;
     FTSConfig config;
+    std::shared_ptr<const stop_words_t> stopWords;
+    std::shared_ptr<FTSPostingIndex> postingIndex;
 };
 
 } // namespace fts_extension
@@ -8,6 +8,39 @@ namespace fts_extension {
 struct CreateFTSFunction : function::SimpleTableFunction {
     static constexpr const char* name = "CREATE_FTS_INDEX";
     static constexpr const char* DOC_LEN_PROP_NAME = "LEN";
+    static constexpr const char* DOC_ID_PROP_NAME = "docID";
+    static constexpr const char* TERM_PROP_NAME = "term";
+    static constexpr const char* DF_PROP_NAME = "df";
+    static constexpr const char* TF_PROP_NAME = "tf";
+    static constexpr const char* STOP_WORD_PROP_NAME = "sw";
+
+    static function::function_set getFunctionSet();
+};
+
+// CREATE_FTS_INDEX is rewritten to a query that creates the docs, terms and appears_in tables of the
+// index, builds its postings with _BUILD_FTS_INDEX and bulk loads the tables from the postings with
+// COPY ... FROM (CALL _FTS_INDEX_DOCS(...) RETURN *). The CREATE_FTS_INDEX call itself then starts
+// maintaining the index.
+struct BuildFTSFunction : function::SimpleTableFunction {
+    static constexpr const char* name = "_BUILD_FTS_INDEX";
+
+    static function::function_set getFunctionSet();
+};
+
+struct FTSIndexDocsFunction : function::SimpleTableFunction {
+    static constexpr const char* name = "_FTS_INDEX_DOCS";
+
+    static function::function_set getFunctionSet();
+};
+
+struct FTSIndexTermsFunction : function::SimpleTableFunction {
+    static constexpr const char* name = "_FTS_INDEX_TERMS";
+
+    static function::function_set getFunctionSet();
+};
+
+struct FTSIndexAppearsInFunction : function::SimpleTableFunction {
+    static constexpr const char* name = "_FTS_INDEX_APPEARS_IN";
 
     static function::function_set getFunctionSet();
 };
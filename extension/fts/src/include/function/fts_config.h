@@ -44,6 +44,14 @@ struct Conjunctive {
     static constexpr bool DEFAULT_VALUE = false;
 };
 
+struct TopK {
+    static constexpr const char* NAME = "top";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    // 0 returns every matching doc.
+    static constexpr uint64_t DEFAULT_VALUE = 0;
+    static void validate(int64_t value);
+};
+
 struct QueryFTSConfig {
     // k: parameter controls the influence of term frequency saturation. It limits the effect of
     // additional occurrences of a term within a document.
@@ -52,6 +60,9 @@ struct QueryFTSConfig {
     // document length.
     double b = B::DEFAULT_VALUE;
     bool isConjunctive = Conjunctive::DEFAULT_VALUE;
+    // topK: if set, only the topK docs with the highest scores are returned. They are computed with
+    // block-max WAND over the in-memory postings of the index instead of scoring every doc.
+    uint64_t topK = TopK::DEFAULT_VALUE;
 
     QueryFTSConfig() = default;
     explicit QueryFTSConfig(const function::optional_params_t& optionalParams);
@@ -23,9 +23,9 @@ struct FTSUtils {
 
     static void validateAutoTrx(const main::ClientContext& context, const std::string& funcName);
 
-    static std::string getStopWordsTableName() {
-        return common::stringFormat("default_english_stopwords");
-    }
+    // The stop-words table is shared by all FTS indexes. It is filled with the default english stop
+    // words when the first index is created and dropped with the last one.
+    static std::string getStopWordsTableName() { return "default_english_stopwords"; }
 
     static std::string getInternalTablePrefix(common::table_id_t tableID,
         const std::string& indexName) {
@@ -36,11 +36,6 @@ struct FTSUtils {
         return common::stringFormat("{}_docs", getInternalTablePrefix(tableID, indexName));
     }
 
-    static std::string getAppearsInfoTableName(common::table_id_t tableID,
-        const std::string& indexName) {
-        return common::stringFormat("{}_appears_info", getInternalTablePrefix(tableID, indexName));
-    }
-
     static std::string getTermsTableName(common::table_id_t tableID, const std::string& indexName) {
         return common::stringFormat("{}_terms", getInternalTablePrefix(tableID, indexName));
     }
@@ -1,10 +1,27 @@
 #pragma once
 
+#include "common/copy_constructors.h"
 #include "function/function.h"
 
+struct sb_stemmer;
+
 namespace kuzu {
 namespace fts_extension {
 
+// Snowball stemmer of a language, or no stemming for 'none'. Stemmers are not thread safe.
+class SnowballStemmer {
+public:
+    explicit SnowballStemmer(const std::string& language);
+    DELETE_COPY_AND_MOVE(SnowballStemmer);
+    ~SnowballStemmer();
+
+    // The result is valid until the next call.
+    std::string_view stem(std::string_view word);
+
+private:
+    sb_stemmer* sbStemmer;
+};
+
 struct StemFunction {
     static constexpr const char* name = "STEM";
 
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "function/fts_config.h"
+#include "index/fts_posting_index.h"
+#include "index/fts_tokenizer.h"
+
+namespace kuzu {
+namespace processor {
+struct ExecutionContext;
+} // namespace processor
+
+namespace fts_extension {
+
+// Builds the postings of an FTS index over properties of a node table. Docs are tokenized and
+// stemmed in parallel into an in-memory term dictionary that is radix-partitioned by the hash of
+// the term, so threads flushing their postings rarely contend on the same partition. The docs,
+// terms and appears_in tables of the index are bulk loaded from the postings afterwards, see
+// BuildFTSFunction.
+class FTSIndexBuilder {
+public:
+    static constexpr uint64_t NUM_PARTITIONS = 64;
+
+    FTSIndexBuilder(common::table_id_t tableID, std::vector<std::string> properties,
+        FTSConfig config, const stop_words_t* stopWords)
+        : tableID{tableID}, properties{std::move(properties)}, config{std::move(config)},
+          stopWords{stopWords} {}
+
+    std::shared_ptr<FTSPostingIndex> build(processor::ExecutionContext* context) const;
+
+private:
+    common::table_id_t tableID;
+    std::vector<std::string> properties;
+    FTSConfig config;
+    const stop_words_t* stopWords;
+};
+
+} // namespace fts_extension
+} // namespace kuzu
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "index/fts_posting_index.h"
+#include "index/fts_tokenizer.h"
+#include "storage/store/node_table_write_listener.h"
+
+namespace kuzu {
+namespace fts_extension {
+
+// Keeps an FTS index in sync with the docs of the indexed node table. An inserted or copied doc is
+// tokenized and added to the docs, terms and appears_in tables; a deleted doc has its postings removed and
+// the df of its terms decremented; an updated doc is removed and added again. The in-memory
+// postings are changed when the writing transaction commits.
+class FTSIndexMaintainer final : public storage::NodeTableWriteListener {
+public:
+    FTSIndexMaintainer(common::table_id_t tableID, std::string indexName,
+        std::vector<common::column_id_t> columnIDs, std::string stemmer,
+        std::shared_ptr<const stop_words_t> stopWords,
+        std::shared_ptr<FTSPostingIndex> postingIndex)
+        : tableID{tableID}, indexName{std::move(indexName)}, columnIDs{std::move(columnIDs)},
+          stemmer{std::move(stemmer)}, stopWords{std::move(stopWords)},
+          postingIndex{std::move(postingIndex)} {}
+
+    void onInsert(transaction::Transaction* transaction, common::offset_t nodeOffset) override;
+    void onUpdate(transaction::Transaction* transaction, common::offset_t nodeOffset,
+        common::column_id_t columnID) override;
+    void onDelete(transaction::Transaction* transaction, common::offset_t nodeOffset) override;
+    void onBulkAppend(transaction::Transaction* transaction, common::offset_t startOffset,
+        common::offset_t endOffset) override;
+
+    void onCommit(transaction::Transaction* transaction) override;
+    void onRollback(transaction::Transaction* transaction) override;
+
+private:
+    // The index may not be visible to the transaction, e.g., if the transaction that created it
+    // has been rolled back or the index is being dropped.
+    bool isIndexVisible(const transaction::Transaction* transaction) const;
+    // Adds the docs in [startDoc, endDoc).
+    void addDocs(transaction::Transaction* transaction, common::offset_t startDoc,
+        common::offset_t endDoc);
+    void removeDoc(transaction::Transaction* transaction, common::offset_t doc);
+
+private:
+    common::table_id_t tableID;
+    std::string indexName;
+    std::vector<common::column_id_t> columnIDs;
+    std::string stemmer;
+    std::shared_ptr<const stop_words_t> stopWords;
+    std::shared_ptr<FTSPostingIndex> postingIndex;
+};
+
+} // namespace fts_extension
+} // namespace kuzu
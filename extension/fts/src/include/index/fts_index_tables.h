@@ -0,0 +1,86 @@
+#pragma once
+
+#include "common/data_chunk/data_chunk.h"
+#include "graph/on_disk_graph.h"
+#include "index/fts_tokenizer.h"
+#include "storage/store/node_table.h"
+#include "storage/store/rel_table.h"
+
+namespace kuzu {
+namespace fts_extension {
+
+// Reads columns of single nodes of a node table, including nodes inserted by the transaction.
+class NodeRowReader {
+public:
+    NodeRowReader(transaction::Transaction* transaction, storage::MemoryManager* mm,
+        storage::NodeTable& table, std::vector<common::column_id_t> columnIDs);
+
+    // Returns false if the node is not visible to the transaction.
+    bool read(common::offset_t offset);
+    const common::ValueVector& getVector(common::idx_t idx) const {
+        return dataChunk.getValueVector(idx);
+    }
+    common::sel_t getPos() const { return dataChunk.state->getSelVector()[0]; }
+
+private:
+    transaction::Transaction* transaction;
+    storage::NodeTable& table;
+    common::DataChunk dataChunk;
+    common::ValueVector nodeIDVector;
+    std::unique_ptr<storage::NodeTableScanState> scanState;
+};
+
+// Reads the words of the stop-words table, see FTSUtils::getStopWordsTableName.
+stop_words_t readStopWords(main::ClientContext* context);
+
+// Row-level writes to the docs, terms and appears_in tables of an FTS index. Writes go through the
+// transactional table APIs, so they are logged to the WAL and rolled back with the transaction.
+class FTSIndexTables {
+public:
+    FTSIndexTables(main::ClientContext* context, common::table_id_t tableID,
+        const std::string& indexName);
+
+    // Docs are keyed by their offset in the indexed table. Returns the offset of the inserted node.
+    common::offset_t insertDoc(common::offset_t doc, uint64_t len);
+    // Returns INVALID_OFFSET if the doc is not in the docs table.
+    common::offset_t lookupDoc(common::offset_t doc);
+    void deleteDoc(common::offset_t docNodeOffset, common::offset_t doc);
+
+    common::offset_t insertTerm(const std::string& term, uint64_t df);
+    // Returns INVALID_OFFSET if the term is not in the terms table.
+    common::offset_t lookupTerm(const std::string& term);
+    std::pair<std::string, uint64_t> readTerm(common::offset_t termNodeOffset);
+    void updateDF(common::offset_t termNodeOffset, uint64_t df);
+    void deleteTerm(common::offset_t termNodeOffset, const std::string& term);
+
+    void insertPosting(common::offset_t termNodeOffset, common::offset_t docNodeOffset,
+        uint64_t tf);
+    // Deletes the postings of the doc and returns the offsets of their terms.
+    std::vector<common::offset_t> deletePostings(common::offset_t docNodeOffset);
+
+private:
+    std::shared_ptr<common::ValueVector> createVector(common::LogicalType type) const;
+    void setTerm(const std::string& term);
+
+private:
+    main::ClientContext* context;
+    transaction::Transaction* transaction;
+    storage::NodeTable* docsTable;
+    storage::NodeTable* termsTable;
+    storage::RelTable* appearsInTable;
+    std::unique_ptr<graph::OnDiskGraph> graph;
+    std::shared_ptr<common::DataChunkState> state;
+    std::shared_ptr<common::ValueVector> docIDVector;
+    std::shared_ptr<common::ValueVector> lenVector;
+    std::shared_ptr<common::ValueVector> docNodeIDVector;
+    std::shared_ptr<common::ValueVector> termVector;
+    std::shared_ptr<common::ValueVector> dfVector;
+    std::shared_ptr<common::ValueVector> termNodeIDVector;
+    std::shared_ptr<common::ValueVector> relIDVector;
+    std::shared_ptr<common::ValueVector> tfVector;
+    common::column_id_t dfColumnID;
+    std::unique_ptr<NodeRowReader> termReader;
+};
+
+} // namespace fts_extension
+} // namespace kuzu
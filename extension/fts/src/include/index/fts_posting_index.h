@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cmath>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/types/types.h"
+#include "function/fts_config.h"
+
+namespace kuzu {
+namespace fts_extension {
+
+struct BM25 {
+    uint64_t numDocs;
+    double avgDocLen;
+    double k;
+    double b;
+
+    BM25(uint64_t numDocs, double avgDocLen, const QueryFTSConfig& config)
+        : numDocs{numDocs}, avgDocLen{avgDocLen}, k{config.k}, b{config.b} {}
+
+    // The score is non-decreasing in tf and non-increasing in len for any valid k and b, which is
+    // what makes (max tf, min len) an upper bound for the score of a posting block.
+    double computeScore(uint64_t df, uint64_t tf, uint64_t len) const {
+        return log10((numDocs - df + 0.5) / (df + 0.5) + 1) *
+               ((tf * (k + 1) / (tf + k * (1 - b + b * (len / avgDocLen)))));
+    }
+};
+
+// Summary of a block of consecutive postings. Scores depend on the query-time BM25 parameters, so
+// instead of a precomputed max score each block stores the max tf and min doc length.
+struct PostingBlock {
+    common::offset_t lastDoc;
+    uint64_t maxTF;
+    uint64_t minDocLen;
+};
+
+// Postings of a term sorted by doc offset. The df of a term is the number of its postings.
+struct PostingList {
+    std::vector<common::offset_t> docs;
+    std::vector<uint64_t> tfs;
+    std::vector<PostingBlock> blocks;
+
+    uint64_t getDF() const { return docs.size(); }
+};
+
+// (term, tf) pairs of an indexed doc.
+using doc_terms_t = std::vector<std::pair<std::string, uint64_t>>;
+
+// Changes made to the indexed docs by a transaction that has not committed yet. An updated doc is
+// removed and added again.
+struct FTSDocChanges {
+    struct AddedDoc {
+        uint64_t len;
+        doc_terms_t terms;
+    };
+
+    // Committed docs removed by the transaction, with the terms they contain.
+    std::unordered_map<common::offset_t, std::vector<std::string>> removedDocs;
+    std::unordered_map<common::offset_t, AddedDoc> addedDocs;
+};
+
+// In-memory copy of the terms->docs postings of an FTS index, grouped into blocks for block-max
+// WAND (Ding & Suel) top-k evaluation. Docs are identified by their offset in the indexed node
+// table. The postings reflect the committed docs; changes of a transaction are staged and applied
+// when it commits.
+class FTSPostingIndex {
+public:
+    using result_t = std::vector<std::pair<common::offset_t /* doc */, double /* score */>>;
+
+    static constexpr uint64_t BLOCK_SIZE = 128;
+
+    // docLens is indexed by doc offset. Docs without any term have length 0 and are not indexed.
+    explicit FTSPostingIndex(std::vector<uint64_t> docLens);
+
+    // postings hold (doc offset, tf) pairs in any order. Must only be called while building.
+    void addTerm(const std::string& term,
+        std::vector<std::pair<common::offset_t, uint64_t>> postings);
+
+    // The lengths of the committed docs and the postings of the committed terms. Must not be called
+    // while changes can be committed, e.g., while the index tables are loaded from the postings.
+    const std::vector<uint64_t>& getDocLens() const { return docLens; }
+    const std::unordered_map<std::string, PostingList>& getPostingLists() const {
+        return postingLists;
+    }
+
+    // Returns the number of indexed docs and their average length as seen by the transaction.
+    uint64_t getNumDocs(common::transaction_t transactionID) const;
+    double getAvgDocLen(common::transaction_t transactionID) const;
+
+    // Returns the topK docs with the highest BM25 scores sorted by decreasing score, ties broken
+    // by increasing doc offset. The scores are exact; blocks and terms whose upper bound cannot
+    // beat the current k-th score are skipped. If isConjunctive is set, only docs containing all
+    // of the (distinct) query terms qualify. Uncommitted changes of the transaction are included.
+    result_t searchTopK(common::transaction_t transactionID, const std::vector<std::string>& terms,
+        uint64_t topK, const QueryFTSConfig& config) const;
+
+    // Stages the removal of a committed or staged doc, given the terms it contains.
+    void removeDoc(common::transaction_t transactionID, common::offset_t doc,
+        std::vector<std::string> terms);
+    void addDoc(common::transaction_t transactionID, common::offset_t doc, uint64_t len,
+        doc_terms_t terms);
+    void commitChanges(common::transaction_t transactionID);
+    void rollbackChanges(common::transaction_t transactionID);
+
+private:
+    FTSPostingIndex() = default;
+
+    // Applies the changes to the postings of the given terms, or of all terms if terms is null.
+    void applyChanges(const FTSDocChanges& changes,
+        const std::unordered_set<std::string>* terms = nullptr);
+    void buildBlocks(PostingList& list) const;
+    const FTSDocChanges* getStagedChangesNoLock(common::transaction_t transactionID) const;
+    result_t searchTopKNoLock(const std::vector<std::string>& terms, uint64_t topK,
+        const BM25& bm25, bool isConjunctive) const;
+
+private:
+    mutable std::shared_mutex mtx;
+    std::vector<uint64_t> docLens;
+    uint64_t numDocs = 0;
+    uint64_t totalDocLen = 0;
+    std::unordered_map<std::string, PostingList> postingLists;
+    std::unordered_map<common::transaction_t, FTSDocChanges> stagedChanges;
+};
+
+} // namespace fts_extension
+} // namespace kuzu
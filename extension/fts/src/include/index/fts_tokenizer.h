@@ -0,0 +1,35 @@
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "common/vector/value_vector.h"
+#include "function/stem.h"
+
+namespace kuzu {
+namespace fts_extension {
+
+using stop_words_t = std::unordered_set<std::string>;
+
+// Splits the text of a doc into terms: the text is lower-cased, digits and punctuation are
+// replaced by spaces, and the remaining words that are not stop words are stemmed. A tokenizer
+// holds a stemmer, so each thread needs its own.
+class FTSTokenizer {
+public:
+    FTSTokenizer(const std::string& stemmer, const stop_words_t* stopWords,
+        storage::MemoryManager* mm);
+
+    // Adds the term frequencies of the value at pos to tfs and returns the number of terms in it.
+    // Values that are not STRINGs are tokenized as CAST(value AS STRING).
+    uint64_t tokenize(const common::ValueVector& vector, common::sel_t pos,
+        std::unordered_map<std::string, uint64_t>& tfs);
+
+private:
+    SnowballStemmer stemmer;
+    const stop_words_t* stopWords;
+    common::ValueVector lowerCaseVector;
+    std::string buffer;
+};
+
+} // namespace fts_extension
+} // namespace kuzu
@@ -0,0 +1,145 @@
+#include "index/fts_index_builder.h"
+
+#include <array>
+#include <mutex>
+
+#include "catalog/catalog.h"
+#include "function/gds/compute.h"
+#include "function/gds/gds_utils.h"
+#include "graph/on_disk_graph.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace fts_extension {
+
+using postings_t = std::vector<std::pair<offset_t /* doc */, uint64_t /* tf */>>;
+
+struct TermPartition {
+    std::mutex mtx;
+    std::unordered_map<std::string, postings_t> postings;
+};
+
+struct FTSBuildSharedState {
+    std::array<TermPartition, FTSIndexBuilder::NUM_PARTITIONS> partitions;
+    std::mutex docsMtx;
+    // (doc, len) pairs of the docs that have at least one term.
+    std::vector<std::pair<offset_t, uint64_t>> docs;
+
+    static uint64_t getPartitionIdx(const std::string& term) {
+        return std::hash<std::string>{}(term) & (FTSIndexBuilder::NUM_PARTITIONS - 1);
+    }
+};
+
+struct TermPosting {
+    std::string term;
+    offset_t doc;
+    uint64_t tf;
+};
+
+// Tokenizes a morsel of docs into thread-local buffers and merges them into the shared
+// partitions once per chunk, taking each partition lock at most once.
+class FTSTokenizeCompute final : public VertexCompute {
+public:
+    FTSTokenizeCompute(FTSBuildSharedState* sharedState, uint64_t numProperties,
+        const std::string& stemmer, const stop_words_t* stopWords, storage::MemoryManager* mm)
+        : sharedState{sharedState}, numProperties{numProperties}, stemmer{stemmer},
+          stopWords{stopWords}, mm{mm}, tokenizer{stemmer, stopWords, mm} {}
+
+    void vertexCompute(const graph::VertexScanState::Chunk& chunk) override;
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<FTSTokenizeCompute>(sharedState, numProperties, stemmer,
+            stopWords, mm);
+    }
+
+private:
+    void flush();
+
+private:
+    FTSBuildSharedState* sharedState;
+    uint64_t numProperties;
+    std::string stemmer;
+    const stop_words_t* stopWords;
+    storage::MemoryManager* mm;
+    FTSTokenizer tokenizer;
+    std::unordered_map<std::string, uint64_t> tfs;
+    std::vector<std::pair<offset_t, uint64_t>> localDocs;
+    std::array<std::vector<TermPosting>, FTSIndexBuilder::NUM_PARTITIONS> localPartitions;
+};
+
+void FTSTokenizeCompute::vertexCompute(const graph::VertexScanState::Chunk& chunk) {
+    auto nodeIDs = chunk.getNodeIDs();
+    for (auto i = 0u; i < nodeIDs.size(); i++) {
+        tfs.clear();
+        uint64_t len = 0;
+        for (auto propIdx = 0u; propIdx < numProperties; propIdx++) {
+            auto& vector = chunk.getPropertyVector(propIdx);
+            if (!vector.isNull(i)) {
+                len += tokenizer.tokenize(vector, i, tfs);
+            }
+        }
+        if (len == 0) {
+            continue;
+        }
+        auto doc = nodeIDs[i].offset;
+        localDocs.emplace_back(doc, len);
+        for (auto& [term, tf] : tfs) {
+            localPartitions[FTSBuildSharedState::getPartitionIdx(term)].push_back(
+                TermPosting{term, doc, tf});
+        }
+    }
+    flush();
+}
+
+void FTSTokenizeCompute::flush() {
+    for (auto partitionIdx = 0u; partitionIdx < FTSIndexBuilder::NUM_PARTITIONS; partitionIdx++) {
+        auto& localPartition = localPartitions[partitionIdx];
+        if (localPartition.empty()) {
+            continue;
+        }
+        auto& partition = sharedState->partitions[partitionIdx];
+        std::unique_lock lck{partition.mtx};
+        for (auto& posting : localPartition) {
+            partition.postings[std::move(posting.term)].emplace_back(posting.doc, posting.tf);
+        }
+        localPartition.clear();
+    }
+    std::unique_lock lck{sharedState->docsMtx};
+    sharedState->docs.insert(sharedState->docs.end(), localDocs.begin(), localDocs.end());
+    localDocs.clear();
+}
+
+std::shared_ptr<FTSPostingIndex> FTSIndexBuilder::build(
+    processor::ExecutionContext* context) const {
+    auto clientContext = context->clientContext;
+    auto transaction = clientContext->getTx();
+    auto tableEntry = clientContext->getCatalog()->getTableCatalogEntry(transaction, tableID);
+    graph::OnDiskGraph graph(clientContext, graph::GraphEntry{{tableEntry}, {}});
+
+    // 1. Tokenize the docs in parallel.
+    FTSBuildSharedState sharedState;
+    FTSTokenizeCompute tokenizeCompute{&sharedState, properties.size(), config.stemmer, stopWords,
+        clientContext->getMemoryManager()};
+    GDSUtils::runVertexCompute(context, &graph, tokenizeCompute, properties);
+
+    // 2. Move the docs and the postings of each term into the posting index.
+    std::vector<uint64_t> docLens(graph.getNumNodes(transaction, tableID), 0);
+    for (auto& [doc, len] : sharedState.docs) {
+        docLens[doc] = len;
+    }
+    auto postingIndex = std::make_shared<FTSPostingIndex>(std::move(docLens));
+    for (auto& partition : sharedState.partitions) {
+        for (auto& [term, postings] : partition.postings) {
+            postingIndex->addTerm(term, std::move(postings));
+        }
+        partition.postings.clear();
+    }
+    return postingIndex;
+}
+
+} // namespace fts_extension
+} // namespace kuzu
@@ -0,0 +1,127 @@
+#include "index/fts_index_maintainer.h"
+
+#include <algorithm>
+
+#include "catalog/catalog.h"
+#include "function/fts_utils.h"
+#include "index/fts_index_tables.h"
+#include "index/fts_tokenizer.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace fts_extension {
+
+void FTSIndexMaintainer::onInsert(Transaction* transaction, offset_t nodeOffset) {
+    if (!isIndexVisible(transaction)) {
+        return;
+    }
+    addDocs(transaction, nodeOffset, nodeOffset + 1);
+}
+
+void FTSIndexMaintainer::onUpdate(Transaction* transaction, offset_t nodeOffset,
+    column_id_t columnID) {
+    if (std::find(columnIDs.begin(), columnIDs.end(), columnID) == columnIDs.end() ||
+        !isIndexVisible(transaction)) {
+        return;
+    }
+    removeDoc(transaction, nodeOffset);
+    addDocs(transaction, nodeOffset, nodeOffset + 1);
+}
+
+void FTSIndexMaintainer::onDelete(Transaction* transaction, offset_t nodeOffset) {
+    if (!isIndexVisible(transaction)) {
+        return;
+    }
+    removeDoc(transaction, nodeOffset);
+}
+
+void FTSIndexMaintainer::onBulkAppend(Transaction* transaction, offset_t startOffset,
+    offset_t endOffset) {
+    if (!isIndexVisible(transaction)) {
+        return;
+    }
+    addDocs(transaction, startOffset, endOffset);
+}
+
+void FTSIndexMaintainer::onCommit(Transaction* transaction) {
+    postingIndex->commitChanges(transaction->getID());
+}
+
+void FTSIndexMaintainer::onRollback(Transaction* transaction) {
+    postingIndex->rollbackChanges(transaction->getID());
+}
+
+bool FTSIndexMaintainer::isIndexVisible(const Transaction* transaction) const {
+    auto catalog = transaction->getClientContext()->getCatalog();
+    // DROP_FTS_INDEX drops the appears_in table first, in a separate transaction.
+    return catalog->containsIndex(transaction, tableID, indexName) &&
+           catalog->containsTable(transaction,
+               FTSUtils::getAppearsInTableName(tableID, indexName));
+}
+
+void FTSIndexMaintainer::addDocs(Transaction* transaction, offset_t startDoc, offset_t endDoc) {
+    auto context = transaction->getClientContext();
+    auto& table = context->getStorageManager()->getTable(tableID)->cast<storage::NodeTable>();
+    NodeRowReader reader{transaction, context->getMemoryManager(), table, columnIDs};
+    FTSTokenizer tokenizer{stemmer, stopWords.get(), context->getMemoryManager()};
+    FTSIndexTables indexTables{context, tableID, indexName};
+    std::unordered_map<std::string, uint64_t> tfs;
+    for (auto doc = startDoc; doc < endDoc; doc++) {
+        if (!reader.read(doc)) {
+            continue;
+        }
+        tfs.clear();
+        uint64_t len = 0;
+        for (auto i = 0u; i < columnIDs.size(); i++) {
+            auto& vector = reader.getVector(i);
+            if (!vector.isNull(reader.getPos())) {
+                len += tokenizer.tokenize(vector, reader.getPos(), tfs);
+            }
+        }
+        if (len == 0) {
+            continue;
+        }
+        auto docNodeOffset = indexTables.insertDoc(doc, len);
+        doc_terms_t terms;
+        for (auto& [term, tf] : tfs) {
+            auto termNodeOffset = indexTables.lookupTerm(term);
+            if (termNodeOffset == INVALID_OFFSET) {
+                termNodeOffset = indexTables.insertTerm(term, 1 /* df */);
+            } else {
+                indexTables.updateDF(termNodeOffset,
+                    indexTables.readTerm(termNodeOffset).second + 1);
+            }
+            indexTables.insertPosting(termNodeOffset, docNodeOffset, tf);
+            terms.emplace_back(term, tf);
+        }
+        postingIndex->addDoc(transaction->getID(), doc, len, std::move(terms));
+    }
+}
+
+void FTSIndexMaintainer::removeDoc(Transaction* transaction, offset_t doc) {
+    FTSIndexTables indexTables{transaction->getClientContext(), tableID, indexName};
+    auto docNodeOffset = indexTables.lookupDoc(doc);
+    if (docNodeOffset == INVALID_OFFSET) {
+        // The doc has no terms.
+        return;
+    }
+    std::vector<std::string> terms;
+    for (auto termNodeOffset : indexTables.deletePostings(docNodeOffset)) {
+        auto [term, df] = indexTables.readTerm(termNodeOffset);
+        if (df == 1) {
+            indexTables.deleteTerm(termNodeOffset, term);
+        } else {
+            indexTables.updateDF(termNodeOffset, df - 1);
+        }
+        terms.push_back(std::move(term));
+    }
+    indexTables.deleteDoc(docNodeOffset, doc);
+    postingIndex->removeDoc(transaction->getID(), doc, std::move(terms));
+}
+
+} // namespace fts_extension
+} // namespace kuzu
@@ -0,0 +1,206 @@
+#include "index/fts_index_tables.h"
+
+#include "function/create_fts_index.h"
+#include "function/fts_utils.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace fts_extension {
+
+NodeRowReader::NodeRowReader(transaction::Transaction* transaction, MemoryManager* mm,
+    NodeTable& table, std::vector<column_id_t> columnIDs)
+    : transaction{transaction}, table{table},
+      dataChunk{static_cast<uint32_t>(columnIDs.size()),
+          DataChunkState::getSingleValueDataChunkState()},
+      nodeIDVector{LogicalType::INTERNAL_ID(), mm} {
+    std::vector<const Column*> columns;
+    for (auto i = 0u; i < columnIDs.size(); i++) {
+        auto& column = table.getColumn(columnIDs[i]);
+        columns.push_back(&column);
+        dataChunk.insert(i, std::make_shared<ValueVector>(column.getDataType().copy(), mm));
+    }
+    nodeIDVector.setState(dataChunk.state);
+    scanState = std::make_unique<NodeTableScanState>(table.getTableID(), std::move(columnIDs),
+        std::move(columns), dataChunk, &nodeIDVector);
+}
+
+bool NodeRowReader::read(offset_t offset) {
+    scanState->resetOutVectors();
+    nodeIDVector.setValue<nodeID_t>(getPos(), nodeID_t{offset, table.getTableID()});
+    table.initScanState(transaction, *scanState, table.getTableID(), offset);
+    return table.lookup(transaction, *scanState);
+}
+
+stop_words_t readStopWords(main::ClientContext* context) {
+    auto transaction = context->getTx();
+    auto entry = context->getCatalog()->getTableCatalogEntry(transaction,
+        FTSUtils::getStopWordsTableName());
+    auto& table = context->getStorageManager()->getTable(entry->getTableID())->cast<NodeTable>();
+    NodeRowReader reader{transaction, context->getMemoryManager(), table,
+        {entry->getColumnID(CreateFTSFunction::STOP_WORD_PROP_NAME)}};
+    stop_words_t result;
+    auto numRows = table.getNumTotalRows(transaction);
+    for (auto offset = 0u; offset < numRows; offset++) {
+        if (reader.read(offset) && !reader.getVector(0).isNull(reader.getPos())) {
+            result.insert(reader.getVector(0).getValue<ku_string_t>(reader.getPos()).getAsString());
+        }
+    }
+    return result;
+}
+
+FTSIndexTables::FTSIndexTables(main::ClientContext* context, table_id_t tableID,
+    const std::string& indexName)
+    : context{context}, transaction{context->getTx()},
+      state{DataChunkState::getSingleValueDataChunkState()} {
+    auto catalog = context->getCatalog();
+    auto storageManager = context->getStorageManager();
+    auto docsEntry = catalog->getTableCatalogEntry(transaction,
+        FTSUtils::getDocsTableName(tableID, indexName));
+    auto termsEntry = catalog->getTableCatalogEntry(transaction,
+        FTSUtils::getTermsTableName(tableID, indexName));
+    auto appearsInEntry = catalog->getTableCatalogEntry(transaction,
+        FTSUtils::getAppearsInTableName(tableID, indexName));
+    docsTable = storageManager->getTable(docsEntry->getTableID())->ptrCast<NodeTable>();
+    termsTable = storageManager->getTable(termsEntry->getTableID())->ptrCast<NodeTable>();
+    appearsInTable = storageManager->getTable(appearsInEntry->getTableID())->ptrCast<RelTable>();
+    graph = std::make_unique<graph::OnDiskGraph>(context,
+        graph::GraphEntry{{termsEntry, docsEntry}, {appearsInEntry}});
+
+    docIDVector = createVector(LogicalType::INT64());
+    lenVector = createVector(LogicalType::UINT64());
+    docNodeIDVector = createVector(LogicalType::INTERNAL_ID());
+    termVector = createVector(LogicalType::STRING());
+    dfVector = createVector(LogicalType::UINT64());
+    termNodeIDVector = createVector(LogicalType::INTERNAL_ID());
+    relIDVector = createVector(LogicalType::INTERNAL_ID());
+    tfVector = createVector(LogicalType::UINT64());
+    dfColumnID = termsEntry->getColumnID(CreateFTSFunction::DF_PROP_NAME);
+    termReader = std::make_unique<NodeRowReader>(transaction, context->getMemoryManager(),
+        *termsTable,
+        std::vector<column_id_t>{termsEntry->getColumnID(CreateFTSFunction::TERM_PROP_NAME),
+            dfColumnID});
+}
+
+std::shared_ptr<ValueVector> FTSIndexTables::createVector(LogicalType type) const {
+    auto vector = std::make_shared<ValueVector>(std::move(type), context->getMemoryManager());
+    vector->setState(state);
+    return vector;
+}
+
+void FTSIndexTables::setTerm(const std::string& term) {
+    // Only one term is held at a time.
+    StringVector::getInMemOverflowBuffer(termVector.get())->resetBuffer();
+    StringVector::addString(termVector.get(), state->getSelVector()[0], term);
+}
+
+offset_t FTSIndexTables::insertDoc(offset_t doc, uint64_t len) {
+    auto pos = state->getSelVector()[0];
+    docIDVector->setValue<int64_t>(pos, doc);
+    lenVector->setValue<uint64_t>(pos, len);
+    docNodeIDVector->setNull(pos, false);
+    std::vector<ValueVector*> propertyVectors{docIDVector.get(), lenVector.get()};
+    auto insertState = NodeTableInsertState{*docNodeIDVector, *docIDVector, propertyVectors};
+    docsTable->insert(transaction, insertState);
+    return docNodeIDVector->readNodeOffset(pos);
+}
+
+offset_t FTSIndexTables::lookupDoc(offset_t doc) {
+    auto pos = state->getSelVector()[0];
+    docIDVector->setValue<int64_t>(pos, doc);
+    offset_t result = INVALID_OFFSET;
+    if (!docsTable->lookupPK(transaction, docIDVector.get(), pos, result)) {
+        return INVALID_OFFSET;
+    }
+    return result;
+}
+
+void FTSIndexTables::deleteDoc(offset_t docNodeOffset, offset_t doc) {
+    auto pos = state->getSelVector()[0];
+    docIDVector->setValue<int64_t>(pos, doc);
+    docNodeIDVector->setValue<nodeID_t>(pos, nodeID_t{docNodeOffset, docsTable->getTableID()});
+    auto deleteState = NodeTableDeleteState{*docNodeIDVector, *docIDVector};
+    docsTable->delete_(transaction, deleteState);
+}
+
+offset_t FTSIndexTables::insertTerm(const std::string& term, uint64_t df) {
+    auto pos = state->getSelVector()[0];
+    setTerm(term);
+    dfVector->setValue<uint64_t>(pos, df);
+    termNodeIDVector->setNull(pos, false);
+    std::vector<ValueVector*> propertyVectors{termVector.get(), dfVector.get()};
+    auto insertState = NodeTableInsertState{*termNodeIDVector, *termVector, propertyVectors};
+    termsTable->insert(transaction, insertState);
+    return termNodeIDVector->readNodeOffset(pos);
+}
+
+offset_t FTSIndexTables::lookupTerm(const std::string& term) {
+    auto pos = state->getSelVector()[0];
+    setTerm(term);
+    offset_t result = INVALID_OFFSET;
+    if (!termsTable->lookupPK(transaction, termVector.get(), pos, result)) {
+        return INVALID_OFFSET;
+    }
+    return result;
+}
+
+std::pair<std::string, uint64_t> FTSIndexTables::readTerm(offset_t termNodeOffset) {
+    [[maybe_unused]] auto found = termReader->read(termNodeOffset);
+    KU_ASSERT(found);
+    auto pos = termReader->getPos();
+    return {termReader->getVector(0).getValue<ku_string_t>(pos).getAsString(),
+        termReader->getVector(1).getValue<uint64_t>(pos)};
+}
+
+void FTSIndexTables::updateDF(offset_t termNodeOffset, uint64_t df) {
+    auto pos = state->getSelVector()[0];
+    termNodeIDVector->setValue<nodeID_t>(pos, nodeID_t{termNodeOffset, termsTable->getTableID()});
+    dfVector->setValue<uint64_t>(pos, df);
+    auto updateState = NodeTableUpdateState{dfColumnID, *termNodeIDVector, *dfVector};
+    termsTable->update(transaction, updateState);
+}
+
+void FTSIndexTables::deleteTerm(offset_t termNodeOffset, const std::string& term) {
+    auto pos = state->getSelVector()[0];
+    setTerm(term);
+    termNodeIDVector->setValue<nodeID_t>(pos, nodeID_t{termNodeOffset, termsTable->getTableID()});
+    auto deleteState = NodeTableDeleteState{*termNodeIDVector, *termVector};
+    termsTable->delete_(transaction, deleteState);
+}
+
+void FTSIndexTables::insertPosting(offset_t termNodeOffset, offset_t docNodeOffset, uint64_t tf) {
+    auto pos = state->getSelVector()[0];
+    termNodeIDVector->setValue<nodeID_t>(pos, nodeID_t{termNodeOffset, termsTable->getTableID()});
+    docNodeIDVector->setValue<nodeID_t>(pos, nodeID_t{docNodeOffset, docsTable->getTableID()});
+    tfVector->setValue<uint64_t>(pos, tf);
+    std::vector<ValueVector*> propertyVectors{relIDVector.get(), tfVector.get()};
+    auto insertState = RelTableInsertState{*termNodeIDVector, *docNodeIDVector, propertyVectors};
+    appearsInTable->insert(transaction, insertState);
+}
+
+std::vector<offset_t> FTSIndexTables::deletePostings(offset_t docNodeOffset) {
+    auto docNodeID = nodeID_t{docNodeOffset, docsTable->getTableID()};
+    std::vector<std::pair<nodeID_t, relID_t>> postings;
+    // The scan state picks up the rels inserted by the transaction so far.
+    auto scanState = graph->prepareScan(appearsInTable->getTableID());
+    for (auto chunk : graph->scanBwd(docNodeID, *scanState)) {
+        chunk.forEach([&](auto termNodeID, auto relID) { postings.emplace_back(termNodeID, relID); });
+    }
+    auto pos = state->getSelVector()[0];
+    std::vector<offset_t> result;
+    for (auto& [termNodeID, relID] : postings) {
+        termNodeIDVector->setValue<nodeID_t>(pos, termNodeID);
+        docNodeIDVector->setValue<nodeID_t>(pos, docNodeID);
+        relIDVector->setValue<relID_t>(pos, relID);
+        auto deleteState = RelTableDeleteState{*termNodeIDVector, *docNodeIDVector, *relIDVector};
+        appearsInTable->delete_(transaction, deleteState);
+        result.push_back(termNodeID.offset);
+    }
+    return result;
+}
+
+} // namespace fts_extension
+} // namespace kuzu
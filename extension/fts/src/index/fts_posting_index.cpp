@@ -0,0 +1,399 @@
+#include "index/fts_posting_index.h"
+
+#include <algorithm>
+#include <mutex>
+#include <queue>
+#include <unordered_set>
+
+#include "common/assert.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace fts_extension {
+
+static double computeAvgDocLen(uint64_t numDocs, uint64_t totalDocLen) {
+    return numDocs == 0 ? 0 : (double)totalDocLen / numDocs;
+}
+
+FTSPostingIndex::FTSPostingIndex(std::vector<uint64_t> docLens) : docLens{std::move(docLens)} {
+    for (auto len : this->docLens) {
+        if (len > 0) {
+            numDocs++;
+            totalDocLen += len;
+        }
+    }
+}
+
+void FTSPostingIndex::addTerm(const std::string& term,
+    std::vector<std::pair<offset_t, uint64_t>> postings) {
+    std::sort(postings.begin(), postings.end());
+    PostingList list;
+    list.docs.reserve(postings.size());
+    list.tfs.reserve(postings.size());
+    for (auto& [doc, tf] : postings) {
+        KU_ASSERT(doc < docLens.size() && docLens[doc] > 0);
+        list.docs.push_back(doc);
+        list.tfs.push_back(tf);
+    }
+    buildBlocks(list);
+    postingLists.emplace(term, std::move(list));
+}
+
+void FTSPostingIndex::buildBlocks(PostingList& list) const {
+    list.blocks.clear();
+    list.blocks.reserve((list.docs.size() + BLOCK_SIZE - 1) / BLOCK_SIZE);
+    for (auto i = 0u; i < list.docs.size(); i++) {
+        auto doc = list.docs[i];
+        auto tf = list.tfs[i];
+        if (i % BLOCK_SIZE == 0) {
+            list.blocks.push_back(PostingBlock{doc, tf, docLens[doc]});
+        }
+        auto& block = list.blocks.back();
+        block.lastDoc = doc;
+        block.maxTF = std::max(block.maxTF, tf);
+        block.minDocLen = std::min(block.minDocLen, docLens[doc]);
+    }
+}
+
+uint64_t FTSPostingIndex::getNumDocs(transaction_t transactionID) const {
+    std::shared_lock lck{mtx};
+    auto changes = getStagedChangesNoLock(transactionID);
+    if (changes == nullptr) {
+        return numDocs;
+    }
+    return numDocs - changes->removedDocs.size() + changes->addedDocs.size();
+}
+
+double FTSPostingIndex::getAvgDocLen(transaction_t transactionID) const {
+    std::shared_lock lck{mtx};
+    auto changes = getStagedChangesNoLock(transactionID);
+    if (changes == nullptr) {
+        return computeAvgDocLen(numDocs, totalDocLen);
+    }
+    auto totalDocLen_ = totalDocLen;
+    for (auto& [doc, _] : changes->removedDocs) {
+        totalDocLen_ -= docLens[doc];
+    }
+    for (auto& [_, addedDoc] : changes->addedDocs) {
+        totalDocLen_ += addedDoc.len;
+    }
+    return computeAvgDocLen(
+        numDocs - changes->removedDocs.size() + changes->addedDocs.size(), totalDocLen_);
+}
+
+void FTSPostingIndex::removeDoc(transaction_t transactionID, offset_t doc,
+    std::vector<std::string> terms) {
+    std::unique_lock lck{mtx};
+    auto& changes = stagedChanges[transactionID];
+    // A doc added by the transaction itself is simply no longer added.
+    if (!changes.addedDocs.erase(doc)) {
+        KU_ASSERT(doc < docLens.size() && docLens[doc] > 0 && !changes.removedDocs.contains(doc));
+        changes.removedDocs.emplace(doc, std::move(terms));
+    }
+}
+
+void FTSPostingIndex::addDoc(transaction_t transactionID, offset_t doc, uint64_t len,
+    doc_terms_t terms) {
+    KU_ASSERT(len > 0);
+    std::unique_lock lck{mtx};
+    auto& changes = stagedChanges[transactionID];
+    KU_ASSERT(!changes.addedDocs.contains(doc));
+    changes.addedDocs.emplace(doc, FTSDocChanges::AddedDoc{len, std::move(terms)});
+}
+
+void FTSPostingIndex::commitChanges(transaction_t transactionID) {
+    std::unique_lock lck{mtx};
+    auto it = stagedChanges.find(transactionID);
+    if (it == stagedChanges.end()) {
+        return;
+    }
+    applyChanges(it->second);
+    stagedChanges.erase(it);
+}
+
+void FTSPostingIndex::rollbackChanges(transaction_t transactionID) {
+    std::unique_lock lck{mtx};
+    stagedChanges.erase(transactionID);
+}
+
+void FTSPostingIndex::applyChanges(const FTSDocChanges& changes,
+    const std::unordered_set<std::string>* terms) {
+    std::unordered_set<std::string> changedTerms;
+    const auto isTracked = [&](const std::string& term) {
+        return terms == nullptr || terms->contains(term);
+    };
+    // Removals go first, as an updated doc is both removed and added.
+    for (auto& [doc, docTerms] : changes.removedDocs) {
+        KU_ASSERT(doc < docLens.size() && docLens[doc] > 0);
+        numDocs--;
+        totalDocLen -= docLens[doc];
+        docLens[doc] = 0;
+        for (auto& term : docTerms) {
+            if (!isTracked(term)) {
+                continue;
+            }
+            auto& list = postingLists.at(term);
+            auto pos = std::lower_bound(list.docs.begin(), list.docs.end(), doc) - list.docs.begin();
+            KU_ASSERT(pos < (int64_t)list.docs.size() && list.docs[pos] == doc);
+            list.docs.erase(list.docs.begin() + pos);
+            list.tfs.erase(list.tfs.begin() + pos);
+            changedTerms.insert(term);
+        }
+    }
+    for (auto& [doc, addedDoc] : changes.addedDocs) {
+        if (doc >= docLens.size()) {
+            docLens.resize(doc + 1, 0);
+        }
+        KU_ASSERT(docLens[doc] == 0);
+        numDocs++;
+        totalDocLen += addedDoc.len;
+        docLens[doc] = addedDoc.len;
+        for (auto& [term, tf] : addedDoc.terms) {
+            if (!isTracked(term)) {
+                continue;
+            }
+            auto& list = postingLists[term];
+            auto pos = std::lower_bound(list.docs.begin(), list.docs.end(), doc) - list.docs.begin();
+            list.docs.insert(list.docs.begin() + pos, doc);
+            list.tfs.insert(list.tfs.begin() + pos, tf);
+            changedTerms.insert(term);
+        }
+    }
+    for (auto& term : changedTerms) {
+        auto& list = postingLists.at(term);
+        if (list.docs.empty()) {
+            postingLists.erase(term);
+        } else {
+            buildBlocks(list);
+        }
+    }
+}
+
+const FTSDocChanges* FTSPostingIndex::getStagedChangesNoLock(transaction_t transactionID) const {
+    auto it = stagedChanges.find(transactionID);
+    return it == stagedChanges.end() ? nullptr : &it->second;
+}
+
+// Upper bounds and exact scores are summed in different orders, so an upper bound may undershoot
+// the score it bounds by a few ulps. Pruning decisions leave this much relative slack.
+static constexpr double UPPER_BOUND_SLACK = 1e-9;
+static constexpr offset_t NO_MORE_DOCS = INVALID_OFFSET;
+
+namespace {
+
+class PostingCursor {
+public:
+    PostingCursor(const PostingList& list, const BM25& bm25) : list{list}, pos{0}, block{0} {
+        blockMaxScores.reserve(list.blocks.size());
+        maxScore = 0;
+        for (auto& postingBlock : list.blocks) {
+            auto score =
+                bm25.computeScore(list.getDF(), postingBlock.maxTF, postingBlock.minDocLen);
+            blockMaxScores.push_back(score);
+            maxScore = std::max(maxScore, score);
+        }
+    }
+
+    offset_t getDoc() const { return pos < list.docs.size() ? list.docs[pos] : NO_MORE_DOCS; }
+    uint64_t getTF() const { return list.tfs[pos]; }
+    uint64_t getDF() const { return list.getDF(); }
+    double getMaxScore() const { return maxScore; }
+
+    void next() { pos++; }
+
+    // Moves to the first posting with doc >= target, skipping whole blocks on the way.
+    void advance(offset_t target) {
+        if (getDoc() >= target) {
+            return;
+        }
+        shallowAdvance(target);
+        if (block == list.blocks.size()) {
+            pos = list.docs.size();
+            return;
+        }
+        constexpr auto blockSize = FTSPostingIndex::BLOCK_SIZE;
+        auto blockBegin = list.docs.begin() + std::max<uint64_t>(pos, block * blockSize);
+        auto blockEnd =
+            list.docs.begin() + std::min<uint64_t>((block + 1) * blockSize, list.docs.size());
+        pos = std::lower_bound(blockBegin, blockEnd, target) - list.docs.begin();
+    }
+
+    // Moves the block pointer (but not the posting pointer) to the block that may contain target.
+    void shallowAdvance(offset_t target) {
+        while (block < list.blocks.size() && list.blocks[block].lastDoc < target) {
+            block++;
+        }
+    }
+    double getBlockMaxScore() const {
+        return block < list.blocks.size() ? blockMaxScores[block] : 0;
+    }
+    offset_t getBlockLastDoc() const {
+        return block < list.blocks.size() ? list.blocks[block].lastDoc : NO_MORE_DOCS;
+    }
+
+private:
+    const PostingList& list;
+    uint64_t pos;
+    uint64_t block;
+    double maxScore;
+    std::vector<double> blockMaxScores;
+};
+
+struct ScoredDoc {
+    double score;
+    offset_t doc;
+
+    // Higher scores rank first; ties are broken by lower doc offsets.
+    bool operator<(const ScoredDoc& other) const {
+        return score > other.score || (score == other.score && doc < other.doc);
+    }
+};
+
+} // namespace
+
+FTSPostingIndex::result_t FTSPostingIndex::searchTopK(transaction_t transactionID,
+    const std::vector<std::string>& terms, uint64_t topK, const QueryFTSConfig& config) const {
+    std::shared_lock lck{mtx};
+    auto changes = getStagedChangesNoLock(transactionID);
+    if (changes == nullptr) {
+        auto bm25 = BM25{numDocs, computeAvgDocLen(numDocs, totalDocLen), config};
+        return searchTopKNoLock(terms, topK, bm25, config.isConjunctive);
+    }
+    // Search a copy of the postings of the query terms with the uncommitted changes applied.
+    auto uniqueTerms = std::unordered_set<std::string>{terms.begin(), terms.end()};
+    FTSPostingIndex index;
+    index.docLens = docLens;
+    index.numDocs = numDocs;
+    index.totalDocLen = totalDocLen;
+    for (auto& term : uniqueTerms) {
+        if (auto it = postingLists.find(term); it != postingLists.end()) {
+            index.postingLists.emplace(term, it->second);
+        }
+    }
+    index.applyChanges(*changes, &uniqueTerms);
+    auto bm25 =
+        BM25{index.numDocs, computeAvgDocLen(index.numDocs, index.totalDocLen), config};
+    return index.searchTopKNoLock(terms, topK, bm25, config.isConjunctive);
+}
+
+FTSPostingIndex::result_t FTSPostingIndex::searchTopKNoLock(const std::vector<std::string>& terms,
+    uint64_t topK, const BM25& bm25, bool isConjunctive) const {
+    result_t result;
+    std::unordered_set<std::string> uniqueTerms;
+    std::vector<PostingCursor> cursors;
+    for (auto& term : terms) {
+        if (!uniqueTerms.insert(term).second) {
+            continue;
+        }
+        auto it = postingLists.find(term);
+        if (it == postingLists.end()) {
+            if (isConjunctive) {
+                return result;
+            }
+            continue;
+        }
+        cursors.emplace_back(it->second, bm25);
+    }
+    if (cursors.empty() || topK == 0) {
+        return result;
+    }
+    // Max-heap under ScoredDoc::operator<, so the top is the worst doc among the best k so far.
+    std::priority_queue<ScoredDoc> heap;
+    const auto canEnterHeap = [&](double upperBound) {
+        return heap.size() < topK || upperBound * (1 + UPPER_BOUND_SLACK) > heap.top().score;
+    };
+    std::vector<PostingCursor*> sortedCursors;
+    for (auto& cursor : cursors) {
+        sortedCursors.push_back(&cursor);
+    }
+    const auto numCursors = sortedCursors.size();
+    while (true) {
+        std::sort(sortedCursors.begin(), sortedCursors.end(),
+            [](auto* left, auto* right) { return left->getDoc() < right->getDoc(); });
+        // Find the pivot: the first doc at which the summed max scores of the terms up to it can
+        // beat the current threshold. Docs before the pivot cannot enter the heap.
+        auto pivot = numCursors;
+        double upperBound = 0;
+        for (auto i = 0u; i < numCursors; i++) {
+            if (sortedCursors[i]->getDoc() == NO_MORE_DOCS) {
+                break;
+            }
+            upperBound += sortedCursors[i]->getMaxScore();
+            if (!isConjunctive && canEnterHeap(upperBound)) {
+                pivot = i;
+                break;
+            }
+        }
+        if (isConjunctive && sortedCursors.back()->getDoc() != NO_MORE_DOCS &&
+            canEnterHeap(upperBound)) {
+            // A qualifying doc contains every term, so it cannot precede the last cursor.
+            pivot = numCursors - 1;
+        }
+        if (pivot == numCursors) {
+            break;
+        }
+        const auto pivotDoc = sortedCursors[pivot]->getDoc();
+        while (pivot + 1 < numCursors && sortedCursors[pivot + 1]->getDoc() == pivotDoc) {
+            pivot++;
+        }
+        // Refine the bound with the max scores of the blocks that contain the pivot doc.
+        double blockUpperBound = 0;
+        for (auto i = 0u; i <= pivot; i++) {
+            sortedCursors[i]->shallowAdvance(pivotDoc);
+            blockUpperBound += sortedCursors[i]->getBlockMaxScore();
+        }
+        if (!canEnterHeap(blockUpperBound)) {
+            // No doc before the end of the shortest of these blocks (or before the doc of the next
+            // term) can enter the heap either.
+            auto nextDoc =
+                pivot + 1 < numCursors ? sortedCursors[pivot + 1]->getDoc() : NO_MORE_DOCS;
+            for (auto i = 0u; i <= pivot; i++) {
+                auto lastDoc = sortedCursors[i]->getBlockLastDoc();
+                nextDoc = std::min(nextDoc, lastDoc == NO_MORE_DOCS ? NO_MORE_DOCS : lastDoc + 1);
+            }
+            KU_ASSERT(nextDoc > pivotDoc);
+            for (auto i = 0u; i <= pivot; i++) {
+                sortedCursors[i]->advance(nextDoc);
+            }
+            continue;
+        }
+        if (sortedCursors[0]->getDoc() != pivotDoc) {
+            for (auto i = 0u; i < pivot; i++) {
+                sortedCursors[i]->advance(pivotDoc);
+            }
+            continue;
+        }
+        // Score the pivot doc. Terms are summed in query order to keep scores deterministic.
+        double score = 0;
+        uint64_t numMatchedTerms = 0;
+        const auto docLen = docLens[pivotDoc];
+        for (auto& cursor : cursors) {
+            if (cursor.getDoc() != pivotDoc) {
+                continue;
+            }
+            score += bm25.computeScore(cursor.getDF(), cursor.getTF(), docLen);
+            numMatchedTerms++;
+            cursor.next();
+        }
+        if (isConjunctive && numMatchedTerms != uniqueTerms.size()) {
+            continue;
+        }
+        if (heap.size() < topK) {
+            heap.push(ScoredDoc{score, pivotDoc});
+        } else if (ScoredDoc{score, pivotDoc} < heap.top()) {
+            heap.pop();
+            heap.push(ScoredDoc{score, pivotDoc});
+        }
+    }
+    result.resize(heap.size());
+    for (auto i = heap.size(); i > 0; i--) {
+        auto& scoredDoc = heap.top();
+        result[i - 1] = std::make_pair(scoredDoc.doc, scoredDoc.score);
+        heap.pop();
+    }
+    return result;
+}
+
+} // namespace fts_extension
+} // namespace kuzu
@@ -0,0 +1,50 @@
+#include "index/fts_tokenizer.h"
+
+#include "common/string_utils.h"
+#include "common/types/value/value.h"
+#include "function/string/functions/base_lower_upper_function.h"
+#include "re2.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace fts_extension {
+
+static const RE2& getSeparatorRegex() {
+    static const RE2 regex{"[0-9!@#$%^&*()_+={}\\[\\]:;<>,.?~\\\\/\\|'\"`-]+"};
+    return regex;
+}
+
+FTSTokenizer::FTSTokenizer(const std::string& stemmer, const stop_words_t* stopWords,
+    storage::MemoryManager* mm)
+    : stemmer{stemmer}, stopWords{stopWords}, lowerCaseVector{LogicalType::STRING(), mm} {
+    lowerCaseVector.setState(DataChunkState::getSingleValueDataChunkState());
+}
+
+uint64_t FTSTokenizer::tokenize(const ValueVector& vector, sel_t pos,
+    std::unordered_map<std::string, uint64_t>& tfs) {
+    StringVector::getInMemOverflowBuffer(&lowerCaseVector)->resetBuffer();
+    ku_string_t text;
+    if (vector.dataType.getLogicalTypeID() == LogicalTypeID::STRING) {
+        text = vector.getValue<ku_string_t>(pos);
+    } else {
+        StringVector::addString(&lowerCaseVector, text, vector.getAsValue(pos)->toString());
+    }
+    ku_string_t lowerCaseText;
+    function::BaseLowerUpperFunction::operation(text, lowerCaseText, lowerCaseVector,
+        false /* isUpper */);
+    buffer = lowerCaseText.getAsString();
+    RE2::GlobalReplace(&buffer, getSeparatorRegex(), " ");
+    uint64_t numTerms = 0;
+    for (auto& word : StringUtils::split(buffer, " ")) {
+        if (stopWords->contains(word)) {
+            continue;
+        }
+        tfs[std::string{stemmer.stem(word)}]++;
+        numTerms++;
+    }
+    return numTerms;
+}
+
+} // namespace fts_extension
+} // namespace kuzu
@@ -0,0 +1,44 @@
+#include "catalog/hnsw_index_catalog_entry.h"
+
+#include "common/serializer/deserializer.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+void HNSWIndexAuxInfo::serialize(common::Serializer& serializer) const {
+    serializer.writeDebuggingInfo("propertyName");
+    serializer.write(propertyName);
+    serializer.writeDebuggingInfo("dimension");
+    serializer.write(dimension);
+    serializer.writeDebuggingInfo("config");
+    serializer.write(config.mu);
+    serializer.write(config.ml);
+    serializer.write(config.efc);
+    serializer.write(config.metric);
+}
+
+std::unique_ptr<HNSWIndexAuxInfo> HNSWIndexAuxInfo::deserialize(
+    common::Deserializer& deserializer) {
+    std::string debuggingInfo;
+    std::string propertyName;
+    uint64_t dimension = 0;
+    HNSWIndexConfig config;
+    deserializer.validateDebuggingInfo(debuggingInfo, "propertyName");
+    deserializer.deserializeValue(propertyName);
+    deserializer.validateDebuggingInfo(debuggingInfo, "dimension");
+    deserializer.deserializeValue(dimension);
+    deserializer.validateDebuggingInfo(debuggingInfo, "config");
+    deserializer.deserializeValue(config.mu);
+    deserializer.deserializeValue(config.ml);
+    deserializer.deserializeValue(config.efc);
+    deserializer.deserializeValue(config.metric);
+    return std::make_unique<HNSWIndexAuxInfo>(std::move(propertyName), dimension,
+        std::move(config));
+}
+
+std::unique_ptr<catalog::IndexAuxInfo> HNSWIndexAuxInfo::copy() const {
+    return std::make_unique<HNSWIndexAuxInfo>(*this);
+}
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -0,0 +1,103 @@
+#include "function/create_vector_index.h"
+
+#include "catalog/catalog.h"
+#include "catalog/hnsw_index_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_input.h"
+#include "function/vector_index_bind_data.h"
+#include "function/vector_index_config.h"
+#include "function/vector_index_utils.h"
+#include "processor/execution_context.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::function;
+
+struct CreateVectorIndexBindData final : public VectorIndexBindData {
+    std::string propertyName;
+    uint64_t dimension;
+    HNSWIndexConfig config;
+
+    CreateVectorIndexBindData(std::string tableName, table_id_t tableID, std::string indexName,
+        std::string propertyName, uint64_t dimension, HNSWIndexConfig config)
+        : VectorIndexBindData{std::move(tableName), tableID, std::move(indexName)},
+          propertyName{std::move(propertyName)}, dimension{dimension}, config{std::move(config)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CreateVectorIndexBindData>(*this);
+    }
+};
+
+static void validateIndexNotExist(const ClientContext& context, table_id_t tableID,
+    const std::string& indexName) {
+    if (context.getCatalog()->containsIndex(context.getTx(), tableID, indexName)) {
+        throw BinderException{stringFormat("Index: {} already exists in table: {}.", indexName,
+            context.getCatalog()->getTableName(context.getTx(), tableID))};
+    }
+}
+
+// Returns the dimension of the indexed property, which must be a FLOAT or DOUBLE ARRAY.
+static uint64_t bindProperty(const catalog::NodeTableCatalogEntry& entry,
+    const std::string& propertyName) {
+    if (!entry.containsProperty(propertyName)) {
+        throw BinderException{stringFormat("Property: {} does not exist in table {}.",
+            propertyName, entry.getName())};
+    }
+    auto& type = entry.getProperty(propertyName).getType();
+    if (type.getLogicalTypeID() == LogicalTypeID::ARRAY) {
+        auto childTypeID = ArrayType::getChildType(type).getLogicalTypeID();
+        if (childTypeID == LogicalTypeID::FLOAT || childTypeID == LogicalTypeID::DOUBLE) {
+            return ArrayType::getNumElements(type);
+        }
+    }
+    throw BinderException{stringFormat("Vector index can only be built on FLOAT or DOUBLE ARRAY "
+                                       "properties. Property: {} has type {}.",
+        propertyName, type.toString())};
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    VectorIndexUtils::validateAutoTrx(*context, CreateVectorIndexFunction::name);
+    auto indexName = input->getLiteralVal<std::string>(1);
+    auto& nodeTableEntry = VectorIndexUtils::bindTable(input->getLiteralVal<std::string>(0),
+        context, indexName, VectorIndexUtils::IndexOperation::CREATE);
+    auto propertyName = input->getLiteralVal<std::string>(2);
+    auto dimension = bindProperty(nodeTableEntry, propertyName);
+    validateIndexNotExist(*context, nodeTableEntry.getTableID(), indexName);
+    auto config = HNSWIndexConfig{input->optionalParams};
+    return std::make_unique<CreateVectorIndexBindData>(nodeTableEntry.getName(),
+        nodeTableEntry.getTableID(), indexName, std::move(propertyName), dimension,
+        std::move(config));
+}
+
+// Builds the index and registers it for maintenance.
+static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& /*output*/) {
+    auto& bindData = *input.bindData->constPtrCast<CreateVectorIndexBindData>();
+    auto clientContext = input.context->clientContext;
+    auto auxInfo = std::make_unique<HNSWIndexAuxInfo>(bindData.propertyName, bindData.dimension,
+        bindData.config);
+    VectorIndexUtils::catchUpIndex(clientContext, bindData.tableID, bindData.propertyName,
+        auxInfo->getIndex());
+    auto entry = std::make_unique<catalog::IndexCatalogEntry>(HNSWIndexAuxInfo::INDEX_TYPE_NAME,
+        bindData.tableID, bindData.indexName, std::move(auxInfo));
+    VectorIndexUtils::registerMaintainer(*clientContext, *entry);
+    clientContext->getCatalog()->createIndex(clientContext->getTx(), std::move(entry));
+    return 0;
+}
+
+function_set CreateVectorIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, tableFunc, bindFunc, initSharedState,
+        initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING,
+            LogicalTypeID::STRING});
+    func->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace vector_extension
+} // namespace kuzu
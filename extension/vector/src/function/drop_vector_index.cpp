@@ -0,0 +1,52 @@
+#include "function/drop_vector_index.h"
+
+#include "catalog/catalog.h"
+#include "function/table/bind_input.h"
+#include "function/vector_index_bind_data.h"
+#include "function/vector_index_utils.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::function;
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    VectorIndexUtils::validateAutoTrx(*context, DropVectorIndexFunction::name);
+    auto indexName = input->getLiteralVal<std::string>(1);
+    auto& tableEntry = VectorIndexUtils::bindTable(input->getLiteralVal<std::string>(0), context,
+        indexName, VectorIndexUtils::IndexOperation::DROP);
+    VectorIndexUtils::bindIndex(*context, tableEntry.getTableID(), indexName);
+    return std::make_unique<VectorIndexBindData>(tableEntry.getName(), tableEntry.getTableID(),
+        indexName);
+}
+
+static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& /*output*/) {
+    auto& bindData = *input.bindData->constPtrCast<VectorIndexBindData>();
+    auto clientContext = input.context->clientContext;
+    clientContext->getCatalog()->dropIndex(clientContext->getTx(), bindData.tableID,
+        bindData.indexName);
+    clientContext->getStorageManager()
+        ->getTable(bindData.tableID)
+        ->cast<storage::NodeTable>()
+        .removeWriteListener(bindData.indexName);
+    return 0;
+}
+
+function_set DropVectorIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, tableFunc, bindFunc, initSharedState,
+        initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -0,0 +1,148 @@
+#include "function/query_vector_index.h"
+
+#include "binder/binder.h"
+#include "binder/expression/expression_util.h"
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/node_expression.h"
+#include "catalog/catalog.h"
+#include "common/exception/binder.h"
+#include "common/types/value/nested.h"
+#include "expression_evaluator/expression_evaluator_utils.h"
+#include "function/vector_index_config.h"
+#include "function/vector_index_utils.h"
+#include "processor/execution_context.h"
+#include "processor/result/factorized_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace vector_extension {
+
+using namespace function;
+
+struct QueryVectorIndexBindData final : public GDSBindData {
+    common::table_id_t tableID;
+    std::string indexName;
+    std::vector<float> queryVector;
+    uint64_t k;
+    QueryHNSWConfig config;
+
+    QueryVectorIndexBindData(graph::GraphEntry graphEntry, std::shared_ptr<Expression> nodeOutput,
+        common::table_id_t tableID, std::string indexName, std::vector<float> queryVector,
+        uint64_t k, QueryHNSWConfig config)
+        : GDSBindData{std::move(graphEntry), std::move(nodeOutput)}, tableID{tableID},
+          indexName{std::move(indexName)}, queryVector{std::move(queryVector)}, k{k},
+          config{std::move(config)} {}
+    QueryVectorIndexBindData(const QueryVectorIndexBindData& other)
+        : GDSBindData{other}, tableID{other.tableID}, indexName{other.indexName},
+          queryVector{other.queryVector}, k{other.k}, config{other.config} {}
+
+    bool hasNodeInput() const override { return false; }
+    // A semi mask on the output nodes turns the search into a filtered k-NN search.
+    bool hasNodeOutput() const override { return true; }
+
+    std::unique_ptr<GDSBindData> copy() const override {
+        return std::make_unique<QueryVectorIndexBindData>(*this);
+    }
+};
+
+void QueryVectorIndexAlgorithm::exec(processor::ExecutionContext* executionContext) {
+    auto clientContext = executionContext->clientContext;
+    auto& queryBindData = *bindData->ptrCast<QueryVectorIndexBindData>();
+    auto tableID = queryBindData.tableID;
+    auto& indexInfo =
+        VectorIndexUtils::bindIndex(*clientContext, tableID, queryBindData.indexName);
+    auto& index = indexInfo.getIndex();
+    VectorIndexUtils::catchUpIndex(clientContext, tableID, indexInfo.propertyName, index);
+
+    HNSWIndex::filter_func_t filter = nullptr;
+    auto outputNodeMask = sharedState->getOutputNodeMaskMap();
+    if (outputNodeMask != nullptr && outputNodeMask->enabled()) {
+        auto mask = outputNodeMask->getOffsetMask(tableID);
+        filter = [mask](offset_t offset) { return mask->isMasked(offset); };
+    }
+    auto result = index.search(queryBindData.queryVector.data(), queryBindData.k,
+        queryBindData.config.efs, filter);
+
+    auto mm = clientContext->getMemoryManager();
+    ValueVector nodeIDVector{LogicalType::INTERNAL_ID(), mm};
+    ValueVector distanceVector{LogicalType::DOUBLE(), mm};
+    auto state = DataChunkState::getSingleValueDataChunkState();
+    auto pos = state->getSelVector()[0];
+    nodeIDVector.setState(state);
+    distanceVector.setState(state);
+    std::vector<ValueVector*> vectors{&nodeIDVector, &distanceVector};
+    auto table = sharedState->claimLocalTable(mm);
+    for (auto& [offset, distance] : result) {
+        nodeIDVector.setValue(pos, nodeID_t{offset, tableID});
+        distanceVector.setValue(pos, distance);
+        table->append(vectors);
+    }
+    sharedState->returnLocalTable(table);
+    sharedState->mergeLocalTables();
+}
+
+binder::expression_vector QueryVectorIndexAlgorithm::getResultColumns(
+    binder::Binder* binder) const {
+    expression_vector columns;
+    auto& node = bindData->getNodeOutput()->constCast<NodeExpression>();
+    columns.push_back(node.getInternalID());
+    columns.push_back(binder->createVariable(DISTANCE_PROP_NAME, LogicalType::DOUBLE()));
+    return columns;
+}
+
+static std::vector<float> bindQueryVector(const GDSBindInput& input, main::ClientContext& context,
+    uint64_t dimension) {
+    auto queryExpr = input.binder->getExpressionBinder()->implicitCastIfNecessary(
+        input.getParam(2), LogicalType::ARRAY(LogicalType::FLOAT(), dimension));
+    auto value = evaluator::ExpressionEvaluatorUtils::evaluateConstantExpression(queryExpr,
+        &context);
+    if (value.isNull()) {
+        throw BinderException{"The query vector of QUERY_VECTOR_INDEX cannot be NULL."};
+    }
+    std::vector<float> queryVector;
+    queryVector.reserve(dimension);
+    for (auto i = 0u; i < value.getChildrenSize(); i++) {
+        auto child = NestedVal::getChildVal(&value, i);
+        queryVector.push_back(child->isNull() ? 0 : child->getValue<float>());
+    }
+    return queryVector;
+}
+
+static uint64_t bindK(const GDSBindInput& input, main::ClientContext& context) {
+    auto value = evaluator::ExpressionEvaluatorUtils::evaluateConstantExpression(input.getParam(3),
+        &context);
+    if (value.isNull() || value.getValue<int64_t>() <= 0) {
+        throw BinderException{"k must be a positive integer."};
+    }
+    return value.getValue<int64_t>();
+}
+
+void QueryVectorIndexAlgorithm::bind(const GDSBindInput& input, main::ClientContext& context) {
+    auto tableName = ExpressionUtil::getLiteralValue<std::string>(
+        input.getParam(0)->constCast<LiteralExpression>());
+    auto indexName = ExpressionUtil::getLiteralValue<std::string>(
+        input.getParam(1)->constCast<LiteralExpression>());
+    auto& tableEntry = VectorIndexUtils::bindTable(tableName, &context, indexName,
+        VectorIndexUtils::IndexOperation::QUERY);
+    auto& indexInfo = VectorIndexUtils::bindIndex(context, tableEntry.getTableID(), indexName);
+    auto queryVector = bindQueryVector(input, context, indexInfo.dimension);
+    auto k = bindK(input, context);
+    auto nodeOutput = bindNodeOutput(input.binder, {&tableEntry});
+    auto graphEntry = graph::GraphEntry({&tableEntry}, {} /* relTableEntries */);
+    bindData = std::make_unique<QueryVectorIndexBindData>(std::move(graphEntry), nodeOutput,
+        tableEntry.getTableID(), indexName, std::move(queryVector), k,
+        QueryHNSWConfig{input.optionalParams});
+}
+
+function::function_set QueryVectorIndexFunction::getFunctionSet() {
+    function_set result;
+    auto algo = std::make_unique<QueryVectorIndexAlgorithm>();
+    result.push_back(
+        std::make_unique<GDSFunction>(name, algo->getParameterTypeIDs(), std::move(algo)));
+    return result;
+}
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -0,0 +1,114 @@
+#include "function/vector_index_config.h"
+
+#include "common/exception/binder.h"
+#include "common/string_utils.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+DistanceMetric Metric::getMetric(const std::string& metricName) {
+    auto lowerCaseName = common::StringUtils::getLower(metricName);
+    if (lowerCaseName == "cosine") {
+        return DistanceMetric::COSINE;
+    } else if (lowerCaseName == "l2") {
+        return DistanceMetric::L2;
+    } else if (lowerCaseName == "l2sq") {
+        return DistanceMetric::L2SQ;
+    } else if (lowerCaseName == "dotproduct") {
+        return DistanceMetric::DOT_PRODUCT;
+    }
+    throw common::BinderException{
+        common::stringFormat("Unrecognized distance metric: {}. Supported metrics are: cosine, l2, "
+                             "l2sq and dotproduct.",
+            metricName)};
+}
+
+std::string Metric::toString(DistanceMetric metric) {
+    switch (metric) {
+    case DistanceMetric::COSINE:
+        return "cosine";
+    case DistanceMetric::L2:
+        return "l2";
+    case DistanceMetric::L2SQ:
+        return "l2sq";
+    case DistanceMetric::DOT_PRODUCT:
+        return "dotproduct";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+static void validatePositive(const char* name, int64_t value) {
+    if (value <= 0) {
+        throw common::BinderException{
+            common::stringFormat("{} must be a positive integer.", name)};
+    }
+}
+
+void Mu::validate(int64_t value) {
+    validatePositive(NAME, value);
+}
+
+void Ml::validate(int64_t value) {
+    validatePositive(NAME, value);
+}
+
+void Efc::validate(int64_t value) {
+    validatePositive(NAME, value);
+}
+
+void Efs::validate(int64_t value) {
+    validatePositive(NAME, value);
+}
+
+HNSWIndexConfig::HNSWIndexConfig(const function::optional_params_t& optionalParams) {
+    auto hasMl = false;
+    for (auto& [name, value] : optionalParams) {
+        auto lowerCaseName = common::StringUtils::getLower(name);
+        if (Mu::NAME == lowerCaseName) {
+            value.validateType(Mu::TYPE);
+            auto val = value.getValue<int64_t>();
+            Mu::validate(val);
+            mu = val;
+        } else if (Ml::NAME == lowerCaseName) {
+            value.validateType(Ml::TYPE);
+            auto val = value.getValue<int64_t>();
+            Ml::validate(val);
+            ml = val;
+            hasMl = true;
+        } else if (Efc::NAME == lowerCaseName) {
+            value.validateType(Efc::TYPE);
+            auto val = value.getValue<int64_t>();
+            Efc::validate(val);
+            efc = val;
+        } else if (Metric::NAME == lowerCaseName) {
+            value.validateType(Metric::TYPE);
+            metric = Metric::getMetric(value.getValue<std::string>());
+        } else {
+            throw common::BinderException{"Unrecognized optional parameter: " + name};
+        }
+    }
+    if (!hasMl) {
+        ml = 2 * mu;
+    }
+    if (ml < mu) {
+        throw common::BinderException{"ml must be greater than or equal to mu."};
+    }
+}
+
+QueryHNSWConfig::QueryHNSWConfig(const function::optional_params_t& optionalParams) {
+    for (auto& [name, value] : optionalParams) {
+        auto lowerCaseName = common::StringUtils::getLower(name);
+        if (Efs::NAME == lowerCaseName) {
+            value.validateType(Efs::TYPE);
+            auto val = value.getValue<int64_t>();
+            Efs::validate(val);
+            efs = val;
+        } else {
+            throw common::BinderException{"Unrecognized optional parameter: " + name};
+        }
+    }
+}
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -0,0 +1,149 @@
+#include "function/vector_index_utils.h"
+
+#include "catalog/catalog.h"
+#include "common/exception/binder.h"
+#include "graph/graph_entry.h"
+#include "graph/on_disk_graph.h"
+#include "index/hnsw_index_maintainer.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace vector_extension {
+
+catalog::NodeTableCatalogEntry& VectorIndexUtils::bindTable(const std::string& tableName,
+    main::ClientContext* context, const std::string& indexName, IndexOperation operation) {
+    if (!context->getCatalog()->containsTable(context->getTx(), tableName)) {
+        throw BinderException{stringFormat("Table {} does not exist.", tableName)};
+    }
+    auto tableEntry = context->getCatalog()->getTableCatalogEntry(context->getTx(), tableName);
+    if (tableEntry->getTableType() != TableType::NODE) {
+        switch (operation) {
+        case IndexOperation::CREATE:
+            throw BinderException{stringFormat("Table: {} is not a node table. Can only build "
+                                               "vector index on node tables.",
+                tableEntry->getName())};
+        case IndexOperation::QUERY:
+        case IndexOperation::DROP:
+            throw BinderException{
+                stringFormat("Table: {} doesn't have an index with name: {}. Only node tables can "
+                             "have vector indexes.",
+                    tableEntry->getName(), indexName)};
+        }
+    }
+    return *tableEntry->ptrCast<catalog::NodeTableCatalogEntry>();
+}
+
+const HNSWIndexAuxInfo& VectorIndexUtils::bindIndex(const main::ClientContext& context,
+    table_id_t tableID, const std::string& indexName) {
+    auto catalog = context.getCatalog();
+    const catalog::IndexCatalogEntry* indexEntry = nullptr;
+    if (catalog->containsIndex(context.getTx(), tableID, indexName)) {
+        indexEntry = catalog->getIndex(context.getTx(), tableID, indexName);
+    }
+    // Vector indexes recovered from disk are loaded when the extension is loaded.
+    if (indexEntry == nullptr || indexEntry->getIndexType() != HNSWIndexAuxInfo::INDEX_TYPE_NAME ||
+        !indexEntry->isLoaded()) {
+        auto tableName = catalog->getTableName(context.getTx(), tableID);
+        throw BinderException{stringFormat("Table: {} doesn't have a vector index with name: {}.",
+            tableName, indexName)};
+    }
+    return indexEntry->getAuxInfo().cast<HNSWIndexAuxInfo>();
+}
+
+void VectorIndexUtils::registerMaintainer(const main::ClientContext& context,
+    const catalog::IndexCatalogEntry& indexEntry) {
+    auto& auxInfo = indexEntry.getAuxInfo().cast<HNSWIndexAuxInfo>();
+    auto tableEntry =
+        context.getCatalog()->getTableCatalogEntry(context.getTx(), indexEntry.getTableID());
+    auto& table = context.getStorageManager()
+                      ->getTable(indexEntry.getTableID())
+                      ->cast<storage::NodeTable>();
+    table.addWriteListener(indexEntry.getIndexName(),
+        std::make_shared<HNSWIndexMaintainer>(indexEntry.getTableID(), indexEntry.getIndexName(),
+            tableEntry->getColumnID(auxInfo.propertyName), auxInfo.index));
+}
+
+void VectorIndexUtils::validateAutoTrx(const main::ClientContext& context,
+    const std::string& funcName) {
+    if (!context.getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{
+            stringFormat("{} is only supported in auto transaction mode.", funcName)};
+    }
+}
+
+template<typename T>
+static void appendElements(const ValueVector& dataVector, const list_entry_t& entry,
+    std::vector<float>& vectors) {
+    for (auto i = 0u; i < entry.size; i++) {
+        // Null elements are treated as zeros.
+        const auto pos = entry.offset + i;
+        vectors.push_back(
+            dataVector.isNull(pos) ? 0 : static_cast<float>(dataVector.getValue<T>(pos)));
+    }
+}
+
+bool VectorIndexUtils::appendVector(const ValueVector& arrayVector, sel_t pos,
+    std::vector<float>& vectors) {
+    if (arrayVector.isNull(pos)) {
+        return false;
+    }
+    auto listEntry = arrayVector.getValue<list_entry_t>(pos);
+    auto dataVector = ListVector::getDataVector(&arrayVector);
+    switch (dataVector->dataType.getLogicalTypeID()) {
+    case LogicalTypeID::FLOAT: {
+        appendElements<float>(*dataVector, listEntry, vectors);
+    } break;
+    case LogicalTypeID::DOUBLE: {
+        appendElements<double>(*dataVector, listEntry, vectors);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    return true;
+}
+
+void VectorIndexUtils::catchUpIndex(main::ClientContext* context, table_id_t tableID,
+    const std::string& propertyName, HNSWIndex& index) {
+    const auto startOffset = index.getNumIndexedOffsets();
+    const auto endOffset = context->getTx()->getMinUncommittedNodeOffset(tableID);
+    if (startOffset >= endOffset) {
+        return;
+    }
+    auto tableEntry = context->getCatalog()->getTableCatalogEntry(context->getTx(), tableID);
+    graph::GraphEntry entry{{tableEntry}, {} /* relTableEntries */};
+    graph::OnDiskGraph graph(context, std::move(entry));
+    auto scanState = graph.prepareVertexScan(tableID, {propertyName});
+    std::vector<offset_t> offsets;
+    std::vector<float> vectors;
+    // Deleted nodes are not scanned, so chunks may have gaps and may even be empty. Each chunk is
+    // inserted as the range from the end of the previous one, and the watermark is finally moved
+    // past trailing deleted nodes.
+    auto chunkStartOffset = startOffset;
+    for (auto chunk : graph.scanVertices(startOffset, endOffset, *scanState)) {
+        auto nodeIDs = chunk.getNodeIDs();
+        if (nodeIDs.empty()) {
+            continue;
+        }
+        auto& arrayVector = chunk.getPropertyVector(0);
+        offsets.clear();
+        vectors.clear();
+        for (auto i = 0u; i < nodeIDs.size(); i++) {
+            if (appendVector(arrayVector, i, vectors)) {
+                offsets.push_back(nodeIDs[i].offset);
+            }
+        }
+        KU_ASSERT(vectors.size() == offsets.size() * index.getDimension());
+        const auto chunkEndOffset = nodeIDs.back().offset + 1;
+        index.insert(chunkStartOffset, chunkEndOffset, offsets, vectors);
+        chunkStartOffset = chunkEndOffset;
+    }
+    index.insert(chunkStartOffset, endOffset, {} /* offsets */, {} /* vectors */);
+}
+
+} // namespace vector_extension
+} // namespace kuzu
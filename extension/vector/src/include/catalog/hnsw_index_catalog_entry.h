@@ -0,0 +1,33 @@
+#pragma once
+
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "index/hnsw_index.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+// Definition of a vector index, kept as the aux info of its IndexCatalogEntry. Only the definition
+// is persisted; the graph is rebuilt from the indexed table the first time the index is queried
+// after the database is reopened.
+struct HNSWIndexAuxInfo final : public catalog::IndexAuxInfo {
+    static constexpr const char* INDEX_TYPE_NAME = "HNSW";
+
+    std::string propertyName;
+    uint64_t dimension;
+    HNSWIndexConfig config;
+    // The index structure is shared by all copies of the entry.
+    std::shared_ptr<HNSWIndex> index;
+
+    HNSWIndexAuxInfo(std::string propertyName, uint64_t dimension, HNSWIndexConfig config)
+        : propertyName{std::move(propertyName)}, dimension{dimension}, config{std::move(config)},
+          index{std::make_shared<HNSWIndex>(this->dimension, this->config)} {}
+
+    HNSWIndex& getIndex() const { return *index; }
+
+    void serialize(common::Serializer& serializer) const override;
+    static std::unique_ptr<HNSWIndexAuxInfo> deserialize(common::Deserializer& deserializer);
+    std::unique_ptr<catalog::IndexAuxInfo> copy() const override;
+};
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "function/table/simple_table_functions.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+struct CreateVectorIndexFunction : function::SimpleTableFunction {
+    static constexpr const char* name = "CREATE_VECTOR_INDEX";
+
+    static function::function_set getFunctionSet();
+};
+
+} // namespace vector_extension
+} // namespace kuzu
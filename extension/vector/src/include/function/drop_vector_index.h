@@ -0,0 +1,15 @@
+#pragma once
+
+#include "function/table/simple_table_functions.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+struct DropVectorIndexFunction : function::SimpleTableFunction {
+    static constexpr const char* name = "DROP_VECTOR_INDEX";
+
+    static function::function_set getFunctionSet();
+};
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "function/gds/gds.h"
+#include "function/gds_function.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+class QueryVectorIndexAlgorithm : public function::GDSAlgorithm {
+public:
+    static constexpr char DISTANCE_PROP_NAME[] = "distance";
+
+public:
+    QueryVectorIndexAlgorithm() = default;
+    QueryVectorIndexAlgorithm(const QueryVectorIndexAlgorithm& other) : GDSAlgorithm{other} {}
+
+    /*
+     * Inputs include the following:
+     *
+     * tableName: STRING
+     * indexName: STRING
+     * queryVector: ANY (a numeric LIST or ARRAY)
+     * k: INT64
+     */
+    std::vector<common::LogicalTypeID> getParameterTypeIDs() const override {
+        return {common::LogicalTypeID::STRING /* tableName */,
+            common::LogicalTypeID::STRING /* indexName */,
+            common::LogicalTypeID::ANY /* queryVector */, common::LogicalTypeID::INT64 /* k */};
+    }
+
+    void exec(processor::ExecutionContext* executionContext) override;
+
+    std::unique_ptr<GDSAlgorithm> copy() const override {
+        return std::make_unique<QueryVectorIndexAlgorithm>(*this);
+    }
+
+    binder::expression_vector getResultColumns(binder::Binder* binder) const override;
+
+    void bind(const function::GDSBindInput& input, main::ClientContext& context) override;
+};
+
+struct QueryVectorIndexFunction {
+    static constexpr const char* name = "QUERY_VECTOR_INDEX";
+
+    static function::function_set getFunctionSet();
+};
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "function/table/simple_table_functions.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+struct VectorIndexBindData : public function::SimpleTableFuncBindData {
+    std::string tableName;
+    common::table_id_t tableID;
+    std::string indexName;
+
+    VectorIndexBindData(std::string tableName, common::table_id_t tableID, std::string indexName)
+        : function::SimpleTableFuncBindData{binder::expression_vector{}, 1 /* maxOffset */},
+          tableName{std::move(tableName)}, tableID{tableID}, indexName{std::move(indexName)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<VectorIndexBindData>(*this);
+    }
+};
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <string>
+
+#include "common/types/types.h"
+#include "common/types/value/value.h"
+#include "function/table/bind_input.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+enum class DistanceMetric : uint8_t {
+    COSINE = 0,
+    L2 = 1,
+    L2SQ = 2,
+    DOT_PRODUCT = 3,
+};
+
+struct Metric {
+    static constexpr const char* NAME = "metric";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::STRING;
+    static constexpr DistanceMetric DEFAULT_VALUE = DistanceMetric::COSINE;
+
+    static DistanceMetric getMetric(const std::string& metricName);
+    static std::string toString(DistanceMetric metric);
+};
+
+// Max number of neighbors of a node in the upper layers.
+struct Mu {
+    static constexpr const char* NAME = "mu";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 30;
+
+    static void validate(int64_t value);
+};
+
+// Max number of neighbors of a node in the lower layer. Defaults to 2 * mu.
+struct Ml {
+    static constexpr const char* NAME = "ml";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 60;
+
+    static void validate(int64_t value);
+};
+
+// Size of the candidate list when searching for the neighbors of a newly inserted node.
+struct Efc {
+    static constexpr const char* NAME = "efc";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 200;
+
+    static void validate(int64_t value);
+};
+
+// Size of the candidate list when answering a query.
+struct Efs {
+    static constexpr const char* NAME = "efs";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 200;
+
+    static void validate(int64_t value);
+};
+
+struct HNSWIndexConfig {
+    uint64_t mu = Mu::DEFAULT_VALUE;
+    uint64_t ml = Ml::DEFAULT_VALUE;
+    uint64_t efc = Efc::DEFAULT_VALUE;
+    DistanceMetric metric = Metric::DEFAULT_VALUE;
+
+    HNSWIndexConfig() = default;
+    explicit HNSWIndexConfig(const function::optional_params_t& optionalParams);
+};
+
+struct QueryHNSWConfig {
+    uint64_t efs = Efs::DEFAULT_VALUE;
+
+    QueryHNSWConfig() = default;
+    explicit QueryHNSWConfig(const function::optional_params_t& optionalParams);
+};
+
+} // namespace vector_extension
+} // namespace kuzu
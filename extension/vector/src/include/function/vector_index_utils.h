@@ -0,0 +1,43 @@
+#pragma once
+
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/hnsw_index_catalog_entry.h"
+#include "main/client_context.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+struct VectorIndexUtils {
+
+    enum class IndexOperation : uint8_t {
+        CREATE = 0,
+        QUERY = 1,
+        DROP = 2,
+    };
+
+    static catalog::NodeTableCatalogEntry& bindTable(const std::string& tableName,
+        main::ClientContext* context, const std::string& indexName, IndexOperation operation);
+
+    // Throws if the table doesn't have a vector index with the given name.
+    static const HNSWIndexAuxInfo& bindIndex(const main::ClientContext& context,
+        common::table_id_t tableID, const std::string& indexName);
+
+    // Registers the maintainer that applies updates and deletes of the indexed table to the index.
+    static void registerMaintainer(const main::ClientContext& context,
+        const catalog::IndexCatalogEntry& indexEntry);
+
+    static void validateAutoTrx(const main::ClientContext& context, const std::string& funcName);
+
+    // Appends the FLOAT copy of the array at pos to vectors. Returns false if the array is NULL.
+    static bool appendVector(const common::ValueVector& arrayVector, common::sel_t pos,
+        std::vector<float>& vectors);
+
+    // Inserts the vectors of committed nodes appended since the index was last caught up. Only
+    // offsets below the first uncommitted offset of the current transaction are indexed, so
+    // uncommitted and rolled back nodes never enter the shared index.
+    static void catchUpIndex(main::ClientContext* context, common::table_id_t tableID,
+        const std::string& propertyName, HNSWIndex& index);
+};
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/types/types.h"
+#include "function/array/array_distance_kernels.h"
+#include "function/vector_index_config.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+// In-memory hierarchical navigable small world graph (Malkov & Yashunin) over the vectors of a
+// fixed-size ARRAY property. Vectors are identified by the offsets of the nodes that hold them and
+// are kept as FLOAT copies. Nodes are indexed in offset order; numIndexedOffsets is the watermark
+// below which every node offset has been visited (nodes with a NULL vector are skipped), so newly
+// appended nodes can be caught up incrementally.
+// Updated and deleted nodes are staged per transaction and applied when it commits. The old vector
+// of such a node is only marked as removed: it stays in the graph to route searches but is never
+// returned. An updated node is inserted again with its new vector.
+class HNSWIndex {
+public:
+    using result_t = std::vector<std::pair<common::offset_t, double>>;
+    using filter_func_t = std::function<bool(common::offset_t)>;
+
+    HNSWIndex(uint64_t dimension, HNSWIndexConfig config);
+
+    uint64_t getDimension() const { return dimension; }
+    const HNSWIndexConfig& getConfig() const { return config; }
+    uint64_t getNumVectors() const;
+    common::offset_t getNumIndexedOffsets() const;
+
+    // Inserts the vectors of the nodes in [startOffset, endOffset) and moves the watermark to
+    // endOffset. startOffset must not be above the watermark. offsets must be sorted and vectors
+    // must hold dimension values per offset; offsets without a vector (NULL or deleted) are simply
+    // left out. Offsets below the current watermark are ignored, so concurrent callers may race to
+    // catch up the same range. So are offsets whose vector was set by a committed update, as the
+    // caller may have read an older version of them.
+    void insert(common::offset_t startOffset, common::offset_t endOffset,
+        const std::vector<common::offset_t>& offsets, const std::vector<float>& vectors);
+
+    // Returns the (approximate) k nearest node offsets to query sorted by increasing distance.
+    // Nodes for which filter returns false are traversed but never returned.
+    result_t search(const float* query, uint64_t k, uint64_t efs,
+        const filter_func_t& filter = nullptr) const;
+
+    // Stages the new vector of a node updated by a transaction. An empty vector (e.g., the node
+    // was set to NULL) removes the node.
+    void setVector(common::transaction_t transactionID, common::offset_t offset,
+        std::vector<float> vector);
+    void removeVector(common::transaction_t transactionID, common::offset_t offset);
+    void commitChanges(common::transaction_t transactionID);
+    void rollbackChanges(common::transaction_t transactionID);
+
+private:
+    using vector_id_t = uint32_t;
+    using candidate_t = std::pair<double, vector_id_t>;
+
+    void insertNoLock(common::offset_t offset, const float* vector);
+    void removeNoLock(common::offset_t offset);
+    uint8_t getRandomLevel();
+    const float* getVector(vector_id_t id) const { return vectors.data() + id * dimension; }
+    double computeDistance(const float* left, const float* right) const;
+    void normalizeIfNecessary(float* vector) const;
+
+    vector_id_t greedySearch(const float* query, vector_id_t entryPoint, uint8_t level) const;
+    std::vector<candidate_t> searchLayer(const float* query, vector_id_t entryPoint,
+        uint64_t ef, uint8_t level, const filter_func_t& filter, bool skipRemoved) const;
+    std::vector<vector_id_t> selectNeighbors(std::vector<candidate_t> candidates,
+        uint64_t maxDegree) const;
+    void shrinkNeighbors(vector_id_t id, uint8_t level);
+    uint64_t getMaxDegree(uint8_t level) const { return level == 0 ? config.ml : config.mu; }
+
+private:
+    uint64_t dimension;
+    HNSWIndexConfig config;
+    double levelMultiplier;
+    std::mt19937_64 levelGenerator;
+    const function::ArrayDistanceKernelSet<float>& kernels;
+
+    mutable std::shared_mutex mtx;
+    common::offset_t numIndexedOffsets;
+    std::vector<float> vectors;
+    std::vector<common::offset_t> offsets;
+    // Vectors of updated or deleted nodes, which are only traversed.
+    std::vector<bool> removed;
+    // Ids of the vectors that are not removed.
+    std::unordered_map<common::offset_t, vector_id_t> ids;
+    // Offsets at or above the watermark whose vector was set or removed by a committed change.
+    std::unordered_set<common::offset_t> changedOffsets;
+    // New vectors staged by uncommitted transactions. Empty vectors are removals.
+    std::unordered_map<common::transaction_t,
+        std::unordered_map<common::offset_t, std::vector<float>>>
+        stagedChanges;
+    // neighbors[id][level] holds the adjacency list of vector id in the given layer.
+    std::vector<std::vector<std::vector<vector_id_t>>> neighbors;
+    vector_id_t entryPoint;
+    uint8_t maxLevel;
+};
+
+} // namespace vector_extension
+} // namespace kuzu
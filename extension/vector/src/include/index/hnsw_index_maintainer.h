@@ -0,0 +1,45 @@
+#pragma once
+
+#include "index/hnsw_index.h"
+#include "storage/store/node_table_write_listener.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+// Keeps a vector index in sync with updates and deletes of the indexed node table. Inserted nodes
+// need no maintenance: they are caught up by the next query once committed, like bulk appended
+// ones. The changes are staged in the index and applied when the writing transaction commits.
+class HNSWIndexMaintainer final : public storage::NodeTableWriteListener {
+public:
+    HNSWIndexMaintainer(common::table_id_t tableID, std::string indexName,
+        common::column_id_t columnID, std::shared_ptr<HNSWIndex> index)
+        : tableID{tableID}, indexName{std::move(indexName)}, columnID{columnID},
+          index{std::move(index)} {}
+
+    void onInsert(transaction::Transaction* /*transaction*/,
+        common::offset_t /*nodeOffset*/) override {}
+    void onUpdate(transaction::Transaction* transaction, common::offset_t nodeOffset,
+        common::column_id_t updatedColumnID) override;
+    void onDelete(transaction::Transaction* transaction, common::offset_t nodeOffset) override;
+    void onBulkAppend(transaction::Transaction* /*transaction*/, common::offset_t /*startOffset*/,
+        common::offset_t /*endOffset*/) override {}
+
+    void onCommit(transaction::Transaction* transaction) override;
+    void onRollback(transaction::Transaction* transaction) override;
+
+private:
+    // The index may not be visible to the transaction, e.g., if it is being dropped.
+    bool isIndexVisible(const transaction::Transaction* transaction) const;
+    // Returns the vector of the node as seen by the transaction, or an empty one if it is NULL.
+    std::vector<float> readVector(transaction::Transaction* transaction,
+        common::offset_t nodeOffset) const;
+
+private:
+    common::table_id_t tableID;
+    std::string indexName;
+    common::column_id_t columnID;
+    std::shared_ptr<HNSWIndex> index;
+};
+
+} // namespace vector_extension
+} // namespace kuzu
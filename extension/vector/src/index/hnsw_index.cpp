@@ -0,0 +1,316 @@
+#include "index/hnsw_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+#include "common/assert.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace vector_extension {
+
+static constexpr uint64_t LEVEL_GENERATOR_SEED = 0x5eed;
+static constexpr uint8_t MAX_LEVEL = 16;
+
+HNSWIndex::HNSWIndex(uint64_t dimension, HNSWIndexConfig config)
+    : dimension{dimension}, config{std::move(config)}, levelGenerator{LEVEL_GENERATOR_SEED},
+      kernels{function::ArrayDistanceKernels::getKernels<float>()}, numIndexedOffsets{0},
+      entryPoint{0}, maxLevel{0} {
+    KU_ASSERT(dimension > 0);
+    // The optimal level multiplier is 1/ln(M) according to the HNSW paper.
+    levelMultiplier = 1.0 / std::log(std::max<double>(this->config.mu, 2));
+}
+
+uint64_t HNSWIndex::getNumVectors() const {
+    std::shared_lock lck{mtx};
+    return ids.size();
+}
+
+offset_t HNSWIndex::getNumIndexedOffsets() const {
+    std::shared_lock lck{mtx};
+    return numIndexedOffsets;
+}
+
+void HNSWIndex::insert([[maybe_unused]] offset_t startOffset, offset_t endOffset,
+    const std::vector<offset_t>& offsetsToInsert, const std::vector<float>& vectorsToInsert) {
+    KU_ASSERT(vectorsToInsert.size() == offsetsToInsert.size() * dimension);
+    std::unique_lock lck{mtx};
+    KU_ASSERT(startOffset <= numIndexedOffsets);
+    if (endOffset <= numIndexedOffsets) {
+        return;
+    }
+    for (auto i = 0u; i < offsetsToInsert.size(); i++) {
+        if (offsetsToInsert[i] < numIndexedOffsets ||
+            changedOffsets.contains(offsetsToInsert[i])) {
+            continue;
+        }
+        KU_ASSERT(offsetsToInsert[i] < endOffset);
+        insertNoLock(offsetsToInsert[i], vectorsToInsert.data() + i * dimension);
+    }
+    numIndexedOffsets = endOffset;
+    std::erase_if(changedOffsets, [&](offset_t offset) { return offset < numIndexedOffsets; });
+}
+
+void HNSWIndex::setVector(transaction_t transactionID, offset_t offset,
+    std::vector<float> vector) {
+    KU_ASSERT(vector.empty() || vector.size() == dimension);
+    std::unique_lock lck{mtx};
+    stagedChanges[transactionID][offset] = std::move(vector);
+}
+
+void HNSWIndex::removeVector(transaction_t transactionID, offset_t offset) {
+    setVector(transactionID, offset, {} /* vector */);
+}
+
+void HNSWIndex::commitChanges(transaction_t transactionID) {
+    std::unique_lock lck{mtx};
+    auto it = stagedChanges.find(transactionID);
+    if (it == stagedChanges.end()) {
+        return;
+    }
+    for (auto& [offset, vector] : it->second) {
+        removeNoLock(offset);
+        if (!vector.empty()) {
+            insertNoLock(offset, vector.data());
+        }
+        if (offset >= numIndexedOffsets) {
+            // Catching up must not overwrite the change with a version read before the commit.
+            changedOffsets.insert(offset);
+        }
+    }
+    stagedChanges.erase(it);
+}
+
+void HNSWIndex::rollbackChanges(transaction_t transactionID) {
+    std::unique_lock lck{mtx};
+    stagedChanges.erase(transactionID);
+}
+
+HNSWIndex::result_t HNSWIndex::search(const float* query, uint64_t k, uint64_t efs,
+    const filter_func_t& filter) const {
+    std::vector<float> normalizedQuery{query, query + dimension};
+    normalizeIfNecessary(normalizedQuery.data());
+    std::shared_lock lck{mtx};
+    result_t result;
+    if (ids.empty() || k == 0) {
+        return result;
+    }
+    auto currentEntryPoint = entryPoint;
+    for (auto level = maxLevel; level > 0; level--) {
+        currentEntryPoint = greedySearch(normalizedQuery.data(), currentEntryPoint, level);
+    }
+    auto candidates = searchLayer(normalizedQuery.data(), currentEntryPoint, std::max(efs, k),
+        0 /* level */, filter, true /* skipRemoved */);
+    result.reserve(std::min<uint64_t>(k, candidates.size()));
+    for (auto& [distance, id] : candidates) {
+        if (result.size() == k) {
+            break;
+        }
+        result.emplace_back(offsets[id], distance);
+    }
+    return result;
+}
+
+void HNSWIndex::insertNoLock(offset_t offset, const float* vector) {
+    const auto id = static_cast<vector_id_t>(offsets.size());
+    vectors.insert(vectors.end(), vector, vector + dimension);
+    normalizeIfNecessary(vectors.data() + id * dimension);
+    offsets.push_back(offset);
+    removed.push_back(false);
+    ids[offset] = id;
+    const auto level = getRandomLevel();
+    neighbors.emplace_back(level + 1);
+    if (id == 0) {
+        entryPoint = id;
+        maxLevel = level;
+        return;
+    }
+    const auto* insertedVector = getVector(id);
+    auto currentEntryPoint = entryPoint;
+    for (auto l = maxLevel; l > level; l--) {
+        currentEntryPoint = greedySearch(insertedVector, currentEntryPoint, l);
+    }
+    for (int64_t l = std::min(level, maxLevel); l >= 0; l--) {
+        const auto currentLevel = static_cast<uint8_t>(l);
+        auto candidates = searchLayer(insertedVector, currentEntryPoint, config.efc, currentLevel,
+            nullptr /* filter */, false /* skipRemoved */);
+        currentEntryPoint = candidates.front().second;
+        auto selected = selectNeighbors(std::move(candidates), getMaxDegree(currentLevel));
+        for (auto neighbor : selected) {
+            auto& neighborList = neighbors[neighbor][currentLevel];
+            neighborList.push_back(id);
+            if (neighborList.size() > getMaxDegree(currentLevel)) {
+                shrinkNeighbors(neighbor, currentLevel);
+            }
+        }
+        neighbors[id][currentLevel] = std::move(selected);
+    }
+    if (level > maxLevel) {
+        entryPoint = id;
+        maxLevel = level;
+    }
+}
+
+void HNSWIndex::removeNoLock(offset_t offset) {
+    auto it = ids.find(offset);
+    if (it == ids.end()) {
+        return;
+    }
+    removed[it->second] = true;
+    ids.erase(it);
+}
+
+uint8_t HNSWIndex::getRandomLevel() {
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    // Map r in [0, 1) to (0, 1] so that the log is always finite.
+    const auto r = 1.0 - distribution(levelGenerator);
+    const auto level = static_cast<uint64_t>(-std::log(r) * levelMultiplier);
+    return static_cast<uint8_t>(std::min<uint64_t>(level, MAX_LEVEL));
+}
+
+double HNSWIndex::computeDistance(const float* left, const float* right) const {
+    switch (config.metric) {
+    case DistanceMetric::COSINE: {
+        // Vectors are normalized on insertion, so the cosine similarity is the inner product.
+        return 1.0 - kernels.innerProduct(left, right, dimension);
+    }
+    case DistanceMetric::L2: {
+        return std::sqrt(kernels.squaredDistance(left, right, dimension));
+    }
+    case DistanceMetric::L2SQ: {
+        return kernels.squaredDistance(left, right, dimension);
+    }
+    case DistanceMetric::DOT_PRODUCT: {
+        return -kernels.innerProduct(left, right, dimension);
+    }
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+void HNSWIndex::normalizeIfNecessary(float* vector) const {
+    if (config.metric != DistanceMetric::COSINE) {
+        return;
+    }
+    const double norm = kernels.innerProduct(vector, vector, dimension);
+    if (norm == 0) {
+        return;
+    }
+    const auto invNorm = 1.0 / std::sqrt(norm);
+    for (auto i = 0u; i < dimension; i++) {
+        vector[i] = static_cast<float>(vector[i] * invNorm);
+    }
+}
+
+HNSWIndex::vector_id_t HNSWIndex::greedySearch(const float* query, vector_id_t currentEntryPoint,
+    uint8_t level) const {
+    auto current = currentEntryPoint;
+    auto currentDistance = computeDistance(query, getVector(current));
+    auto changed = true;
+    while (changed) {
+        changed = false;
+        for (auto neighbor : neighbors[current][level]) {
+            const auto distance = computeDistance(query, getVector(neighbor));
+            if (distance < currentDistance) {
+                current = neighbor;
+                currentDistance = distance;
+                changed = true;
+            }
+        }
+    }
+    return current;
+}
+
+std::vector<HNSWIndex::candidate_t> HNSWIndex::searchLayer(const float* query,
+    vector_id_t currentEntryPoint, uint64_t ef, uint8_t level, const filter_func_t& filter,
+    bool skipRemoved) const {
+    std::vector<bool> visited(offsets.size(), false);
+    // Min-heap of nodes to expand and max-heap of the best ef nodes found so far.
+    std::priority_queue<candidate_t, std::vector<candidate_t>, std::greater<>> toExpand;
+    std::priority_queue<candidate_t> results;
+    const auto isAccepted = [&](vector_id_t id) {
+        return !(skipRemoved && removed[id]) && (!filter || filter(offsets[id]));
+    };
+    const auto entryDistance = computeDistance(query, getVector(currentEntryPoint));
+    visited[currentEntryPoint] = true;
+    toExpand.emplace(entryDistance, currentEntryPoint);
+    if (isAccepted(currentEntryPoint)) {
+        results.emplace(entryDistance, currentEntryPoint);
+    }
+    while (!toExpand.empty()) {
+        const auto [distance, id] = toExpand.top();
+        if (results.size() >= ef && distance > results.top().first) {
+            break;
+        }
+        toExpand.pop();
+        for (auto neighbor : neighbors[id][level]) {
+            if (visited[neighbor]) {
+                continue;
+            }
+            visited[neighbor] = true;
+            const auto neighborDistance = computeDistance(query, getVector(neighbor));
+            if (results.size() < ef || neighborDistance < results.top().first) {
+                toExpand.emplace(neighborDistance, neighbor);
+                if (isAccepted(neighbor)) {
+                    results.emplace(neighborDistance, neighbor);
+                    if (results.size() > ef) {
+                        results.pop();
+                    }
+                }
+            }
+        }
+    }
+    std::vector<candidate_t> sortedResults(results.size());
+    for (auto i = results.size(); i > 0; i--) {
+        sortedResults[i - 1] = results.top();
+        results.pop();
+    }
+    return sortedResults;
+}
+
+std::vector<HNSWIndex::vector_id_t> HNSWIndex::selectNeighbors(
+    std::vector<candidate_t> candidates, uint64_t maxDegree) const {
+    std::sort(candidates.begin(), candidates.end());
+    std::vector<vector_id_t> selected;
+    std::vector<vector_id_t> pruned;
+    // Keep a candidate only if it is closer to the vector than to every neighbor selected so far,
+    // which spreads the neighbors over different directions.
+    for (auto& [distance, candidate] : candidates) {
+        if (selected.size() == maxDegree) {
+            break;
+        }
+        auto isDiverse = true;
+        for (auto neighbor : selected) {
+            if (computeDistance(getVector(candidate), getVector(neighbor)) < distance) {
+                isDiverse = false;
+                break;
+            }
+        }
+        if (isDiverse) {
+            selected.push_back(candidate);
+        } else {
+            pruned.push_back(candidate);
+        }
+    }
+    // Fill the remaining slots with the closest pruned candidates to keep the graph well connected.
+    for (auto i = 0u; i < pruned.size() && selected.size() < maxDegree; i++) {
+        selected.push_back(pruned[i]);
+    }
+    return selected;
+}
+
+void HNSWIndex::shrinkNeighbors(vector_id_t id, uint8_t level) {
+    const auto* vector = getVector(id);
+    auto& neighborList = neighbors[id][level];
+    std::vector<candidate_t> candidates;
+    candidates.reserve(neighborList.size());
+    for (auto neighbor : neighborList) {
+        candidates.emplace_back(computeDistance(vector, getVector(neighbor)), neighbor);
+    }
+    neighborList = selectNeighbors(std::move(candidates), getMaxDegree(level));
+}
+
+} // namespace vector_extension
+} // namespace kuzu
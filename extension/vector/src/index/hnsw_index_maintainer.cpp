@@ -0,0 +1,66 @@
+#include "index/hnsw_index_maintainer.h"
+
+#include "catalog/catalog.h"
+#include "function/vector_index_utils.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace vector_extension {
+
+void HNSWIndexMaintainer::onUpdate(Transaction* transaction, offset_t nodeOffset,
+    column_id_t updatedColumnID) {
+    if (updatedColumnID != columnID || !isIndexVisible(transaction)) {
+        return;
+    }
+    index->setVector(transaction->getID(), nodeOffset, readVector(transaction, nodeOffset));
+}
+
+void HNSWIndexMaintainer::onDelete(Transaction* transaction, offset_t nodeOffset) {
+    if (!isIndexVisible(transaction)) {
+        return;
+    }
+    index->removeVector(transaction->getID(), nodeOffset);
+}
+
+void HNSWIndexMaintainer::onCommit(Transaction* transaction) {
+    index->commitChanges(transaction->getID());
+}
+
+void HNSWIndexMaintainer::onRollback(Transaction* transaction) {
+    index->rollbackChanges(transaction->getID());
+}
+
+bool HNSWIndexMaintainer::isIndexVisible(const Transaction* transaction) const {
+    return transaction->getClientContext()->getCatalog()->containsIndex(transaction, tableID,
+        indexName);
+}
+
+std::vector<float> HNSWIndexMaintainer::readVector(Transaction* transaction,
+    offset_t nodeOffset) const {
+    auto context = transaction->getClientContext();
+    auto& table = context->getStorageManager()->getTable(tableID)->cast<storage::NodeTable>();
+    auto& column = table.getColumn(columnID);
+    DataChunk dataChunk{1 /* numValueVectors */, DataChunkState::getSingleValueDataChunkState()};
+    dataChunk.insert(0,
+        std::make_shared<ValueVector>(column.getDataType().copy(), context->getMemoryManager()));
+    ValueVector nodeIDVector{LogicalType::INTERNAL_ID(), context->getMemoryManager()};
+    nodeIDVector.setState(dataChunk.state);
+    storage::NodeTableScanState scanState{tableID, {columnID}, {&column}, dataChunk,
+        &nodeIDVector};
+    const auto pos = dataChunk.state->getSelVector()[0];
+    nodeIDVector.setValue<nodeID_t>(pos, nodeID_t{nodeOffset, tableID});
+    table.initScanState(transaction, scanState, tableID, nodeOffset);
+    std::vector<float> vector;
+    if (table.lookup(transaction, scanState)) {
+        VectorIndexUtils::appendVector(dataChunk.getValueVector(0), pos, vector);
+    }
+    return vector;
+}
+
+} // namespace vector_extension
+} // namespace kuzu
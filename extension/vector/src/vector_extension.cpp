@@ -0,0 +1,54 @@
+#include "vector_extension.h"
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/catalog_entry_type.h"
+#include "catalog/hnsw_index_catalog_entry.h"
+#include "function/create_vector_index.h"
+#include "function/drop_vector_index.h"
+#include "function/query_vector_index.h"
+#include "function/vector_index_utils.h"
+#include "main/client_context.h"
+#include "main/database.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+// Vector indexes recovered from disk only have their definition serialized. Their graphs are empty
+// and are built by the first query.
+static void loadVectorIndexes(main::ClientContext* context) {
+    for (auto indexEntry : context->getCatalog()->getIndexEntries(context->getTx())) {
+        if (indexEntry->getIndexType() != HNSWIndexAuxInfo::INDEX_TYPE_NAME ||
+            indexEntry->isLoaded()) {
+            continue;
+        }
+        auto deserializer = indexEntry->getAuxInfoDeserializer();
+        indexEntry->setAuxInfo(HNSWIndexAuxInfo::deserialize(deserializer));
+        VectorIndexUtils::registerMaintainer(*context, *indexEntry);
+    }
+}
+
+void VectorExtension::load(main::ClientContext* context) {
+    auto& db = *context->getDatabase();
+    ADD_GDS_FUNC(QueryVectorIndexFunction);
+    db.addStandaloneCallFunction(CreateVectorIndexFunction::name,
+        CreateVectorIndexFunction::getFunctionSet());
+    db.addStandaloneCallFunction(DropVectorIndexFunction::name,
+        DropVectorIndexFunction::getFunctionSet());
+    loadVectorIndexes(context);
+}
+
+} // namespace vector_extension
+} // namespace kuzu
+
+extern "C" {
+// Because we link against the static library on windows, we implicitly inherit KUZU_STATIC_DEFINE,
+// which cancels out any exporting, so we can't use KUZU_API.
+#if defined(_WIN32)
+#define INIT_EXPORT __declspec(dllexport)
+#else
+#define INIT_EXPORT __attribute__((visibility("default")))
+#endif
+INIT_EXPORT void init(kuzu::main::ClientContext* context) {
+    kuzu::vector_extension::VectorExtension::load(context);
+}
+}
@@ -90,6 +90,21 @@ std::vector<uint32_t> SubqueryGraph::getConnectedNodePos(const SubqueryGraph& nb
     return result;
 }
 
+std::string SubqueryGraph::getUniqueName() const {
+    std::string result;
+    for (auto i = 0u; i < queryGraph.getNumQueryNodes(); ++i) {
+        if (queryNodesSelector[i]) {
+            result += queryGraph.getQueryNode(i)->getUniqueName() + ",";
+        }
+    }
+    for (auto i = 0u; i < queryGraph.getNumQueryRels(); ++i) {
+        if (queryRelsSelector[i]) {
+            result += queryGraph.getQueryRel(i)->getUniqueName() + ",";
+        }
+    }
+    return result;
+}
+
 std::unordered_set<uint32_t> SubqueryGraph::getNodePositionsIgnoringNodeSelector() const {
     std::unordered_set<uint32_t> result;
     for (auto nodePos = 0u; nodePos < queryGraph.getNumQueryNodes(); ++nodePos) {
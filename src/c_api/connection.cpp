@@ -155,3 +155,15 @@ kuzu_state kuzu_connection_set_query_timeout(kuzu_connection* connection, uint64
     }
     return KuzuSuccess;
 }
+
+kuzu_state kuzu_connection_set_streaming_results(kuzu_connection* connection, bool enable) {
+    if (connection == nullptr || connection->_connection == nullptr) {
+        return KuzuError;
+    }
+    try {
+        static_cast<Connection*>(connection->_connection)->setStreamingResults(enable);
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+    return KuzuSuccess;
+}
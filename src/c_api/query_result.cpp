@@ -71,7 +71,13 @@ kuzu_state kuzu_query_result_get_query_summary(kuzu_query_result* query_result,
 }
 
 bool kuzu_query_result_has_next(kuzu_query_result* query_result) {
-    return static_cast<QueryResult*>(query_result->_query_result)->hasNext();
+    try {
+        return static_cast<QueryResult*>(query_result->_query_result)->hasNext();
+    } catch (Exception& e) {
+        // Streamed results can fail while they are read. Report a next tuple so that the error is
+        // surfaced by kuzu_query_result_get_next.
+        return true;
+    }
 }
 
 bool kuzu_query_result_has_next_query_result(kuzu_query_result* query_result) {
@@ -6,6 +6,7 @@
 #include "catalog/catalog_entry/function_catalog_entry.h"
 #include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "catalog/catalog_entry/rel_table_catalog_entry.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
@@ -241,6 +242,18 @@ void Catalog::alterTableEntry(Transaction* transaction, const BoundAlterInfo& in
             }
         }
     } break;
+    case AlterType::RENAME_PROPERTY: {
+        auto renamePropertyInfo = info.extraInfo->constCast<BoundExtraRenamePropertyInfo>();
+        for (auto indexEntry : getIndexEntries(transaction, tableEntry.getTableID())) {
+            if (indexEntry->getType() == CatalogEntryType::PROPERTY_INDEX_ENTRY &&
+                indexEntry->constCast<PropertyIndexCatalogEntry>().getPropertyName() ==
+                    renamePropertyInfo.oldName) {
+                throw CatalogException{stringFormat(
+                    "Cannot rename property {} as it is used by index {}. Drop the index first.",
+                    renamePropertyInfo.oldName, indexEntry->getIndexName())};
+            }
+        }
+    } break;
     default:
         break;
     }
@@ -336,6 +349,26 @@ bool Catalog::containsIndex(const transaction::Transaction* transaction, common:
     return indexes->containsEntry(transaction, common::stringFormat("{}_{}", tableID, indexName));
 }
 
+std::vector<IndexCatalogEntry*> Catalog::getIndexEntries(const Transaction* transaction) const {
+    std::vector<IndexCatalogEntry*> result;
+    for (auto& [_, entry] : indexes->getEntries(transaction)) {
+        result.push_back(entry->ptrCast<IndexCatalogEntry>());
+    }
+    return result;
+}
+
+std::vector<IndexCatalogEntry*> Catalog::getIndexEntries(const Transaction* transaction,
+    common::table_id_t tableID) const {
+    std::vector<IndexCatalogEntry*> result;
+    for (auto& [_, entry] : indexes->getEntries(transaction)) {
+        auto indexEntry = entry->ptrCast<IndexCatalogEntry>();
+        if (indexEntry->getTableID() == tableID) {
+            result.push_back(indexEntry);
+        }
+    }
+    return result;
+}
+
 void Catalog::dropAllIndexes(transaction::Transaction* transaction, common::table_id_t tableID) {
     for (auto catalogEntry : indexes->getEntries(transaction)) {
         auto& indexCatalogEntry = catalogEntry.second->constCast<IndexCatalogEntry>();
@@ -352,6 +385,16 @@ void Catalog::dropIndex(transaction::Transaction* transaction, common::table_id_
     indexes->dropEntry(transaction, std::move(uniqueName), entry->getOID());
 }
 
+void Catalog::dropIndex(Transaction* transaction, oid_t indexID) const {
+    for (auto& [name, entry] : indexes->getEntries(transaction)) {
+        if (entry->getOID() == indexID) {
+            indexes->dropEntry(transaction, name, indexID);
+            return;
+        }
+    }
+    KU_UNREACHABLE;
+}
+
 void Catalog::addFunction(Transaction* transaction, CatalogEntryType entryType, std::string name,
     function::function_set functionSet) {
     if (functions->containsEntry(transaction, name)) {
@@ -473,6 +516,7 @@ void Catalog::saveToFile(const std::string& directory, VirtualFileSystem* fs,
     sequences->serialize(serializer);
     functions->serialize(serializer);
     types->serialize(serializer);
+    indexes->serialize(serializer);
 }
 
 void Catalog::readFromFile(const std::string& directory, VirtualFileSystem* fs,
@@ -489,7 +533,7 @@ void Catalog::readFromFile(const std::string& directory, VirtualFileSystem* fs,
     sequences = CatalogSet::deserialize(deserializer);
     functions = CatalogSet::deserialize(deserializer);
     types = CatalogSet::deserialize(deserializer);
-    indexes = std::make_unique<CatalogSet>();
+    indexes = CatalogSet::deserialize(deserializer);
 }
 
 void Catalog::registerBuiltInFunctions() {
@@ -1,5 +1,6 @@
 #include "catalog/catalog_entry/catalog_entry.h"
 
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
@@ -51,6 +52,12 @@ std::unique_ptr<CatalogEntry> CatalogEntry::deserialize(common::Deserializer& de
     case CatalogEntryType::TYPE_ENTRY: {
         entry = TypeCatalogEntry::deserialize(deserializer);
     } break;
+    case CatalogEntryType::INDEX_ENTRY: {
+        entry = IndexCatalogEntry::deserialize(deserializer);
+    } break;
+    case CatalogEntryType::PROPERTY_INDEX_ENTRY: {
+        entry = PropertyIndexCatalogEntry::deserialize(deserializer);
+    } break;
     default:
         KU_UNREACHABLE;
     }
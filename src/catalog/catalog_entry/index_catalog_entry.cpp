@@ -0,0 +1,84 @@
+#include "catalog/catalog_entry/index_catalog_entry.h"
+
+#include <cstring>
+
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/buffered_serializer.h"
+
+namespace kuzu {
+namespace catalog {
+
+void IndexCatalogEntry::setAuxInfo(std::unique_ptr<IndexAuxInfo> auxInfo_) {
+    auxInfo = std::move(auxInfo_);
+    auxBuffer.reset();
+    auxBufferSize = 0;
+}
+
+common::Deserializer IndexCatalogEntry::getAuxInfoDeserializer() const {
+    KU_ASSERT(!isLoaded());
+    return common::Deserializer{
+        std::make_unique<common::BufferReader>(auxBuffer.get(), auxBufferSize)};
+}
+
+void IndexCatalogEntry::serialize(common::Serializer& serializer) const {
+    KU_ASSERT(isPersistent());
+    CatalogEntry::serialize(serializer);
+    serializer.writeDebuggingInfo("tableID");
+    serializer.write(tableID);
+    serializer.writeDebuggingInfo("indexName");
+    serializer.write(indexName);
+    serializer.writeDebuggingInfo("indexType");
+    serializer.write(indexType);
+    serializer.writeDebuggingInfo("auxInfo");
+    if (isLoaded()) {
+        auto bufferedWriter = std::make_shared<common::BufferedSerializer>();
+        auto auxSerializer = common::Serializer(bufferedWriter);
+        auxInfo->serialize(auxSerializer);
+        serializer.write<uint64_t>(bufferedWriter->getSize());
+        serializer.write(bufferedWriter->getBlobData(), bufferedWriter->getSize());
+    } else {
+        serializer.write<uint64_t>(auxBufferSize);
+        serializer.write(auxBuffer.get(), auxBufferSize);
+    }
+}
+
+std::unique_ptr<IndexCatalogEntry> IndexCatalogEntry::deserialize(
+    common::Deserializer& deserializer) {
+    std::string debuggingInfo;
+    auto entry = std::make_unique<IndexCatalogEntry>();
+    deserializer.validateDebuggingInfo(debuggingInfo, "tableID");
+    deserializer.deserializeValue(entry->tableID);
+    deserializer.validateDebuggingInfo(debuggingInfo, "indexName");
+    deserializer.deserializeValue(entry->indexName);
+    deserializer.validateDebuggingInfo(debuggingInfo, "indexType");
+    deserializer.deserializeValue(entry->indexType);
+    deserializer.validateDebuggingInfo(debuggingInfo, "auxInfo");
+    deserializer.deserializeValue(entry->auxBufferSize);
+    entry->auxBuffer = std::make_unique<uint8_t[]>(entry->auxBufferSize);
+    deserializer.read(entry->auxBuffer.get(), entry->auxBufferSize);
+    return entry;
+}
+
+std::unique_ptr<IndexCatalogEntry> IndexCatalogEntry::copy() const {
+    auto other = std::make_unique<IndexCatalogEntry>();
+    other->copyFrom(*this);
+    return other;
+}
+
+void IndexCatalogEntry::copyFrom(const CatalogEntry& other) {
+    CatalogEntry::copyFrom(other);
+    auto& otherIndex = other.constCast<IndexCatalogEntry>();
+    tableID = otherIndex.tableID;
+    indexName = otherIndex.indexName;
+    indexType = otherIndex.indexType;
+    auxInfo = otherIndex.auxInfo ? otherIndex.auxInfo->copy() : nullptr;
+    auxBufferSize = otherIndex.auxBufferSize;
+    auxBuffer.reset();
+    if (otherIndex.auxBuffer) {
+        auxBuffer = std::make_unique<uint8_t[]>(auxBufferSize);
+        memcpy(auxBuffer.get(), otherIndex.auxBuffer.get(), auxBufferSize);
+    }
+}
+
+} // namespace catalog
+} // namespace kuzu
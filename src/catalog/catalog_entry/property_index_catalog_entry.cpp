@@ -0,0 +1,51 @@
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
+
+#include "catalog/catalog.h"
+#include "common/serializer/deserializer.h"
+#include "main/client_context.h"
+
+namespace kuzu {
+namespace catalog {
+
+void PropertyIndexCatalogEntry::serialize(common::Serializer& serializer) const {
+    CatalogEntry::serialize(serializer);
+    serializer.writeDebuggingInfo("tableID");
+    serializer.write(tableID);
+    serializer.writeDebuggingInfo("indexName");
+    serializer.write(indexName);
+    serializer.writeDebuggingInfo("propertyName");
+    serializer.write(propertyName);
+}
+
+std::unique_ptr<PropertyIndexCatalogEntry> PropertyIndexCatalogEntry::deserialize(
+    common::Deserializer& deserializer) {
+    std::string debuggingInfo;
+    auto tableID = common::INVALID_TABLE_ID;
+    std::string indexName;
+    std::string propertyName;
+    deserializer.validateDebuggingInfo(debuggingInfo, "tableID");
+    deserializer.deserializeValue(tableID);
+    deserializer.validateDebuggingInfo(debuggingInfo, "indexName");
+    deserializer.deserializeValue(indexName);
+    deserializer.validateDebuggingInfo(debuggingInfo, "propertyName");
+    deserializer.deserializeValue(propertyName);
+    return std::make_unique<PropertyIndexCatalogEntry>(tableID, std::move(indexName),
+        std::move(propertyName));
+}
+
+std::string PropertyIndexCatalogEntry::toCypher(main::ClientContext* clientContext) const {
+    const auto tableName =
+        clientContext->getCatalog()->getTableName(clientContext->getTx(), tableID);
+    return common::stringFormat("CALL CREATE_INDEX('{}', '{}', '{}');", tableName, indexName,
+        propertyName);
+}
+
+std::unique_ptr<IndexCatalogEntry> PropertyIndexCatalogEntry::copy() const {
+    auto other = std::make_unique<PropertyIndexCatalogEntry>();
+    other->copyFrom(*this);
+    other->propertyName = propertyName;
+    return other;
+}
+
+} // namespace catalog
+} // namespace kuzu
@@ -4,6 +4,7 @@
 
 #include "binder/ddl/bound_alter_info.h"
 #include "catalog/catalog_entry/dummy_catalog_entry.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/assert.h"
 #include "common/exception/catalog.h"
@@ -255,6 +256,14 @@ void CatalogSet::serialize(Serializer serializer) const {
         case CatalogEntryType::GDS_FUNCTION_ENTRY:
         case CatalogEntryType::STANDALONE_TABLE_FUNCTION_ENTRY:
             continue;
+        case CatalogEntryType::INDEX_ENTRY: {
+            // Only indexes of extensions that serialize their definition can be recovered.
+            auto committedEntry = getCommittedEntryNoLock(entry.get());
+            if (committedEntry && !committedEntry->isDeleted() &&
+                committedEntry->constCast<IndexCatalogEntry>().isPersistent()) {
+                entriesToSerialize.push_back(committedEntry);
+            }
+        } break;
         default: {
             auto committedEntry = getCommittedEntryNoLock(entry.get());
             if (committedEntry && !committedEntry->isDeleted()) {
@@ -1,12 +1,15 @@
 #include "common/arrow/arrow_row_batch.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "common/exception/runtime.h"
+#include "common/null_buffer.h"
 #include "common/types/uuid.h"
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
 #include "common/types/value/value.h"
+#include "processor/result/factorized_table.h"
 #include "storage/storage_utils.h"
 
 namespace kuzu {
@@ -951,6 +954,184 @@ ArrowArray ArrowRowBatch::toArray() {
     return result;
 }
 
+// Types whose arrow representation is the same as their row layout.
+static bool isFixedWidthType(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::INT128:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_TZ:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ArrowRowBatch::appendCells(ArrowVector* vector, const LogicalType& type,
+    const std::vector<const uint8_t*>& cells) {
+    auto startPos = vector->numValues;
+    auto numCells = cells.size();
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL: {
+        for (auto i = 0u; i < numCells; i++) {
+            if (cells[i] == nullptr) {
+                templateCopyNullValue<LogicalTypeID::BOOL>(vector, startPos + i);
+            } else if (*(bool*)cells[i]) {
+                setBitToOne(vector->data.data(), startPos + i);
+            } else {
+                setBitToZero(vector->data.data(), startPos + i);
+            }
+        }
+    } break;
+    case LogicalTypeID::BLOB:
+    case LogicalTypeID::STRING: {
+        // Compute all offsets first so the overflow buffer is resized only once.
+        auto offsets = (std::uint32_t*)vector->data.data();
+        if (startPos == 0) {
+            offsets[0] = 0;
+        }
+        for (auto i = 0u; i < numCells; i++) {
+            auto pos = startPos + i;
+            if (cells[i] == nullptr) {
+                templateCopyNullValue<LogicalTypeID::STRING>(vector, pos);
+            } else {
+                offsets[pos + 1] = offsets[pos] + ((ku_string_t*)cells[i])->len;
+            }
+        }
+        vector->overflow.resize(offsets[startPos + numCells] + 1);
+        for (auto i = 0u; i < numCells; i++) {
+            if (cells[i] != nullptr) {
+                auto str = (ku_string_t*)cells[i];
+                std::memcpy(vector->overflow.data() + offsets[startPos + i], str->getData(),
+                    str->len);
+            }
+        }
+    } break;
+    default: {
+        if (isFixedWidthType(type)) {
+            auto valSize = LogicalTypeUtils::getRowLayoutSize(type);
+            for (auto i = 0u; i < numCells; i++) {
+                if (cells[i] == nullptr) {
+                    templateCopyNullValue<LogicalTypeID::INT64>(vector, startPos + i);
+                } else {
+                    std::memcpy(vector->data.data() + (startPos + i) * valSize, cells[i], valSize);
+                }
+            }
+            break;
+        }
+        // Types that need a conversion, e.g., INTERVAL and UUID, or that have child vectors go
+        // through a Value.
+        auto value = Value::createDefaultValue(type.copy());
+        for (auto cell : cells) {
+            value.setNull(cell == nullptr);
+            if (cell != nullptr) {
+                value.copyFromRowLayout(cell);
+            }
+            appendValue(vector, type, &value);
+        }
+        return;
+    }
+    }
+    vector->numValues += numCells;
+}
+
+void ArrowRowBatch::appendUnflatColumn(ArrowVector* vector, const LogicalType& type,
+    const uint8_t* values, uint64_t numValues, bool mayContainNulls) {
+    auto valSize = LogicalTypeUtils::getRowLayoutSize(type);
+    auto nullBuffer = values + valSize * numValues;
+    if (isFixedWidthType(type)) {
+        auto startPos = vector->numValues;
+        std::memcpy(vector->data.data() + startPos * valSize, values, numValues * valSize);
+        if (mayContainNulls) {
+            for (auto i = 0u; i < numValues; i++) {
+                if (NullBuffer::isNull(nullBuffer, i)) {
+                    templateCopyNullValue<LogicalTypeID::INT64>(vector, startPos + i);
+                }
+            }
+        }
+        vector->numValues += numValues;
+        return;
+    }
+    std::vector<const uint8_t*> cells(numValues);
+    for (auto i = 0u; i < numValues; i++) {
+        auto isNull = mayContainNulls && NullBuffer::isNull(nullBuffer, i);
+        cells[i] = isNull ? nullptr : values + i * valSize;
+    }
+    appendCells(vector, type, cells);
+}
+
+uint64_t ArrowRowBatch::appendColumnarTuples(processor::FlatTupleIterator& iterator,
+    uint64_t maxNumTuples) {
+    auto& table = iterator.getFactorizedTable();
+    auto schema = table.getTableSchema();
+    KU_ASSERT(schema->getNumColumns() == types.size());
+    auto unflatGroupID = INVALID_IDX;
+    for (auto i = 0u; i < schema->getNumColumns(); i++) {
+        auto column = schema->getColumn(i);
+        if (column->isFlat()) {
+            continue;
+        }
+        if (unflatGroupID == INVALID_IDX) {
+            unflatGroupID = column->getGroupID();
+        } else if (unflatGroupID != column->getGroupID()) {
+            return 0;
+        }
+    }
+    auto tupleIdx = iterator.getNextTupleIdx();
+    std::vector<const uint8_t*> cells;
+    if (unflatGroupID == INVALID_IDX) {
+        // Each tuple is a single flat tuple.
+        auto numTuplesToAppend = std::min({maxNumTuples, table.getNumTuples() - tupleIdx,
+            (uint64_t)DEFAULT_VECTOR_CAPACITY});
+        cells.resize(numTuplesToAppend);
+        for (auto i = 0u; i < schema->getNumColumns(); i++) {
+            for (auto j = 0u; j < numTuplesToAppend; j++) {
+                auto tuple = table.getTuple(tupleIdx + j);
+                auto isNull = table.isNonOverflowColNull(tuple + schema->getNullMapOffset(), i);
+                cells[j] = isNull ? nullptr : tuple + schema->getColOffset(i);
+            }
+            appendCells(vectors[i].get(), types[i], cells);
+        }
+        iterator.skipTuples(numTuplesToAppend);
+        return numTuplesToAppend;
+    }
+    // The flat tuples of the tuple are the values of its unflat columns, each paired with the
+    // values of its flat columns.
+    auto tuple = table.getTuple(tupleIdx);
+    auto numFlatTuples = table.getNumFlatTuples(tupleIdx);
+    if (numFlatTuples == 0 || numFlatTuples > maxNumTuples) {
+        return 0;
+    }
+    for (auto i = 0u; i < schema->getNumColumns(); i++) {
+        if (schema->getColumn(i)->isFlat()) {
+            auto isNull = table.isNonOverflowColNull(tuple + schema->getNullMapOffset(), i);
+            cells.assign(numFlatTuples, isNull ? nullptr : tuple + schema->getColOffset(i));
+            appendCells(vectors[i].get(), types[i], cells);
+        } else {
+            auto overflowValue = (overflow_value_t*)(tuple + schema->getColOffset(i));
+            KU_ASSERT(overflowValue->numElements == numFlatTuples);
+            appendUnflatColumn(vectors[i].get(), types[i], overflowValue->value, numFlatTuples,
+                !table.hasNoNullGuarantee(i));
+        }
+    }
+    iterator.skipTuples(1);
+    return numFlatTuples;
+}
+
 ArrowArray ArrowRowBatch::append(main::QueryResult& queryResult, std::int64_t chunkSize) {
     std::int64_t numTuplesInBatch = 0;
     auto numColumns = queryResult.getColumnNames().size();
@@ -958,6 +1139,14 @@ ArrowArray ArrowRowBatch::append(main::QueryResult& queryResult, std::int64_t ch
         if (!queryResult.hasNext()) {
             break;
         }
+        auto iterator = queryResult.getFlatTupleIterator();
+        if (iterator->isAtTupleBoundary()) {
+            auto numAppended = appendColumnarTuples(*iterator, chunkSize - numTuplesInBatch);
+            if (numAppended > 0) {
+                numTuplesInBatch += numAppended;
+                continue;
+            }
+        }
         auto tuple = queryResult.getNext();
         for (auto i = 0u; i < numColumns; i++) {
             appendValue(vectors[i].get(), types[i], tuple->getValue(i));
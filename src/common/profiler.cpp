@@ -1,8 +1,59 @@
 #include "common/profiler.h"
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <ctime>
+#endif
+
 namespace kuzu {
 namespace common {
 
+static double getThreadCPUTimeMS() {
+#if defined(_WIN32)
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return 0;
+    }
+    auto toTicks = [](const FILETIME& time) {
+        return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    };
+    // FILETIME counts in units of 100ns.
+    return static_cast<double>(toTicks(kernelTime) + toTicks(userTime)) / 10000;
+#else
+    timespec time{};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0) {
+        return 0;
+    }
+    return static_cast<double>(time.tv_sec) * 1000 + static_cast<double>(time.tv_nsec) / 1000000;
+#endif
+}
+
+PipelineThreadTimer::PipelineThreadTimer()
+    : startCPUTimeMS{getThreadCPUTimeMS()}, startMetrics{ThreadMetrics::get()} {
+    // Track the peak of this pipeline only. The peak of an enclosing pipeline executed by the same
+    // thread is restored in finish().
+    ThreadMetrics::get().peakMemoryUsage = startMetrics.memoryUsage;
+    timer.start();
+}
+
+PipelineThreadMetrics PipelineThreadTimer::finish() {
+    timer.stop();
+    auto& metrics = ThreadMetrics::get();
+    PipelineThreadMetrics result;
+    result.wallTimeMS = timer.getDuration() / 1000;
+    result.cpuTimeMS = getThreadCPUTimeMS() - startCPUTimeMS;
+    result.numPins = metrics.numPins - startMetrics.numPins;
+    result.numEvictions = metrics.numEvictions - startMetrics.numEvictions;
+    result.numBytesRead = metrics.numBytesRead - startMetrics.numBytesRead;
+    result.numBytesWritten = metrics.numBytesWritten - startMetrics.numBytesWritten;
+    result.numBytesSpilled = metrics.numBytesSpilled - startMetrics.numBytesSpilled;
+    result.peakMemoryUsage = metrics.peakMemoryUsage - startMetrics.memoryUsage;
+    metrics.peakMemoryUsage =
+        std::max<int64_t>(metrics.peakMemoryUsage, startMetrics.peakMemoryUsage);
+    return result;
+}
+
 TimeMetric* Profiler::registerTimeMetric(const std::string& key) {
     auto timeMetric = std::make_unique<TimeMetric>(enabled);
     auto metricPtr = timeMetric.get();
@@ -39,6 +90,16 @@ uint64_t Profiler::sumAllNumericMetricsWithKey(const std::string& key) {
     return sum;
 }
 
+void Profiler::addPipelineThreadMetrics(uint32_t pipelineID, PipelineThreadMetrics threadMetrics) {
+    std::lock_guard<std::mutex> lck(mtx);
+    pipelineMetrics[pipelineID].threads.push_back(threadMetrics);
+}
+
+void Profiler::addPipelineWallTime(uint32_t pipelineID, double wallTimeMS) {
+    std::lock_guard<std::mutex> lck(mtx);
+    pipelineMetrics[pipelineID].wallTimeMS += wallTimeMS;
+}
+
 void Profiler::addMetric(const std::string& key, std::unique_ptr<Metric> metric) {
     std::lock_guard<std::mutex> lck(mtx);
     if (!metrics.contains(key)) {
@@ -0,0 +1,151 @@
+#include "expression_evaluator/comparison_conjunction_evaluator.h"
+
+#include "common/type_utils.h"
+#include "function/comparison/comparison_functions.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace evaluator {
+
+template<typename T, typename OP>
+static bool compare(const T& value, const T& constant) {
+    uint8_t result = 0;
+    OP::operation(value, constant, result, nullptr /* leftVector */, nullptr /* rightVector */);
+    return result;
+}
+
+// Selected positions are written unconditionally and kept by advancing the output size, so the
+// loops have no data dependent branches. Fixed size values at null positions are compared as well
+// and then dropped, while strings at null positions are not read.
+template<typename T, typename OP>
+static sel_t selectColumn(const ValueVector& column, const ValueVector& constantVector,
+    const SelectionVector& inSelVector, std::span<sel_t> outBuffer) {
+    const auto constant = constantVector.getValue<T>(constantVector.state->getSelVector()[0]);
+    const auto data = reinterpret_cast<const T*>(column.getData());
+    const auto numPositions = inSelVector.getSelSize();
+    sel_t numSelected = 0;
+    if (column.hasNoNullsGuarantee()) {
+        if (inSelVector.isUnfiltered()) {
+            for (sel_t i = 0; i < numPositions; ++i) {
+                outBuffer[numSelected] = i;
+                numSelected += compare<T, OP>(data[i], constant);
+            }
+        } else {
+            for (sel_t i = 0; i < numPositions; ++i) {
+                const auto pos = inSelVector[i];
+                outBuffer[numSelected] = pos;
+                numSelected += compare<T, OP>(data[pos], constant);
+            }
+        }
+    } else {
+        for (sel_t i = 0; i < numPositions; ++i) {
+            const auto pos = inSelVector[i];
+            outBuffer[numSelected] = pos;
+            if constexpr (std::is_same_v<T, ku_string_t>) {
+                numSelected += !column.isNull(pos) && compare<T, OP>(data[pos], constant);
+            } else {
+                numSelected += !column.isNull(pos) & compare<T, OP>(data[pos], constant);
+            }
+        }
+    }
+    return numSelected;
+}
+
+template<typename T>
+static column_select_func_t getSelectFunc(ExpressionType comparisonType) {
+    switch (comparisonType) {
+    case ExpressionType::EQUALS:
+        return selectColumn<T, Equals>;
+    case ExpressionType::NOT_EQUALS:
+        return selectColumn<T, NotEquals>;
+    case ExpressionType::GREATER_THAN:
+        return selectColumn<T, GreaterThan>;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return selectColumn<T, GreaterThanEquals>;
+    case ExpressionType::LESS_THAN:
+        return selectColumn<T, LessThan>;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return selectColumn<T, LessThanEquals>;
+    default:
+        return nullptr;
+    }
+}
+
+column_select_func_t ComparisonConjunctionEvaluator::getSelectFunc(const LogicalType& type,
+    ExpressionType comparisonType) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT128:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::STRING:
+        break;
+    default:
+        return nullptr;
+    }
+    return TypeUtils::visit(
+        type.getPhysicalType(),
+        [&]<typename T>(T) -> column_select_func_t
+            requires(std::is_arithmetic_v<T> || std::is_same_v<T, int128_t> ||
+                     std::is_same_v<T, ku_string_t>)
+        { return evaluator::getSelectFunc<T>(comparisonType); },
+        [](auto) -> column_select_func_t { return nullptr; });
+}
+
+void ComparisonConjunctionEvaluator::init(const processor::ResultSet& resultSet,
+    main::ClientContext* clientContext) {
+    fallbackEvaluator->init(resultSet, clientContext);
+    ExpressionEvaluator::init(resultSet, clientContext);
+}
+
+bool ComparisonConjunctionEvaluator::select(SelectionVector& selVector) {
+    auto& state = *children[comparisons[0].columnIdx]->resultVector->state;
+    if (state.isFlat()) {
+        // All columns are flat, so the tuple is checked without updating selVector. See
+        // FunctionExpressionEvaluator::select.
+        sel_t pos = 0;
+        for (auto& comparison : comparisons) {
+            if (comparison.selectFunc(*children[comparison.columnIdx]->resultVector,
+                    *children[comparison.constantIdx]->resultVector, state.getSelVector(),
+                    std::span<sel_t>(&pos, 1)) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+    // The first comparison reads the positions selected in the data chunk. The following ones
+    // narrow them down in selVector.
+    const SelectionVector* inSelVector = &state.getSelVector();
+    for (auto& comparison : comparisons) {
+        auto numSelected = comparison.selectFunc(*children[comparison.columnIdx]->resultVector,
+            *children[comparison.constantIdx]->resultVector, *inSelVector,
+            selVector.getMutableBuffer());
+        selVector.setToFiltered(numSelected);
+        if (numSelected == 0) {
+            return false;
+        }
+        inSelVector = &selVector;
+    }
+    return true;
+}
+
+void ComparisonConjunctionEvaluator::resolveResultVector(const processor::ResultSet& /*resultSet*/,
+    storage::MemoryManager* /*memoryManager*/) {
+    resultVector = fallbackEvaluator->resultVector;
+    isResultFlat_ = fallbackEvaluator->isResultFlat();
+}
+
+} // namespace evaluator
+} // namespace kuzu
@@ -31,6 +31,9 @@ void ExpressionEvaluatorVisitor::visitSwitch(ExpressionEvaluator* evaluator) {
     case EvaluatorType::REFERENCE: {
         visitReference(evaluator);
     } break;
+    case EvaluatorType::COMPARISON_CONJUNCTION: {
+        visitComparisonConjunction(evaluator);
+    } break;
     default:
         KU_UNREACHABLE;
     }
@@ -57,9 +57,13 @@ void UndirectedRelExpressionEvaluator::evaluate() {
     updateNullPattern(*resultVector, *idVector);
     directionEvaluator->evaluate();
     auto& selVector = resultVector->state->getSelVector();
+    // The direction may be flat while the rel is not, e.g. if it is a hash join payload that was
+    // built in the key chunk.
+    auto isDirectionFlat = directionVector->state->isFlat();
     for (auto i = 0u; i < selVector.getSelSize(); ++i) {
         auto pos = selVector[i];
-        if (!directionVector->getValue<bool>(pos)) {
+        auto directionPos = isDirectionFlat ? directionVector->state->getSelVector()[0] : pos;
+        if (!directionVector->getValue<bool>(directionPos)) {
             continue;
         }
         auto srcID = srcIDVector->getValue<internalID_t>(pos);
@@ -0,0 +1,290 @@
+#include "function/array/array_distance_kernels.h"
+
+#include <cstring>
+
+#include "common/assert.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define KUZU_ARRAY_KERNELS_X86
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#define KUZU_ARRAY_KERNELS_NEON
+#endif
+
+namespace kuzu {
+namespace function {
+
+namespace {
+
+template<typename T>
+struct ScalarKernels {
+    static T innerProduct(const T* left, const T* right, uint64_t numElements) {
+        T result = 0;
+        for (auto i = 0u; i < numElements; i++) {
+            result += left[i] * right[i];
+        }
+        return result;
+    }
+
+    static T squaredDistance(const T* left, const T* right, uint64_t numElements) {
+        T result = 0;
+        for (auto i = 0u; i < numElements; i++) {
+            auto diff = left[i] - right[i];
+            result += diff * diff;
+        }
+        return result;
+    }
+
+    static void cosineTerms(const T* left, const T* right, uint64_t numElements, T& product,
+        T& leftNorm, T& rightNorm) {
+        product = 0;
+        leftNorm = 0;
+        rightNorm = 0;
+        for (auto i = 0u; i < numElements; i++) {
+            auto x = left[i];
+            auto y = right[i];
+            product += x * y;
+            leftNorm += x * x;
+            rightNorm += y * y;
+        }
+    }
+};
+
+#if defined(KUZU_ARRAY_KERNELS_X86) || defined(KUZU_ARRAY_KERNELS_NEON)
+
+#define KUZU_KERNEL_INLINE inline __attribute__((always_inline))
+
+// Vectors only cross function boundaries between always-inlined helpers, so the ABI of passing them
+// by value without the target enabled is irrelevant.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+// The SIMD kernels are written once with GCC/Clang vector extensions and instantiated per
+// register width. They are always inlined into wrappers carrying the target attribute of their
+// instruction set, which is where the actual code generation happens.
+template<typename T, uint64_t BYTES>
+struct SIMDVector {
+    typedef T type __attribute__((vector_size(BYTES)));
+    static constexpr uint64_t NUM_LANES = BYTES / sizeof(T);
+
+    static KUZU_KERNEL_INLINE type load(const T* data) {
+        type result;
+        memcpy(&result, data, BYTES);
+        return result;
+    }
+
+    static KUZU_KERNEL_INLINE T reduce(const type& value) {
+        T result = 0;
+        for (auto i = 0u; i < NUM_LANES; i++) {
+            result += value[i];
+        }
+        return result;
+    }
+};
+
+// The inner product and squared distance kernels keep two independent accumulators to hide the
+// latency of the adds, then handle the remaining full vector and the scalar tail. The cosine kernel
+// already updates three independent accumulators per vector, so it keeps one of each.
+template<typename T, uint64_t BYTES>
+KUZU_KERNEL_INLINE T innerProductSIMD(const T* left, const T* right, uint64_t numElements) {
+    using V = SIMDVector<T, BYTES>;
+    constexpr auto lanes = V::NUM_LANES;
+    typename V::type acc0 = {}, acc1 = {};
+    uint64_t i = 0;
+    for (; i + 2 * lanes <= numElements; i += 2 * lanes) {
+        acc0 += V::load(left + i) * V::load(right + i);
+        acc1 += V::load(left + i + lanes) * V::load(right + i + lanes);
+    }
+    if (i + lanes <= numElements) {
+        acc0 += V::load(left + i) * V::load(right + i);
+        i += lanes;
+    }
+    auto result = V::reduce(acc0 + acc1);
+    for (; i < numElements; i++) {
+        result += left[i] * right[i];
+    }
+    return result;
+}
+
+template<typename T, uint64_t BYTES>
+KUZU_KERNEL_INLINE T squaredDistanceSIMD(const T* left, const T* right, uint64_t numElements) {
+    using V = SIMDVector<T, BYTES>;
+    constexpr auto lanes = V::NUM_LANES;
+    typename V::type acc0 = {}, acc1 = {};
+    uint64_t i = 0;
+    for (; i + 2 * lanes <= numElements; i += 2 * lanes) {
+        auto diff0 = V::load(left + i) - V::load(right + i);
+        auto diff1 = V::load(left + i + lanes) - V::load(right + i + lanes);
+        acc0 += diff0 * diff0;
+        acc1 += diff1 * diff1;
+    }
+    if (i + lanes <= numElements) {
+        auto diff = V::load(left + i) - V::load(right + i);
+        acc0 += diff * diff;
+        i += lanes;
+    }
+    auto result = V::reduce(acc0 + acc1);
+    for (; i < numElements; i++) {
+        auto diff = left[i] - right[i];
+        result += diff * diff;
+    }
+    return result;
+}
+
+template<typename T, uint64_t BYTES>
+KUZU_KERNEL_INLINE void cosineTermsSIMD(const T* left, const T* right, uint64_t numElements,
+    T& product, T& leftNorm, T& rightNorm) {
+    using V = SIMDVector<T, BYTES>;
+    constexpr auto lanes = V::NUM_LANES;
+    typename V::type productAcc = {}, leftAcc = {}, rightAcc = {};
+    uint64_t i = 0;
+    for (; i + lanes <= numElements; i += lanes) {
+        auto x = V::load(left + i);
+        auto y = V::load(right + i);
+        productAcc += x * y;
+        leftAcc += x * x;
+        rightAcc += y * y;
+    }
+    product = V::reduce(productAcc);
+    leftNorm = V::reduce(leftAcc);
+    rightNorm = V::reduce(rightAcc);
+    for (; i < numElements; i++) {
+        auto x = left[i];
+        auto y = right[i];
+        product += x * y;
+        leftNorm += x * x;
+        rightNorm += y * y;
+    }
+}
+
+#define KUZU_DEFINE_SIMD_KERNELS(NAME, TARGET, BYTES)                                              \
+    template<typename T>                                                                           \
+    struct NAME {                                                                                  \
+        TARGET static T innerProduct(const T* left, const T* right, uint64_t numElements) {        \
+            return innerProductSIMD<T, BYTES>(left, right, numElements);                           \
+        }                                                                                          \
+        TARGET static T squaredDistance(const T* left, const T* right, uint64_t numElements) {     \
+            return squaredDistanceSIMD<T, BYTES>(left, right, numElements);                        \
+        }                                                                                          \
+        TARGET static void cosineTerms(const T* left, const T* right, uint64_t numElements,        \
+            T& product, T& leftNorm, T& rightNorm) {                                               \
+            cosineTermsSIMD<T, BYTES>(left, right, numElements, product, leftNorm, rightNorm);     \
+        }                                                                                          \
+    };
+
+#if defined(KUZU_ARRAY_KERNELS_X86)
+KUZU_DEFINE_SIMD_KERNELS(AVX2Kernels, __attribute__((target("avx2,fma"))), 32)
+KUZU_DEFINE_SIMD_KERNELS(AVX512Kernels, __attribute__((target("avx512f"))), 64)
+#else
+// NEON is part of the aarch64 baseline, so no target attribute is needed.
+KUZU_DEFINE_SIMD_KERNELS(NEONKernels, , 16)
+#endif
+
+#undef KUZU_DEFINE_SIMD_KERNELS
+#undef KUZU_KERNEL_INLINE
+#pragma GCC diagnostic pop
+
+#endif
+
+template<template<typename> class KERNELS, typename T>
+constexpr ArrayDistanceKernelSet<T> getKernelSet() {
+    return ArrayDistanceKernelSet<T>{KERNELS<T>::innerProduct, KERNELS<T>::squaredDistance,
+        KERNELS<T>::cosineTerms};
+}
+
+} // namespace
+
+bool ArrayDistanceKernels::isSupported(SIMDLevel level) {
+    switch (level) {
+    case SIMDLevel::SCALAR:
+        return true;
+    case SIMDLevel::NEON: {
+#if defined(KUZU_ARRAY_KERNELS_NEON)
+        return true;
+#else
+        return false;
+#endif
+    }
+    case SIMDLevel::AVX2: {
+#if defined(KUZU_ARRAY_KERNELS_X86)
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+        return false;
+#endif
+    }
+    case SIMDLevel::AVX512: {
+#if defined(KUZU_ARRAY_KERNELS_X86)
+        return __builtin_cpu_supports("avx512f");
+#else
+        return false;
+#endif
+    }
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+SIMDLevel ArrayDistanceKernels::getBestSupportedLevel() {
+    for (auto level : {SIMDLevel::AVX512, SIMDLevel::AVX2, SIMDLevel::NEON}) {
+        if (isSupported(level)) {
+            return level;
+        }
+    }
+    return SIMDLevel::SCALAR;
+}
+
+std::string ArrayDistanceKernels::toString(SIMDLevel level) {
+    switch (level) {
+    case SIMDLevel::SCALAR:
+        return "SCALAR";
+    case SIMDLevel::NEON:
+        return "NEON";
+    case SIMDLevel::AVX2:
+        return "AVX2";
+    case SIMDLevel::AVX512:
+        return "AVX512";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+template<typename T>
+const ArrayDistanceKernelSet<T>& ArrayDistanceKernels::getKernels(SIMDLevel level) {
+    KU_ASSERT(isSupported(level));
+    static constexpr auto scalarKernels = getKernelSet<ScalarKernels, T>();
+#if defined(KUZU_ARRAY_KERNELS_X86)
+    static constexpr auto avx2Kernels = getKernelSet<AVX2Kernels, T>();
+    static constexpr auto avx512Kernels = getKernelSet<AVX512Kernels, T>();
+#elif defined(KUZU_ARRAY_KERNELS_NEON)
+    static constexpr auto neonKernels = getKernelSet<NEONKernels, T>();
+#endif
+    switch (level) {
+#if defined(KUZU_ARRAY_KERNELS_X86)
+    case SIMDLevel::AVX2:
+        return avx2Kernels;
+    case SIMDLevel::AVX512:
+        return avx512Kernels;
+#elif defined(KUZU_ARRAY_KERNELS_NEON)
+    case SIMDLevel::NEON:
+        return neonKernels;
+#endif
+    default:
+        return scalarKernels;
+    }
+}
+
+template<typename T>
+const ArrayDistanceKernelSet<T>& ArrayDistanceKernels::getKernels() {
+    // Resolved once; the CPU capabilities cannot change while the process is running.
+    static const auto& kernels = getKernels<T>(getBestSupportedLevel());
+    return kernels;
+}
+
+template KUZU_API const ArrayDistanceKernelSet<float>& ArrayDistanceKernels::getKernels<float>(
+    SIMDLevel level);
+template KUZU_API const ArrayDistanceKernelSet<double>& ArrayDistanceKernels::getKernels<double>(
+    SIMDLevel level);
+template KUZU_API const ArrayDistanceKernelSet<float>& ArrayDistanceKernels::getKernels<float>();
+template KUZU_API const ArrayDistanceKernelSet<double>& ArrayDistanceKernels::getKernels<double>();
+
+} // namespace function
+} // namespace kuzu
@@ -222,6 +222,8 @@ FunctionCollection* FunctionCollection::getFunctions() {
         STANDALONE_TABLE_FUNCTION(ClearWarningsFunction),
         STANDALONE_TABLE_FUNCTION(CreateProjectGraphFunction),
         STANDALONE_TABLE_FUNCTION(DropProjectGraphFunction),
+        STANDALONE_TABLE_FUNCTION(CreateIndexFunction), STANDALONE_TABLE_FUNCTION(DropIndexFunction),
+        STANDALONE_TABLE_FUNCTION(AnalyzeFunction),
 
         // Scan functions
         TABLE_FUNCTION(ParquetScanFunction), TABLE_FUNCTION(NpyScanFunction),
@@ -0,0 +1,220 @@
+#include <cmath>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/catalog_entry/rel_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_functions.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+#include "storage/store/rel_table.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::catalog;
+
+namespace kuzu {
+namespace function {
+
+struct AnalyzeTask {
+    storage::Table* table;
+    // Direction of the rel table data to compute the degree stats of. Unused for node tables.
+    RelDataDirection direction;
+    node_group_idx_t nodeGroupIdx;
+};
+
+struct AnalyzeBindData : SimpleTableFuncBindData {
+    std::vector<storage::NodeTable*> nodeTables;
+    std::vector<AnalyzeTask> tasks;
+
+    AnalyzeBindData(std::vector<storage::NodeTable*> nodeTables, std::vector<AnalyzeTask> tasks)
+        : SimpleTableFuncBindData{0}, nodeTables{std::move(nodeTables)}, tasks{std::move(tasks)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<AnalyzeBindData>(nodeTables, tasks);
+    }
+};
+
+struct AnalyzeSharedState final : TableFuncSharedState {
+    std::vector<storage::NodeTable*> nodeTables;
+    std::vector<AnalyzeTask> tasks;
+    std::atomic<uint64_t> nextTaskIdx;
+
+    std::mutex mtx;
+    std::unordered_map<table_id_t, storage::TableStats> nodeTableStats;
+    // Number of rows in the sampled node groups of each node table, including deleted ones.
+    std::unordered_map<table_id_t, row_idx_t> numRowsInSampledGroups;
+    std::vector<std::pair<AnalyzeTask, storage::DegreeStats>> degreeStats;
+
+    AnalyzeSharedState(std::vector<storage::NodeTable*> nodeTables,
+        std::vector<AnalyzeTask> tasks)
+        : nodeTables{std::move(nodeTables)}, tasks{std::move(tasks)}, nextTaskIdx{0} {}
+};
+
+static std::unique_ptr<TableFuncSharedState> initSharedState(TableFunctionInitInput& input) {
+    auto bindData = input.bindData->constPtrCast<AnalyzeBindData>();
+    return std::make_unique<AnalyzeSharedState>(bindData->nodeTables, bindData->tasks);
+}
+
+static void analyzeNodeGroup(transaction::Transaction* transaction, const AnalyzeTask& task,
+    AnalyzeSharedState& sharedState) {
+    if (task.table->getTableType() == TableType::NODE) {
+        auto& nodeTable = task.table->cast<storage::NodeTable>();
+        auto stats = nodeTable.computeNodeGroupStats(transaction, task.nodeGroupIdx);
+        auto numRows = nodeTable.getNumTuplesInNodeGroup(task.nodeGroupIdx);
+        std::unique_lock lck{sharedState.mtx};
+        auto tableID = nodeTable.getTableID();
+        if (sharedState.nodeTableStats.contains(tableID)) {
+            sharedState.nodeTableStats.at(tableID).merge(stats);
+        } else {
+            sharedState.nodeTableStats.emplace(tableID, std::move(stats));
+        }
+        sharedState.numRowsInSampledGroups[tableID] += numRows;
+    } else {
+        auto& relTable = task.table->cast<storage::RelTable>();
+        auto stats =
+            relTable.getDirectedTableData(task.direction)->computeDegreeStats(task.nodeGroupIdx);
+        std::unique_lock lck{sharedState.mtx};
+        sharedState.degreeStats.emplace_back(task, std::move(stats));
+    }
+}
+
+static offset_t tableFunc(TableFuncInput& input, TableFuncOutput&) {
+    auto& sharedState = *input.sharedState->ptrCast<AnalyzeSharedState>();
+    auto transaction = input.context->clientContext->getTx();
+    while (true) {
+        auto taskIdx = sharedState.nextTaskIdx.fetch_add(1);
+        if (taskIdx >= sharedState.tasks.size()) {
+            break;
+        }
+        analyzeNodeGroup(transaction, sharedState.tasks[taskIdx], sharedState);
+    }
+    return 0;
+}
+
+static void setNodeTableStats(storage::NodeTable& nodeTable, AnalyzeSharedState& sharedState) {
+    auto tableID = nodeTable.getTableID();
+    if (!sharedState.nodeTableStats.contains(tableID)) {
+        auto types = storage::NodeTable::getNodeTableColumnTypes(nodeTable);
+        nodeTable.setStats(storage::TableStats{types});
+        return;
+    }
+    auto& stats = sharedState.nodeTableStats.at(tableID);
+    // The share of visible rows in the sampled node groups is extrapolated to the whole table.
+    row_idx_t numRows = 0;
+    for (auto i = 0u; i < nodeTable.getNumNodeGroups(); i++) {
+        numRows += nodeTable.getNumTuplesInNodeGroup(i);
+    }
+    auto numRowsInSampledGroups = sharedState.numRowsInSampledGroups.at(tableID);
+    if (numRowsInSampledGroups > 0 && numRowsInSampledGroups < numRows) {
+        auto scale = static_cast<double>(numRows) / static_cast<double>(numRowsInSampledGroups);
+        stats.setCardinality(static_cast<cardinality_t>(
+            std::round(static_cast<double>(stats.getNumSampledRows()) * scale)));
+    }
+    nodeTable.setStats(stats);
+}
+
+static void finalizeFunc(processor::ExecutionContext* context, TableFuncSharedState* state) {
+    auto& sharedState = *state->ptrCast<AnalyzeSharedState>();
+    for (auto nodeTable : sharedState.nodeTables) {
+        setNodeTableStats(*nodeTable, sharedState);
+    }
+    for (auto& [task, stats] : sharedState.degreeStats) {
+        task.table->cast<storage::RelTable>()
+            .getDirectedTableData(task.direction)
+            ->updateDegreeStats(task.nodeGroupIdx, stats, true /* replace */);
+    }
+    // Stats are not versioned, so they are only persisted by a checkpoint.
+    context->clientContext->getTx()->setForceCheckpoint();
+}
+
+// Picks about sampleRate of the node groups, spread evenly over the table and including at least
+// one of them.
+static std::vector<node_group_idx_t> sampleNodeGroups(node_group_idx_t numNodeGroups,
+    double sampleRate) {
+    std::vector<node_group_idx_t> result;
+    for (auto i = 0u; i < numNodeGroups; i++) {
+        if (std::floor((i + 1) * sampleRate) > std::floor(i * sampleRate)) {
+            result.push_back(i);
+        }
+    }
+    if (result.empty() && numNodeGroups > 0) {
+        result.push_back(0);
+    }
+    return result;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    TableFuncBindInput* input) {
+    if (!context->getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{stringFormat("{} is only supported in auto transaction mode.",
+            AnalyzeFunction::name)};
+    }
+    auto catalog = context->getCatalog();
+    std::vector<TableCatalogEntry*> tableEntries;
+    if (input->params.empty()) {
+        for (auto entry : catalog->getNodeTableEntries(context->getTx())) {
+            tableEntries.push_back(entry);
+        }
+        for (auto entry : catalog->getRelTableEntries(context->getTx())) {
+            tableEntries.push_back(entry);
+        }
+    } else {
+        auto tableName = input->getLiteralVal<std::string>(0);
+        if (!catalog->containsTable(context->getTx(), tableName)) {
+            throw BinderException{stringFormat("Table {} does not exist.", tableName)};
+        }
+        auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableName);
+        if (tableEntry->getTableType() != TableType::NODE &&
+            tableEntry->getTableType() != TableType::REL) {
+            throw BinderException{stringFormat("Cannot analyze table {} of type {}.", tableName,
+                TableTypeUtils::toString(tableEntry->getTableType()))};
+        }
+        tableEntries.push_back(tableEntry);
+    }
+    auto sampleRate = context->getClientConfig()->analyzeSampleRate;
+    auto storageManager = context->getStorageManager();
+    std::vector<storage::NodeTable*> nodeTables;
+    std::vector<AnalyzeTask> tasks;
+    for (auto tableEntry : tableEntries) {
+        auto table = storageManager->getTable(tableEntry->getTableID());
+        if (tableEntry->getTableType() == TableType::NODE) {
+            auto& nodeTable = table->cast<storage::NodeTable>();
+            nodeTables.push_back(&nodeTable);
+            for (auto idx : sampleNodeGroups(nodeTable.getNumNodeGroups(), sampleRate)) {
+                tasks.push_back(AnalyzeTask{table, RelDataDirection::FWD, idx});
+            }
+            continue;
+        }
+        auto& relTable = table->cast<storage::RelTable>();
+        for (auto direction : {RelDataDirection::FWD, RelDataDirection::BWD}) {
+            auto numNodeGroups = relTable.getDirectedTableData(direction)->getNumNodeGroups();
+            for (auto idx : sampleNodeGroups(numNodeGroups, sampleRate)) {
+                tasks.push_back(AnalyzeTask{table, direction, idx});
+            }
+        }
+    }
+    return std::make_unique<AnalyzeBindData>(std::move(nodeTables), std::move(tasks));
+}
+
+static std::unique_ptr<TableFunction> getFunction(std::vector<LogicalTypeID> inputTypes) {
+    auto func = std::make_unique<TableFunction>(AnalyzeFunction::name, std::move(inputTypes));
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = initSharedState;
+    func->initLocalStateFunc = SimpleTableFunction::initEmptyLocalState;
+    func->finalizeFunc = finalizeFunc;
+    return func;
+}
+
+function_set AnalyzeFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(getFunction({}));
+    functionSet.push_back(getFunction({LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,108 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_functions.h"
+#include "processor/execution_context.h"
+#include "storage/index/property_index.h"
+#include "storage/storage_manager.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::catalog;
+
+namespace kuzu {
+namespace function {
+
+struct CreateIndexBindData : SimpleTableFuncBindData {
+    table_id_t tableID;
+    std::string indexName;
+    std::string propertyName;
+
+    CreateIndexBindData(table_id_t tableID, std::string indexName, std::string propertyName)
+        : SimpleTableFuncBindData{0}, tableID{tableID}, indexName{std::move(indexName)},
+          propertyName{std::move(propertyName)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CreateIndexBindData>(tableID, indexName, propertyName);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& /*output*/) {
+    auto& bindData = *input.bindData->constPtrCast<CreateIndexBindData>();
+    auto clientContext = input.context->clientContext;
+    auto catalog = clientContext->getCatalog();
+    auto indexEntry = std::make_unique<PropertyIndexCatalogEntry>(bindData.tableID,
+        bindData.indexName, bindData.propertyName);
+    clientContext->getStorageManager()->createPropertyIndex(*catalog, clientContext->getTx(),
+        *indexEntry);
+    catalog->createIndex(clientContext->getTx(), std::move(indexEntry));
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    TableFuncBindInput* input) {
+    if (!context->getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{stringFormat("{} is only supported in auto transaction mode.",
+            CreateIndexFunction::name)};
+    }
+    auto tableName = input->getLiteralVal<std::string>(0);
+    auto indexName = input->getLiteralVal<std::string>(1);
+    auto propertyName = input->getLiteralVal<std::string>(2);
+    auto catalog = context->getCatalog();
+    if (!catalog->containsTable(context->getTx(), tableName)) {
+        throw BinderException{stringFormat("Table {} does not exist.", tableName)};
+    }
+    auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableName);
+    if (tableEntry->getTableType() != TableType::NODE) {
+        throw BinderException{stringFormat(
+            "Table {} is not a node table. Property indexes can only be created on node tables.",
+            tableEntry->getName())};
+    }
+    if (catalog->containsIndex(context->getTx(), tableEntry->getTableID(), indexName)) {
+        throw BinderException{stringFormat("Index {} already exists in table {}.", indexName,
+            tableEntry->getName())};
+    }
+    if (!tableEntry->containsProperty(propertyName)) {
+        throw BinderException{stringFormat("Table {} does not have a property named {}.",
+            tableEntry->getName(), propertyName)};
+    }
+    auto& property = tableEntry->getProperty(propertyName);
+    if (property.getName() == tableEntry->constCast<NodeTableCatalogEntry>().getPrimaryKeyName()) {
+        throw BinderException{stringFormat(
+            "Property {} is the primary key of table {}, which is already indexed.",
+            property.getName(), tableEntry->getName())};
+    }
+    if (!storage::PropertyIndex::isSupported(property.getType().getPhysicalType())) {
+        throw BinderException{stringFormat("Cannot create index on property {} of type {}.",
+            property.getName(), property.getType().toString())};
+    }
+    for (auto indexEntry : catalog->getIndexEntries(context->getTx(), tableEntry->getTableID())) {
+        if (indexEntry->getType() == CatalogEntryType::PROPERTY_INDEX_ENTRY &&
+            indexEntry->constCast<PropertyIndexCatalogEntry>().getPropertyName() ==
+                property.getName()) {
+            throw BinderException{stringFormat("Property {} is already indexed by index {}.",
+                property.getName(), indexEntry->getIndexName())};
+        }
+    }
+    return std::make_unique<CreateIndexBindData>(tableEntry->getTableID(), indexName,
+        property.getName());
+}
+
+function_set CreateIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING,
+            LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = initSharedState;
+    func->initLocalStateFunc = initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
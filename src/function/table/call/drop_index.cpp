@@ -0,0 +1,80 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_functions.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::catalog;
+
+namespace kuzu {
+namespace function {
+
+struct DropIndexBindData : SimpleTableFuncBindData {
+    table_id_t tableID;
+    std::string indexName;
+
+    DropIndexBindData(table_id_t tableID, std::string indexName)
+        : SimpleTableFuncBindData{0}, tableID{tableID}, indexName{std::move(indexName)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<DropIndexBindData>(tableID, indexName);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& /*output*/) {
+    auto& bindData = *input.bindData->constPtrCast<DropIndexBindData>();
+    auto clientContext = input.context->clientContext;
+    // The in-memory index is released at the next checkpoint, as older transactions may still
+    // be scanning it.
+    clientContext->getCatalog()->dropIndex(clientContext->getTx(), bindData.tableID,
+        bindData.indexName);
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    TableFuncBindInput* input) {
+    if (!context->getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{stringFormat("{} is only supported in auto transaction mode.",
+            DropIndexFunction::name)};
+    }
+    auto tableName = input->getLiteralVal<std::string>(0);
+    auto indexName = input->getLiteralVal<std::string>(1);
+    auto catalog = context->getCatalog();
+    if (!catalog->containsTable(context->getTx(), tableName)) {
+        throw BinderException{stringFormat("Table {} does not exist.", tableName)};
+    }
+    auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableName);
+    if (!catalog->containsIndex(context->getTx(), tableEntry->getTableID(), indexName)) {
+        throw BinderException{stringFormat("Table {} doesn't have an index with name {}.",
+            tableEntry->getName(), indexName)};
+    }
+    auto indexEntry = catalog->getIndex(context->getTx(), tableEntry->getTableID(), indexName);
+    if (indexEntry->getType() != CatalogEntryType::PROPERTY_INDEX_ENTRY) {
+        // Indexes created by extensions are dropped through their own functions, which also
+        // remove their auxiliary tables.
+        throw BinderException{stringFormat(
+            "Index {} was not created by CREATE_INDEX and cannot be dropped by {}.", indexName,
+            DropIndexFunction::name)};
+    }
+    return std::make_unique<DropIndexBindData>(tableEntry->getTableID(), indexName);
+}
+
+function_set DropIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = initSharedState;
+    func->initLocalStateFunc = initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -1,9 +1,12 @@
+#include <bit>
+
 #include "binder/binder.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/exception/binder.h"
 #include "function/table/simple_table_functions.h"
 #include "storage/storage_manager.h"
 #include "storage/store/node_table.h"
+#include "storage/store/rel_table.h"
 
 using namespace kuzu::catalog;
 using namespace kuzu::common;
@@ -32,6 +35,64 @@ struct StatsInfoBindData final : SimpleTableFuncBindData {
     }
 };
 
+template<typename T>
+static void setList(ValueVector& vector, const std::vector<T>& values) {
+    auto listEntry = ListVector::addList(&vector, values.size());
+    vector.setValue(0, listEntry);
+    auto dataVector = ListVector::getDataVector(&vector);
+    for (auto i = 0u; i < values.size(); ++i) {
+        dataVector->setValue<T>(listEntry.offset + i, values[i]);
+    }
+}
+
+static void setNodeTableStats(const DataChunk& dataChunk, const storage::TableStats& stats,
+    const std::vector<LogicalType>& columnTypes) {
+    auto vectorIdx = 1u;
+    for (auto i = 0u; i < columnTypes.size(); ++i) {
+        dataChunk.getValueVectorMutable(vectorIdx++).setValue(0, stats.getNumDistinctValues(i));
+        auto& columnStats = stats.getColumnStats(i);
+        dataChunk.getValueVectorMutable(vectorIdx++).setValue(0, columnStats.getNullFraction());
+        if (columnTypes[i].getPhysicalType() == PhysicalTypeID::STRING) {
+            dataChunk.getValueVectorMutable(vectorIdx++).setValue(0,
+                columnStats.getAverageStringLength());
+        }
+        if (storage::Histogram::isSupportedType(columnTypes[i].getPhysicalType())) {
+            setList(dataChunk.getValueVectorMutable(vectorIdx++),
+                columnStats.getHistogram()->getBoundaries());
+        }
+        if (!LogicalTypeUtils::isNested(columnTypes[i])) {
+            std::vector<int64_t> counts;
+            for (auto count : columnStats.getMostCommonValues()->getCounts()) {
+                counts.push_back(count);
+            }
+            setList(dataChunk.getValueVectorMutable(vectorIdx++), counts);
+        }
+    }
+}
+
+static void setRelTableStats(const DataChunk& dataChunk, const storage::RelTable& relTable) {
+    auto vectorIdx = 1u;
+    for (auto direction : {RelDataDirection::FWD, RelDataDirection::BWD}) {
+        auto stats = relTable.getDirectedTableData(direction)->getDegreeStats();
+        dataChunk.getValueVectorMutable(vectorIdx++).setValue<int64_t>(0,
+            stats.getNumBoundNodes());
+        dataChunk.getValueVectorMutable(vectorIdx++).setValue<int64_t>(0, stats.getMaxDegree());
+        // Buckets beyond the max degree are left out.
+        std::vector<int64_t> buckets;
+        auto numBuckets = stats.getMaxDegree() == 0 ? 0 : std::bit_width(stats.getMaxDegree());
+        for (auto i = 0u; i < std::min<uint64_t>(numBuckets, storage::DegreeStats::NUM_BUCKETS);
+             ++i) {
+            buckets.push_back(stats.getBuckets()[i]);
+        }
+        setList(dataChunk.getValueVectorMutable(vectorIdx++), buckets);
+        std::vector<int64_t> topDegrees;
+        for (auto& [_, degree] : stats.getHeavyHitters()) {
+            topDegrees.push_back(degree);
+        }
+        setList(dataChunk.getValueVectorMutable(vectorIdx++), topDegrees);
+    }
+}
+
 static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
     const auto& dataChunk = output.dataChunk;
     KU_ASSERT(dataChunk.state->getSelVector().isUnfiltered());
@@ -46,9 +107,18 @@ static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
         const auto& nodeTable = table->cast<storage::NodeTable>();
         const auto stats = nodeTable.getStats(bindData->context->getTx());
         dataChunk.getValueVectorMutable(0).setValue<cardinality_t>(0, stats.getTableCard());
+        std::vector<LogicalType> columnTypes;
         for (auto i = 0u; i < nodeTable.getNumColumns(); ++i) {
-            dataChunk.getValueVectorMutable(i + 1).setValue(0, stats.getNumDistinctValues(i));
+            columnTypes.push_back(nodeTable.getColumn(i).getDataType().copy());
         }
+        setNodeTableStats(dataChunk, stats, columnTypes);
+        dataChunk.state->getSelVectorUnsafe().setToUnfiltered(1);
+    } break;
+    case TableType::REL: {
+        const auto& relTable = table->cast<storage::RelTable>();
+        dataChunk.getValueVectorMutable(0).setValue<cardinality_t>(0,
+            table->getNumTotalRows(bindData->context->getTx()));
+        setRelTableStats(dataChunk, relTable);
         dataChunk.state->getSelVectorUnsafe().setToUnfiltered(1);
     } break;
     default: {
@@ -67,17 +137,47 @@ static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
     }
     const auto tableID = catalog->getTableID(context->getTx(), tableName);
     auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableID);
-    if (tableEntry->getTableType() != TableType::NODE) {
-        throw BinderException{
-            "Stats from a non-node table " + tableName + " is not supported yet!"};
-    }
-
     std::vector<std::string> columnNames = {"cardinality"};
     std::vector<LogicalType> columnTypes;
     columnTypes.push_back(LogicalType::INT64());
-    for (auto& propDef : tableEntry->getProperties()) {
-        columnNames.push_back(propDef.getName() + "_distinct_count");
-        columnTypes.push_back(LogicalType::INT64());
+    switch (tableEntry->getTableType()) {
+    case TableType::NODE: {
+        for (auto& propDef : tableEntry->getProperties()) {
+            auto& type = propDef.getType();
+            columnNames.push_back(propDef.getName() + "_distinct_count");
+            columnTypes.push_back(LogicalType::INT64());
+            columnNames.push_back(propDef.getName() + "_null_fraction");
+            columnTypes.push_back(LogicalType::DOUBLE());
+            if (type.getPhysicalType() == PhysicalTypeID::STRING) {
+                columnNames.push_back(propDef.getName() + "_avg_string_length");
+                columnTypes.push_back(LogicalType::DOUBLE());
+            }
+            if (storage::Histogram::isSupportedType(type.getPhysicalType())) {
+                columnNames.push_back(propDef.getName() + "_histogram");
+                columnTypes.push_back(LogicalType::LIST(LogicalType::DOUBLE()));
+            }
+            if (!LogicalTypeUtils::isNested(type)) {
+                columnNames.push_back(propDef.getName() + "_most_common_counts");
+                columnTypes.push_back(LogicalType::LIST(LogicalType::INT64()));
+            }
+        }
+    } break;
+    case TableType::REL: {
+        for (auto direction : {"fwd", "bwd"}) {
+            columnNames.push_back(std::string(direction) + "_num_bound_nodes");
+            columnTypes.push_back(LogicalType::INT64());
+            columnNames.push_back(std::string(direction) + "_max_degree");
+            columnTypes.push_back(LogicalType::INT64());
+            columnNames.push_back(std::string(direction) + "_degree_histogram");
+            columnTypes.push_back(LogicalType::LIST(LogicalType::INT64()));
+            columnNames.push_back(std::string(direction) + "_top_degrees");
+            columnTypes.push_back(LogicalType::LIST(LogicalType::INT64()));
+        }
+    } break;
+    default:
+        throw BinderException{"Stats from table " + tableName + " of type " +
+                              TableTypeUtils::toString(tableEntry->getTableType()) +
+                              " is not supported yet!"};
     }
     const auto storageManager = context->getStorageManager();
     auto table = storageManager->getTable(tableID);
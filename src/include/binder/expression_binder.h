@@ -108,7 +108,7 @@ public:
         const parser::ParsedExpression& parsedExpression);
 
     /****** cast *****/
-    std::shared_ptr<Expression> implicitCastIfNecessary(
+    KUZU_API std::shared_ptr<Expression> implicitCastIfNecessary(
         const std::shared_ptr<Expression>& expression, const common::LogicalType& targetType);
     // Use implicitCast to cast to types you have obtained through known implicit casting rules.
     // Use forceCast to cast to types you have obtained through other means, for example,
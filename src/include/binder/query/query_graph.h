@@ -58,6 +58,10 @@ struct SubqueryGraph {
 
     std::vector<common::idx_t> getNbrNodeIndices() const;
 
+    // Unlike the selectors, the unique names of the variables also identify the subgraph when the
+    // statement is bound again.
+    std::string getUniqueName() const;
+
     bool operator==(const SubqueryGraph& other) const {
         return queryRelsSelector == other.queryRelsSelector &&
                queryNodesSelector == other.queryNodesSelector;
@@ -416,6 +416,17 @@ KUZU_C_API void kuzu_connection_interrupt(kuzu_connection* connection);
  */
 KUZU_C_API kuzu_state kuzu_connection_set_query_timeout(kuzu_connection* connection,
     uint64_t timeout_in_ms);
+/**
+ * @brief Sets whether the results of read-only queries are streamed for the connection. A streamed
+ * result is produced in bounded chunks while the query is executing, does not support
+ * kuzu_query_result_get_num_tuples and kuzu_query_result_reset_iterator, and is closed once another
+ * query is executed on the connection.
+ * @param connection The connection instance to set the option for.
+ * @param enable Whether to stream query results.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_connection_set_streaming_results(kuzu_connection* connection,
+    bool enable);
 
 // PreparedStatement
 /**
@@ -1439,6 +1450,12 @@ KUZU_C_API double kuzu_query_summary_get_compiling_time(kuzu_query_summary* quer
  * @param query_summary The query summary to get execution time.
  */
 KUZU_C_API double kuzu_query_summary_get_execution_time(kuzu_query_summary* query_summary);
+/**
+ * @brief Returns the profile of the given query summary as JSON, or an empty string if the query is
+ * not profiled. The returned string must be destroyed with kuzu_destroy_string.
+ * @param query_summary The query summary to get the profile.
+ */
+KUZU_C_API char* kuzu_query_summary_get_profile_json(kuzu_query_summary* query_summary);
 
 // Utility functions
 /**
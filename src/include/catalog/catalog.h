@@ -126,9 +126,14 @@ public:
         std::string indexName) const;
     bool containsIndex(const transaction::Transaction* transaction, common::table_id_t tableID,
         std::string indexName) const;
+    std::vector<IndexCatalogEntry*> getIndexEntries(
+        const transaction::Transaction* transaction) const;
+    std::vector<IndexCatalogEntry*> getIndexEntries(const transaction::Transaction* transaction,
+        common::table_id_t tableID) const;
     void dropAllIndexes(transaction::Transaction* transaction, common::table_id_t tableID);
     void dropIndex(transaction::Transaction* transaction, common::table_id_t tableID,
         std::string indexName) const;
+    void dropIndex(transaction::Transaction* transaction, common::oid_t indexID) const;
 
     // ----------------------------- Functions ----------------------------
     void addFunction(transaction::Transaction* transaction, CatalogEntryType entryType,
@@ -28,6 +28,7 @@ enum class CatalogEntryType : uint8_t {
     TYPE_ENTRY = 41,
     // Index entries
     INDEX_ENTRY = 42,
+    PROPERTY_INDEX_ENTRY = 43,
     // Dummy entry
     DUMMY_ENTRY = 100,
 };
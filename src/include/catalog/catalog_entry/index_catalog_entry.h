@@ -1,10 +1,25 @@
 #pragma once
 
 #include "catalog_entry.h"
+#include "common/serializer/deserializer.h"
 
 namespace kuzu {
 namespace catalog {
 
+// Definition of an index owned by the extension that created it, e.g., the indexed property and
+// the parameters of a vector index.
+struct KUZU_API IndexAuxInfo {
+    virtual ~IndexAuxInfo() = default;
+
+    virtual void serialize(common::Serializer& serializer) const = 0;
+    virtual std::unique_ptr<IndexAuxInfo> copy() const = 0;
+
+    template<class TARGET>
+    const TARGET& cast() const {
+        return common::ku_dynamic_cast<const TARGET&>(*this);
+    }
+};
+
 class KUZU_API IndexCatalogEntry : public CatalogEntry {
 public:
     //===--------------------------------------------------------------------===//
@@ -13,37 +28,60 @@ public:
     IndexCatalogEntry() = default;
 
     IndexCatalogEntry(common::table_id_t tableID, std::string indexName)
-        : CatalogEntry{CatalogEntryType::INDEX_ENTRY,
-              common::stringFormat("{}_{}", tableID, indexName)},
+        : IndexCatalogEntry{CatalogEntryType::INDEX_ENTRY, tableID, std::move(indexName)} {}
+    IndexCatalogEntry(CatalogEntryType entryType, common::table_id_t tableID,
+        std::string indexName)
+        : CatalogEntry{entryType, common::stringFormat("{}_{}", tableID, indexName)},
           tableID{tableID}, indexName{std::move(indexName)} {}
+    // Extension indexes that have an index type are persisted with the catalog, see isPersistent.
+    IndexCatalogEntry(std::string indexType, common::table_id_t tableID, std::string indexName,
+        std::unique_ptr<IndexAuxInfo> auxInfo)
+        : IndexCatalogEntry{tableID, std::move(indexName)} {
+        this->indexType = std::move(indexType);
+        this->auxInfo = std::move(auxInfo);
+    }
 
     common::table_id_t getTableID() const { return tableID; }
+    const std::string& getIndexName() const { return indexName; }
+    const std::string& getIndexType() const { return indexType; }
+
+    // An extension index is persisted if it has an index type. Its aux info is serialized into an
+    // opaque buffer, so that the catalog can be checkpointed and recovered without the extension.
+    // The extension deserializes the buffer with getAuxInfoDeserializer and sets the aux info
+    // when it is loaded. Indexes without an index type (e.g., FTS indexes) are not persisted.
+    bool isPersistent() const {
+        return getType() != CatalogEntryType::INDEX_ENTRY || !indexType.empty();
+    }
+    bool isLoaded() const { return auxInfo != nullptr; }
+    const IndexAuxInfo& getAuxInfo() const {
+        KU_ASSERT(isLoaded());
+        return *auxInfo;
+    }
+    void setAuxInfo(std::unique_ptr<IndexAuxInfo> auxInfo_);
+    common::Deserializer getAuxInfoDeserializer() const;
 
     //===--------------------------------------------------------------------===//
     // serialization & deserialization
     //===--------------------------------------------------------------------===//
-    void serialize(common::Serializer& /*serializer*/) const override {}
+    void serialize(common::Serializer& serializer) const override;
     // TODO(Ziyi/Guodong) : If the database fails with loaded extensions, should we restart the db
     // and reload previously loaded extensions? Currently, we don't have the mechanism to reload
-    // extensions during recovery, thus, we are not able to recover the indexes created by
-    // extensions.
-    static std::unique_ptr<IndexCatalogEntry> deserialize(common::Deserializer& /*deserializer*/) {
-        KU_UNREACHABLE;
-    }
+    // extensions during recovery, thus, only the aux info of persistent indexes is recovered and
+    // it stays serialized until the extension is loaded.
+    static std::unique_ptr<IndexCatalogEntry> deserialize(common::Deserializer& deserializer);
 
     std::string toCypher(main::ClientContext* /*clientContext*/) const override { KU_UNREACHABLE; }
-    virtual std::unique_ptr<IndexCatalogEntry> copy() const = 0;
+    virtual std::unique_ptr<IndexCatalogEntry> copy() const;
 
-    void copyFrom(const CatalogEntry& other) override {
-        CatalogEntry::copyFrom(other);
-        auto& otherTable = other.constCast<IndexCatalogEntry>();
-        tableID = otherTable.tableID;
-        indexName = otherTable.indexName;
-    }
+    void copyFrom(const CatalogEntry& other) override;
 
 protected:
     common::table_id_t tableID = common::INVALID_TABLE_ID;
     std::string indexName;
+    std::string indexType;
+    std::unique_ptr<IndexAuxInfo> auxInfo;
+    std::unique_ptr<uint8_t[]> auxBuffer;
+    uint64_t auxBufferSize = 0;
 };
 
 } // namespace catalog
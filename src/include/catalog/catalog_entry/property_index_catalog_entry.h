@@ -0,0 +1,42 @@
+#pragma once
+
+#include "index_catalog_entry.h"
+
+namespace kuzu {
+namespace catalog {
+
+// Secondary index over a single (non-primary-key) property of a node table. Unlike indexes
+// defined by extensions, property indexes are built into the storage layer and are persisted
+// together with the rest of the catalog.
+class KUZU_API PropertyIndexCatalogEntry final : public IndexCatalogEntry {
+public:
+    //===--------------------------------------------------------------------===//
+    // constructors
+    //===--------------------------------------------------------------------===//
+    PropertyIndexCatalogEntry() = default;
+    PropertyIndexCatalogEntry(common::table_id_t tableID, std::string indexName,
+        std::string propertyName)
+        : IndexCatalogEntry{CatalogEntryType::PROPERTY_INDEX_ENTRY, tableID, std::move(indexName)},
+          propertyName{std::move(propertyName)} {}
+
+    //===--------------------------------------------------------------------===//
+    // getter & setter
+    //===--------------------------------------------------------------------===//
+    const std::string& getPropertyName() const { return propertyName; }
+
+    //===--------------------------------------------------------------------===//
+    // serialization & deserialization
+    //===--------------------------------------------------------------------===//
+    void serialize(common::Serializer& serializer) const override;
+    static std::unique_ptr<PropertyIndexCatalogEntry> deserialize(
+        common::Deserializer& deserializer);
+
+    std::string toCypher(main::ClientContext* clientContext) const override;
+    std::unique_ptr<IndexCatalogEntry> copy() const override;
+
+private:
+    std::string propertyName;
+};
+
+} // namespace catalog
+} // namespace kuzu
@@ -55,6 +55,19 @@ private:
         std::int64_t capacity);
     static void appendValue(ArrowVector* vector, const LogicalType& type, Value* value);
 
+    // Appends whole tuples of the factorized table behind the iterator column by column, reading
+    // the values from its row layout instead of materializing each flat tuple as Values. Returns the
+    // number of flat tuples appended, or 0 if the tuples have to be appended row by row, e.g.,
+    // because their flat tuples are a cross product of more than one unflat group.
+    uint64_t appendColumnarTuples(processor::FlatTupleIterator& iterator, uint64_t maxNumTuples);
+    // Appends the given row layout cells, where a nullptr cell is a null value.
+    static void appendCells(ArrowVector* vector, const LogicalType& type,
+        const std::vector<const uint8_t*>& cells);
+    // Appends the values of an unflat column, which are stored contiguously followed by their null
+    // bitmap.
+    static void appendUnflatColumn(ArrowVector* vector, const LogicalType& type,
+        const uint8_t* values, uint64_t numValues, bool mayContainNulls);
+
     static ArrowArray* convertVectorToArray(ArrowVector& vector, const LogicalType& type);
     static ArrowArray* convertStructVectorToArray(ArrowVector& vector, const LogicalType& type);
     static ArrowArray* convertInternalIDVectorToArray(ArrowVector& vector, const LogicalType& type);
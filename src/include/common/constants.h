@@ -188,6 +188,9 @@ struct PlannerKnobs {
     static constexpr double NON_EQUALITY_PREDICATE_SELECTIVITY = 0.1;
     static constexpr double EQUALITY_PREDICATE_SELECTIVITY = 0.01;
     static constexpr uint64_t BUILD_PENALTY = 2;
+    // Looking up the adjacency list of a node that is not scanned in node offset order reads the
+    // CSR at random instead of sequentially.
+    static constexpr uint64_t RANDOM_LOOKUP_PENALTY = 4;
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
@@ -27,7 +27,7 @@ public:
         : valueVectors(numValueVectors), state{state} {};
     DELETE_COPY_DEFAULT_MOVE(DataChunk);
 
-    void insert(uint32_t pos, std::shared_ptr<ValueVector> valueVector);
+    KUZU_API void insert(uint32_t pos, std::shared_ptr<ValueVector> valueVector);
 
     void resetAuxiliaryBuffer();
 
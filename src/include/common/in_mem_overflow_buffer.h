@@ -50,7 +50,7 @@ public:
     // Releases all memory accumulated for string overflows so far and re-initializes its state to
     // an empty buffer. If there is a large string that used point to any of these overflow buffers
     // they will error.
-    void resetBuffer();
+    KUZU_API void resetBuffer();
 
 private:
     bool requireNewBlock(uint64_t sizeToAllocate) {
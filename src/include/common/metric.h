@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+
 #include "common/timer.h"
 
 namespace kuzu {
@@ -48,5 +51,34 @@ public:
     uint64_t accumulatedValue;
 };
 
+/**
+ * Resources used by the current thread, counted by the buffer manager, the memory manager and the
+ * spiller whether or not a query is profiled. Counters are thread local so that keeping them up to
+ * date costs no synchronization.
+ */
+struct ThreadMetrics {
+    uint64_t numPins = 0;
+    uint64_t numEvictions = 0;
+    uint64_t numBytesRead = 0;
+    uint64_t numBytesWritten = 0;
+    uint64_t numBytesSpilled = 0;
+    // Memory allocated by the memory manager minus memory freed. Buffers are often freed by another
+    // thread than the one that allocated them, so only differences between two points in time of
+    // the same thread are meaningful.
+    int64_t memoryUsage = 0;
+    int64_t peakMemoryUsage = 0;
+
+    void allocateMemory(uint64_t size) {
+        memoryUsage += static_cast<int64_t>(size);
+        peakMemoryUsage = std::max<int64_t>(peakMemoryUsage, memoryUsage);
+    }
+    void freeMemory(uint64_t size) { memoryUsage -= static_cast<int64_t>(size); }
+
+    static ThreadMetrics& get() {
+        static thread_local ThreadMetrics metrics;
+        return metrics;
+    }
+};
+
 } // namespace common
 } // namespace kuzu
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -10,6 +11,40 @@
 namespace kuzu {
 namespace common {
 
+// Share of a pipeline executed by one thread.
+struct PipelineThreadMetrics {
+    double wallTimeMS = 0;
+    double cpuTimeMS = 0;
+    uint64_t numPins = 0;
+    uint64_t numEvictions = 0;
+    uint64_t numBytesRead = 0;
+    uint64_t numBytesWritten = 0;
+    uint64_t numBytesSpilled = 0;
+    // Highest amount of memory allocated by the thread on top of what it held when it started
+    // executing the pipeline.
+    uint64_t peakMemoryUsage = 0;
+};
+
+struct PipelineMetrics {
+    // From the initialization of the pipeline's shared state to its finalization.
+    double wallTimeMS = 0;
+    std::vector<PipelineThreadMetrics> threads;
+};
+
+// Measures the thread metrics of the calling thread between its construction and finish(). Must be
+// finished on the thread that constructed it.
+class PipelineThreadTimer {
+public:
+    PipelineThreadTimer();
+
+    PipelineThreadMetrics finish();
+
+private:
+    Timer timer;
+    double startCPUTimeMS;
+    ThreadMetrics startMetrics;
+};
+
 class Profiler {
 
 public:
@@ -21,6 +56,10 @@ public:
 
     uint64_t sumAllNumericMetricsWithKey(const std::string& key);
 
+    // Pipelines are identified by the operator ID of their sink.
+    void addPipelineThreadMetrics(uint32_t pipelineID, PipelineThreadMetrics threadMetrics);
+    void addPipelineWallTime(uint32_t pipelineID, double wallTimeMS);
+
 private:
     void addMetric(const std::string& key, std::unique_ptr<Metric> metric);
 
@@ -28,6 +67,7 @@ public:
     std::mutex mtx;
     bool enabled = false;
     std::unordered_map<std::string, std::vector<std::unique_ptr<Metric>>> metrics;
+    std::map<uint32_t, PipelineMetrics> pipelineMetrics;
 };
 
 } // namespace common
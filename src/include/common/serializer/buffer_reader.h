@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstring>
+
+#include "common/assert.h"
+#include "common/serializer/reader.h"
+
+namespace kuzu {
+namespace common {
+
+// Reads from an in-memory buffer, e.g., one written by a BufferedSerializer. The buffer is not
+// owned and must outlive the reader.
+class BufferReader final : public Reader {
+public:
+    BufferReader(const uint8_t* data, uint64_t size) : data{data}, size{size}, readSize{0} {}
+
+    void read(uint8_t* outputData, uint64_t outputSize) override {
+        KU_ASSERT(readSize + outputSize <= size);
+        memcpy(outputData, data + readSize, outputSize);
+        readSize += outputSize;
+    }
+
+    bool finished() override { return readSize >= size; }
+
+private:
+    const uint8_t* data;
+    uint64_t size;
+    uint64_t readSize;
+};
+
+} // namespace common
+} // namespace kuzu
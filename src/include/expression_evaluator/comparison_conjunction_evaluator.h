@@ -0,0 +1,62 @@
+#pragma once
+
+#include "expression_evaluator.h"
+
+namespace kuzu {
+namespace evaluator {
+
+// Selects positions of the column whose value compares true with the constant at position 0. Input
+// positions are read from inSelVector and selected ones are written to outBuffer, which may be the
+// buffer of inSelVector. Returns the number of selected positions.
+using column_select_func_t = common::sel_t (*)(const common::ValueVector& column,
+    const common::ValueVector& constant, const common::SelectionVector& inSelVector,
+    std::span<common::sel_t> outBuffer);
+
+struct ColumnComparison {
+    // Children of the evaluator that are compared, i.e. a reference and a literal.
+    common::idx_t columnIdx;
+    common::idx_t constantIdx;
+    column_select_func_t selectFunc;
+};
+
+// ComparisonConjunctionEvaluator evaluates conjunctions of comparisons between a column and a
+// constant, e.g. a.x > 5 AND a.y = 'foo', where all columns are in the same data chunk. Comparisons
+// are applied one after another, each to the positions selected by the previous ones, through a
+// kernel specialized for the column type and comparison. Evaluating to a boolean vector, e.g. in a
+// projection, falls back to the function evaluator of the conjunction.
+class ComparisonConjunctionEvaluator final : public ExpressionEvaluator {
+    static constexpr EvaluatorType type_ = EvaluatorType::COMPARISON_CONJUNCTION;
+
+public:
+    ComparisonConjunctionEvaluator(std::shared_ptr<binder::Expression> expression,
+        evaluator_vector_t children, std::vector<ColumnComparison> comparisons,
+        std::unique_ptr<ExpressionEvaluator> fallbackEvaluator)
+        : ExpressionEvaluator{type_, std::move(expression), std::move(children)},
+          comparisons{std::move(comparisons)}, fallbackEvaluator{std::move(fallbackEvaluator)} {}
+
+    // Returns nullptr if comparing columns of the type has no kernel.
+    static column_select_func_t getSelectFunc(const common::LogicalType& type,
+        common::ExpressionType comparisonType);
+
+    void init(const processor::ResultSet& resultSet, main::ClientContext* clientContext) override;
+
+    void evaluate() override { fallbackEvaluator->evaluate(); }
+
+    bool select(common::SelectionVector& selVector) override;
+
+    std::unique_ptr<ExpressionEvaluator> clone() override {
+        return std::make_unique<ComparisonConjunctionEvaluator>(expression, cloneVector(children),
+            comparisons, fallbackEvaluator->clone());
+    }
+
+protected:
+    void resolveResultVector(const processor::ResultSet& resultSet,
+        storage::MemoryManager* memoryManager) override;
+
+private:
+    std::vector<ColumnComparison> comparisons;
+    std::unique_ptr<ExpressionEvaluator> fallbackEvaluator;
+};
+
+} // namespace evaluator
+} // namespace kuzu
@@ -20,6 +20,7 @@ enum class EvaluatorType : uint8_t {
     PATH = 5,
     NODE_REL = 6,
     REFERENCE = 8,
+    COMPARISON_CONJUNCTION = 9,
 };
 
 class ExpressionEvaluator;
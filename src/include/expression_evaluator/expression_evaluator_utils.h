@@ -8,7 +8,7 @@ namespace kuzu {
 namespace evaluator {
 
 struct ExpressionEvaluatorUtils {
-    static common::Value evaluateConstantExpression(std::shared_ptr<binder::Expression> expression,
+    static KUZU_API common::Value evaluateConstantExpression(std::shared_ptr<binder::Expression> expression,
         main::ClientContext* clientContext);
 };
 
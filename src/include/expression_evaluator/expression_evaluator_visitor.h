@@ -19,6 +19,7 @@ protected:
     virtual void visitLiteral(ExpressionEvaluator*) {}
     virtual void visitPath(ExpressionEvaluator*) {}
     virtual void visitReference(ExpressionEvaluator*) {}
+    virtual void visitComparisonConjunction(ExpressionEvaluator*) {}
     // NOTE: If one decides to overwrite pattern evaluator visitor, make sure we differentiate
     // pattern evaluator and undirected rel evaluator.
     void visitPattern(ExpressionEvaluator*) {}
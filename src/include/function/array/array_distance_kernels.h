@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "common/api.h"
+
+namespace kuzu {
+namespace function {
+
+enum class SIMDLevel : uint8_t {
+    SCALAR = 0,
+    NEON = 1,
+    AVX2 = 2,
+    AVX512 = 3,
+};
+
+// Reductions over two arrays of numElements values each.
+template<typename T>
+struct ArrayDistanceKernelSet {
+    T (*innerProduct)(const T* left, const T* right, uint64_t numElements);
+    T (*squaredDistance)(const T* left, const T* right, uint64_t numElements);
+    // Computes the inner product and the squared norms of both arrays in a single pass.
+    void (*cosineTerms)(const T* left, const T* right, uint64_t numElements, T& product,
+        T& leftNorm, T& rightNorm);
+};
+
+// FLOAT and DOUBLE distance kernels used by the array distance functions and vector indexes. The
+// SIMD variants are compiled for their target instruction set regardless of the build flags and
+// are selected at runtime based on the capabilities of the CPU. The SCALAR kernels are the
+// reference implementation and accumulate in element order.
+struct KUZU_API ArrayDistanceKernels {
+    // Returns true if the build contains kernels for the level and the CPU can run them.
+    static bool isSupported(SIMDLevel level);
+    static SIMDLevel getBestSupportedLevel();
+    static std::string toString(SIMDLevel level);
+
+    template<typename T>
+    static const ArrayDistanceKernelSet<T>& getKernels(SIMDLevel level);
+    // Kernels of the best supported level.
+    template<typename T>
+    static const ArrayDistanceKernelSet<T>& getKernels();
+};
+
+} // namespace function
+} // namespace kuzu
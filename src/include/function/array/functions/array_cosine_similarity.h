@@ -3,6 +3,7 @@
 #include "math.h"
 
 #include "common/vector/value_vector.h"
+#include "function/array/array_distance_kernels.h"
 
 namespace kuzu {
 namespace function {
@@ -17,13 +18,8 @@ struct ArrayCosineSimilarity {
         T distance = 0;
         T normLeft = 0;
         T normRight = 0;
-        for (auto i = 0u; i < left.size; i++) {
-            auto x = leftElements[i];
-            auto y = rightElements[i];
-            distance += x * y;
-            normLeft += x * x;
-            normRight += y * y;
-        }
+        ArrayDistanceKernels::getKernels<T>().cosineTerms(leftElements, rightElements, left.size,
+            distance, normLeft, normRight);
         auto similarity = distance / (std::sqrt(normLeft) * std::sqrt(normRight));
         result = std::max(static_cast<T>(-1), std::min(similarity, static_cast<T>(1)));
     }
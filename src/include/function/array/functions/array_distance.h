@@ -3,6 +3,7 @@
 #include "math.h"
 
 #include "common/vector/value_vector.h"
+#include "function/array/array_distance_kernels.h"
 
 namespace kuzu {
 namespace function {
@@ -14,12 +15,8 @@ struct ArrayDistance {
         common::ValueVector& /*resultVector*/) {
         auto leftElements = (T*)common::ListVector::getListValues(&leftVector, left);
         auto rightElements = (T*)common::ListVector::getListValues(&rightVector, right);
-        result = 0;
-        for (auto i = 0u; i < left.size; i++) {
-            auto diff = leftElements[i] - rightElements[i];
-            result += diff * diff;
-        }
-        result = std::sqrt(result);
+        result = std::sqrt(ArrayDistanceKernels::getKernels<T>().squaredDistance(leftElements,
+            rightElements, left.size));
     }
 };
 
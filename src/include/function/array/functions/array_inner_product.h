@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/vector/value_vector.h"
+#include "function/array/array_distance_kernels.h"
 
 namespace kuzu {
 namespace function {
@@ -12,10 +13,8 @@ struct ArrayInnerProduct {
         common::ValueVector& /*resultVector*/) {
         auto leftElements = (T*)common::ListVector::getListValues(&leftVector, left);
         auto rightElements = (T*)common::ListVector::getListValues(&rightVector, right);
-        result = 0;
-        for (auto i = 0u; i < left.size; i++) {
-            result += leftElements[i] * rightElements[i];
-        }
+        result = ArrayDistanceKernels::getKernels<T>().innerProduct(leftElements, rightElements,
+            left.size);
     }
 };
 
@@ -144,5 +144,23 @@ struct DropProjectGraphFunction : public SimpleTableFunction {
     static function_set getFunctionSet();
 };
 
+struct CreateIndexFunction : public SimpleTableFunction {
+    static constexpr const char* name = "CREATE_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropIndexFunction : public SimpleTableFunction {
+    static constexpr const char* name = "DROP_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct AnalyzeFunction : public SimpleTableFunction {
+    static constexpr const char* name = "ANALYZE";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
@@ -95,6 +95,10 @@ public:
             return std::span(reinterpret_cast<const T*>(propertyVectors[propertyIndex]->getData()),
                 nodeIDs.size());
         }
+        // Nested properties (e.g. ARRAY) can't be exposed as a span of values.
+        const common::ValueVector& getPropertyVector(size_t propertyIndex) const {
+            return *propertyVectors[propertyIndex];
+        }
 
     private:
         Chunk(std::span<const common::nodeID_t> nodeIDs,
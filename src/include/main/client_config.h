@@ -22,6 +22,12 @@ struct ClientConfigDefault {
     static constexpr bool DISABLE_MAP_KEY_CHECK = true;
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
     static constexpr bool ENABLE_PLAN_OPTIMIZER = true;
+    static constexpr bool ENABLE_STREAMING_RESULTS = false;
+    static constexpr bool PROFILE_JSON = false;
+    static constexpr double PROFILE_SAMPLE_RATE = 0;
+    static constexpr double ANALYZE_SAMPLE_RATE = 1;
+    static constexpr double REOPTIMIZATION_THRESHOLD = 100;
+    static constexpr uint64_t JOIN_ORDER_BUDGET = 4096;
 };
 
 struct ClientConfig {
@@ -53,6 +59,21 @@ struct ClientConfig {
     uint64_t warningLimit = ClientConfigDefault::WARNING_LIMIT;
     bool disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
     bool enablePlanOptimizer = ClientConfigDefault::ENABLE_PLAN_OPTIMIZER;
+    // If streaming the results of read-only queries instead of materializing them.
+    bool enableStreamingResults = ClientConfigDefault::ENABLE_STREAMING_RESULTS;
+    // If PROFILE returns the profile as JSON instead of a printed plan.
+    bool profileJson = ClientConfigDefault::PROFILE_JSON;
+    // Fraction of queries other than PROFILE that are profiled. Their profile is available in JSON
+    // from the query summary.
+    double profileSampleRate = ClientConfigDefault::PROFILE_SAMPLE_RATE;
+    // Fraction of the node groups of each table that ANALYZE computes statistics from.
+    double analyzeSampleRate = ClientConfigDefault::ANALYZE_SAMPLE_RATE;
+    // A read-only query is planned again once a hash join build turns out this many times larger
+    // or smaller than estimated. 0 disables re-optimization.
+    double reoptimizationThreshold = ClientConfigDefault::REOPTIMIZATION_THRESHOLD;
+    // Join order is planned exactly if a query graph has at most this many csg-cmp pairs, i.e.
+    // pairs of connected subgraphs that can be joined, and greedily otherwise.
+    uint64_t joinOrderBudget = ClientConfigDefault::JOIN_ORDER_BUDGET;
 };
 
 } // namespace main
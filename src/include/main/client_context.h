@@ -33,7 +33,8 @@ struct ExtensionOptions;
 
 namespace processor {
 class ImportDB;
-}
+class AdaptiveExecutionState;
+} // namespace processor
 
 namespace graph {
 class GraphEntrySet;
@@ -44,6 +45,7 @@ struct DBConfig;
 class Database;
 class DatabaseManager;
 class AttachedKuzuDatabase;
+class ResultStream;
 struct SpillToDiskSetting;
 
 struct ActiveQuery {
@@ -64,6 +66,7 @@ class KUZU_API ClientContext {
     friend class binder::ExpressionBinder;
     friend class processor::ImportDB;
     friend struct main::SpillToDiskSetting;
+    friend class main::ResultStream;
 
 public:
     explicit ClientContext(Database* database);
@@ -86,6 +89,10 @@ public:
     uint64_t getTimeoutRemainingInMS() const;
     void resetActiveQuery() { activeQuery.reset(); }
 
+    // Streaming results
+    void setStreamingResults(bool enable);
+    bool isStreamingResults() const;
+
     // Parallelism
     void setMaxNumThreadForExec(uint64_t numThreads);
     uint64_t getMaxNumThreadForExec() const;
@@ -143,6 +150,11 @@ public:
 
     graph::GraphEntrySet& getGraphEntrySetUnsafe();
 
+    // Only set while a statement that can be re-optimized is executed.
+    processor::AdaptiveExecutionState* getAdaptiveExecutionState() const {
+        return adaptiveExecutionState.get();
+    }
+
     void cleanUP();
 
     std::unique_ptr<QueryResult> queryInternal(std::string_view query, std::string_view encodedJoin,
@@ -178,6 +190,12 @@ private:
 
     std::unique_ptr<QueryResult> executeNoLock(PreparedStatement* preparedStatement,
         uint32_t planIdx = 0u, std::optional<uint64_t> queryID = std::nullopt);
+    // Returns nullptr if the execution was aborted to re-optimize the statement.
+    std::unique_ptr<QueryResult> executePlanNoLock(PreparedStatement* preparedStatement,
+        uint32_t planIdx, std::optional<uint64_t> queryID);
+    // Read-only queries with a single plan are planned again if a hash join build turns out far
+    // larger or smaller than estimated.
+    bool canReoptimizeNoLock(PreparedStatement* preparedStatement, uint32_t planIdx) const;
 
     bool canExecuteWriteQuery();
 
@@ -186,6 +204,20 @@ private:
     std::unique_ptr<QueryResult> handleFailedExecution(
         processor::ExecutionContext* executionContext, std::exception& e);
 
+    // Decides whether a query other than PROFILE is profiled, according to profile_sample_rate.
+    bool sampleProfileNoLock();
+
+    // Results of the last statement of a query are streamed if streaming is enabled and the
+    // statement is a read-only query.
+    bool canStreamNoLock(PreparedStatement* preparedStatement) const;
+    std::unique_ptr<QueryResult> executeStreamingNoLock(
+        std::unique_ptr<PreparedStatement> preparedStatement,
+        std::optional<uint64_t> queryID = std::nullopt);
+    // A connection has at most one active result stream, which is finished before any other
+    // statement is prepared or executed on the connection.
+    void finishActiveStreamNoLock();
+    void finishStream(ResultStream* stream);
+
     // Client side configurable settings.
     ClientConfig clientConfig;
     // Database configurable settings.
@@ -210,6 +242,10 @@ private:
     processor::WarningContext warningContext;
     // Graph entries
     std::unique_ptr<graph::GraphEntrySet> graphEntrySet;
+    // Result stream of the last streamed query, if it is not finished yet.
+    ResultStream* activeStream;
+    // Runtime feedback of the statement being executed, if it can be re-optimized.
+    std::unique_ptr<processor::AdaptiveExecutionState> adaptiveExecutionState;
     std::mutex mtx;
 };
 
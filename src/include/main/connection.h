@@ -88,6 +88,14 @@ public:
      */
     KUZU_API void setQueryTimeOut(uint64_t timeoutInMS);
 
+    /**
+     * @brief sets whether the results of read-only queries are streamed. A streamed result is
+     * produced in bounded chunks while the query is executing instead of being materialized before
+     * the query returns. It does not support getNumTuples() and resetIterator(), and it is closed
+     * once another query is executed on the connection. Disabled by default.
+     */
+    KUZU_API void setStreamingResults(bool enable);
+
     // Note: this function throws exception if creating scalar function fails.
     template<typename TR, typename... Args>
     void createScalarFunction(std::string name, TR (*udfFunc)(Args...)) {
@@ -82,6 +82,7 @@ class Database {
     friend class EmbeddedShell;
     friend class ClientContext;
     friend class Connection;
+    friend class ResultStream;
     friend class StorageDriver;
     friend class testing::BaseGraphTest;
     friend class testing::PrivateGraphTest;
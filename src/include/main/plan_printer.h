@@ -102,6 +102,11 @@ struct PlanPrinter {
         common::Profiler* profiler);
     static std::ostringstream printPlanToOstream(const processor::PhysicalPlan* physicalPlan,
         common::Profiler* profiler);
+    // The profiled plan together with the wall time, CPU time, thread skew, buffer manager and I/O
+    // counters and peak memory usage of each pipeline, serialized as JSON. A negative indent
+    // serializes it on a single line.
+    static std::string printProfileToJson(const processor::PhysicalPlan* physicalPlan,
+        common::Profiler* profiler, int indent = -1);
     static std::string getOperatorName(const processor::PhysicalOperator* physicalOperator);
     static std::string getOperatorParams(const processor::PhysicalOperator* physicalOperator);
 
@@ -113,6 +118,7 @@ struct PlanPrinter {
 private:
     static nlohmann::json toJson(const processor::PhysicalOperator* physicalOperator,
         common::Profiler& profiler_);
+    static nlohmann::json toJson(const common::PipelineThreadMetrics& threadMetrics);
     static nlohmann::json toJson(const planner::LogicalOperator* logicalOperator);
 };
 
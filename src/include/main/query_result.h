@@ -12,6 +12,8 @@
 namespace kuzu {
 namespace main {
 
+class ResultStream;
+
 /**
  * @brief QueryResult stores the result of a query execution.
  */
@@ -72,7 +74,7 @@ public:
      */
     KUZU_API std::vector<common::LogicalType> getColumnDataTypes() const;
     /**
-     * @return num of tuples in query result.
+     * @return num of tuples in query result. Not available if the result is streamed.
      */
     KUZU_API uint64_t getNumTuples() const;
     /**
@@ -104,11 +106,20 @@ public:
     KUZU_API std::string toString();
 
     /**
-     * @brief Resets the result tuple iterator.
+     * @brief Resets the result tuple iterator. Not available if the result is streamed.
      */
     KUZU_API void resetIterator();
 
+    /**
+     * @return whether the tuples of the query result are streamed while the query is executing
+     * instead of being materialized before the query returns.
+     */
+    KUZU_API bool isStreaming() const;
+
     processor::FactorizedTable* getTable() { return factorizedTable.get(); }
+    // Returns the iterator over the tuples that have not been read yet. For a streaming result, the
+    // iterator changes between chunks, so it is only valid after hasNext() returned true.
+    processor::FlatTupleIterator* getFlatTupleIterator();
 
     /**
      * @brief Returns the arrow schema of the query result.
@@ -136,6 +147,9 @@ private:
     void setColumnHeader(std::vector<std::string> columnNames,
         std::vector<common::LogicalType> columnTypes);
     void initResultTableAndIterator(std::shared_ptr<processor::FactorizedTable> factorizedTable_);
+    void initResultStream(std::unique_ptr<ResultStream> stream_);
+    std::vector<common::Value*> initTuple();
+    void validateNotStreaming(const std::string& functionName) const;
     void validateQuerySucceed() const;
 
 private:
@@ -156,6 +170,10 @@ private:
 
     // query iterator
     QueryResultIterator queryResultIterator;
+
+    // Declared last so the stream is finished before the tuple and summary it writes to are
+    // destroyed.
+    std::unique_ptr<ResultStream> stream;
 };
 
 } // namespace main
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "common/api.h"
 #include "kuzu_fwd.h"
 
@@ -19,6 +21,7 @@ struct PreparedSummary { // NOLINT(*-pro-type-member-init)
  */
 class QuerySummary {
     friend class ClientContext;
+    friend class ResultStream;
     friend class benchmark::Benchmark;
 
 public:
@@ -30,6 +33,17 @@ public:
      * @return query execution time in milliseconds.
      */
     KUZU_API double getExecutionTime() const;
+    /**
+     * @return true if the query is profiled, either because it is executed with PROFILE or because
+     * it is sampled according to profile_sample_rate.
+     */
+    KUZU_API bool isProfiled() const;
+    /**
+     * @return the profile of the query as JSON if it is profiled, otherwise an empty string. It
+     * contains the profiled plan as well as the wall and CPU time, thread skew, buffer manager
+     * pins and evictions, I/O and spilled bytes and peak memory usage of each pipeline.
+     */
+    KUZU_API std::string getProfileJson() const;
 
     void setPreparedSummary(PreparedSummary preparedSummary_);
 
@@ -40,6 +54,7 @@ public:
 
 private:
     double executionTime = 0;
+    std::string profileJson;
     PreparedSummary preparedSummary;
 };
 
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <exception>
+#ifndef __SINGLE_THREADED__
+#include <thread>
+#endif
+
+#include "common/copy_constructors.h"
+#include "common/metric.h"
+#include "common/profiler.h"
+#include "processor/execution_context.h"
+#include "processor/physical_plan.h"
+#include "processor/result/result_queue.h"
+
+namespace kuzu {
+namespace main {
+
+class ClientContext;
+class PreparedStatement;
+class QuerySummary;
+
+// Executes a read-only query in the background and hands its results to the reader chunk by chunk
+// through a bounded ResultQueue, instead of materializing the whole result before the first tuple
+// is read. The transaction of the query stays active until the stream is finished, which happens
+// when the reader reaches the end of the result, when the result is destroyed, or when another
+// query is executed on the same connection.
+class ResultStream {
+public:
+    ResultStream(ClientContext* context, std::unique_ptr<PreparedStatement> preparedStatement,
+        std::unique_ptr<processor::PhysicalPlan> physicalPlan,
+        std::unique_ptr<common::Profiler> profiler,
+        std::unique_ptr<processor::ExecutionContext> executionContext, QuerySummary* querySummary);
+    DELETE_COPY_AND_MOVE(ResultStream);
+    ~ResultStream();
+
+    void start(std::vector<common::Value*> valuesToCollect);
+
+    bool hasNextFlatTuple();
+    void getNextFlatTuple();
+    // Returns the iterator of the current chunk. Only valid after hasNextFlatTuple returned true.
+    processor::FlatTupleIterator* getFlatTupleIterator() { return iterator.get(); }
+
+    // Stops the query if it is still running and ends its transaction. Must be called with the
+    // client context lock held.
+    void finishNoLock(bool closedByOtherQuery = false);
+
+private:
+    ClientContext* context;
+    std::unique_ptr<PreparedStatement> preparedStatement;
+    std::unique_ptr<processor::PhysicalPlan> physicalPlan;
+    std::unique_ptr<common::Profiler> profiler;
+    std::unique_ptr<processor::ExecutionContext> executionContext;
+    QuerySummary* querySummary;
+    common::TimeMetric executingTimer;
+
+    std::shared_ptr<processor::ResultQueue> queue;
+#ifndef __SINGLE_THREADED__
+    std::thread producer;
+#endif
+    std::exception_ptr producerException;
+
+    std::vector<common::Value*> valuesToCollect;
+    std::shared_ptr<processor::FactorizedTable> currentTable;
+    std::unique_ptr<processor::FlatTupleIterator> iterator;
+    // Set once the reader popped the end of the queue.
+    bool drained;
+    bool finished;
+    bool closedByOtherQuery;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -229,6 +229,54 @@ struct SpillToDiskSetting {
     }
 };
 
+struct ProfileJsonSetting {
+    static constexpr auto name = "profile_json";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->profileJson = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value::createValue(context->getClientConfig()->profileJson);
+    }
+};
+
+struct ProfileSampleRateSetting {
+    static constexpr auto name = "profile_sample_rate";
+    static constexpr auto inputType = common::LogicalTypeID::DOUBLE;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value::createValue(context->getClientConfig()->profileSampleRate);
+    }
+};
+
+struct AnalyzeSampleRateSetting {
+    static constexpr auto name = "analyze_sample_rate";
+    static constexpr auto inputType = common::LogicalTypeID::DOUBLE;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value::createValue(context->getClientConfig()->analyzeSampleRate);
+    }
+};
+
+struct ReoptimizationThresholdSetting {
+    static constexpr auto name = "reoptimization_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::DOUBLE;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value::createValue(context->getClientConfig()->reoptimizationThreshold);
+    }
+};
+
+struct JoinOrderBudgetSetting {
+    static constexpr auto name = "join_order_budget";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value::createValue(context->getClientConfig()->joinOrderBudget);
+    }
+};
+
 struct EnableOptimizerSetting {
     static constexpr auto name = "enable_plan_optimizer";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
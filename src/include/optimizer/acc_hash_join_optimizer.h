@@ -7,7 +7,8 @@ namespace kuzu {
 namespace optimizer {
 
 // This optimizer enables the Accumulated hash join algorithm as introduced in paper "Kuzu Graph
-// Database Management System".
+// Database Management System". It also passes join key filters from the build side of hash joins
+// to the scans on their probe side.
 class HashJoinSIPOptimizer : public LogicalOperatorVisitor {
 public:
     void rewrite(planner::LogicalPlan* plan);
@@ -17,6 +18,11 @@ private:
 
     void visitHashJoin(planner::LogicalOperator* op) override;
 
+    void tryApplyHJSemiMask(planner::LogicalOperator* op);
+    // Passes a bloom filter and range over the build keys of a join on property values to the
+    // scans on its probe side, if the build side is estimated to be small enough.
+    void tryApplyJoinKeyFilter(planner::LogicalOperator* op);
+
     bool tryProbeToBuildHJSIP(planner::LogicalOperator* op);
     bool tryBuildToProbeHJSIP(planner::LogicalOperator* op);
 
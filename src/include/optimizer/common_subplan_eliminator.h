@@ -0,0 +1,67 @@
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+/* Queries may compute the same subplan several times, e.g. the same pattern is matched in each
+ * branch of a UNION ALL or in multiple subqueries.
+ *      UNION_ALL
+ *     /        \
+ *   P(b)       P(b)
+ *    |          |
+ *   HJ(a)      HJ(a)
+ * Each branch is bound separately, so the subplans are only identical up to the names the binder
+ * gives to their variables and literals. This optimizer finds subplans that are identical up to
+ * such names and replaces each of them with a LogicalSharedSubplanScan. The subplan is then
+ * materialized once and scanned by all of them.
+ *
+ * Only subplans of pure reads that contain a join are shared, and only between different union
+ * branches. The largest shared subplans are chosen first, and a shared subplan does not contain
+ * other shared subplans.
+ */
+class CommonSubplanEliminator {
+    struct SubplanOccurrence {
+        planner::LogicalOperator* op;
+        planner::LogicalOperator* parent;
+        common::idx_t childIdx;
+        // Index of the innermost union branch containing the subplan.
+        common::idx_t unionBranch;
+        uint64_t numOperators;
+    };
+
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+    // Subplans are optimized separately from the plan, since their scans do not have children.
+    std::vector<std::shared_ptr<planner::LogicalOperator>> getSubplans() const {
+        return subplans;
+    }
+
+private:
+    void collectRuntimeFilterTargets(planner::LogicalOperator* op);
+    // Returns true if the subplan rooted at op can be shared.
+    bool collectOccurrences(planner::LogicalOperator* op, planner::LogicalOperator* parent,
+        common::idx_t childIdx, common::idx_t unionBranch);
+    bool canShare(planner::LogicalOperator* op) const;
+
+    void shareSubplan(const std::vector<SubplanOccurrence>& occurrences);
+    void markAsShared(planner::LogicalOperator* op);
+
+private:
+    std::unordered_set<planner::LogicalOperator*> runtimeFilterTargets;
+    common::idx_t numUnionBranches = 0;
+    std::unordered_map<std::string, std::vector<SubplanOccurrence>> occurrencesPerDigest;
+    // Digests in the order they are first found.
+    std::vector<std::string> digests;
+    // Operators of subplans that were already shared or replaced.
+    std::unordered_set<planner::LogicalOperator*> sharedOps;
+    std::vector<std::shared_ptr<planner::LogicalOperator>> subplans;
+};
+
+} // namespace optimizer
+} // namespace kuzu
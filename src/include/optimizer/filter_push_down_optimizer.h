@@ -1,5 +1,6 @@
 #pragma once
 
+#include "planner/join_order/cardinality_estimator.h"
 #include "planner/operator/logical_plan.h"
 
 namespace kuzu {
@@ -34,11 +35,15 @@ private:
 
 class FilterPushDownOptimizer {
 public:
-    explicit FilterPushDownOptimizer(main::ClientContext* context) : context{context} {
+    FilterPushDownOptimizer(main::ClientContext* context,
+        const planner::CardinalityEstimator& cardinalityEstimator)
+        : context{context}, cardinalityEstimator{cardinalityEstimator} {
         predicateSet = PredicateSet();
     }
-    explicit FilterPushDownOptimizer(main::ClientContext* context, PredicateSet predicateSet)
-        : predicateSet{std::move(predicateSet)}, context{context} {}
+    FilterPushDownOptimizer(main::ClientContext* context,
+        const planner::CardinalityEstimator& cardinalityEstimator, PredicateSet predicateSet)
+        : predicateSet{std::move(predicateSet)}, context{context},
+          cardinalityEstimator{cardinalityEstimator} {}
 
     void rewrite(planner::LogicalPlan* plan);
 
@@ -87,6 +92,9 @@ private:
 private:
     PredicateSet predicateSet;
     main::ClientContext* context;
+    // Estimates the operators created by the push down, whose cardinalities are used by later
+    // rewriters, e.g. join key filters.
+    const planner::CardinalityEstimator& cardinalityEstimator;
 };
 
 } // namespace optimizer
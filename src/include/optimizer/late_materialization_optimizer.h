@@ -0,0 +1,46 @@
+#pragma once
+
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+/* Scans read the properties of all nodes they scan, even if filters, joins or LIMIT then remove
+ * most of the nodes. E.g. for
+ *      MATCH (a)-[]->(b) WHERE b.x > 10 RETURN a.text
+ * a.text is read for every a and materialized in a hash join, although only few of them are
+ * returned. This optimizer removes such properties from the scan and reads them by node ID with a
+ * LogicalPropertyLookup right below the first operator that uses them.
+ *
+ * Operators in between must not use the properties. The projection of RETURN is changed to pass
+ * the node ID instead if it only passes them through, and its expressions are projected again
+ * above the lookup. A lookup is only added if it is estimated to read fewer nodes than the scan.
+ *
+ * Scans are left alone if their node has more than one label or is used as a whole, e.g. returned,
+ * collected or in a path. Properties that operators off the path to the root read, e.g. a
+ * correlated subquery, stay in the scan.
+ */
+class LateMaterializationOptimizer {
+    struct Ancestor {
+        planner::LogicalOperator* op;
+        common::idx_t childIdx;
+    };
+
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    void rewriteScan(planner::LogicalPlan* plan, planner::LogicalOperator* scan);
+
+    // Appends the ancestors of target from its parent up to op. Returns false if op does not
+    // contain target.
+    static bool collectAncestors(planner::LogicalOperator* op,
+        const planner::LogicalOperator* target, std::vector<Ancestor>& ancestors);
+
+    // Returns the number of ancestors that property can be passed through before it is used.
+    static common::idx_t getNumAncestorsToPass(const binder::Expression& property,
+        const std::vector<Ancestor>& ancestors);
+};
+
+} // namespace optimizer
+} // namespace kuzu
@@ -28,6 +28,11 @@ protected:
     void visitFilter(planner::LogicalOperator* op) override { ops.push_back(op); }
 };
 
+class LogicalHashJoinCollector final : public LogicalOperatorCollector {
+protected:
+    void visitHashJoin(planner::LogicalOperator* op) override { ops.push_back(op); }
+};
+
 class LogicalScanNodeTableCollector final : public LogicalOperatorCollector {
 protected:
     void visitScanNodeTable(planner::LogicalOperator* op) override { ops.push_back(op); }
@@ -141,6 +141,12 @@ protected:
         return op;
     }
 
+    virtual void visitPropertyLookup(planner::LogicalOperator* /*op*/) {}
+    virtual std::shared_ptr<planner::LogicalOperator> visitPropertyLookupReplace(
+        std::shared_ptr<planner::LogicalOperator> op) {
+        return op;
+    }
+
     virtual void visitRecursiveExtend(planner::LogicalOperator* /*op*/) {}
     virtual std::shared_ptr<planner::LogicalOperator> visitRecursiveExtendReplace(
         std::shared_ptr<planner::LogicalOperator> op) {
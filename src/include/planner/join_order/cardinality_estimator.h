@@ -1,6 +1,9 @@
 #pragma once
 
+#include <optional>
+
 #include "binder/query/query_graph.h"
+#include "common/enums/extend_direction.h"
 #include "planner/operator/logical_plan.h"
 #include "storage/stats/table_stats.h"
 
@@ -45,10 +48,32 @@ public:
         const binder::Expression& predicate) const;
     cardinality_t estimateAggregate(const LogicalAggregate& op) const;
 
+    // Cardinality of the subgraph observed by an earlier execution of the statement being
+    // re-optimized, if any.
+    std::optional<cardinality_t> getObservedCardinality(
+        const binder::SubqueryGraph& subgraph) const;
+
     double getExtensionRate(const binder::RelExpression& rel,
         const binder::NodeExpression& boundNode, const transaction::Transaction* transaction) const;
+    // Extension rate of a non-recursive extend on top of boundSide. If boundSide reached the bound
+    // node through the same rels, the bound node is more likely to have a high degree than a
+    // random node.
+    double getExtensionRate(const binder::RelExpression& rel,
+        const binder::NodeExpression& boundNode, common::ExtendDirection direction,
+        const LogicalOperator& boundSide, const transaction::Transaction* transaction) const;
 
 private:
+    double getDegreeSkewFactor(const binder::RelExpression& rel,
+        const binder::NodeExpression& boundNode, common::ExtendDirection direction,
+        const LogicalOperator& boundSide, const transaction::Transaction* transaction) const;
+    std::optional<double> estimateEqualitySelectivity(const binder::Expression& property,
+        const binder::Expression& literal) const;
+    std::optional<double> estimateRangeSelectivity(const binder::Expression& predicate) const;
+    std::optional<double> estimateJoinSelectivity(const binder::Expression& left,
+        const binder::Expression& right) const;
+    const storage::TableStats* getTableStats(const binder::Expression& property,
+        common::column_id_t& columnID) const;
+
     cardinality_t getNodeIDDom(const std::string& nodeIDName) const;
     cardinality_t getNumNodes(const transaction::Transaction* transaction,
         const std::vector<common::table_id_t>& tableIDs) const;
@@ -5,9 +5,19 @@
 namespace kuzu {
 namespace planner {
 
+// Costs are in units of processing one tuple. On top of the cost of its children, each join
+// method is charged for
+// - extend (index nested loop join): one CSR lookup per bound node tuple, penalized if the bound
+//   node is not scanned sequentially.
+// - hash join: one probe per probe side tuple and materializing the build side.
+// - intersect (worst case optimal join): one probe per build per probe side tuple and
+//   materializing every build side.
+// Outputs are not charged since all methods produce the same tuples. A hash join closing a cycle
+// is instead charged for probing with all the paths it closes, which intersect never enumerates.
 class CostModel {
 public:
-    static uint64_t computeExtendCost(const LogicalPlan& childPlan);
+    static uint64_t computeExtendCost(const LogicalPlan& childPlan,
+        const binder::Expression& boundNodeID);
     static uint64_t computeRecursiveExtendCost(uint8_t upperBound, double extensionRate,
         const LogicalPlan& childPlan);
     static uint64_t computeHashJoinCost(const std::vector<binder::expression_pair>& joinConditions,
@@ -18,8 +28,8 @@ public:
         const LogicalPlan& probe, const LogicalPlan& build);
     static uint64_t computeMarkJoinCost(const binder::expression_vector& joinNodeIDs,
         const LogicalPlan& probe, const LogicalPlan& build);
-    static uint64_t computeIntersectCost(const LogicalPlan& probePlan,
-        const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans);
+    static uint64_t computeIntersectCost(const binder::expression_vector& boundNodeIDs,
+        const LogicalPlan& probePlan, const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans);
 };
 
 } // namespace planner
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "binder/query/query_graph.h"
+
+namespace kuzu {
+namespace planner {
+
+using csg_cmp_pair_t = std::pair<binder::SubqueryGraph, binder::SubqueryGraph>;
+
+// Enumerates each pair of disjoint connected subgraphs (csg) that are connected to each other
+// (cmp) exactly once, following DPhyp (Moerkotte & Neumann). A rel only connects its two end
+// nodes, so the query graph is not a hypergraph and the enumeration is the one of DPccp over the
+// base scans: each vertex is either a rel or the nodes scanned together.
+// Enumeration gives up once it finds more than maxNumPairs pairs, so that the number of joins
+// planned exactly stays bounded.
+class CsgCmpPairEnumerator {
+    using vertex_set_t = std::bitset<2 * binder::MAX_NUM_QUERY_VARIABLES>;
+
+public:
+    CsgCmpPairEnumerator(std::vector<binder::SubqueryGraph> vertices, uint64_t maxNumPairs);
+
+    // Returns false if there are more pairs than the budget.
+    bool enumerate();
+
+    // Pairs whose union has the given total number of variables, i.e. the pairs of a dp level.
+    const std::vector<csg_cmp_pair_t>& getPairs(uint32_t level) const;
+
+private:
+    vertex_set_t getNbrs(const vertex_set_t& vertexSet, const vertex_set_t& excluded) const;
+    binder::SubqueryGraph getSubgraph(const vertex_set_t& vertexSet) const;
+
+    bool emitCsg(const vertex_set_t& csg);
+    bool enumerateCsgRec(const vertex_set_t& csg, const vertex_set_t& excluded);
+    bool enumerateCmpRec(const vertex_set_t& csg, const vertex_set_t& cmp,
+        const vertex_set_t& excluded);
+    bool emitPair(const vertex_set_t& csg, const vertex_set_t& cmp);
+
+    // Calls func on each non-empty subset of vertexSet. Stops and returns false if func does.
+    template<typename Func>
+    bool forEachSubset(const vertex_set_t& vertexSet, Func func) const;
+
+private:
+    std::vector<binder::SubqueryGraph> vertices;
+    std::vector<vertex_set_t> adjacency;
+    uint64_t maxNumPairs;
+    uint64_t numPairs;
+    std::vector<std::vector<csg_cmp_pair_t>> pairsPerLevel;
+};
+
+} // namespace planner
+} // namespace kuzu
@@ -10,6 +10,9 @@ struct JoinOrderUtil {
     // cardinality and cost estimation based on their flat cardinality.
     static uint64_t getJoinKeysFlatCardinality(const binder::expression_vector& joinNodeIDs,
         const LogicalOperator& buildOp);
+    // Whether the given node ID is produced in node offset order by a sequential scan at the
+    // bottom of the operator chain, so that its adjacency lists are read in CSR order.
+    static bool isNodeSequential(const LogicalOperator& op, const binder::Expression& nodeID);
 };
 
 } // namespace planner
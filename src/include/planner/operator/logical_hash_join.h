@@ -45,6 +45,25 @@ public:
     SIPInfo& getSIPInfoUnsafe() { return sipInfo; }
     SIPInfo getSIPInfo() const { return sipInfo; }
 
+    // Scans on the probe side which drop rows whose join key is not on the build side. Only set
+    // for joins with a single condition.
+    void setJoinKeyFilterTargets(std::vector<LogicalOperator*> targets) {
+        joinKeyFilterTargets = std::move(targets);
+    }
+    const std::vector<LogicalOperator*>& getJoinKeyFilterTargets() const {
+        return joinKeyFilterTargets;
+    }
+
+    // Set for joins between two parts of a query graph, whose build side cardinality is compared
+    // with the estimate at runtime. See AdaptiveExecutionState.
+    void setBuildSubgraph(std::string name, common::cardinality_t estimatedCardinality) {
+        buildSubgraphName = std::move(name);
+        buildCardinality = estimatedCardinality;
+    }
+    bool hasBuildSubgraph() const { return !buildSubgraphName.empty(); }
+    const std::string& getBuildSubgraphName() const { return buildSubgraphName; }
+    common::cardinality_t getBuildCardinality() const { return buildCardinality; }
+
     std::unique_ptr<LogicalOperator> copy() override;
 
     // Flat probe side key group in either of the following two cases:
@@ -66,6 +85,9 @@ private:
     common::JoinType joinType;
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark or Left
     SIPInfo sipInfo;
+    std::vector<LogicalOperator*> joinKeyFilterTargets;
+    std::string buildSubgraphName;
+    common::cardinality_t buildCardinality = 0;
 };
 
 } // namespace planner
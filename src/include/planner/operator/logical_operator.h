@@ -49,9 +49,11 @@ enum class LogicalOperatorType : uint8_t {
     PARTITIONER,
     PATH_PROPERTY_PROBE,
     PROJECTION,
+    PROPERTY_LOOKUP,
     RECURSIVE_EXTEND,
     SCAN_NODE_TABLE,
     SEMI_MASKER,
+    SHARED_SUBPLAN_SCAN,
     PROPERTY_COLLECTOR,
     SET_PROPERTY,
     STANDALONE_CALL,
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "binder/expression/expression_util.h"
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// LogicalPropertyLookup reads properties of the nodes in its child by node ID. Properties that are
+// only needed late in a plan are read this way instead of by the scan of the node, see
+// LateMaterializationOptimizer.
+class LogicalPropertyLookup final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::PROPERTY_LOOKUP;
+
+public:
+    LogicalPropertyLookup(std::shared_ptr<binder::Expression> nodeID,
+        std::vector<common::table_id_t> nodeTableIDs, binder::expression_vector properties,
+        std::shared_ptr<LogicalOperator> child)
+        : LogicalOperator{type_, std::move(child)}, nodeID{std::move(nodeID)},
+          nodeTableIDs{std::move(nodeTableIDs)}, properties{std::move(properties)} {}
+
+    void computeFactorizedSchema() override;
+    void computeFlatSchema() override;
+
+    std::string getExpressionsForPrinting() const override {
+        return nodeID->toString() + " " + binder::ExpressionUtil::toString(properties);
+    }
+
+    std::shared_ptr<binder::Expression> getNodeID() const { return nodeID; }
+    std::vector<common::table_id_t> getTableIDs() const { return nodeTableIDs; }
+    binder::expression_vector getProperties() const { return properties; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalPropertyLookup>(nodeID, nodeTableIDs, properties,
+            children[0]->copy());
+    }
+
+private:
+    std::shared_ptr<binder::Expression> nodeID;
+    std::vector<common::table_id_t> nodeTableIDs;
+    binder::expression_vector properties;
+};
+
+} // namespace planner
+} // namespace kuzu
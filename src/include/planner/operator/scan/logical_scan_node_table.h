@@ -11,6 +11,7 @@ enum class LogicalScanNodeTableType : uint8_t {
     SCAN = 0,
     OFFSET_SCAN = 1,
     PRIMARY_KEY_SCAN = 2,
+    PROPERTY_INDEX_SCAN = 3,
 };
 
 struct ExtraScanNodeTableInfo {
@@ -47,6 +48,19 @@ struct PrimaryKeyScanInfo final : ExtraScanNodeTableInfo {
     }
 };
 
+struct PropertyIndexScanInfo final : ExtraScanNodeTableInfo {
+    std::shared_ptr<binder::Expression> property;
+    std::shared_ptr<binder::Expression> key;
+
+    PropertyIndexScanInfo(std::shared_ptr<binder::Expression> property,
+        std::shared_ptr<binder::Expression> key)
+        : property{std::move(property)}, key{std::move(key)} {}
+
+    std::unique_ptr<ExtraScanNodeTableInfo> copy() const override {
+        return std::make_unique<PropertyIndexScanInfo>(property, key);
+    }
+};
+
 struct LogicalScanNodeTablePrintInfo final : OPPrintInfo {
     std::shared_ptr<binder::Expression> nodeID;
     binder::expression_vector properties;
@@ -96,6 +110,8 @@ public:
     void addProperty(std::shared_ptr<binder::Expression> expr) {
         properties.push_back(std::move(expr));
     }
+    // Removes properties together with their predicates.
+    void removeProperties(const binder::expression_set& propertiesToRemove);
     void setPropertyPredicates(std::vector<storage::ColumnPredicateSet> predicates) {
         propertyPredicates = std::move(predicates);
     }
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "binder/expression/expression_util.h"
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// LogicalSharedSubplanScan scans the materialized result of a subplan that several parts of the
+// plan compute identically, e.g. the same pattern matched in multiple UNION ALL branches. The
+// subplan is not a child, since it is shared by all its scans and is materialized only once.
+// Expressions are the scan's own copies of the subplan's payloads, in the same order.
+class LogicalSharedSubplanScan final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::SHARED_SUBPLAN_SCAN;
+
+public:
+    LogicalSharedSubplanScan(binder::expression_vector expressions,
+        binder::expression_vector payloads, std::shared_ptr<LogicalOperator> subplan)
+        : LogicalOperator{type_}, expressions{std::move(expressions)},
+          payloads{std::move(payloads)}, subplan{std::move(subplan)} {
+        cardinality = this->subplan->getCardinality();
+    }
+
+    void computeFactorizedSchema() override;
+    void computeFlatSchema() override;
+
+    std::string getExpressionsForPrinting() const override {
+        return binder::ExpressionUtil::toString(expressions);
+    }
+
+    binder::expression_vector getExpressions() const { return expressions; }
+    binder::expression_vector getPayloads() const { return payloads; }
+    std::shared_ptr<LogicalOperator> getSubplan() const { return subplan; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalSharedSubplanScan>(expressions, payloads, subplan);
+    }
+
+private:
+    binder::expression_vector expressions;
+    binder::expression_vector payloads;
+    std::shared_ptr<LogicalOperator> subplan;
+};
+
+} // namespace planner
+} // namespace kuzu
@@ -27,6 +27,7 @@ struct BoundGDSCallInfo;
 namespace planner {
 
 struct LogicalInsertInfo;
+class CsgCmpPairEnumerator;
 
 enum class SubqueryPlanningType : uint8_t {
     NONE = 0,
@@ -184,10 +185,18 @@ public:
         common::ExtendDirection direction, const binder::expression_vector& properties,
         LogicalPlan& plan);
 
-    // Plan dp level
-    void planLevel(uint32_t level);
-    void planLevelExactly(uint32_t level);
-    void planLevelApproximately(uint32_t level);
+    // Adds a plan of the subgraph to the dp table. It takes the cardinality observed for the
+    // subgraph by an earlier execution of the statement, if there is one.
+    void addPlan(const binder::SubqueryGraph& subgraph, std::unique_ptr<LogicalPlan> plan);
+
+    // Plan join order exactly with dp if the query graph has few enough csg-cmp pairs, and greedily
+    // otherwise.
+    void planJoinOrder();
+    void planLevel(uint32_t level, const CsgCmpPairEnumerator& enumerator);
+    void planJoinOrderGreedily(const std::vector<binder::SubqueryGraph>& baseSubgraphs);
+    void planGreedyJoin(const binder::SubqueryGraph& subgraph,
+        const binder::SubqueryGraph& relSubgraph, const binder::SubqueryGraph& otherSubgraph,
+        binder::subquery_graph_set_t& plannedSubgraphs);
 
     // Plan worst case optimal join
     void planWCOJoin(uint32_t leftLevel, uint32_t rightLevel);
@@ -196,13 +205,14 @@ public:
         const std::shared_ptr<binder::NodeExpression>& intersectNode);
 
     // Plan index-nested-loop join / hash join
-    void planInnerJoin(uint32_t leftLevel, uint32_t rightLevel);
-    bool tryPlanINLJoin(const binder::SubqueryGraph& subgraph,
+    void planInnerJoin(const binder::SubqueryGraph& subgraph,
+        const binder::SubqueryGraph& otherSubgraph);
+    void planInnerINLJoin(const binder::SubqueryGraph& subgraph,
         const binder::SubqueryGraph& otherSubgraph,
         const std::vector<std::shared_ptr<binder::NodeExpression>>& joinNodes);
     void planInnerHashJoin(const binder::SubqueryGraph& subgraph,
         const binder::SubqueryGraph& otherSubgraph,
-        const std::vector<std::shared_ptr<binder::NodeExpression>>& joinNodes, bool flipPlan);
+        const std::vector<std::shared_ptr<binder::NodeExpression>>& joinNodes);
 
     std::vector<std::unique_ptr<LogicalPlan>> planCrossProduct(
         std::vector<std::unique_ptr<LogicalPlan>> leftPlans,
@@ -8,8 +8,6 @@
 namespace kuzu {
 namespace planner {
 
-const uint64_t MAX_LEVEL_TO_PLAN_EXACTLY = 7;
-
 // Different from vanilla dp algorithm where one optimal plan is kept per subgraph, we keep multiple
 // plans each with a different factorization structure. The following example will explain our
 // rationale.
@@ -49,6 +47,15 @@ private:
 
 // A DPLevel is a collection of plans per subgraph. All subgraph should have the same number of
 // variables.
+// The number of subgraphs is not capped here because the join_order_budget already bounds it, see
+// Planner::planJoinOrder():
+// - DP only runs if there are at most join_order_budget csg-cmp pairs. A hash or INL join adds
+//   plans to the union of its pair. A WCOJ join adds plans to a connected set of base scans, which
+//   is also the union of a pair (the set without one of its non-cut vertices, and that vertex).
+//   So DP adds at most join_order_budget subgraphs over all levels.
+// - The greedy fallback adds at most three subgraphs per candidate rel and step, i.e. O(#rels^2).
+// A fixed cap per level would instead drop subgraphs that the pairs of the next levels rely on,
+// and could leave the greedy fallback without room for its own joins.
 class DPLevel {
 public:
     inline bool contains(const binder::SubqueryGraph& subqueryGraph) {
@@ -65,9 +72,6 @@ public:
 
     inline void clear() { subgraph2Plans.clear(); }
 
-private:
-    constexpr static uint32_t MAX_NUM_SUBGRAPH = 50;
-
 private:
     binder::subquery_graph_V_map_t<std::unique_ptr<SubgraphPlans>> subgraph2Plans;
 };
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/exception/exception.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace processor {
+
+class HashJoinSharedState;
+
+// Thrown by a finished pipeline breaker whose actual cardinality is far off from the planner's
+// estimate. The statement is then planned and executed again, see ClientContext::executeNoLock.
+class ReoptimizationException final : public common::Exception {
+public:
+    explicit ReoptimizationException(const std::string& msg) : common::Exception{msg} {}
+};
+
+// Runtime feedback kept across the re-optimizations of a read-only statement. Cardinalities are
+// keyed by the query graph part they were observed for (see SubqueryGraph::getUniqueName()), so
+// that the planner can look them up for the same part in the next plan. Finished hash join builds
+// are kept so that the next plan can probe them instead of building them again.
+class AdaptiveExecutionState {
+public:
+    // Bounds the number of times a statement is planned again.
+    static constexpr uint32_t MAX_NUM_REOPTIMIZATIONS = 3;
+
+    explicit AdaptiveExecutionState(double threshold)
+        : threshold{threshold}, numReoptimizations{0} {}
+
+    // Records the actual cardinality and throws a ReoptimizationException if it is more than
+    // threshold times larger or smaller than the estimate. Each subgraph triggers at most once.
+    void observeCardinality(const std::string& subgraphName, common::cardinality_t estimate,
+        common::cardinality_t actual);
+    bool hasObservedCardinality(const std::string& subgraphName) const;
+    common::cardinality_t getObservedCardinality(const std::string& subgraphName) const;
+
+    void addHashJoinBuild(const std::string& buildName,
+        std::shared_ptr<HashJoinSharedState> sharedState);
+    // Returns nullptr if there is no finished build of the given name.
+    std::shared_ptr<HashJoinSharedState> getFinishedHashJoinBuild(
+        const std::string& buildName) const;
+
+private:
+    mutable std::mutex mtx;
+    double threshold;
+    uint32_t numReoptimizations;
+    std::unordered_map<std::string, common::cardinality_t> observedCardinalities;
+    std::unordered_map<std::string, std::shared_ptr<HashJoinSharedState>> hashJoinBuilds;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -38,6 +38,10 @@ private:
     std::unique_ptr<evaluator::ExpressionEvaluator> getFunctionEvaluator(
         std::shared_ptr<binder::Expression> expression);
 
+    // Returns nullptr if the expression is not a conjunction of column and constant comparisons.
+    std::unique_ptr<evaluator::ExpressionEvaluator> getComparisonConjunctionEvaluator(
+        std::shared_ptr<binder::Expression> expression);
+
     std::unique_ptr<evaluator::ExpressionEvaluator> getNodeEvaluator(
         std::shared_ptr<binder::Expression> expression);
 
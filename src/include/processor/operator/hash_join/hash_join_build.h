@@ -1,6 +1,10 @@
 #pragma once
 
+#include <optional>
+
 #include "join_hash_table.h"
+#include "join_key_filter.h"
+#include "processor/adaptive_execution_state.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
@@ -46,9 +50,56 @@ public:
 
     inline JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    void addNumFlatTuples(uint64_t numTuples) { numFlatTuples.fetch_add(numTuples); }
+    uint64_t getNumFlatTuples() const { return numFlatTuples.load(); }
+
+    // Set once the hash slots are built. A re-optimized plan can then probe the hash table without
+    // running its build pipeline again.
+    void setBuilt() { built.store(true, std::memory_order_release); }
+    bool isBuilt() const { return built.load(std::memory_order_acquire); }
+
+    void setJoinKeyFilter(std::shared_ptr<JoinKeyFilter> filter) {
+        joinKeyFilter = std::move(filter);
+    }
+    std::shared_ptr<JoinKeyFilter> getJoinKeyFilter() const { return joinKeyFilter; }
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+    // Built once the hash table is finalized if the optimizer chose to pass the build keys to the
+    // scans on the probe side.
+    std::shared_ptr<JoinKeyFilter> joinKeyFilter;
+    // Number of tuples of the build side with unflat payloads flattened. Only counted for builds
+    // with an estimate.
+    std::atomic<uint64_t> numFlatTuples{0};
+    std::atomic<bool> built{false};
+};
+
+// Estimated cardinality of a build side that covers a part of a query graph. It is compared with
+// the actual cardinality once the build finishes, see AdaptiveExecutionState.
+struct HashJoinBuildEstimate {
+    std::string subgraphName;
+    common::cardinality_t cardinality;
+};
+
+// Inserts the tuples of the build side into the hash slots once all HashJoinBuild threads merged
+// their local tuples. Threads claim tuple blocks one at a time and insert their tuples with
+// compare-and-swap, since tuples of different blocks can hash to the same slot.
+class HashJoinBuildSlotsTask final : public common::Task {
+public:
+    HashJoinBuildSlotsTask(uint64_t maxNumThreads, std::shared_ptr<HashJoinSharedState> sharedState,
+        AdaptiveExecutionState* adaptiveState, std::optional<HashJoinBuildEstimate> estimate)
+        : Task{maxNumThreads}, sharedState{std::move(sharedState)}, adaptiveState{adaptiveState},
+          estimate{std::move(estimate)}, nextTupleBlockIdx{0} {}
+
+    void run() override;
+    void finalizeIfNecessary() override;
+
+private:
+    std::shared_ptr<HashJoinSharedState> sharedState;
+    AdaptiveExecutionState* adaptiveState;
+    std::optional<HashJoinBuildEstimate> estimate;
+    std::atomic<uint64_t> nextTupleBlockIdx;
 };
 
 class HashJoinBuildInfo {
@@ -90,15 +141,21 @@ public:
 
     inline std::shared_ptr<HashJoinSharedState> getSharedState() const { return sharedState; }
 
+    void setEstimate(HashJoinBuildEstimate buildEstimate) { estimate = std::move(buildEstimate); }
+
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     void executeInternal(ExecutionContext* context) override;
 
     void finalizeInternal(ExecutionContext* context) override;
 
+    std::unique_ptr<common::Task> createFinalizeTask(ExecutionContext* context) override;
+
     inline std::unique_ptr<PhysicalOperator> clone() override {
-        return make_unique<HashJoinBuild>(resultSetDescriptor->copy(), operatorType, sharedState,
-            info->copy(), children[0]->clone(), id, printInfo->copy());
+        auto result = make_unique<HashJoinBuild>(resultSetDescriptor->copy(), operatorType,
+            sharedState, info->copy(), children[0]->clone(), id, printInfo->copy());
+        result->estimate = estimate;
+        return result;
     }
 
 protected:
@@ -119,6 +176,11 @@ protected:
     std::vector<common::ValueVector*> payloadVectors;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
+
+    std::optional<HashJoinBuildEstimate> estimate;
+    // States of the unflat payloads, whose tuples multiply the number of appended tuples when the
+    // build side is flattened.
+    std::vector<common::DataChunkState*> unFlatPayloadStates;
 };
 
 } // namespace processor
@@ -6,6 +6,20 @@
 namespace kuzu {
 namespace processor {
 
+// Slot tags rely on user space addresses fitting into the lower 48 bits. They are compiled out on
+// other platforms and when the upper bits may carry pointer tags (HWASan, ARM MTE).
+#if (defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64)) &&      \
+    !defined(__SANITIZE_HWADDRESS__) && !defined(__ARM_FEATURE_MEMORY_TAGGING)
+#define KUZU_HASH_SLOT_TAGS 1
+#else
+#define KUZU_HASH_SLOT_TAGS 0
+#endif
+
+// Hash slots point to the most recently inserted tuple of their chain, and each tuple points to the
+// previous one through its prev pointer column. On 64-bit platforms the unused upper 16 bits of the
+// slot pointers hold a tag, which is a small bloom filter of the hashes in the chain. Probes whose
+// tag bit is not set are rejected without touching any tuple. Tags are only used if all tuples of
+// the table are at addresses below 2^48, e.g. not with 5-level paging handing out higher addresses.
 class JoinHashTable : public BaseHashTable {
 public:
     JoinHashTable(storage::MemoryManager& memoryManager, common::logical_type_vec_t keyTypes,
@@ -22,7 +36,15 @@ public:
 
     void allocateHashSlots(uint64_t numTuples);
     void buildHashSlots();
+    // Inserts the tuples of one tuple block into the hash slots. Can be called concurrently for
+    // different blocks, in which case slots are updated with compare-and-swap.
+    void buildHashSlots(uint64_t tupleBlockIdx, bool concurrent);
+    uint64_t getNumTupleBlocks() const {
+        return factorizedTable->getTupleDataBlocks().size();
+    }
 
+    // Finds the head of the chain of each key. Slots are prefetched a fixed distance ahead of the
+    // key being looked up, and chain heads are prefetched for matchFlatKeys or matchUnFlatKey.
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector& hashVector,
         common::SelectionVector& hashSelVec, common::ValueVector& tmpHashResultVector,
         uint8_t** probedTuples);
@@ -30,7 +52,9 @@ public:
     // given key tuple.
     common::sel_t matchFlatKeys(const std::vector<common::ValueVector*>& keyVectors,
         uint8_t** probedTuples, uint8_t** matchedTuples);
-    // Input is multiple tuples, at most one match exist for each key.
+    // Input is multiple tuples, at most one match exist for each key. The chains of all keys are
+    // walked one hop at a time in rounds, so the next tuple of each chain is prefetched while the
+    // other keys are compared.
     common::sel_t matchUnFlatKey(common::ValueVector* keyVector, uint8_t** probedTuples,
         uint8_t** matchedTuples, common::SelectionVector& matchedTuplesSelVector);
 
@@ -43,30 +67,62 @@ public:
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
-    uint8_t* getTupleForHash(common::hash_t hash) {
-        auto slotIdx = getSlotIdxForHash(hash);
-        KU_ASSERT(slotIdx < maxNumHashSlots);
-        return ((uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]
-                                ->getData()))[slotIdx & slotIdxInBlockMask];
+    // Returns nullptr if no tuple with the given hash can be in the table.
+    uint8_t* getTupleForHash(common::hash_t hash) const {
+        return getTupleFromSlot(*getSlotForHash(hash), hash);
     }
     FactorizedTable* getFactorizedTable() { return factorizedTable.get(); }
     const FactorizedTableSchema* getTableSchema() { return factorizedTable->getTableSchema(); }
+    common::offset_t getHashValueColOffset() const;
 
 private:
+    uint8_t** getSlotForHash(common::hash_t hash) const {
+        auto slotIdx = getSlotIdxForHash(hash);
+        KU_ASSERT(slotIdx < maxNumHashSlots);
+        return slotBlocksData[slotIdx >> numSlotsPerBlockLog2] + (slotIdx & slotIdxInBlockMask);
+    }
+    static uint64_t getSlotTag(common::hash_t hash) {
+        // The lower bits of the hash select the slot, so the tag is taken from the top bits.
+        return 1ull << (SLOT_TAG_SHIFT + (hash >> (64 - 4)));
+    }
+    uint8_t* getTupleFromSlot(uint8_t* slot, common::hash_t hash) const {
+        auto slotValue = reinterpret_cast<uintptr_t>(slot);
+        if (useSlotTags) {
+            // Branch free, since whether the tag matches is unpredictable.
+            auto tagMatches = static_cast<uintptr_t>((slotValue & getSlotTag(hash)) != 0);
+            slotValue &= SLOT_POINTER_MASK & (0 - tagMatches);
+        }
+        return reinterpret_cast<uint8_t*>(slotValue);
+    }
+    // Returns true if all tuples are at addresses that leave room for slot tags.
+    bool canUseSlotTags() const;
+
+    template<typename FUNC>
+    common::sel_t matchUnFlatKey(common::ValueVector* keyVector, uint8_t** probedTuples,
+        uint8_t** matchedTuples, common::SelectionVector& matchedTuplesSelVector,
+        FUNC compareEntry);
+
     uint8_t** findHashSlot(const uint8_t* tuple) const;
     // This function returns the pointer that previously stored in the same slot.
+    template<bool CONCURRENT>
     uint8_t* insertEntry(uint8_t* tuple) const;
+    uint64_t getSlotValueToInsert(const uint8_t* tuple, uint64_t slotValue) const;
 
     // Join hash table assumes all keys to be flat.
     void computeVectorHashes(std::vector<common::ValueVector*> keyVectors);
 
-    common::offset_t getHashValueColOffset() const;
-
 private:
+    static constexpr uint64_t SLOT_TAG_SHIFT = 48;
+    static constexpr uint64_t SLOT_POINTER_MASK = (1ull << SLOT_TAG_SHIFT) - 1;
+    static constexpr common::sel_t PROBE_PREFETCH_DISTANCE = 32;
     static constexpr uint64_t PREV_PTR_COL_IDX = 1;
     static constexpr uint64_t HASH_COL_IDX = 2;
     const FactorizedTableSchema* tableSchema;
     uint64_t prevPtrColOffset;
+    // Decided when the hash slots are allocated, before any tuple is inserted.
+    bool useSlotTags = false;
+    // Data of hashSlotsBlocks, so that looking up a slot does not go through the memory buffers.
+    std::vector<uint8_t**> slotBlocksData;
 };
 
 } // namespace processor
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+
+#include "common/vector/value_vector.h"
+#include "processor/data_pos.h"
+#include "processor/result/result_set.h"
+
+namespace kuzu {
+namespace processor {
+
+class JoinHashTable;
+
+// Summary of the keys on the build side of a hash join, passed sideways to the scans on its probe
+// side so that rows which cannot find a match are dropped before they reach the probe. It consists
+// of a blocked bloom filter over the key hashes, plus the range of the keys if they are integers.
+// The filter is built once the build side is finalized and lets every row through before that, so
+// results never depend on whether a scan runs before or after the build.
+class JoinKeyFilter {
+public:
+    // Bloom filters over more keys than this take too much memory and are unlikely to drop enough
+    // probe rows to pay off.
+    static constexpr uint64_t MAX_NUM_KEYS = 1ull << 22;
+    static constexpr uint64_t NUM_BITS_PER_KEY = 16;
+
+    explicit JoinKeyFilter(common::PhysicalTypeID keyType)
+        : keyType{keyType}, enabled{false}, hasRange{false}, minKey{0}, maxKey{0}, blockMask{0} {}
+
+    static bool isSupportedKeyType(const common::LogicalType& type);
+
+    // Must be called once all build side tuples have been appended to hashTable.
+    void build(JoinHashTable& hashTable);
+
+    bool isEnabled() const { return enabled.load(std::memory_order_acquire); }
+
+    // Removes the positions whose key cannot match any build key from the selection vector of
+    // keyVector. hashVector is used as scratch space for the key hashes.
+    void filter(common::ValueVector& keyVector, common::ValueVector& hashVector) const;
+
+private:
+    template<typename T>
+    void buildRange(JoinHashTable& hashTable);
+    template<typename T>
+    bool isInRange(T key) const {
+        return key >= static_cast<T>(minKey) && key <= static_cast<T>(maxKey);
+    }
+
+    void insertHash(common::hash_t hash) {
+        blocks[(hash >> 32) & blockMask] |= getBitsInBlock(hash);
+    }
+    bool mayContainHash(common::hash_t hash) const {
+        auto bits = getBitsInBlock(hash);
+        return (blocks[(hash >> 32) & blockMask] & bits) == bits;
+    }
+    static uint64_t getBitsInBlock(common::hash_t hash) {
+        return (1ull << (hash & 63)) | (1ull << ((hash >> 6) & 63)) |
+               (1ull << ((hash >> 12) & 63));
+    }
+
+private:
+    common::PhysicalTypeID keyType;
+    std::atomic<bool> enabled;
+    // Integer keys are range checked before their hash is computed. Keys of unsigned types are
+    // stored with the same bits as their signed counterpart.
+    bool hasRange;
+    int64_t minKey;
+    int64_t maxKey;
+    std::vector<uint64_t> blocks;
+    uint64_t blockMask;
+};
+
+struct JoinKeyFilterInfo {
+    std::shared_ptr<JoinKeyFilter> filter;
+    // Position of the probe key in the result set of the scan applying the filter.
+    DataPos keyPos;
+
+    JoinKeyFilterInfo(std::shared_ptr<JoinKeyFilter> filter, DataPos keyPos)
+        : filter{std::move(filter)}, keyPos{keyPos} {}
+};
+
+// Thread local state of a scan applying the join key filters passed to it.
+class JoinKeyFilterApplier {
+public:
+    void init(const std::vector<JoinKeyFilterInfo>& infos, const ResultSet& resultSet);
+
+    // Returns false if all rows of the current batch have been filtered out.
+    bool apply();
+
+private:
+    std::vector<std::pair<const JoinKeyFilter*, common::ValueVector*>> filters;
+    std::unique_ptr<common::ValueVector> hashVector;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -138,7 +138,7 @@ public:
     }
 
 private:
-    uint64_t findRightKeyBlockIdx(uint8_t* leftEndTuplePtr) const;
+    uint64_t findMergePathSplit(uint64_t numOutputTuples) const;
 
 public:
     static const uint32_t batch_size = 10000;
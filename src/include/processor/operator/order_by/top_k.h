@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include "processor/operator/sink.h"
 #include "sort_state.h"
 
@@ -73,7 +75,8 @@ public:
     void append(const std::vector<common::ValueVector*>& keyVectors,
         const std::vector<common::ValueVector*>& payloadVectors);
 
-    void reduce();
+    // Returns true if the buffer has been reduced, which sets a new boundary value.
+    bool reduce();
 
     // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
     inline void finalize() { sortState->finalize(); }
@@ -84,6 +87,12 @@ public:
         return sortState->getScanner(skip, limit);
     }
 
+    // Returns true if the boundary value of this buffer sorts before the one of other, i.e. it
+    // prunes more tuples.
+    bool hasTighterBoundaryValue(TopKBuffer& other);
+
+    void copyBoundaryValue(const TopKBuffer& other);
+
 private:
     void initVectors();
 
@@ -127,18 +136,21 @@ private:
     std::vector<common::ValueVector*> lastKeyVecsToScan;
 };
 
+class TopKSharedState;
+
 class TopKLocalState {
 public:
     void init(const OrderByDataInfo& orderByDataInfo, storage::MemoryManager* memoryManager,
         ResultSet& resultSet, uint64_t skipNumber, uint64_t limitNumber);
 
     void append(const std::vector<common::ValueVector*>& keyVectors,
-        const std::vector<common::ValueVector*>& payloadVectors);
+        const std::vector<common::ValueVector*>& payloadVectors, TopKSharedState& sharedState);
 
     // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
     inline void finalize() { buffer->finalize(); }
 
     std::unique_ptr<TopKBuffer> buffer;
+    uint64_t seenBoundaryVersion = 0;
 };
 
 class TopKSharedState {
@@ -147,6 +159,9 @@ public:
         uint64_t skipNumber, uint64_t limitNumber) {
         buffer = std::make_unique<TopKBuffer>(orderByDataInfo);
         buffer->init(memoryManager, skipNumber, limitNumber);
+        boundaryBuffer = std::make_unique<TopKBuffer>(orderByDataInfo);
+        boundaryBuffer->init(memoryManager, skipNumber, limitNumber);
+        boundaryVersion = 0;
     }
 
     void mergeLocalState(TopKLocalState* localState) {
@@ -154,6 +169,15 @@ public:
         buffer->merge(localState->buffer.get());
     }
 
+    // Any boundary value of a local buffer bounds the global result as well, since skip + limit
+    // tuples sort before it. Threads exchange their boundary value with the shared one whenever
+    // they reduce: the tighter of both is kept on both sides, so that each thread prunes tuples
+    // with the best boundary value found by any thread.
+    void exchangeBoundaryValue(TopKBuffer& localBuffer, uint64_t& seenBoundaryVersion);
+    // Copies the shared boundary value into localBuffer if it changed since the last call and is
+    // tighter than the local one.
+    void tightenBoundaryValue(TopKBuffer& localBuffer, uint64_t& seenBoundaryVersion);
+
     // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
     inline void finalize() { buffer->finalize(); }
 
@@ -161,6 +185,11 @@ public:
 
 private:
     std::mutex mtx;
+    // Kept apart from buffer, whose own boundary value is only updated by merges.
+    std::unique_ptr<TopKBuffer> boundaryBuffer;
+    // Incremented whenever boundaryBuffer is tightened, so that threads only take the lock once
+    // there is something new to pick up.
+    std::atomic<uint64_t> boundaryVersion{0};
 };
 
 class TopK final : public Sink {
@@ -79,12 +79,16 @@ struct NodeBatchInsertSharedState final : BatchInsertSharedState {
     // ops.
     std::unique_ptr<storage::ChunkedNodeGroup> sharedNodeGroup;
 
+    // Offset of the first node appended by the COPY, used to report the appended nodes to the
+    // write listeners of the table.
+    common::offset_t startNodeOffset;
+
     NodeBatchInsertSharedState(storage::Table* table, common::column_id_t pkColumnID,
         common::LogicalType pkType, std::shared_ptr<FactorizedTable> fTable, storage::WAL* wal,
         storage::MemoryManager* mm)
         : BatchInsertSharedState{table, std::move(fTable), wal, mm}, pkColumnID{pkColumnID},
           pkType{std::move(pkType)}, globalIndexBuilder(std::nullopt), readerSharedState{nullptr},
-          sharedNodeGroup{nullptr} {}
+          sharedNodeGroup{nullptr}, startNodeOffset{0} {}
 
     void initPKIndex(const ExecutionContext* context);
 };
@@ -46,7 +46,9 @@ enum class PhysicalOperatorType : uint8_t {
     PARTITIONER,
     PATH_PROPERTY_PROBE,
     PRIMARY_KEY_SCAN_NODE_TABLE,
+    PROPERTY_INDEX_SCAN_NODE_TABLE,
     PROJECTION,
+    PROPERTY_LOOKUP,
     PROFILE,
     RECURSIVE_JOIN,
     RESULT_COLLECTOR,
@@ -128,7 +130,7 @@ public:
 
     virtual void finalize(ExecutionContext* context);
 
-    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+    virtual std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
         common::Profiler& profiler) const;
     std::vector<std::string> getProfilerAttributes(common::Profiler& profiler) const;
 
@@ -3,6 +3,7 @@
 #include "common/enums/accumulate_type.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/result_queue.h"
 
 namespace kuzu {
 namespace processor {
@@ -19,9 +20,15 @@ public:
 
     std::shared_ptr<FactorizedTable> getTable() { return table; }
 
+    // If a result queue is set, results are streamed through the queue instead of being merged
+    // into the shared table.
+    void setResultQueue(std::shared_ptr<ResultQueue> queue) { resultQueue = std::move(queue); }
+    ResultQueue* getResultQueue() const { return resultQueue.get(); }
+
 private:
     std::mutex mtx;
     std::shared_ptr<FactorizedTable> table;
+    std::shared_ptr<ResultQueue> resultQueue;
 };
 
 struct ResultCollectorInfo {
@@ -75,6 +82,9 @@ public:
     void finalizeInternal(ExecutionContext* context) final;
 
     std::shared_ptr<FactorizedTable> getResultFactorizedTable() { return sharedState->getTable(); }
+    void setResultQueue(std::shared_ptr<ResultQueue> queue) {
+        sharedState->setResultQueue(std::move(queue));
+    }
 
     std::unique_ptr<PhysicalOperator> clone() final {
         return make_unique<ResultCollector>(resultSetDescriptor->copy(), info.copy(), sharedState,
@@ -86,6 +96,8 @@ private:
 
     void initNecessaryLocalState(ResultSet* resultSet, ExecutionContext* context);
 
+    void executeStreaming(ExecutionContext* context, ResultQueue& queue);
+
 private:
     ResultCollectorInfo info;
     std::shared_ptr<ResultCollectorSharedState> sharedState;
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "expression_evaluator/expression_evaluator.h"
+#include "processor/operator/scan/scan_node_table.h"
+
+namespace kuzu {
+namespace processor {
+
+struct PropertyIndexScanPrintInfo final : OPPrintInfo {
+    binder::expression_vector expressions;
+    std::string property;
+    std::string key;
+    std::string alias;
+
+    PropertyIndexScanPrintInfo(binder::expression_vector expressions, std::string property,
+        std::string key, std::string alias)
+        : expressions{std::move(expressions)}, property{std::move(property)}, key{std::move(key)},
+          alias{std::move(alias)} {}
+
+    std::string toString() const override;
+
+    std::unique_ptr<OPPrintInfo> copy() const override {
+        return std::unique_ptr<PropertyIndexScanPrintInfo>(new PropertyIndexScanPrintInfo(*this));
+    }
+
+private:
+    PropertyIndexScanPrintInfo(const PropertyIndexScanPrintInfo& other)
+        : OPPrintInfo{other}, expressions{other.expressions}, property{other.property},
+          key{other.key}, alias{other.alias} {}
+};
+
+// Scans the nodes whose indexed property may be equal to the key. Candidates are emitted one node
+// at a time and must be re-checked by a filter on top, see storage::PropertyIndex.
+class PropertyIndexScanNodeTable final : public ScanTable {
+    static constexpr PhysicalOperatorType type_ =
+        PhysicalOperatorType::PROPERTY_INDEX_SCAN_NODE_TABLE;
+
+public:
+    PropertyIndexScanNodeTable(ScanTableInfo info, ScanNodeTableInfo nodeInfo,
+        common::column_id_t indexedColumnID,
+        std::unique_ptr<evaluator::ExpressionEvaluator> keyEvaluator, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : ScanTable{type_, std::move(info), id, std::move(printInfo)},
+          nodeInfo{std::move(nodeInfo)}, indexedColumnID{indexedColumnID},
+          keyEvaluator{std::move(keyEvaluator)}, candidateIdx{0}, initialized{false} {}
+
+    bool isSource() const override { return true; }
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    bool isParallel() const override { return false; }
+
+    std::unique_ptr<PhysicalOperator> clone() override {
+        return std::make_unique<PropertyIndexScanNodeTable>(info.copy(), nodeInfo.copy(),
+            indexedColumnID, keyEvaluator->clone(), id, printInfo->copy());
+    }
+
+private:
+    void initVectors(storage::TableScanState& state, const ResultSet& resultSet) const override;
+
+private:
+    ScanNodeTableInfo nodeInfo;
+    common::column_id_t indexedColumnID;
+    std::unique_ptr<evaluator::ExpressionEvaluator> keyEvaluator;
+    std::vector<common::offset_t> candidates;
+    common::idx_t candidateIdx;
+    bool initialized;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "processor/operator/scan/scan_node_table.h"
+
+namespace kuzu {
+namespace processor {
+
+struct PropertyLookupTableInfo {
+    // Only has the columns of the properties that the table has.
+    ScanNodeTableInfo nodeInfo;
+    // Positions of the properties that the table has in the output vectors. The others are null.
+    std::vector<common::idx_t> outVectorIdxs;
+
+    PropertyLookupTableInfo(ScanNodeTableInfo nodeInfo, std::vector<common::idx_t> outVectorIdxs)
+        : nodeInfo{std::move(nodeInfo)}, outVectorIdxs{std::move(outVectorIdxs)} {}
+    EXPLICIT_COPY_DEFAULT_MOVE(PropertyLookupTableInfo);
+
+private:
+    PropertyLookupTableInfo(const PropertyLookupTableInfo& other)
+        : nodeInfo{other.nodeInfo.copy()}, outVectorIdxs{other.outVectorIdxs} {}
+};
+
+// Reads properties of the nodes in the node ID vector, e.g. after filters and joins removed most of
+// the nodes a scan produced. Nodes are sorted and looked up one node group at a time, so that each
+// node group is initialized once and read in offset order.
+class PropertyLookup final : public ScanTable {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::PROPERTY_LOOKUP;
+
+public:
+    PropertyLookup(ScanTableInfo info,
+        common::table_id_map_t<PropertyLookupTableInfo> tableIDToInfo,
+        std::unique_ptr<PhysicalOperator> child, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : ScanTable{type_, std::move(info), std::move(child), id, std::move(printInfo)},
+          tableIDToInfo{std::move(tableIDToInfo)}, nodeIDVector{nullptr} {}
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> clone() override {
+        return std::make_unique<PropertyLookup>(info.copy(), copyMap(tableIDToInfo),
+            children[0]->clone(), id, printInfo->copy());
+    }
+
+private:
+    // Looks up nodes of the same table and node group.
+    void lookup(transaction::Transaction* transaction, common::nodeID_t firstNodeID,
+        std::span<const common::sel_t> nodePositions);
+
+private:
+    common::table_id_map_t<PropertyLookupTableInfo> tableIDToInfo;
+    common::ValueVector* nodeIDVector;
+    std::vector<common::ValueVector*> outVectors;
+    // Selects the nodes of one node group while they are looked up.
+    std::shared_ptr<common::SelectionVector> lookupSelVector;
+    std::vector<common::sel_t> positions;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -92,7 +92,7 @@ public:
         std::shared_ptr<ScanNodeTableProgressSharedState> progressSharedState)
         : ScanTable{type_, std::move(info), id, std::move(printInfo)}, currentTableIdx{0},
           nodeInfos{std::move(nodeInfos)}, sharedStates{std::move(sharedStates)},
-          progressSharedState{std::move(progressSharedState)} {
+          progressSharedState{std::move(progressSharedState)}, numRowsSkippedByZoneMap{nullptr} {
         KU_ASSERT(this->nodeInfos.size() == this->sharedStates.size());
     }
 
@@ -113,7 +113,14 @@ public:
 
     double getProgress(ExecutionContext* context) const override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
 private:
+    std::string getNumRowsSkippedByZoneMapMetricKey() const {
+        return "numRowsSkippedByZoneMap-" + std::to_string(id);
+    }
+
     void initGlobalStateInternal(ExecutionContext* context) override;
     void initVectors(storage::TableScanState& state, const ResultSet& resultSet) const override;
 
@@ -122,6 +129,7 @@ private:
     std::vector<ScanNodeTableInfo> nodeInfos;
     std::vector<std::shared_ptr<ScanNodeTableSharedState>> sharedStates;
     std::shared_ptr<ScanNodeTableProgressSharedState> progressSharedState;
+    common::NumericMetric* numRowsSkippedByZoneMap;
 };
 
 } // namespace processor
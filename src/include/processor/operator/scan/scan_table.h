@@ -1,5 +1,6 @@
 #pragma once
 
+#include "processor/operator/hash_join/join_key_filter.h"
 #include "processor/operator/physical_operator.h"
 #include "storage/store/table.h"
 
@@ -11,6 +12,8 @@ struct ScanTableInfo {
     DataPos nodeIDPos;
     // Output vector (properties or CSRs) positions
     std::vector<DataPos> outVectorsPos;
+    // Filters passed from the build side of hash joins over the keys of the output vectors.
+    std::vector<JoinKeyFilterInfo> joinKeyFilterInfos;
 
     ScanTableInfo(DataPos nodeIDPos, std::vector<DataPos> outVectorsPos)
         : nodeIDPos{nodeIDPos}, outVectorsPos{std::move(outVectorsPos)} {}
@@ -18,7 +21,8 @@ struct ScanTableInfo {
 
 private:
     ScanTableInfo(const ScanTableInfo& other)
-        : nodeIDPos{other.nodeIDPos}, outVectorsPos{other.outVectorsPos} {}
+        : nodeIDPos{other.nodeIDPos}, outVectorsPos{other.outVectorsPos},
+          joinKeyFilterInfos{other.joinKeyFilterInfos} {}
 };
 
 class ScanTable : public PhysicalOperator {
@@ -33,11 +37,18 @@ public:
         std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{operatorType, id, std::move(printInfo)}, info{std::move(info)} {}
 
+    void addJoinKeyFilter(JoinKeyFilterInfo filterInfo) {
+        info.joinKeyFilterInfos.push_back(std::move(filterInfo));
+    }
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
 protected:
     virtual void initVectors(storage::TableScanState& state, const ResultSet& resultSet) const;
 
 protected:
     ScanTableInfo info;
+    JoinKeyFilterApplier joinKeyFilterApplier;
 };
 
 } // namespace processor
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/exception/internal.h"
+#include "common/task_system/task.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/result/result_set_descriptor.h"
 
@@ -32,6 +33,13 @@ public:
 
     std::unique_ptr<PhysicalOperator> clone() override = 0;
 
+    // Finalize runs on a single thread while the task scheduler is locked. Sinks with expensive
+    // finalization can return a task here instead, which the query processor schedules after the
+    // pipeline of the sink has been finalized and before the pipelines depending on it start.
+    virtual std::unique_ptr<common::Task> createFinalizeTask(ExecutionContext* /*context*/) {
+        return nullptr;
+    }
+
 protected:
     virtual void executeInternal(ExecutionContext* context) = 0;
 
@@ -2,6 +2,7 @@
 
 #include "function/table/bind_data.h"
 #include "function/table_functions.h"
+#include "processor/operator/hash_join/join_key_filter.h"
 #include "processor/operator/physical_operator.h"
 
 namespace kuzu {
@@ -16,6 +17,7 @@ struct TableFunctionCallLocalState {
     std::unique_ptr<function::TableFuncLocalState> funcState = nullptr;
     function::TableFuncInput funcInput{};
     function::TableFuncOutput funcOutput{};
+    JoinKeyFilterApplier joinKeyFilterApplier;
 
     TableFunctionCallLocalState() = default;
     DELETE_COPY_DEFAULT_MOVE(TableFunctionCallLocalState);
@@ -32,6 +34,9 @@ struct TableFunctionCallInfo {
     std::unique_ptr<function::TableFuncBindData> bindData;
     std::vector<DataPos> outPosV;
     TableScanOutputType outputType = TableScanOutputType::EMPTY;
+    // Filters passed from the build side of hash joins over the output columns. Only applied if
+    // the output is a single data chunk.
+    std::vector<JoinKeyFilterInfo> joinKeyFilterInfos;
 
     TableFunctionCallInfo() = default;
     EXPLICIT_COPY_DEFAULT_MOVE(TableFunctionCallInfo);
@@ -42,6 +47,7 @@ private:
         bindData = other.bindData->copy();
         outPosV = other.outPosV;
         outputType = other.outputType;
+        joinKeyFilterInfos = other.joinKeyFilterInfos;
     }
 };
 
@@ -99,6 +105,10 @@ public:
 
     TableFunctionCallSharedState* getSharedState() { return sharedState.get(); }
 
+    void addJoinKeyFilter(JoinKeyFilterInfo filterInfo) {
+        info.joinKeyFilterInfos.push_back(std::move(filterInfo));
+    }
+
     bool isSource() const override { return true; }
 
     bool isParallel() const override { return info.function.canParallelFunc(); }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <unordered_set>
+
 #include "common/enums/rel_direction.h"
 #include "expression_mapper.h"
 #include "planner/operator/logical_operator.h"
@@ -97,6 +99,7 @@ private:
     std::unique_ptr<PhysicalOperator> mapPathPropertyProbe(
         planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapProjection(planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapPropertyLookup(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapRecursiveExtend(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapScanSource(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapScanNodeTable(planner::LogicalOperator* logicalOperator);
@@ -106,6 +109,8 @@ private:
     std::unique_ptr<PhysicalOperator> mapSetProperty(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapSetNodeProperty(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapSetRelProperty(planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapSharedSubplanScan(
+        planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapStandaloneCall(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapTableFunctionCall(
         planner::LogicalOperator* logicalOperator);
@@ -154,8 +159,11 @@ private:
         const binder::expression_vector& exprs, planner::Schema* schema,
         std::shared_ptr<FactorizedTable> table, uint64_t maxMorselSize);
 
+    // If compactInternalIDs is set, single table internal ID payloads are stored as offsets only.
+    // Their table must then only be read through FactorizedTable::lookup.
     std::unique_ptr<HashJoinBuildInfo> createHashBuildInfo(const planner::Schema& buildSideSchema,
-        const binder::expression_vector& keys, const binder::expression_vector& payloads);
+        const binder::expression_vector& keys, const binder::expression_vector& payloads,
+        bool compactInternalIDs);
 
     std::unique_ptr<PhysicalOperator> createDistinctHashAggregate(
         const binder::expression_vector& keys, const binder::expression_vector& payloads,
@@ -188,6 +196,15 @@ private:
 
     static void mapSIPJoin(PhysicalOperator* joinRoot);
 
+    // Appends the result collectors of the shared subplans mapped so far as the right most
+    // children of a result collector, so that they are materialized before its other pipelines.
+    void appendSharedSubplans(PhysicalOperator* resultCollector);
+
+    // Collects the scans whose output is reduced at runtime by a semi mask or a join key filter.
+    void collectRuntimeFilteredScans(planner::LogicalOperator* op);
+    // A plan without runtime filters produces the same tuples in any plan of the statement.
+    bool hasRuntimeFilters(planner::LogicalOperator* op) const;
+
     static std::vector<DataPos> getDataPos(const binder::expression_vector& expressions,
         const planner::Schema& schema);
 
@@ -201,6 +218,11 @@ public:
 
 private:
     std::unordered_map<planner::LogicalOperator*, PhysicalOperator*> logicalOpToPhysicalOpMap;
+    // Only collected for statements that can be re-optimized.
+    std::unordered_set<planner::LogicalOperator*> runtimeFilteredScans;
+    std::unordered_map<planner::LogicalOperator*, std::shared_ptr<FactorizedTable>>
+        sharedSubplanTables;
+    physical_op_vector_t sharedSubplanCollectors;
     uint32_t physicalOperatorID;
 };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/task_system/task.h"
+#include "common/timer.h"
 #include "processor/operator/sink.h"
 
 namespace kuzu {
@@ -20,6 +21,8 @@ public:
 
 private:
     bool sharedStateInitialized;
+    // Only started when the query is profiled.
+    common::Timer pipelineTimer;
     Sink* sink;
     ExecutionContext* executionContext;
 };
@@ -212,6 +212,16 @@ private:
     void readFlatCol(uint8_t** tuplesToRead, ft_col_idx_t colIdx, common::ValueVector& vector,
         uint64_t numTuplesToRead) const;
 
+    // Compact internal ID columns only store the offsets of their values, see ColumnSchema.
+    void copyVectorToCompactInternalIDColumn(const common::ValueVector& vector,
+        const BlockAppendingInfo& blockAppendInfo, uint64_t numAppendedTuples, ft_col_idx_t colIdx);
+    void readCompactInternalIDFlatCol(uint8_t** tuplesToRead, ft_col_idx_t colIdx,
+        common::ValueVector& vector, uint64_t numTuplesToRead) const;
+    // Reads the values at the positions of selVector, or all values if selVector is null.
+    void readCompactInternalIDUnflatCol(const uint8_t* tupleToRead,
+        const common::SelectionVector* selVector, ft_col_idx_t colIdx,
+        common::ValueVector& vector) const;
+
 private:
     storage::MemoryManager* memoryManager;
     // Table Schema. Keeping track of factorization structure.
@@ -242,6 +252,18 @@ public:
 
     void resetState();
 
+    // A reader can also consume whole tuples of the factorized table, e.g., to convert them column
+    // by column, as long as the iterator is not in the middle of a tuple.
+    bool isAtTupleBoundary() const {
+        return nextFlatTupleIdx == 0 || nextFlatTupleIdx >= numFlatTuples;
+    }
+    // Returns the index of the first tuple none of whose flat tuples has been read.
+    ft_tuple_idx_t getNextTupleIdx() const {
+        return nextFlatTupleIdx < numFlatTuples ? nextTupleIdx - 1 : nextTupleIdx;
+    }
+    void skipTuples(uint64_t numTuples);
+    const FactorizedTable& getFactorizedTable() const { return factorizedTable; }
+
 private:
     // The dataChunkPos may be not consecutive, which means some entries in the
     // flatTuplePositionsInDataChunk is invalid. We put pair(UINT64_MAX, UINT64_MAX) in the
@@ -17,7 +17,8 @@ typedef uint32_t ft_block_offset_t;
 class ColumnSchema {
 public:
     ColumnSchema(bool isUnFlat, common::idx_t groupID, uint32_t numBytes)
-        : isUnFlat{isUnFlat}, groupID{groupID}, numBytes{numBytes}, mayContainNulls{false} {}
+        : isUnFlat{isUnFlat}, groupID{groupID}, numBytes{numBytes}, mayContainNulls{false},
+          compactTableID{common::INVALID_TABLE_ID} {}
     EXPLICIT_COPY_DEFAULT_MOVE(ColumnSchema);
 
     bool isFlat() const { return !isUnFlat; }
@@ -26,8 +27,22 @@ public:
 
     uint32_t getNumBytes() const { return numBytes; }
 
+    // Internal ID columns whose values all belong to the same table only store their offsets,
+    // which halves their size. Must be set before the column is appended to a table schema.
+    void setCompactInternalID(common::table_id_t tableID) {
+        compactTableID = tableID;
+        if (!isUnFlat) {
+            numBytes = sizeof(common::offset_t);
+        }
+    }
+
+    bool isCompactInternalID() const { return compactTableID != common::INVALID_TABLE_ID; }
+
+    common::table_id_t getCompactTableID() const { return compactTableID; }
+
     bool operator==(const ColumnSchema& other) const {
-        return isUnFlat == other.isUnFlat && groupID == other.groupID && numBytes == other.numBytes;
+        return isUnFlat == other.isUnFlat && groupID == other.groupID &&
+               numBytes == other.numBytes && compactTableID == other.compactTableID;
     }
     bool operator!=(const ColumnSchema& other) const { return !(*this == other); }
 
@@ -50,6 +65,8 @@ private:
     // Whether column may contain nulls.
     // If this field is true, the column can still be all non-null.
     bool mayContainNulls;
+    // Table of all values of a compact internal ID column, INVALID_TABLE_ID for other columns.
+    common::table_id_t compactTableID;
 };
 
 class KUZU_API FactorizedTableSchema {
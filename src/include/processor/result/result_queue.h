@@ -0,0 +1,47 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+
+#include "processor/result/factorized_table.h"
+
+namespace kuzu {
+namespace processor {
+
+// Bounded queue of result chunks between the threads executing the root pipeline of a query
+// (producers) and the thread reading the query result (consumer). Producers block while the queue
+// is full, so the memory held by un-consumed results is bounded by CAPACITY chunks of at most
+// CHUNK_SIZE tuples each.
+class ResultQueue {
+public:
+    static constexpr uint64_t CAPACITY = 8;
+    // Number of factorized table tuples a thread appends before pushing its chunk.
+    static constexpr uint64_t CHUNK_SIZE = 2048;
+
+    ResultQueue() : finished{false}, closed{false} {}
+
+    // Returns false if the consumer closed the queue, in which case producers should stop.
+    bool push(std::shared_ptr<FactorizedTable> table);
+    // Blocks until a chunk is available. Returns nullptr once the producers finished and all chunks
+    // have been consumed, and rethrows the exception the producers finished with, if any.
+    std::shared_ptr<FactorizedTable> pop();
+
+    // Called once all producers are done.
+    void finish(std::exception_ptr exception = nullptr);
+    // Called by the consumer to unblock and stop the producers.
+    void close();
+
+private:
+    std::mutex mtx;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    std::deque<std::shared_ptr<FactorizedTable>> tables;
+    bool finished;
+    bool closed;
+    std::exception_ptr exception;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -140,7 +140,7 @@ struct InPlaceUpdateLocalState {
 };
 
 // Data statistics used for determining how to handle compressed data
-struct CompressionMetadata {
+struct KUZU_API CompressionMetadata {
 
     // Minimum and maximum are upper and lower bounds for the data.
     // Updates and deletions may cause them to no longer be the exact minimums and maximums,
@@ -381,6 +381,15 @@ public:
         uint64_t dstOffset, uint64_t numValues,
         const struct CompressionMetadata& metadata) const final;
 
+    // Decompresses like decompressFromPage, and sets selected[i] to whether the value written to
+    // dstBuffer at dstOffset + i is in [lower, upper], which must not be empty. If there are no
+    // negative values, full chunks are compared when they are unpacked, before the frame of
+    // reference offset is added.
+    void selectFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues, const struct CompressionMetadata& metadata,
+        T lower, T upper, uint8_t* selected) const
+        requires std::integral<T>;
+
     static bool canUpdateInPlace(std::span<const T> value, const CompressionMetadata& metadata,
         const std::optional<common::NullMask>& nullMask = std::nullopt,
         uint64_t nullMaskOffset = 0);
@@ -462,6 +471,25 @@ public:
         uint32_t posInVector, uint64_t numValuesToRead, const CompressionMetadata& metadata);
 };
 
+// Reads values like ReadCompressedValuesFromPageToVector, and also sets selected[i] to whether the
+// value read to position i of the vector is in [lower, upper], which must not be empty. Only
+// supports integer types.
+class SelectCompressedValuesFromPageToVector : public CompressedFunctor {
+public:
+    SelectCompressedValuesFromPageToVector(const common::LogicalType& logicalType,
+        StorageValue lower, StorageValue upper, uint8_t* selected)
+        : CompressedFunctor(logicalType), lower{lower}, upper{upper}, selected{selected} {}
+    SelectCompressedValuesFromPageToVector(const SelectCompressedValuesFromPageToVector&) = default;
+
+    void operator()(const uint8_t* frame, PageCursor& pageCursor, common::ValueVector* resultVector,
+        uint32_t posInVector, uint64_t numValuesToRead, const CompressionMetadata& metadata);
+
+private:
+    StorageValue lower;
+    StorageValue upper;
+    uint8_t* selected;
+};
+
 class ReadCompressedValuesFromPage : public CompressedFunctor {
 public:
     explicit ReadCompressedValuesFromPage(const common::LogicalType& logicalType)
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Deserializer;
+class Serializer;
+class ValueVector;
+} // namespace common
+
+namespace storage {
+
+class ColumnChunkData;
+
+// Non-unique in-memory index from the hash of a property value to the offsets of the nodes that
+// hold the value. A lookup returns a superset of the matching offsets: distinct values may share a
+// hash, and entries are never removed when a value is overwritten, deleted or rolled back. Callers
+// are therefore responsible for re-checking both the predicate and the visibility of every offset.
+// Stale entries are dropped when the index is rebuilt during checkpointing. Indexes are serialized
+// together with the node table they belong to. Only node table properties can be indexed.
+class PropertyIndex {
+public:
+    explicit PropertyIndex(common::PhysicalTypeID keyType) : keyType{keyType}, numEntries{0} {}
+
+    common::PhysicalTypeID getKeyType() const { return keyType; }
+    uint64_t getNumEntries() const;
+
+    // Inserts every selected non-null position pos of the vector with node offset startOffset + pos.
+    void insert(const common::ValueVector& keyVector, common::offset_t startOffset);
+    void insert(const common::ValueVector& keyVector, common::sel_t pos, common::offset_t offset);
+    void insert(const ColumnChunkData& chunkData, common::offset_t startOffset, uint64_t numValues);
+
+    // Returns the sorted and de-duplicated candidate offsets for the key at pos of keyVector.
+    std::vector<common::offset_t> lookup(const common::ValueVector& keyVector,
+        common::sel_t pos) const;
+
+    void clear();
+
+    void serialize(common::Serializer& serializer) const;
+    static std::unique_ptr<PropertyIndex> deserialize(common::Deserializer& deSer);
+
+    static bool isSupported(common::PhysicalTypeID keyType);
+
+private:
+    void insertNoLock(common::hash_t hash, common::offset_t offset);
+
+private:
+    mutable std::mutex mtx;
+    common::PhysicalTypeID keyType;
+    std::unordered_map<common::hash_t, std::vector<common::offset_t>> offsets;
+    uint64_t numEntries;
+};
+
+} // namespace storage
+} // namespace kuzu
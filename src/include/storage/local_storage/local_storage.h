@@ -4,6 +4,7 @@
 
 #include "common/copy_constructors.h"
 #include "storage/local_storage/local_table.h"
+#include "storage/store/node_table_write_listener.h"
 
 namespace kuzu {
 namespace main {
@@ -26,6 +27,10 @@ public:
     LocalTable* getLocalTable(common::table_id_t tableID,
         NotExistAction action = NotExistAction::RETURN_NULL);
 
+    // Registers a listener notified of a write in this transaction, so that it is notified when
+    // the transaction commits or rolls back.
+    void addWriteListener(std::shared_ptr<NodeTableWriteListener> listener);
+
     void commit();
     void rollback();
 
@@ -34,6 +39,7 @@ public:
 private:
     main::ClientContext& clientContext;
     std::unordered_map<common::table_id_t, std::unique_ptr<LocalTable>> tables;
+    std::vector<std::shared_ptr<NodeTableWriteListener>> writeListeners;
 };
 
 } // namespace storage
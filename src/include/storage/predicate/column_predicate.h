@@ -8,6 +8,7 @@ namespace kuzu {
 namespace storage {
 
 struct MergedColumnChunkStats;
+union StorageValue;
 
 class ColumnPredicate;
 class KUZU_API ColumnPredicateSet {
@@ -23,6 +24,17 @@ public:
 
     common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const;
 
+    // Whether any of the predicates can be checked against a single string value.
+    bool canSelectString() const;
+    // Checks a non-null string value of the column against the predicates that can be checked
+    // against it. Returns false if the value does not satisfy one of them.
+    bool selectString(std::string_view value) const;
+    // Computes [lower, upper], the range of stored values of an integer column of type columnType
+    // that may satisfy the predicates. Returns false if none of the predicates bound the range. The
+    // range is empty if lower > upper.
+    bool getIntegerRange(const common::LogicalType& columnType, StorageValue& lower,
+        StorageValue& upper) const;
+
     std::string toString() const;
 
 private:
@@ -42,6 +54,18 @@ public:
 
     virtual common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const = 0;
 
+    // Predicates on the stored strings of a column, e.g. equality or prefix matches, can be
+    // evaluated once per entry of a string dictionary instead of once per row.
+    virtual bool canSelectString() const { return false; }
+    virtual bool selectString(std::string_view /*value*/) const { KU_UNREACHABLE; }
+    // Comparisons with integer constants can be evaluated on a range of stored values. Narrows
+    // [lower, upper] to the values that may satisfy the predicate, and returns false if it can't be
+    // evaluated this way.
+    virtual bool narrowIntegerRange(const common::LogicalType& /*columnType*/,
+        StorageValue& /*lower*/, StorageValue& /*upper*/) const {
+        return false;
+    }
+
     virtual std::string toString();
 
     virtual std::unique_ptr<ColumnPredicate> copy() const = 0;
@@ -15,13 +15,22 @@ public:
 
     common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
 
+    bool narrowIntegerRange(const common::LogicalType& columnType, StorageValue& lower,
+        StorageValue& upper) const override;
+
     std::string toString() override;
 
     std::unique_ptr<ColumnPredicate> copy() const override {
         return std::make_unique<ColumnConstantPredicate>(columnName, expressionType, value);
     }
 
-private:
+    // Checks the min/max zone map against `column <expressionType> value`.
+    static common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats,
+        common::ExpressionType expressionType, const common::Value& value);
+
+    static std::string valueToString(const common::Value& value);
+
+protected:
     common::Value value;
 };
 
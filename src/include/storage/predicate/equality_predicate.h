@@ -0,0 +1,30 @@
+#pragma once
+
+#include "constant_predicate.h"
+
+namespace kuzu {
+namespace storage {
+
+// `column = constant`. In addition to the min/max zone map, consults the bloom filter of the
+// column chunk if there is one.
+class ColumnEqualityPredicate final : public ColumnConstantPredicate {
+public:
+    ColumnEqualityPredicate(std::string columnName, common::Value value)
+        : ColumnConstantPredicate{std::move(columnName), common::ExpressionType::EQUALS,
+              std::move(value)} {}
+
+    common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+
+    // The column is not casted, so string constants are compared with the stored strings.
+    bool canSelectString() const override {
+        return value.getDataType().getLogicalTypeID() == common::LogicalTypeID::STRING;
+    }
+    bool selectString(std::string_view stored) const override { return stored == value.strVal; }
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnEqualityPredicate>(columnName, value);
+    }
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "column_predicate.h"
+#include "common/types/value/value.h"
+
+namespace kuzu {
+namespace storage {
+
+// `column IN [constant, ...]`. A chunk is skipped if neither its zone map nor its bloom filter
+// admits any of the constants.
+class ColumnInListPredicate final : public ColumnPredicate {
+public:
+    ColumnInListPredicate(std::string columnName, std::vector<common::Value> values,
+        bool useBloomFilter)
+        : ColumnPredicate{std::move(columnName), common::ExpressionType::FUNCTION},
+          values{std::move(values)}, useBloomFilter{useBloomFilter} {}
+
+    common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+
+    bool canSelectString() const override;
+    bool selectString(std::string_view value) const override;
+
+    std::string toString() override;
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnInListPredicate>(columnName, values, useBloomFilter);
+    }
+
+private:
+    std::vector<common::Value> values;
+    // Bloom filters hash the stored values, so they can't be used if the column is casted.
+    bool useBloomFilter;
+};
+
+} // namespace storage
+} // namespace kuzu
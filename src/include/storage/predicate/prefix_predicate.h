@@ -0,0 +1,35 @@
+#pragma once
+
+#include "column_predicate.h"
+
+namespace kuzu {
+namespace storage {
+
+// `column STARTS WITH prefix`. String zone maps are not kept, so it is only evaluated against the
+// values of string dictionaries.
+class ColumnPrefixPredicate final : public ColumnPredicate {
+public:
+    ColumnPrefixPredicate(std::string columnName, std::string prefix)
+        : ColumnPredicate{std::move(columnName), common::ExpressionType::FUNCTION},
+          prefix{std::move(prefix)} {}
+
+    common::ZoneMapCheckResult checkZoneMap(
+        const MergedColumnChunkStats& /*stats*/) const override {
+        return common::ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+
+    bool canSelectString() const override { return true; }
+    bool selectString(std::string_view value) const override { return value.starts_with(prefix); }
+
+    std::string toString() override;
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnPrefixPredicate>(columnName, prefix);
+    }
+
+private:
+    std::string prefix;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -5,7 +5,9 @@
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "common/vector/value_vector.h"
+#include "storage/stats/histogram.h"
 #include "storage/stats/hyperloglog.h"
+#include "storage/stats/most_common_values.h"
 
 namespace kuzu {
 namespace storage {
@@ -17,43 +19,107 @@ public:
     EXPLICIT_COPY_DEFAULT_MOVE(ColumnStats);
 
     common::cardinality_t getNumDistinctValues() const { return hll ? hll->count() : 0; }
+    // Most common values are tracked for the same columns as the number of distinct values. Nulls
+    // are not counted, so the number of values they cover is the number of non-null values.
+    const MostCommonValues* getMostCommonValues() const { return hll ? &mcv : nullptr; }
+    // Only numeric columns have a histogram.
+    const Histogram* getHistogram() const { return histogram ? &*histogram : nullptr; }
+    common::cardinality_t getNumNonNullValues() const { return numNonNullValues; }
+    common::cardinality_t getNumNullValues() const { return numNullValues; }
+    // Fraction of the values seen by update() that are null.
+    double getNullFraction() const {
+        auto numValues = numNonNullValues + numNullValues;
+        return numValues == 0 ? 0 : static_cast<double>(numNullValues) / numValues;
+    }
+    // Average length in bytes of the non-null values of string columns, or 0 for other columns.
+    double getAverageStringLength() const {
+        return numNonNullValues == 0 ? 0 :
+                                       static_cast<double>(totalStringLength) / numNonNullValues;
+    }
 
     void update(const common::ValueVector* vector);
 
     void merge(const ColumnStats& other) {
+        numNonNullValues += other.numNonNullValues;
+        numNullValues += other.numNullValues;
+        totalStringLength += other.totalStringLength;
         if (hll) {
             KU_ASSERT(other.hll);
             hll->merge(*other.hll);
-        };
+            mcv.merge(other.mcv);
+        }
+        if (histogram) {
+            KU_ASSERT(other.histogram);
+            histogram->merge(*other.histogram);
+        }
     }
 
     void serialize(common::Serializer& serializer) const {
+        serializer.writeDebuggingInfo("num_non_null_values");
+        serializer.serializeValue(numNonNullValues);
+        serializer.writeDebuggingInfo("num_null_values");
+        serializer.serializeValue(numNullValues);
+        serializer.writeDebuggingInfo("total_string_length");
+        serializer.serializeValue(totalStringLength);
         serializer.writeDebuggingInfo("has_hll");
         serializer.serializeValue(hll.has_value());
         if (hll) {
             serializer.writeDebuggingInfo("hll");
             hll->serialize(serializer);
+            serializer.writeDebuggingInfo("mcv");
+            mcv.serialize(serializer);
+        }
+        serializer.writeDebuggingInfo("has_histogram");
+        serializer.serializeValue(histogram.has_value());
+        if (histogram) {
+            serializer.writeDebuggingInfo("histogram");
+            histogram->serialize(serializer);
         }
     }
 
     static ColumnStats deserialize(common::Deserializer& deserializer) {
         ColumnStats columnStats;
         std::string info;
+        deserializer.validateDebuggingInfo(info, "num_non_null_values");
+        deserializer.deserializeValue(columnStats.numNonNullValues);
+        deserializer.validateDebuggingInfo(info, "num_null_values");
+        deserializer.deserializeValue(columnStats.numNullValues);
+        deserializer.validateDebuggingInfo(info, "total_string_length");
+        deserializer.deserializeValue(columnStats.totalStringLength);
         deserializer.validateDebuggingInfo(info, "has_hll");
         bool hasHll = false;
         deserializer.deserializeValue(hasHll);
         if (hasHll) {
             deserializer.validateDebuggingInfo(info, "hll");
             columnStats.hll = HyperLogLog::deserialize(deserializer);
+            deserializer.validateDebuggingInfo(info, "mcv");
+            columnStats.mcv = MostCommonValues::deserialize(deserializer);
+        }
+        deserializer.validateDebuggingInfo(info, "has_histogram");
+        bool hasHistogram = false;
+        deserializer.deserializeValue(hasHistogram);
+        if (hasHistogram) {
+            deserializer.validateDebuggingInfo(info, "histogram");
+            columnStats.histogram = Histogram::deserialize(deserializer);
         }
         return columnStats;
     }
 
 private:
-    ColumnStats(const ColumnStats& other) : hll{other.hll}, hashes{nullptr} {}
+    ColumnStats(const ColumnStats& other)
+        : numNonNullValues{other.numNonNullValues}, numNullValues{other.numNullValues},
+          totalStringLength{other.totalStringLength}, hll{other.hll}, mcv{other.mcv},
+          histogram{other.histogram}, hashes{nullptr} {}
+
+    void updateHistogram(const common::ValueVector* vector);
 
 private:
+    common::cardinality_t numNonNullValues = 0;
+    common::cardinality_t numNullValues = 0;
+    uint64_t totalStringLength = 0;
     std::optional<HyperLogLog> hll;
+    MostCommonValues mcv;
+    std::optional<Histogram> histogram;
     // Preallocated vector for hash values.
     std::unique_ptr<common::ValueVector> hashes;
 };
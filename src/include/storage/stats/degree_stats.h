@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Distribution of the number of rels per bound node in one direction of a rel table. Bucket i of
+// the degree histogram counts the bound nodes whose degree is in [2^i, 2^(i+1)). The bound nodes
+// with the highest degrees are kept by their offsets.
+class DegreeStats {
+public:
+    static constexpr uint64_t NUM_BUCKETS = 32;
+    static constexpr uint64_t NUM_HEAVY_HITTERS = 8;
+
+    DegreeStats() : numBoundNodes{0}, numRels{0}, sumOfSquares{0}, maxDegree{0}, buckets{} {}
+
+    void insert(common::offset_t boundNodeOffset, uint64_t degree);
+    void merge(const DegreeStats& other);
+
+    // Number of bound nodes with at least one rel.
+    uint64_t getNumBoundNodes() const { return numBoundNodes; }
+    uint64_t getNumRels() const { return numRels; }
+    double getSumOfSquares() const { return sumOfSquares; }
+    uint64_t getMaxDegree() const { return maxDegree; }
+    const std::array<uint64_t, NUM_BUCKETS>& getBuckets() const { return buckets; }
+    // Pairs of bound node offset and degree in descending order of degree.
+    const std::vector<std::pair<common::offset_t, uint64_t>>& getHeavyHitters() const {
+        return heavyHitters;
+    }
+
+    void serialize(common::Serializer& serializer) const;
+    static DegreeStats deserialize(common::Deserializer& deserializer);
+
+private:
+    void addHeavyHitter(common::offset_t boundNodeOffset, uint64_t degree);
+
+private:
+    uint64_t numBoundNodes;
+    uint64_t numRels;
+    // Kept as a double as the squares of high degrees quickly overflow.
+    double sumOfSquares;
+    uint64_t maxDegree;
+    std::array<uint64_t, NUM_BUCKETS> buckets;
+    std::vector<std::pair<common::offset_t, uint64_t>> heavyHitters;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Equi-depth histogram of a numeric column. Values are kept in a uniform reservoir sample, from
+// which the bucket boundaries are derived when the histogram is read, so that the histogram stays
+// up to date as values are appended and samples of different threads can be merged.
+class Histogram {
+public:
+    static constexpr uint64_t SAMPLE_CAPACITY = 512;
+    static constexpr uint64_t NUM_BUCKETS = 32;
+
+    Histogram() : numValues{0}, randomState{0} {}
+
+    static bool isSupportedType(common::PhysicalTypeID physicalType);
+
+    void insert(double value) {
+        numValues++;
+        if (sample.size() < SAMPLE_CAPACITY) {
+            sample.push_back(value);
+            return;
+        }
+        auto idx = nextRandom() % numValues;
+        if (idx < SAMPLE_CAPACITY) {
+            sample[idx] = value;
+        }
+    }
+
+    void merge(const Histogram& other);
+
+    uint64_t getNumValues() const { return numValues; }
+    // Returns NUM_BUCKETS + 1 boundaries, such that each bucket holds about the same number of
+    // values, or nothing if the histogram is empty.
+    std::vector<double> getBoundaries() const;
+    // Estimated fraction of the values below (or equal to, if inclusive) the given value.
+    double estimateFractionBelow(double value, bool inclusive) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static Histogram deserialize(common::Deserializer& deserializer);
+
+private:
+    // splitmix64.
+    uint64_t nextRandom() {
+        auto z = (randomState += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+private:
+    uint64_t numValues;
+    uint64_t randomState;
+    std::vector<double> sample;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Most common values of a column, tracked by the hashes of the values with the Misra-Gries
+// summary. Any value occurring more than numValues / (CAPACITY + 1) times is guaranteed to be kept,
+// and its count is underestimated by at most that much. Summaries of different threads can be
+// merged without losing these guarantees.
+class MostCommonValues {
+public:
+    static constexpr uint64_t CAPACITY = 64;
+
+    MostCommonValues() : numValues{0} {}
+
+    void insert(common::hash_t hash) {
+        numValues++;
+        auto it = counts.find(hash);
+        if (it != counts.end()) {
+            it->second++;
+            return;
+        }
+        if (counts.size() < CAPACITY) {
+            counts.emplace(hash, 1);
+            return;
+        }
+        decrementAll(1);
+    }
+
+    void merge(const MostCommonValues& other);
+
+    uint64_t getNumValues() const { return numValues; }
+    // Returns a lower bound of the number of occurrences of the value with the given hash, or 0 if
+    // it is not among the most common values.
+    uint64_t getCount(common::hash_t hash) const {
+        auto it = counts.find(hash);
+        return it == counts.end() ? 0 : it->second;
+    }
+    const std::unordered_map<common::hash_t, uint64_t>& getEntries() const { return counts; }
+    // Counts of the most common values in descending order.
+    std::vector<uint64_t> getCounts() const;
+    uint64_t getSumOfCounts() const;
+    uint64_t getNumEntries() const { return counts.size(); }
+
+    void serialize(common::Serializer& serializer) const;
+    static MostCommonValues deserialize(common::Deserializer& deserializer);
+
+private:
+    // Subtracts count from every entry and drops the entries reaching 0.
+    void decrementAll(uint64_t count);
+
+private:
+    uint64_t numValues;
+    std::unordered_map<common::hash_t, uint64_t> counts;
+};
+
+} // namespace storage
+} // namespace kuzu
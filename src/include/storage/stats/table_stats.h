@@ -16,9 +16,13 @@ public:
     EXPLICIT_COPY_DEFAULT_MOVE(TableStats);
 
     void incrementCardinality(common::cardinality_t increment) { cardinality += increment; }
+    // Used when the column statistics are computed from a sample of the rows, which keeps the
+    // number of sampled rows unchanged.
+    void setCardinality(common::cardinality_t cardinality_) { cardinality = cardinality_; }
 
     void merge(const TableStats& other) {
         cardinality += other.cardinality;
+        numSampledRows += other.numSampledRows;
         KU_ASSERT(columnStats.size() == other.columnStats.size());
         for (auto i = 0u; i < columnStats.size(); ++i) {
             columnStats[i].merge(other.columnStats[i]);
@@ -27,9 +31,12 @@ public:
 
     common::cardinality_t getTableCard() const { return cardinality; }
 
-    common::cardinality_t getNumDistinctValues(common::column_id_t columnID) const {
+    common::cardinality_t getNumSampledRows() const { return numSampledRows; }
+
+    common::cardinality_t getNumDistinctValues(common::column_id_t columnID) const;
+    const ColumnStats& getColumnStats(common::column_id_t columnID) const {
         KU_ASSERT(columnID < columnStats.size());
-        return columnStats[columnID].getNumDistinctValues();
+        return columnStats[columnID];
     }
 
     void update(const std::vector<common::ValueVector*>& vectors,
@@ -49,6 +56,9 @@ private:
 private:
     // Note: cardinality is the estimated number of rows in the table. It is not always up-to-date.
     common::cardinality_t cardinality;
+    // Number of rows the column statistics were computed from. Differs from cardinality only after
+    // the statistics have been rebuilt from a sample of the table.
+    common::cardinality_t numSampledRows;
     std::vector<ColumnStats> columnStats;
 };
 
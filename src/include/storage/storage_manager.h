@@ -8,6 +8,9 @@
 #include "storage/wal/wal.h"
 
 namespace kuzu {
+namespace catalog {
+class PropertyIndexCatalogEntry;
+} // namespace catalog
 namespace main {
 class Database;
 } // namespace main
@@ -28,6 +31,11 @@ public:
     void createTable(common::table_id_t tableID, const catalog::Catalog* catalog,
         main::ClientContext* context);
 
+    // Builds the in-memory index of the given entry from the committed data of its table.
+    void createPropertyIndex(const catalog::Catalog& catalog,
+        const transaction::Transaction* transaction,
+        const catalog::PropertyIndexCatalogEntry& indexEntry);
+
     void checkpoint(main::ClientContext& clientContext);
     void rollbackCheckpoint(main::ClientContext& clientContext);
 
@@ -88,7 +88,7 @@ public:
         common::offset_t numRowsToAppend);
     void write(const ChunkedNodeGroup& data, common::column_id_t offsetColumnID);
 
-    void scan(const transaction::Transaction* transaction, const TableScanState& scanState,
+    void scan(const transaction::Transaction* transaction, TableScanState& scanState,
         const NodeGroupScanState& nodeGroupScanState, common::offset_t rowIdxInGroup,
         common::length_t numRowsToScan) const;
 
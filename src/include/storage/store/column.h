@@ -20,6 +20,7 @@ struct CompressionMetadata;
 using batch_lookup_func_t = read_values_to_page_func_t;
 
 class NullColumn;
+class ColumnPredicateSet;
 class StructColumn;
 class RelTableData;
 struct ColumnCheckpointState;
@@ -52,6 +53,13 @@ public:
     virtual void scan(transaction::Transaction* transaction, const ChunkState& state,
         common::offset_t startOffsetInChunk, common::row_idx_t numValuesToScan,
         common::ValueVector* resultVector) const;
+    // Scans like scan(), but may also remove rows whose values don't satisfy `predicates` from the
+    // selection vector of resultVector. Kept rows may still not satisfy them, so predicates must
+    // be evaluated again on the scanned values.
+    // Integer columns check comparisons with constants while decompressing values.
+    virtual void scanAndSelect(transaction::Transaction* transaction, const ChunkState& state,
+        common::offset_t startOffsetInChunk, common::row_idx_t numValuesToScan,
+        common::ValueVector* resultVector, const ColumnPredicateSet& predicates) const;
     virtual void lookupValue(const transaction::Transaction* transaction, const ChunkState& state,
         common::offset_t nodeOffset, common::ValueVector* resultVector, uint32_t posInVector) const;
 
@@ -6,6 +6,7 @@
 namespace kuzu {
 namespace storage {
 class MemoryManager;
+class ColumnPredicateSet;
 
 struct ChunkCheckpointState {
     std::unique_ptr<ColumnChunkData> chunkData;
@@ -50,6 +51,10 @@ public:
     void initializeScanState(ChunkState& state, const Column* column) const;
     void scan(const transaction::Transaction* transaction, const ChunkState& state,
         common::ValueVector& output, common::offset_t offsetInChunk, common::length_t length) const;
+    // See Column::scanAndSelect. Rows are only selected in chunks on disk without updates.
+    void scanAndSelect(const transaction::Transaction* transaction, const ChunkState& state,
+        common::ValueVector& output, common::offset_t offsetInChunk, common::length_t length,
+        const ColumnPredicateSet& predicates) const;
     template<ResidencyState SCAN_RESIDENCY_STATE>
     void scanCommitted(const transaction::Transaction* transaction, ChunkState& chunkState,
         ColumnChunk& output, common::row_idx_t startRow = 0,
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+class Value;
+} // namespace common
+
+namespace storage {
+
+class ColumnChunkData;
+
+// Bloom filter over the non-null values of a persistent column chunk. It complements the min/max
+// zone map for types whose values are not range-clustered (e.g. strings and UUIDs), so that
+// equality and IN-list predicates can skip chunks that cannot contain any of their constants.
+// The filter is register-blocked: every value sets NUM_HASH_FUNCTIONS bits inside a single 64-bit
+// word, so a probe touches exactly one word.
+class ColumnChunkBloomFilter {
+public:
+    static constexpr uint64_t NUM_BITS_PER_VALUE = 8;
+    static constexpr uint64_t NUM_HASH_FUNCTIONS = 3;
+
+    ColumnChunkBloomFilter(common::PhysicalTypeID physicalType, uint64_t numValues);
+
+    common::PhysicalTypeID getPhysicalType() const { return physicalType; }
+    uint64_t getNumWords() const { return words.size(); }
+
+    void insert(common::hash_t hash);
+    bool mayContain(common::hash_t hash) const;
+    // Returns true if the value may be present in the chunk. Values of a different physical type
+    // than the one the filter was built over are conservatively reported as present.
+    bool mayContain(const common::Value& value) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static std::shared_ptr<const ColumnChunkBloomFilter> deserialize(
+        common::Deserializer& deserializer);
+
+    static bool isSupported(common::PhysicalTypeID physicalType);
+    // Builds a bloom filter over the in-memory values of the chunk. Returns nullptr if the type is
+    // not supported or the chunk is empty.
+    static std::shared_ptr<const ColumnChunkBloomFilter> build(const ColumnChunkData& chunkData);
+
+private:
+    ColumnChunkBloomFilter(common::PhysicalTypeID physicalType, std::vector<uint64_t> words)
+        : physicalType{physicalType}, words{std::move(words)} {}
+
+    uint64_t getWordIdx(common::hash_t hash) const { return (hash >> 32) & (words.size() - 1); }
+    static uint64_t getMask(common::hash_t hash) {
+        uint64_t mask = 0;
+        for (auto i = 0u; i < NUM_HASH_FUNCTIONS; i++) {
+            mask |= static_cast<uint64_t>(1) << ((hash >> (i * 6)) & 63);
+        }
+        return mask;
+    }
+
+private:
+    common::PhysicalTypeID physicalType;
+    // The number of words is always a power of two.
+    std::vector<uint64_t> words;
+};
+
+} // namespace storage
+} // namespace kuzu
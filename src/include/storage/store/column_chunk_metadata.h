@@ -2,6 +2,7 @@
 
 #include "common/types/types.h"
 #include "storage/compression/compression.h"
+#include "storage/store/column_chunk_bloom_filter.h"
 
 namespace kuzu::storage {
 struct ColumnChunkMetadata {
@@ -9,6 +10,8 @@ struct ColumnChunkMetadata {
     common::page_idx_t numPages;
     uint64_t numValues;
     CompressionMetadata compMeta;
+    // Optional. Built when the chunk is flushed and dropped once the chunk is written in place.
+    std::shared_ptr<const ColumnChunkBloomFilter> bloomFilter;
 
     // Returns the number of pages used to store data
     // In the case of ALP compression, this does not include the number of pages used to store
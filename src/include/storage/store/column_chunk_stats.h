@@ -1,6 +1,8 @@
 #pragma once
 
 #include "storage/compression/compression.h"
+#include "storage/store/column_chunk_bloom_filter.h"
+
 namespace kuzu::storage {
 
 struct ColumnChunkStats {
@@ -23,6 +25,9 @@ struct MergedColumnChunkStats {
     ColumnChunkStats stats;
     bool guaranteedNoNulls;
     bool guaranteedAllNulls;
+    // Only set when every value of the chunk is covered by the bloom filter, i.e. there are no
+    // in-memory updates on top of the persistent data.
+    std::shared_ptr<const ColumnChunkBloomFilter> bloomFilter;
 
     void merge(const MergedColumnChunkStats& o, common::PhysicalTypeID dataType);
 };
@@ -2,9 +2,11 @@
 
 #include <array>
 #include <bitset>
+#include <unordered_map>
 
 #include "common/data_chunk/data_chunk.h"
 #include "storage/enums/csr_node_group_scan_source.h"
+#include "storage/stats/degree_stats.h"
 #include "storage/store/csr_chunked_node_group.h"
 #include "storage/store/node_group.h"
 
@@ -144,6 +146,8 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
 
     std::unique_ptr<ChunkedCSRHeader> oldHeader;
     std::unique_ptr<ChunkedCSRHeader> newHeader;
+    // Degree stats of the node groups rewritten by the checkpoint.
+    std::unordered_map<common::node_group_idx_t, DegreeStats> degreeStats;
 
     CSRNodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
         std::vector<Column*> columns, FileHandle& dataFH, MemoryManager* mm, Column* csrOffsetCol,
@@ -202,6 +206,9 @@ public:
         FileHandle* dataFH, ColumnStats* newColumnStats) override;
 
     void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state) override;
+    // Computes the degree stats of the committed rels without checkpointing them. Persistent rels
+    // that have been deleted since the last checkpoint are still counted.
+    DegreeStats computeDegreeStats(CSRNodeGroupCheckpointState& csrState) const;
 
     bool isEmpty() const override { return !persistentChunkGroup && NodeGroup::isEmpty(); }
 
@@ -234,7 +241,7 @@ private:
     NodeGroupScanResult scanCommittedInMem(const transaction::Transaction* transaction,
         RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const;
     NodeGroupScanResult scanCommittedInMemSequential(const transaction::Transaction* transaction,
-        const RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const;
+        RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const;
     NodeGroupScanResult scanCommittedInMemRandom(const transaction::Transaction* transaction,
         const RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const;
 
@@ -274,6 +281,7 @@ private:
         common::column_id_t columnID, const CSRNodeGroupCheckpointState& csrState,
         const CSRRegion& region);
     void checkpointCSRHeaderColumns(const CSRNodeGroupCheckpointState& csrState) const;
+    void collectDegreeStats(CSRNodeGroupCheckpointState& csrState) const;
     void finalizeCheckpoint(const common::UniqLock& lock);
 
 private:
@@ -7,6 +7,8 @@
 namespace kuzu {
 namespace storage {
 
+class ColumnPredicateSet;
+
 class DictionaryColumn {
 public:
     DictionaryColumn(const std::string& name, FileHandle* dataFH, MemoryManager* mm,
@@ -17,10 +19,13 @@ public:
     // Offsets to scan should be a sorted list of pairs mapping the index of the entry in the string
     // dictionary (as read from the index column) to the output index in the result vector to store
     // the string.
+    // If predicates are given, they are evaluated once for each distinct entry, and pairs whose
+    // entry doesn't satisfy them are removed from offsetsToScan without writing to the result.
     void scan(const transaction::Transaction* transaction, const ChunkState& offsetState,
         const ChunkState& dataState,
         std::vector<std::pair<DictionaryChunk::string_index_t, uint64_t>>& offsetsToScan,
-        common::ValueVector* resultVector, const ColumnChunkMetadata& indexMeta) const;
+        common::ValueVector* resultVector, const ColumnChunkMetadata& indexMeta,
+        const ColumnPredicateSet* predicates = nullptr) const;
 
     DictionaryChunk::string_index_t append(const DictionaryChunk& dictChunk, ChunkState& state,
         std::string_view val);
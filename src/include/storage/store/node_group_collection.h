@@ -85,6 +85,10 @@ public:
         KU_UNUSED(lock);
         return stats.copy();
     }
+    void setStats(const TableStats& stats) {
+        const auto lock = nodeGroups.lock();
+        this->stats = stats.copy();
+    }
     void mergeStats(const TableStats& stats) {
         auto lock = nodeGroups.lock();
         this->stats.merge(stats);
@@ -4,7 +4,9 @@
 
 #include "common/types/types.h"
 #include "storage/index/hash_index.h"
+#include "storage/index/property_index.h"
 #include "storage/store/node_group_collection.h"
+#include "storage/store/node_table_write_listener.h"
 #include "storage/store/table.h"
 
 namespace kuzu {
@@ -23,7 +25,7 @@ class Transaction;
 namespace storage {
 class NodeTable;
 
-struct NodeTableScanState final : TableScanState {
+struct KUZU_API NodeTableScanState final : TableScanState {
     // Scan state for un-committed data.
     // Ideally we shouldn't need columns to scan un-checkpointed but committed data.
     NodeTableScanState(common::table_id_t tableID, std::vector<common::column_id_t> columnIDs,
@@ -136,23 +138,30 @@ public:
         const catalog::NodeTableCatalogEntry* nodeTableEntry, bool readOnly,
         common::VirtualFileSystem* vfs, main::ClientContext* context);
 
-    common::row_idx_t getNumTotalRows(const transaction::Transaction* transaction) override;
+    KUZU_API common::row_idx_t getNumTotalRows(
+        const transaction::Transaction* transaction) override;
 
     void initScanState(transaction::Transaction* transaction,
         TableScanState& scanState) const override;
-    void initScanState(transaction::Transaction* transaction, TableScanState& scanState,
+    KUZU_API void initScanState(transaction::Transaction* transaction, TableScanState& scanState,
         common::table_id_t tableID, common::offset_t startOffset) const;
 
     bool scanInternal(transaction::Transaction* transaction, TableScanState& scanState) override;
-    bool lookup(transaction::Transaction* transaction, const TableScanState& scanState) const;
+    // Looks up all selected nodes, which must be in the node group the scan state is initialized
+    // to.
+    KUZU_API bool lookup(transaction::Transaction* transaction,
+        const TableScanState& scanState) const;
 
     // Return the max node offset during insertions.
     common::offset_t validateUniquenessConstraint(const transaction::Transaction* transaction,
         const std::vector<common::ValueVector*>& propertyVectors) const;
 
-    void insert(transaction::Transaction* transaction, TableInsertState& insertState) override;
-    void update(transaction::Transaction* transaction, TableUpdateState& updateState) override;
-    bool delete_(transaction::Transaction* transaction, TableDeleteState& deleteState) override;
+    KUZU_API void insert(transaction::Transaction* transaction,
+        TableInsertState& insertState) override;
+    KUZU_API void update(transaction::Transaction* transaction,
+        TableUpdateState& updateState) override;
+    KUZU_API bool delete_(transaction::Transaction* transaction,
+        TableDeleteState& deleteState) override;
 
     void addColumn(transaction::Transaction* transaction,
         TableAddColumnState& addColumnState) override;
@@ -160,8 +169,8 @@ public:
     bool isVisibleNoLock(const transaction::Transaction* transaction,
         common::offset_t offset) const;
 
-    bool lookupPK(const transaction::Transaction* transaction, common::ValueVector* keyVector,
-        uint64_t vectorPos, common::offset_t& result) const;
+    KUZU_API bool lookupPK(const transaction::Transaction* transaction,
+        common::ValueVector* keyVector, uint64_t vectorPos, common::offset_t& result) const;
     template<common::IndexHashable T>
     size_t appendPKWithIndexPos(const transaction::Transaction* transaction,
         const IndexBuffer<T>& buffer, uint64_t bufferOffset, uint64_t indexPos) {
@@ -169,6 +178,29 @@ public:
             [&](common::offset_t offset) { return isVisible(transaction, offset); });
     }
 
+    // Builds a property index over the committed values of the column. Later writes to the column
+    // are added to the index on update, commit and bulk append.
+    void addPropertyIndex(common::column_id_t columnID);
+    bool hasPropertyIndex(common::column_id_t columnID) const;
+    // Returns the candidate offsets of nodes whose value in the column may equal the key, including
+    // every uncommitted node of the transaction. Candidates must be re-checked by the caller.
+    std::vector<common::offset_t> lookupPropertyIndex(const transaction::Transaction* transaction,
+        common::column_id_t columnID, const common::ValueVector& keyVector,
+        common::sel_t pos) const;
+    // Drops indexes on columns that are no longer indexed and compacts the remaining ones. Must be
+    // called before the table itself is checkpointed.
+    void checkpointPropertyIndexes(const std::vector<common::column_id_t>& indexedColumnIDs);
+
+    // Listeners are identified by name, e.g., the name of the index they maintain. Adding a
+    // listener replaces the one with the same name.
+    KUZU_API void addWriteListener(const std::string& name,
+        std::shared_ptr<NodeTableWriteListener> listener);
+    KUZU_API void removeWriteListener(const std::string& name);
+    // Notifies the listeners of the rows in [startOffset, endOffset) bulk appended by the
+    // transaction.
+    void notifyBulkAppend(transaction::Transaction* transaction, common::offset_t startOffset,
+        common::offset_t endOffset) const;
+
     common::column_id_t getPKColumnID() const { return pkColumnID; }
     PrimaryKeyIndex* getPKIndex() const { return pkIndex.get(); }
     common::column_id_t getNumColumns() const { return columns.size(); }
@@ -210,6 +242,10 @@ public:
 
     TableStats getStats(const transaction::Transaction* transaction) const;
     void mergeStats(const TableStats& stats) { nodeGroups->mergeStats(stats); }
+    void setStats(const TableStats& stats) { nodeGroups->setStats(stats); }
+    // Computes the stats of the rows of a committed node group that are visible to transaction.
+    TableStats computeNodeGroupStats(transaction::Transaction* transaction,
+        common::node_group_idx_t nodeGroupIdx) const;
 
 private:
     void validatePkNotExists(const transaction::Transaction* transaction,
@@ -221,12 +257,25 @@ private:
     common::DataChunk constructDataChunkForPKColumn() const;
     void scanPKColumn(const transaction::Transaction* transaction, PKColumnScanHelper& scanHelper,
         NodeGroupCollection& nodeGroups_);
+    PropertyIndex* getPropertyIndex(common::column_id_t columnID) const;
+    std::vector<std::pair<common::column_id_t, PropertyIndex*>> getPropertyIndexes() const;
+    void insertIntoPropertyIndexes(transaction::Transaction* transaction,
+        NodeGroupCollection& nodeGroups_, TableScanSource source, common::offset_t startNodeOffset,
+        const std::vector<std::pair<common::column_id_t, PropertyIndex*>>& indexes);
+    // Returns the listeners to notify of a write and registers them with the local storage of the
+    // transaction, which notifies them on commit or rollback.
+    std::vector<std::shared_ptr<NodeTableWriteListener>> getWriteListeners(
+        const transaction::Transaction* transaction) const;
 
 private:
     std::vector<std::unique_ptr<Column>> columns;
     std::unique_ptr<NodeGroupCollection> nodeGroups;
     common::column_id_t pkColumnID;
     std::unique_ptr<PrimaryKeyIndex> pkIndex;
+    mutable std::mutex propertyIndexesMtx;
+    std::unordered_map<common::column_id_t, std::unique_ptr<PropertyIndex>> propertyIndexes;
+    mutable std::mutex writeListenersMtx;
+    std::vector<std::pair<std::string, std::shared_ptr<NodeTableWriteListener>>> writeListeners;
     NodeTableVersionRecordHandler versionRecordHandler;
 };
 
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace transaction {
+class Transaction;
+} // namespace transaction
+
+namespace storage {
+
+// Maintains a structure derived from the rows of a node table, e.g., an extension index stored in
+// other tables. Listeners are notified of the writes made through NodeTable::insert, update and
+// delete_ within the writing transaction, after the write has been applied. Writes made by a
+// listener to other tables are part of the same transaction and are rolled back with it. Bulk
+// appends (COPY) are reported once all rows of the COPY have been appended.
+class NodeTableWriteListener {
+public:
+    virtual ~NodeTableWriteListener() = default;
+
+    virtual void onInsert(transaction::Transaction* transaction, common::offset_t nodeOffset) = 0;
+    virtual void onUpdate(transaction::Transaction* transaction, common::offset_t nodeOffset,
+        common::column_id_t columnID) = 0;
+    virtual void onDelete(transaction::Transaction* transaction, common::offset_t nodeOffset) = 0;
+    // Reports the rows in [startOffset, endOffset) appended by a COPY. Rows that failed to copy
+    // are deleted before they are reported. By default each row is reported as inserted.
+    virtual void onBulkAppend(transaction::Transaction* transaction, common::offset_t startOffset,
+        common::offset_t endOffset) {
+        for (auto offset = startOffset; offset < endOffset; offset++) {
+            onInsert(transaction, offset);
+        }
+    }
+
+    // Called once when a transaction that notified the listener commits or rolls back.
+    virtual void onCommit(transaction::Transaction* transaction) = 0;
+    virtual void onRollback(transaction::Transaction* transaction) = 0;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -135,9 +135,11 @@ public:
 
     bool scanInternal(transaction::Transaction* transaction, TableScanState& scanState) override;
 
-    void insert(transaction::Transaction* transaction, TableInsertState& insertState) override;
+    KUZU_API void insert(transaction::Transaction* transaction,
+        TableInsertState& insertState) override;
     void update(transaction::Transaction* transaction, TableUpdateState& updateState) override;
-    bool delete_(transaction::Transaction* transaction, TableDeleteState& deleteState) override;
+    KUZU_API bool delete_(transaction::Transaction* transaction,
+        TableDeleteState& deleteState) override;
 
     void detachDelete(transaction::Transaction* transaction, common::RelDataDirection direction,
         RelTableDeleteState* deleteState);
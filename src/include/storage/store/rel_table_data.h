@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <mutex>
 
 #include "common/enums/rel_direction.h"
 #include "common/enums/rel_multiplicity.h"
@@ -93,6 +94,14 @@ public:
     common::RelMultiplicity getMultiplicity() const { return multiplicity; }
 
     TableStats getStats() const { return nodeGroups->getStats(); }
+    // Degree stats of the persistent data, merged over all node groups.
+    DegreeStats getDegreeStats() const;
+    // Replaces the degree stats of the node group, or adds to them if the rels of stats are
+    // appended to the ones already in the node group.
+    void updateDegreeStats(common::node_group_idx_t nodeGroupIdx, const DegreeStats& stats,
+        bool replace);
+    // Computes the degree stats of the committed rels of the node group from scratch.
+    DegreeStats computeDegreeStats(common::node_group_idx_t nodeGroupIdx) const;
 
     void checkpoint(const std::vector<common::column_id_t>& columnIDs);
 
@@ -155,6 +164,11 @@ private:
 
     PersistentVersionRecordHandler persistentVersionRecordHandler;
     InMemoryVersionRecordHandler inMemoryVersionRecordHandler;
+
+    // Degree stats indexed by node group. They are refreshed by COPY, checkpoints and ANALYZE, so
+    // rels inserted since then are not reflected.
+    mutable std::mutex degreeStatsMtx;
+    std::vector<DegreeStats> degreeStats;
 };
 
 } // namespace storage
@@ -24,6 +24,12 @@ public:
         ColumnChunkData* columnChunk, common::offset_t startOffset = 0,
         common::offset_t endOffset = common::INVALID_OFFSET) const override;
 
+    // Evaluates predicates on strings once per distinct dictionary entry among the scanned rows,
+    // and only decodes the strings of rows that satisfy them.
+    void scanAndSelect(transaction::Transaction* transaction, const ChunkState& state,
+        common::offset_t startOffsetInChunk, common::row_idx_t numValuesToScan,
+        common::ValueVector* resultVector, const ColumnPredicateSet& predicates) const override;
+
     void write(ColumnChunkData& persistentChunk, ChunkState& state, common::offset_t dstOffset,
         ColumnChunkData* data, common::offset_t srcOffset, common::length_t numValues) override;
 
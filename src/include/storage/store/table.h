@@ -34,6 +34,8 @@ struct TableScanState {
     std::unique_ptr<NodeGroupScanState> nodeGroupScanState;
 
     std::vector<ColumnPredicateSet> columnPredicateSets;
+    // Number of rows skipped because the zone maps (and bloom filters) ruled them out.
+    common::row_idx_t numRowsSkippedByZoneMap = 0;
 
     TableScanState(common::table_id_t tableID, std::vector<common::column_id_t> columnIDs,
         std::vector<const Column*> columns = {},
@@ -55,7 +57,7 @@ struct TableScanState {
 
     virtual bool scanNext(transaction::Transaction*) { KU_UNREACHABLE; }
 
-    void resetOutVectors();
+    KUZU_API void resetOutVectors();
 
     template<class TARGET>
     TARGET& cast() {
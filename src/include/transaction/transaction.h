@@ -63,6 +63,7 @@ public:
             forceCheckpoint = true;
         }
     }
+    void setForceCheckpoint() { forceCheckpoint = true; }
     bool shouldAppendToUndoBuffer() const {
         return getID() > DUMMY_TRANSACTION_ID && !isReadOnly();
     }
@@ -13,12 +13,15 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/plan_printer.h"
+#include "main/result_stream.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/standalone_call_rewriter.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
 #include "planner/operator/logical_plan_util.h"
 #include "planner/planner.h"
+#include "processor/adaptive_execution_state.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
 #include "storage/buffer_manager/buffer_manager.h"
@@ -53,6 +56,7 @@ ClientContext::ClientContext(Database* database)
     transactionContext = std::make_unique<TransactionContext>(*this);
     randomEngine = std::make_unique<RandomEngine>();
     remoteDatabase = nullptr;
+    activeStream = nullptr;
     graphEntrySet = std::make_unique<graph::GraphEntrySet>();
 #if defined(_WIN32)
     clientConfig.homeDirectory = getEnvVariable("USERPROFILE");
@@ -72,10 +76,19 @@ ClientContext::ClientContext(Database* database)
         ClientConfigDefault::RECURSIVE_PATTERN_FACTOR;
     clientConfig.disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
     clientConfig.warningLimit = ClientConfigDefault::WARNING_LIMIT;
+    clientConfig.enableStreamingResults = ClientConfigDefault::ENABLE_STREAMING_RESULTS;
+    clientConfig.profileJson = ClientConfigDefault::PROFILE_JSON;
+    clientConfig.profileSampleRate = ClientConfigDefault::PROFILE_SAMPLE_RATE;
+    clientConfig.analyzeSampleRate = ClientConfigDefault::ANALYZE_SAMPLE_RATE;
+    clientConfig.reoptimizationThreshold = ClientConfigDefault::REOPTIMIZATION_THRESHOLD;
+    clientConfig.joinOrderBudget = ClientConfigDefault::JOIN_ORDER_BUDGET;
     progressBar = std::make_unique<ProgressBar>(clientConfig.enableProgressBar);
 }
 
-ClientContext::~ClientContext() = default;
+ClientContext::~ClientContext() {
+    lock_t lck{mtx};
+    finishActiveStreamNoLock();
+}
 
 uint64_t ClientContext::getTimeoutRemainingInMS() const {
     KU_ASSERT(hasTimeout());
@@ -98,6 +111,15 @@ uint64_t ClientContext::getQueryTimeOut() const {
     return clientConfig.timeoutInMS;
 }
 
+void ClientContext::setStreamingResults(bool enable) {
+    lock_t lck{mtx};
+    clientConfig.enableStreamingResults = enable;
+}
+
+bool ClientContext::isStreamingResults() const {
+    return clientConfig.enableStreamingResults;
+}
+
 void ClientContext::setMaxNumThreadForExec(uint64_t numThreads) {
     lock_t lck{mtx};
     clientConfig.numThreads = numThreads;
@@ -246,6 +268,7 @@ std::string ClientContext::getEnvVariable(const std::string& name) {
 
 std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query) {
     std::unique_lock<std::mutex> lck{mtx};
+    finishActiveStreamNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -268,6 +291,7 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view queryStatemen
 
 std::unique_ptr<QueryResult> ClientContext::queryInternal(std::string_view query,
     std::string_view encodedJoin, bool enumerateAllPlans, std::optional<uint64_t> queryID) {
+    finishActiveStreamNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -276,10 +300,16 @@ std::unique_ptr<QueryResult> ClientContext::queryInternal(std::string_view query
     }
     std::unique_ptr<QueryResult> queryResult;
     QueryResult* lastResult = nullptr;
-    for (auto& statement : parsedStatements) {
-        auto preparedStatement = prepareNoLock(statement,
+    for (auto i = 0u; i < parsedStatements.size(); i++) {
+        auto preparedStatement = prepareNoLock(parsedStatements[i],
             enumerateAllPlans /* enumerate all plans */, encodedJoin, false /*requireNewTx*/);
-        auto currentQueryResult = executeNoLock(preparedStatement.get(), 0u, queryID);
+        std::unique_ptr<QueryResult> currentQueryResult;
+        if (i == parsedStatements.size() - 1 && encodedJoin.empty() &&
+            canStreamNoLock(preparedStatement.get())) {
+            currentQueryResult = executeStreamingNoLock(std::move(preparedStatement), queryID);
+        } else {
+            currentQueryResult = executeNoLock(preparedStatement.get(), 0u, queryID);
+        }
         if (!lastResult) {
             // first result of the query
             queryResult = std::move(currentQueryResult);
@@ -436,6 +466,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     std::optional<uint64_t> queryID) { // NOLINT(performance-unnecessary-value-param): It doesn't
                                        // make sense to pass the map as a const reference.
     lock_t lck{mtx};
+    finishActiveStreamNoLock();
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -448,6 +479,9 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     KU_ASSERT(preparedStatement->parsedStatement != nullptr);
     auto rebindPreparedStatement = prepareNoLock(preparedStatement->parsedStatement, false, "",
         false, preparedStatement->parameterMap);
+    if (canStreamNoLock(rebindPreparedStatement.get())) {
+        return executeStreamingNoLock(std::move(rebindPreparedStatement), queryID);
+    }
     return executeNoLock(rebindPreparedStatement.get(), 0u, queryID);
 }
 
@@ -466,11 +500,45 @@ void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
     }
 }
 
+bool ClientContext::canReoptimizeNoLock(PreparedStatement* preparedStatement,
+    uint32_t planIdx) const {
+    return clientConfig.reoptimizationThreshold > 0 && planIdx == 0 &&
+           preparedStatement->logicalPlans.size() == 1 &&
+           preparedStatement->getStatementType() == StatementType::QUERY &&
+           preparedStatement->isReadOnly() && !preparedStatement->isProfile();
+}
+
 std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* preparedStatement,
     uint32_t planIdx, std::optional<uint64_t> queryID) {
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
+    if (!canReoptimizeNoLock(preparedStatement, planIdx)) {
+        return executePlanNoLock(preparedStatement, planIdx, queryID);
+    }
+    adaptiveExecutionState =
+        std::make_unique<AdaptiveExecutionState>(clientConfig.reoptimizationThreshold);
+    auto queryResult = executePlanNoLock(preparedStatement, planIdx, queryID);
+    std::unique_ptr<PreparedStatement> reoptimizedStatement;
+    while (queryResult == nullptr) {
+        // The statement is bound again, so the same unique names identify the same parts of the
+        // query graph, and planned with the cardinalities observed so far. Its read-only
+        // transaction is kept.
+        reoptimizedStatement = prepareNoLock(preparedStatement->parsedStatement,
+            false /* enumerateAllPlans */, "" /* encodedJoin */, false /* requireNewTx */,
+            preparedStatement->parameterMap);
+        if (!reoptimizedStatement->isSuccess()) {
+            queryResult = queryResultWithError(reoptimizedStatement->errMsg);
+            break;
+        }
+        queryResult = executePlanNoLock(reoptimizedStatement.get(), 0u, queryID);
+    }
+    adaptiveExecutionState.reset();
+    return queryResult;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executePlanNoLock(PreparedStatement* preparedStatement,
+    uint32_t planIdx, std::optional<uint64_t> queryID) {
     if (preparedStatement->parsedStatement->requireTx() && getTx() == nullptr) {
         this->transactionContext->beginAutoTransaction(preparedStatement->isReadOnly());
     }
@@ -494,7 +562,7 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
         queryID = localDatabase->getNextQueryID();
     }
     auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
-    profiler->enabled = preparedStatement->isProfile();
+    profiler->enabled = preparedStatement->isProfile() || sampleProfileNoLock();
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
     std::shared_ptr<FactorizedTable> resultFT;
@@ -510,6 +578,11 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
                 this->transactionContext->commit();
             }
         }
+    } catch (ReoptimizationException&) {
+        getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+            [](auto& spiller) { spiller.clearFile(); });
+        progressBar->endProgress(executionContext->queryID);
+        return nullptr;
     } catch (CheckpointException& e) {
         transactionContext->clearTransaction();
         return handleFailedExecution(executionContext.get(), e);
@@ -522,6 +595,10 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
         [](auto& spiller) { spiller.clearFile(); });
     executingTimer.stop();
     queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
+    if (profiler->enabled && physicalPlan != nullptr) {
+        queryResult->querySummary->profileJson =
+            PlanPrinter::printProfileToJson(physicalPlan.get(), profiler.get());
+    }
     auto sResult = preparedStatement->statementResult.get();
     queryResult->setColumnHeader(sResult->getColumnNames(), sResult->getColumnTypes());
     queryResult->initResultTableAndIterator(std::move(resultFT));
@@ -529,6 +606,77 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     return queryResult;
 }
 
+bool ClientContext::sampleProfileNoLock() {
+    auto sampleRate = clientConfig.profileSampleRate;
+    if (sampleRate <= 0) {
+        return false;
+    }
+    if (sampleRate >= 1) {
+        return true;
+    }
+    return randomEngine->nextRandomInteger() <
+           sampleRate * static_cast<double>(std::numeric_limits<uint32_t>::max());
+}
+
+bool ClientContext::canStreamNoLock(PreparedStatement* preparedStatement) const {
+#ifdef __SINGLE_THREADED__
+    (void)preparedStatement;
+    return false;
+#else
+    return clientConfig.enableStreamingResults && preparedStatement->isSuccess() &&
+           preparedStatement->getStatementType() == StatementType::QUERY &&
+           preparedStatement->isReadOnly() && !preparedStatement->isProfile();
+#endif
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeStreamingNoLock(
+    std::unique_ptr<PreparedStatement> preparedStatement, std::optional<uint64_t> queryID) {
+    if (getTx() == nullptr) {
+        this->transactionContext->beginAutoTransaction(true /* readOnlyStatement */);
+    }
+    this->resetActiveQuery();
+    this->startTimer();
+    auto mapper = PlanMapper(this);
+    std::unique_ptr<PhysicalPlan> physicalPlan;
+    try {
+        physicalPlan = mapper.mapLogicalPlanToPhysical(preparedStatement->logicalPlans[0].get(),
+            preparedStatement->statementResult->getColumns());
+    } catch (std::exception& e) {
+        this->transactionContext->rollback();
+        return queryResultWithError(e.what());
+    }
+    auto queryResult = std::make_unique<QueryResult>(preparedStatement->preparedSummary);
+    auto sResult = preparedStatement->statementResult.get();
+    queryResult->setColumnHeader(sResult->getColumnNames(), sResult->getColumnTypes());
+    auto profiler = std::make_unique<Profiler>();
+    if (!queryID) {
+        queryID = localDatabase->getNextQueryID();
+    }
+    auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
+    profiler->enabled = sampleProfileNoLock();
+    auto stream = std::make_unique<ResultStream>(this, std::move(preparedStatement),
+        std::move(physicalPlan), std::move(profiler), std::move(executionContext),
+        queryResult->querySummary.get());
+    activeStream = stream.get();
+    queryResult->initResultStream(std::move(stream));
+    return queryResult;
+}
+
+void ClientContext::finishActiveStreamNoLock() {
+    if (activeStream != nullptr) {
+        activeStream->finishNoLock(true /* closedByOtherQuery */);
+        activeStream = nullptr;
+    }
+}
+
+void ClientContext::finishStream(ResultStream* stream) {
+    lock_t lck{mtx};
+    if (activeStream == stream) {
+        activeStream->finishNoLock();
+        activeStream = nullptr;
+    }
+}
+
 std::unique_ptr<QueryResult> ClientContext::handleFailedExecution(
     ExecutionContext* executionContext, std::exception& e) {
     getMemoryManager()->getBufferManager()->getSpillerOrSkip(
@@ -540,6 +688,10 @@ std::unique_ptr<QueryResult> ClientContext::handleFailedExecution(
 // If there is an active transaction in the context, we execute the function in current active
 // transaction. If there is no active transaction, we start an auto commit transaction.
 void ClientContext::runFuncInTransaction(const std::function<void(void)>& fun) {
+    {
+        lock_t lck{mtx};
+        finishActiveStreamNoLock();
+    }
     // check if we are on AutoCommit. In this case we should start a transaction
     bool startNewTrx = !transactionContext->hasActiveTransaction();
     if (startNewTrx) {
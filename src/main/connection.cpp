@@ -70,6 +70,10 @@ void Connection::setQueryTimeOut(uint64_t timeoutInMS) {
     clientContext->setQueryTimeOut(timeoutInMS);
 }
 
+void Connection::setStreamingResults(bool enable) {
+    clientContext->setStreamingResults(enable);
+}
+
 std::unique_ptr<QueryResult> Connection::executeWithParams(PreparedStatement* preparedStatement,
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams) {
     return clientContext->executeWithParams(preparedStatement, std::move(inputParams));
@@ -1,5 +1,7 @@
 #include "main/plan_printer.h"
 
+#include <limits>
+#include <mutex>
 #include <sstream>
 
 #include "json.hpp"
@@ -389,6 +391,70 @@ nlohmann::json PlanPrinter::printPlanToJson(const PhysicalPlan* physicalPlan, Pr
     return toJson(physicalPlan->lastOperator.get(), *profiler);
 }
 
+static void collectOperators(const PhysicalOperator* physicalOperator,
+    std::unordered_map<physical_op_id, const PhysicalOperator*>& operators) {
+    operators.insert({physicalOperator->getOperatorID(), physicalOperator});
+    for (auto i = 0u; i < physicalOperator->getNumChildren(); ++i) {
+        collectOperators(physicalOperator->getChild(i), operators);
+    }
+}
+
+std::string PlanPrinter::printProfileToJson(const PhysicalPlan* physicalPlan,
+    Profiler* profiler, int indent) {
+    auto json = nlohmann::json();
+    json["Plan"] = printPlanToJson(physicalPlan, profiler);
+    std::unordered_map<physical_op_id, const PhysicalOperator*> operators;
+    collectOperators(physicalPlan->lastOperator.get(), operators);
+    auto pipelines = nlohmann::json::array();
+    std::lock_guard<std::mutex> lck(profiler->mtx);
+    for (auto& [pipelineID, pipelineMetrics] : profiler->pipelineMetrics) {
+        auto pipeline = nlohmann::json();
+        pipeline["Sink"] = operators.contains(pipelineID) ?
+                               getOperatorName(operators.at(pipelineID)) :
+                               std::to_string(pipelineID);
+        pipeline["WallTime"] = pipelineMetrics.wallTimeMS;
+        PipelineThreadMetrics total;
+        auto totalThreadTime = 0.0;
+        auto minThreadTime = std::numeric_limits<double>::max();
+        auto maxThreadTime = 0.0;
+        auto threads = nlohmann::json::array();
+        for (auto& threadMetrics : pipelineMetrics.threads) {
+            totalThreadTime += threadMetrics.wallTimeMS;
+            total.cpuTimeMS += threadMetrics.cpuTimeMS;
+            total.numPins += threadMetrics.numPins;
+            total.numEvictions += threadMetrics.numEvictions;
+            total.numBytesRead += threadMetrics.numBytesRead;
+            total.numBytesWritten += threadMetrics.numBytesWritten;
+            total.numBytesSpilled += threadMetrics.numBytesSpilled;
+            // Threads of a pipeline run concurrently, so their peaks may add up.
+            total.peakMemoryUsage += threadMetrics.peakMemoryUsage;
+            minThreadTime = std::min(minThreadTime, threadMetrics.wallTimeMS);
+            maxThreadTime = std::max(maxThreadTime, threadMetrics.wallTimeMS);
+            threads.push_back(toJson(threadMetrics));
+        }
+        auto numThreads = pipelineMetrics.threads.size();
+        pipeline["CPUTime"] = total.cpuTimeMS;
+        pipeline["NumThreads"] = numThreads;
+        if (numThreads > 0) {
+            pipeline["MinThreadTime"] = minThreadTime;
+            pipeline["MaxThreadTime"] = maxThreadTime;
+            // Ratio of the slowest thread to the average one. 1 means no skew.
+            pipeline["ThreadSkew"] =
+                totalThreadTime > 0 ? maxThreadTime * numThreads / totalThreadTime : 1.0;
+        }
+        pipeline["NumPins"] = total.numPins;
+        pipeline["NumEvictions"] = total.numEvictions;
+        pipeline["NumBytesRead"] = total.numBytesRead;
+        pipeline["NumBytesWritten"] = total.numBytesWritten;
+        pipeline["NumBytesSpilled"] = total.numBytesSpilled;
+        pipeline["PeakMemoryUsage"] = total.peakMemoryUsage;
+        pipeline["Threads"] = std::move(threads);
+        pipelines.push_back(std::move(pipeline));
+    }
+    json["Pipelines"] = std::move(pipelines);
+    return json.dump(indent);
+}
+
 std::ostringstream PlanPrinter::printPlanToOstream(const PhysicalPlan* physicalPlan,
     Profiler* profiler) {
     return OpProfileTree(physicalPlan->lastOperator.get(), *profiler).printPlanToOstream();
@@ -432,6 +498,19 @@ nlohmann::json PlanPrinter::toJson(const PhysicalOperator* physicalOperator, Pro
     return json;
 }
 
+nlohmann::json PlanPrinter::toJson(const PipelineThreadMetrics& threadMetrics) {
+    auto json = nlohmann::json();
+    json["WallTime"] = threadMetrics.wallTimeMS;
+    json["CPUTime"] = threadMetrics.cpuTimeMS;
+    json["NumPins"] = threadMetrics.numPins;
+    json["NumEvictions"] = threadMetrics.numEvictions;
+    json["NumBytesRead"] = threadMetrics.numBytesRead;
+    json["NumBytesWritten"] = threadMetrics.numBytesWritten;
+    json["NumBytesSpilled"] = threadMetrics.numBytesSpilled;
+    json["PeakMemoryUsage"] = threadMetrics.peakMemoryUsage;
+    return json;
+}
+
 nlohmann::json PlanPrinter::toJson(const LogicalOperator* logicalOperator) {
     auto json = nlohmann::json();
     json["Name"] = getOperatorName(logicalOperator);
@@ -2,6 +2,8 @@
 
 #include "common/arrow/arrow_converter.h"
 #include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "main/result_stream.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/flat_tuple.h"
 
@@ -42,6 +44,7 @@ std::vector<LogicalType> QueryResult::getColumnDataTypes() const {
 }
 
 uint64_t QueryResult::getNumTuples() const {
+    validateNotStreaming("getNumTuples");
     return factorizedTable->getTotalNumFlatTuples();
 }
 
@@ -50,9 +53,14 @@ QuerySummary* QueryResult::getQuerySummary() const {
 }
 
 void QueryResult::resetIterator() {
+    validateNotStreaming("resetIterator");
     iterator->resetState();
 }
 
+bool QueryResult::isStreaming() const {
+    return stream != nullptr;
+}
+
 void QueryResult::setColumnHeader(std::vector<std::string> columnNames_,
     std::vector<LogicalType> columnTypes_) {
     columnNames = std::move(columnNames_);
@@ -62,6 +70,15 @@ void QueryResult::setColumnHeader(std::vector<std::string> columnNames_,
 void QueryResult::initResultTableAndIterator(
     std::shared_ptr<processor::FactorizedTable> factorizedTable_) {
     factorizedTable = std::move(factorizedTable_);
+    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, initTuple());
+}
+
+void QueryResult::initResultStream(std::unique_ptr<ResultStream> stream_) {
+    stream = std::move(stream_);
+    stream->start(initTuple());
+}
+
+std::vector<Value*> QueryResult::initTuple() {
     tuple = std::make_shared<FlatTuple>();
     std::vector<Value*> valuesToCollect;
     for (auto& type : columnDataTypes) {
@@ -69,11 +86,14 @@ void QueryResult::initResultTableAndIterator(
         valuesToCollect.push_back(value.get());
         tuple->addValue(std::move(value));
     }
-    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, std::move(valuesToCollect));
+    return valuesToCollect;
 }
 
 bool QueryResult::hasNext() const {
     validateQuerySucceed();
+    if (stream) {
+        return stream->hasNextFlatTuple();
+    }
     return iterator->hasNextFlatTuple();
 }
 
@@ -95,10 +115,21 @@ std::shared_ptr<FlatTuple> QueryResult::getNext() {
             "No more tuples in QueryResult, Please check hasNext() before calling getNext().");
     }
     validateQuerySucceed();
-    iterator->getNextFlatTuple();
+    if (stream) {
+        stream->getNextFlatTuple();
+    } else {
+        iterator->getNextFlatTuple();
+    }
     return tuple;
 }
 
+FlatTupleIterator* QueryResult::getFlatTupleIterator() {
+    if (stream) {
+        return stream->getFlatTupleIterator();
+    }
+    return iterator.get();
+}
+
 std::string QueryResult::toString() {
     std::string result;
     if (isSuccess()) {
@@ -110,7 +141,9 @@ std::string QueryResult::toString() {
             result += columnNames[i];
         }
         result += "\n";
-        resetIterator();
+        if (!stream) {
+            resetIterator();
+        }
         while (hasNext()) {
             getNext();
             result += tuple->toString();
@@ -127,6 +160,13 @@ void QueryResult::validateQuerySucceed() const {
     }
 }
 
+void QueryResult::validateNotStreaming(const std::string& functionName) const {
+    if (stream) {
+        throw RuntimeException(
+            stringFormat("{} is not supported for streaming query results.", functionName));
+    }
+}
+
 std::unique_ptr<ArrowSchema> QueryResult::getArrowSchema() const {
     return ArrowConverter::toArrowSchema(getColumnDataTypes(), getColumnNames());
 }
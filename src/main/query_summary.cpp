@@ -15,6 +15,14 @@ double QuerySummary::getExecutionTime() const {
     return executionTime;
 }
 
+bool QuerySummary::isProfiled() const {
+    return !profileJson.empty();
+}
+
+std::string QuerySummary::getProfileJson() const {
+    return profileJson;
+}
+
 void QuerySummary::setPreparedSummary(PreparedSummary preparedSummary_) {
     preparedSummary = preparedSummary_;
 }
@@ -0,0 +1,134 @@
+#include "main/result_stream.h"
+
+#include "common/exception/runtime.h"
+#include "common/task_system/progress_bar.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "main/plan_printer.h"
+#include "processor/operator/result_collector.h"
+#include "processor/processor.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/spiller.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace main {
+
+ResultStream::ResultStream(ClientContext* context,
+    std::unique_ptr<PreparedStatement> preparedStatement,
+    std::unique_ptr<PhysicalPlan> physicalPlan, std::unique_ptr<Profiler> profiler,
+    std::unique_ptr<ExecutionContext> executionContext, QuerySummary* querySummary)
+    : context{context}, preparedStatement{std::move(preparedStatement)},
+      physicalPlan{std::move(physicalPlan)}, profiler{std::move(profiler)},
+      executionContext{std::move(executionContext)}, querySummary{querySummary},
+      executingTimer{true /* enable */}, queue{std::make_shared<ResultQueue>()}, drained{false},
+      finished{false}, closedByOtherQuery{false} {}
+
+ResultStream::~ResultStream() {
+    if (context != nullptr) {
+        context->finishStream(this);
+    }
+#ifndef __SINGLE_THREADED__
+    if (producer.joinable()) {
+        producer.join();
+    }
+#endif
+}
+
+void ResultStream::start(std::vector<Value*> valuesToCollect_) {
+#ifdef __SINGLE_THREADED__
+    KU_UNREACHABLE;
+#else
+    valuesToCollect = std::move(valuesToCollect_);
+    auto resultCollector = ku_dynamic_cast<ResultCollector*>(physicalPlan->lastOperator.get());
+    resultCollector->setResultQueue(queue);
+    executingTimer.start();
+    producer = std::thread([this]() {
+        try {
+            context->getDatabase()->queryProcessor->execute(physicalPlan.get(),
+                executionContext.get());
+        } catch (...) {
+            producerException = std::current_exception();
+            context->getProgressBar()->endProgress(executionContext->queryID);
+        }
+        queue->finish(producerException);
+    });
+#endif
+}
+
+bool ResultStream::hasNextFlatTuple() {
+    while (iterator == nullptr || !iterator->hasNextFlatTuple()) {
+        if (finished) {
+            if (closedByOtherQuery) {
+                throw RuntimeException("The streaming query result has been closed because "
+                                       "another query was executed on its connection or the "
+                                       "connection was closed.");
+            }
+            return false;
+        }
+        std::shared_ptr<FactorizedTable> table;
+        try {
+            table = queue->pop();
+        } catch (...) {
+            drained = true;
+            context->finishStream(this);
+            throw;
+        }
+        if (table == nullptr) {
+            drained = true;
+            context->finishStream(this);
+            return false;
+        }
+        currentTable = std::move(table);
+        iterator = std::make_unique<FlatTupleIterator>(*currentTable, valuesToCollect);
+    }
+    return true;
+}
+
+void ResultStream::getNextFlatTuple() {
+    iterator->getNextFlatTuple();
+}
+
+void ResultStream::finishNoLock(bool closedByOtherQuery_) {
+    if (finished) {
+        return;
+    }
+    finished = true;
+    closedByOtherQuery = closedByOtherQuery_;
+    if (!drained) {
+        // Unblock the threads waiting for space in the queue and stop the remaining pipelines.
+        queue->close();
+        context->interrupt();
+    }
+#ifndef __SINGLE_THREADED__
+    producer.join();
+#endif
+    auto transactionContext = context->getTransactionContext();
+    if (!drained) {
+        // The query was abandoned by its reader, so there is nothing left to report.
+        if (transactionContext->isAutoTransaction()) {
+            transactionContext->rollback();
+        }
+    } else if (producerException) {
+        transactionContext->rollback();
+    } else if (transactionContext->isAutoTransaction()) {
+        transactionContext->commit();
+    }
+    context->getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+        [](auto& spiller) { spiller.clearFile(); });
+    executingTimer.stop();
+    querySummary->executionTime = executingTimer.getElapsedTimeMS();
+    if (drained && !producerException && profiler->enabled) {
+        querySummary->profileJson =
+            PlanPrinter::printProfileToJson(physicalPlan.get(), profiler.get());
+    }
+    iterator.reset();
+    currentTable.reset();
+    context = nullptr;
+}
+
+} // namespace main
+} // namespace kuzu
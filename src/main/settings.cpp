@@ -32,5 +32,44 @@ void SpillToDiskSetting::setContext(ClientContext* context, const common::Value&
     context->getMemoryManager()->getBufferManager()->resetSpiller(spillPath);
 }
 
+void ProfileSampleRateSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto sampleRate = parameter.getValue<double>();
+    if (sampleRate < 0 || sampleRate > 1) {
+        throw common::RuntimeException("profile_sample_rate must be between 0 and 1.");
+    }
+    context->getClientConfigUnsafe()->profileSampleRate = sampleRate;
+}
+
+void AnalyzeSampleRateSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto sampleRate = parameter.getValue<double>();
+    if (sampleRate <= 0 || sampleRate > 1) {
+        throw common::RuntimeException("analyze_sample_rate must be in (0, 1].");
+    }
+    context->getClientConfigUnsafe()->analyzeSampleRate = sampleRate;
+}
+
+void ReoptimizationThresholdSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto threshold = parameter.getValue<double>();
+    if (threshold != 0 && threshold < 1) {
+        throw common::RuntimeException("reoptimization_threshold must be 0 or at least 1.");
+    }
+    context->getClientConfigUnsafe()->reoptimizationThreshold = threshold;
+}
+
+void JoinOrderBudgetSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto budget = parameter.getValue<int64_t>();
+    if (budget < 0) {
+        throw common::RuntimeException("join_order_budget must be non-negative.");
+    }
+    context->getClientConfigUnsafe()->joinOrderBudget = budget;
+}
+
 } // namespace main
 } // namespace kuzu
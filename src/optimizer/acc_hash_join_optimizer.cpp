@@ -2,13 +2,16 @@
 
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "optimizer/logical_operator_collector.h"
+#include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/extend/logical_recursive_extend.h"
 #include "planner/operator/logical_accumulate.h"
 #include "planner/operator/logical_gds_call.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_intersect.h"
+#include "planner/operator/logical_table_function_call.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "planner/operator/sip/logical_semi_masker.h"
+#include "processor/operator/hash_join/join_key_filter.h"
 
 using namespace kuzu::common;
 using namespace kuzu::binder;
@@ -134,6 +137,11 @@ void HashJoinSIPOptimizer::visitOperator(LogicalOperator* op) {
 }
 
 void HashJoinSIPOptimizer::visitHashJoin(LogicalOperator* op) {
+    tryApplyHJSemiMask(op);
+    tryApplyJoinKeyFilter(op);
+}
+
+void HashJoinSIPOptimizer::tryApplyHJSemiMask(LogicalOperator* op) {
     auto& hashJoin = op->cast<LogicalHashJoin>();
     if (LogicalOperatorUtils::isAccHashJoin(hashJoin)) {
         return;
@@ -237,6 +245,112 @@ bool HashJoinSIPOptimizer::tryBuildToProbeHJSIP(LogicalOperator* op) {
     return true;
 }
 
+// Costs of the join key filter, in units of probing the hash table with one tuple as in CostModel.
+// Inserting a build key only sets bits of the filter, and checking a probe key is a hash and a
+// lookup in a cache resident filter.
+static constexpr double JOIN_KEY_FILTER_INSERT_COST = 0.5;
+static constexpr double JOIN_KEY_FILTER_CHECK_COST = 0.25;
+// With 16 bits per key and 3 bits set per key.
+static constexpr double JOIN_KEY_FILTER_FALSE_POSITIVE_RATE = 0.01;
+
+static bool containsExpression(const expression_vector& expressions, const Expression& key) {
+    for (auto& expression : expressions) {
+        if (expression->getUniqueName() == key.getUniqueName()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Collects the scans producing key which run in the same pipeline as the probe of the join. Only
+// operators that never drop or merge rows based on rows other than their own, and that leave key
+// unchanged, are traversed; filtering below them is then equivalent to filtering at the probe.
+// numPassedOperators is the number of operators between the join and the scans, which process the
+// rows the filter drops.
+static void collectJoinKeyFilterTargets(const Expression& key, LogicalOperator* op,
+    std::vector<LogicalOperator*>& targets, uint64_t& numPassedOperators) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        auto& scan = op->constCast<LogicalScanNodeTable>();
+        if (scan.getScanType() == LogicalScanNodeTableType::SCAN &&
+            containsExpression(scan.getProperties(), key)) {
+            targets.push_back(op);
+        }
+    } break;
+    case LogicalOperatorType::EXTEND: {
+        if (containsExpression(op->constCast<LogicalExtend>().getProperties(), key)) {
+            targets.push_back(op);
+        } else {
+            numPassedOperators++;
+            collectJoinKeyFilterTargets(key, op->getChild(0).get(), targets, numPassedOperators);
+        }
+    } break;
+    case LogicalOperatorType::TABLE_FUNCTION_CALL: {
+        if (containsExpression(op->constCast<LogicalTableFunctionCall>().getColumns(), key)) {
+            targets.push_back(op);
+        }
+    } break;
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::PROJECTION:
+    case LogicalOperatorType::PROPERTY_LOOKUP:
+    // The build sides of joins run in their own pipelines, so only the probe sides are visited.
+    case LogicalOperatorType::CROSS_PRODUCT:
+    case LogicalOperatorType::HASH_JOIN:
+    case LogicalOperatorType::INTERSECT: {
+        numPassedOperators++;
+        collectJoinKeyFilterTargets(key, op->getChild(0).get(), targets, numPassedOperators);
+    } break;
+    default:
+        break;
+    }
+}
+
+void HashJoinSIPOptimizer::tryApplyJoinKeyFilter(LogicalOperator* op) {
+    auto& hashJoin = op->cast<LogicalHashJoin>();
+    if (hashJoin.getJoinType() != JoinType::INNER || hashJoin.getJoinConditions().size() != 1) {
+        return;
+    }
+    // The filter is only built once the build side is done, so the probe side must not run first.
+    if (LogicalOperatorUtils::isAccHashJoin(hashJoin) ||
+        hashJoin.getSIPInfo().dependency == SIPDependency::BUILD_DEPENDS_ON_PROBE) {
+        return;
+    }
+    auto [probeKey, buildKey] = hashJoin.getJoinConditions()[0];
+    if (probeKey->getDataType() != buildKey->getDataType() ||
+        !processor::JoinKeyFilter::isSupportedKeyType(probeKey->getDataType())) {
+        return;
+    }
+    auto buildCard = hashJoin.getChild(1)->getCardinality();
+    if (buildCard > processor::JoinKeyFilter::MAX_NUM_KEYS) {
+        return;
+    }
+    std::vector<LogicalOperator*> targets;
+    uint64_t numPassedOperators = 0;
+    collectJoinKeyFilterTargets(*probeKey, hashJoin.getChild(0).get(), targets,
+        numPassedOperators);
+    if (targets.empty()) {
+        return;
+    }
+    // Some table functions, e.g. LOAD FROM, do not estimate their cardinality. The filter is then
+    // applied, since building it is bounded by MAX_NUM_KEYS and checking it is cheap.
+    auto probeCard = hashJoin.getChild(0)->getCardinality();
+    if (probeCard != 0) {
+        // Probe rows without a match are at most those that do not show up in the join output.
+        // Each of them dropped by the filter saves the probe and the operators passed below it.
+        auto numMatchedRows = std::min(probeCard, hashJoin.getCardinality());
+        auto numDroppedRows =
+            (double)(probeCard - numMatchedRows) * (1 - JOIN_KEY_FILTER_FALSE_POSITIVE_RATE);
+        auto benefit = numDroppedRows * (double)(1 + numPassedOperators);
+        auto cost = (double)buildCard * JOIN_KEY_FILTER_INSERT_COST +
+                    (double)probeCard * JOIN_KEY_FILTER_CHECK_COST;
+        if (benefit <= cost) {
+            return;
+        }
+    }
+    hashJoin.setJoinKeyFilterTargets(std::move(targets));
+}
+
 // TODO(Xiyang): we don't apply SIP from build to probe.
 void HashJoinSIPOptimizer::visitIntersect(LogicalOperator* op) {
     auto& intersect = op->cast<LogicalIntersect>();
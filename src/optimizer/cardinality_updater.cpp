@@ -81,7 +81,7 @@ void CardinalityUpdater::visitExtend(planner::LogicalOperator* op) {
     KU_ASSERT(transaction);
     auto& extend = op->cast<planner::LogicalExtend&>();
     const auto extensionRate = cardinalityEstimator.getExtensionRate(*extend.getRel(),
-        *extend.getBoundNode(), transaction);
+        *extend.getBoundNode(), extend.getDirection(), *op->getChild(0), transaction);
     extend.setCardinality(cardinalityEstimator.estimateExtend(extensionRate, *op->getChild(0)));
 }
 
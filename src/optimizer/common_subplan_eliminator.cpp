@@ -0,0 +1,328 @@
+#include "optimizer/common_subplan_eliminator.h"
+
+#include <algorithm>
+
+#include "binder/expression/node_expression.h"
+#include "binder/expression/rel_expression.h"
+#include "binder/expression_visitor.h"
+#include "planner/operator/extend/logical_extend.h"
+#include "planner/operator/logical_cross_product.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_flatten.h"
+#include "planner/operator/logical_hash_join.h"
+#include "planner/operator/logical_intersect.h"
+#include "planner/operator/logical_node_label_filter.h"
+#include "planner/operator/logical_projection.h"
+#include "planner/operator/scan/logical_property_lookup.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+#include "planner/operator/scan/logical_shared_subplan_scan.h"
+#include "planner/operator/sip/logical_semi_masker.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+// Describes a subplan by its operators and the expressions they use. The binder prefixes the name
+// of each variable and literal with an id, e.g. _3_a or _5_30. Ids are replaced with the order in
+// which they are met, so that subplans bound separately from the same pattern are described
+// identically.
+struct SubplanDigest {
+    std::unordered_map<std::string, std::string> ids;
+    uint64_t numOperators = 0;
+    uint64_t numJoins = 0;
+
+    std::string getDigest(const LogicalOperator& op);
+
+    std::string getOperatorDigest(const LogicalOperator& op);
+    std::string getSchemaDigest(const Schema& schema);
+    std::string rename(const std::string& name);
+    std::string rename(const Expression& expression) { return rename(expression.getUniqueName()); }
+    std::string rename(const expression_vector& expressions);
+};
+
+std::string SubplanDigest::getDigest(const LogicalOperator& op) {
+    numOperators++;
+    auto result = LogicalOperatorUtils::logicalOperatorTypeToString(op.getOperatorType()) + "(" +
+                  getOperatorDigest(op) + ")" + getSchemaDigest(*op.getSchema()) + "[";
+    for (auto i = 0u; i < op.getNumChildren(); ++i) {
+        result += getDigest(*op.getChild(i)) + ";";
+    }
+    return result + "]";
+}
+
+static std::string getSIPDigest(const SIPInfo& sipInfo) {
+    return std::to_string((uint8_t)sipInfo.position) + "," +
+           std::to_string((uint8_t)sipInfo.dependency) + "," +
+           std::to_string((uint8_t)sipInfo.direction);
+}
+
+static std::string getPredicatesDigest(
+    const std::vector<storage::ColumnPredicateSet>& predicateSets) {
+    std::string result;
+    for (auto& predicateSet : predicateSets) {
+        result += predicateSet.toString() + ";";
+    }
+    return result;
+}
+
+static std::string getTableIDsDigest(std::vector<table_id_t> tableIDs) {
+    std::sort(tableIDs.begin(), tableIDs.end());
+    std::string result;
+    for (auto& tableID : tableIDs) {
+        result += std::to_string(tableID) + ",";
+    }
+    return result;
+}
+
+std::string SubplanDigest::getOperatorDigest(const LogicalOperator& op) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::CROSS_PRODUCT: {
+        numJoins++;
+        auto& crossProduct = op.constCast<LogicalCrossProduct>();
+        return std::to_string((uint8_t)crossProduct.getAccumulateType()) + "|" +
+               (crossProduct.hasMark() ? rename(*crossProduct.getMark()) : "") + "|" +
+               getSIPDigest(crossProduct.getSIPInfo());
+    }
+    case LogicalOperatorType::EXTEND: {
+        numJoins++;
+        auto& extend = op.constCast<LogicalExtend>();
+        return rename(*extend.getBoundNode()) + "|" + rename(*extend.getNbrNode()) + "|" +
+               rename(*extend.getRel()) + "|" +
+               getTableIDsDigest(extend.getRel()->getTableIDs()) + "|" +
+               std::to_string((uint8_t)extend.getDirection()) + "|" +
+               std::to_string(extend.extendFromSourceNode()) + "|" +
+               std::to_string(extend.shouldScanNbrID()) + "|" + rename(extend.getProperties()) +
+               "|" + getPredicatesDigest(extend.getPropertyPredicates());
+    }
+    case LogicalOperatorType::FILTER: {
+        return rename(*op.constCast<LogicalFilter>().getPredicate());
+    }
+    case LogicalOperatorType::FLATTEN: {
+        return std::to_string(op.constCast<LogicalFlatten>().getGroupPos());
+    }
+    case LogicalOperatorType::HASH_JOIN: {
+        numJoins++;
+        auto& hashJoin = op.constCast<LogicalHashJoin>();
+        std::string result;
+        for (auto& [probeKey, buildKey] : hashJoin.getJoinConditions()) {
+            result += rename(*probeKey) + "=" + rename(*buildKey) + ",";
+        }
+        return result + "|" + std::to_string((uint8_t)hashJoin.getJoinType()) + "|" +
+               (hashJoin.hasMark() ? rename(*hashJoin.getMark()) : "") + "|" +
+               getSIPDigest(hashJoin.getSIPInfo());
+    }
+    case LogicalOperatorType::INTERSECT: {
+        numJoins++;
+        auto& intersect = op.constCast<LogicalIntersect>();
+        return rename(*intersect.getIntersectNodeID()) + "|" + rename(intersect.getKeyNodeIDs()) +
+               "|" + getSIPDigest(intersect.getSIPInfo());
+    }
+    case LogicalOperatorType::NODE_LABEL_FILTER: {
+        auto& labelFilter = op.constCast<LogicalNodeLabelFilter>();
+        auto tableIDSet = labelFilter.getTableIDSet();
+        return rename(*labelFilter.getNodeID()) + "|" +
+               getTableIDsDigest(std::vector<table_id_t>{tableIDSet.begin(), tableIDSet.end()});
+    }
+    case LogicalOperatorType::PROJECTION: {
+        return rename(op.constCast<LogicalProjection>().getExpressionsToProject());
+    }
+    case LogicalOperatorType::PROPERTY_LOOKUP: {
+        auto& lookup = op.constCast<LogicalPropertyLookup>();
+        return rename(*lookup.getNodeID()) + "|" + getTableIDsDigest(lookup.getTableIDs()) + "|" +
+               rename(lookup.getProperties());
+    }
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        auto& scan = op.constCast<LogicalScanNodeTable>();
+        return rename(*scan.getNodeID()) + "|" + getTableIDsDigest(scan.getTableIDs()) + "|" +
+               rename(scan.getProperties()) + "|" +
+               getPredicatesDigest(scan.getPropertyPredicates());
+    }
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+std::string SubplanDigest::getSchemaDigest(const Schema& schema) {
+    std::string result = "{";
+    for (auto& expression : schema.getExpressionsInScope()) {
+        auto groupPos = schema.getGroupPos(*expression);
+        result += rename(*expression) + "@" + std::to_string(groupPos) +
+                  (schema.getGroup(groupPos)->isSingleState() ? "s" : "") + ",";
+    }
+    return result + "}";
+}
+
+std::string SubplanDigest::rename(const std::string& name) {
+    std::string result;
+    auto i = 0u;
+    while (i < name.size()) {
+        // An id starts a name, or the name of a function argument.
+        if (name[i] == '_' && (i == 0 || name[i - 1] == '(' || name[i - 1] == ',')) {
+            auto end = i + 1;
+            while (end < name.size() && std::isdigit(name[end])) {
+                end++;
+            }
+            if (end > i + 1 && end < name.size() && name[end] == '_') {
+                auto id = name.substr(i + 1, end - i - 1);
+                if (!ids.contains(id)) {
+                    ids.insert({id, std::to_string(ids.size())});
+                }
+                result += "_" + ids.at(id) + "_";
+                i = end + 1;
+                continue;
+            }
+        }
+        result += name[i++];
+    }
+    return result;
+}
+
+std::string SubplanDigest::rename(const expression_vector& expressions) {
+    std::string result;
+    for (auto& expression : expressions) {
+        result += rename(*expression) + ",";
+    }
+    return result;
+}
+
+void CommonSubplanEliminator::rewrite(LogicalPlan* plan) {
+    auto root = plan->getLastOperator().get();
+    collectRuntimeFilterTargets(root);
+    collectOccurrences(root, nullptr /* parent */, 0 /* childIdx */, INVALID_IDX /* unionBranch */);
+    std::stable_sort(digests.begin(), digests.end(), [&](const auto& left, const auto& right) {
+        return occurrencesPerDigest.at(left)[0].numOperators >
+               occurrencesPerDigest.at(right)[0].numOperators;
+    });
+    for (auto& digest : digests) {
+        // Repeated subplans within a branch, e.g. the same join in a MATCH pattern twice, are
+        // left alone. Only one occurrence per union branch is shared.
+        std::vector<SubplanOccurrence> occurrences;
+        std::unordered_set<idx_t> unionBranches;
+        for (auto& occurrence : occurrencesPerDigest.at(digest)) {
+            if (!sharedOps.contains(occurrence.op) &&
+                !unionBranches.contains(occurrence.unionBranch)) {
+                unionBranches.insert(occurrence.unionBranch);
+                occurrences.push_back(occurrence);
+            }
+        }
+        if (occurrences.size() > 1) {
+            shareSubplan(occurrences);
+        }
+    }
+}
+
+// Semi masks and join key filters point at the scans they filter. A subplan containing such a
+// scan cannot be shared, since the filter would not be built before the subplan is materialized.
+void CommonSubplanEliminator::collectRuntimeFilterTargets(LogicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::SEMI_MASKER: {
+        for (auto target : op->cast<LogicalSemiMasker>().getTargetOperators()) {
+            runtimeFilterTargets.insert(target);
+        }
+    } break;
+    case LogicalOperatorType::HASH_JOIN: {
+        for (auto target : op->cast<LogicalHashJoin>().getJoinKeyFilterTargets()) {
+            runtimeFilterTargets.insert(target);
+        }
+    } break;
+    default:
+        break;
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        collectRuntimeFilterTargets(op->getChild(i).get());
+    }
+}
+
+bool CommonSubplanEliminator::collectOccurrences(LogicalOperator* op, LogicalOperator* parent,
+    idx_t childIdx, idx_t unionBranch) {
+    auto isSharable = canShare(op);
+    auto isUnion = op->getOperatorType() == LogicalOperatorType::UNION_ALL;
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        auto childUnionBranch = isUnion ? numUnionBranches++ : unionBranch;
+        if (!collectOccurrences(op->getChild(i).get(), op, i, childUnionBranch)) {
+            isSharable = false;
+        }
+    }
+    // Only subplans in union branches are shared.
+    if (!isSharable || parent == nullptr || unionBranch == INVALID_IDX) {
+        return isSharable;
+    }
+    auto subplanDigest = SubplanDigest();
+    auto digest = subplanDigest.getDigest(*op);
+    // Materializing a subplan without joins costs about as much as computing it again. A subplan
+    // without expressions in scope, e.g. below COUNT(*), would be materialized without any row.
+    if (subplanDigest.numJoins == 0 || op->getSchema()->getExpressionsInScope().empty()) {
+        return true;
+    }
+    if (!occurrencesPerDigest.contains(digest)) {
+        occurrencesPerDigest.insert({digest, std::vector<SubplanOccurrence>{}});
+        digests.push_back(digest);
+    }
+    occurrencesPerDigest.at(digest).push_back(
+        SubplanOccurrence{op, parent, childIdx, unionBranch, subplanDigest.numOperators});
+    return true;
+}
+
+bool CommonSubplanEliminator::canShare(LogicalOperator* op) const {
+    if (runtimeFilterTargets.contains(op)) {
+        return false;
+    }
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::CROSS_PRODUCT:
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::INTERSECT:
+    case LogicalOperatorType::NODE_LABEL_FILTER:
+    case LogicalOperatorType::PROPERTY_LOOKUP:
+        return true;
+    case LogicalOperatorType::FILTER:
+        return !ExpressionVisitor::isRandom(*op->constCast<LogicalFilter>().getPredicate());
+    case LogicalOperatorType::HASH_JOIN:
+        return op->constCast<LogicalHashJoin>().getJoinKeyFilterTargets().empty();
+    case LogicalOperatorType::PROJECTION: {
+        for (auto& expression : op->constCast<LogicalProjection>().getExpressionsToProject()) {
+            if (ExpressionVisitor::isRandom(*expression)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        auto& scan = op->constCast<LogicalScanNodeTable>();
+        return scan.getScanType() == LogicalScanNodeTableType::SCAN &&
+               scan.getExtraInfo() == nullptr;
+    }
+    default:
+        return false;
+    }
+}
+
+void CommonSubplanEliminator::shareSubplan(const std::vector<SubplanOccurrence>& occurrences) {
+    auto subplan = occurrences[0].parent->getChild(occurrences[0].childIdx);
+    // Subplans have the same digest, so their expressions in scope correspond to each other. Their
+    // order may change once the subplan's factorized schema is computed, so it is recorded here.
+    auto payloads = subplan->getSchema()->getExpressionsInScope();
+    for (auto& occurrence : occurrences) {
+        auto expressions = occurrence.op->getSchema()->getExpressionsInScope();
+        auto scan =
+            std::make_shared<LogicalSharedSubplanScan>(std::move(expressions), payloads, subplan);
+        scan->computeFlatSchema();
+        // Replacing the occurrence frees it, unless it is the shared subplan.
+        markAsShared(occurrence.op);
+        occurrence.parent->setChild(occurrence.childIdx, std::move(scan));
+    }
+    subplans.push_back(std::move(subplan));
+}
+
+void CommonSubplanEliminator::markAsShared(LogicalOperator* op) {
+    sharedOps.insert(op);
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        markAsShared(op->getChild(i).get());
+    }
+}
+
+} // namespace optimizer
+} // namespace kuzu
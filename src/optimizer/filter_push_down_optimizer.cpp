@@ -3,6 +3,9 @@
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
+#include "main/client_context.h"
 #include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/logical_empty_result.h"
 #include "planner/operator/logical_filter.h"
@@ -50,7 +53,7 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitChildren(
     const std::shared_ptr<LogicalOperator>& op) {
     for (auto i = 0u; i < op->getNumChildren(); ++i) {
         // Start new push down for child.
-        auto optimizer = FilterPushDownOptimizer(context);
+        auto optimizer = FilterPushDownOptimizer(context, cardinalityEstimator);
         op->setChild(i, optimizer.visitOperator(op->getChild(i)));
     }
     op->computeFlatSchema();
@@ -92,10 +95,12 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
     }
     KU_ASSERT(op->getNumChildren() == 2);
     // Push probe side
-    auto probeOptimizer = FilterPushDownOptimizer(context, std::move(probePSet));
+    auto probeOptimizer =
+        FilterPushDownOptimizer(context, cardinalityEstimator, std::move(probePSet));
     op->setChild(0, probeOptimizer.visitOperator(op->getChild(0)));
     // Push build side
-    auto buildOptimizer = FilterPushDownOptimizer(context, std::move(buildPSet));
+    auto buildOptimizer =
+        FilterPushDownOptimizer(context, cardinalityEstimator, std::move(buildPSet));
     op->setChild(1, buildOptimizer.visitOperator(op->getChild(1)));
 
     auto probeSchema = op->getChild(0)->getSchema();
@@ -120,8 +125,10 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
     if (joinConditions.empty()) { // Nothing to push down. Terminate.
         return finishPushDown(op);
     }
+    auto cardinality =
+        cardinalityEstimator.estimateHashJoin(joinConditions, *op->getChild(0), *op->getChild(1));
     auto hashJoin = std::make_shared<LogicalHashJoin>(joinConditions, JoinType::INNER,
-        nullptr /* mark */, op->getChild(0), op->getChild(1), 0 /* cardinality */);
+        nullptr /* mark */, op->getChild(0), op->getChild(1), cardinality);
     // For non-id based joins, we disable side way information passing.
     hashJoin->getSIPInfoUnsafe().position = SemiMaskPosition::PROHIBIT;
     hashJoin->computeFlatSchema();
@@ -176,6 +183,44 @@ static bool isConstantExpression(const std::shared_ptr<Expression> expression) {
     }
 }
 
+// Returns the scan info of the first equality predicate that compares an indexed property of the
+// node with a constant, or nullptr if there is no such predicate.
+static std::unique_ptr<PropertyIndexScanInfo> getPropertyIndexScanInfo(
+    const expression_vector& equalityPredicates, const Expression& nodeID, table_id_t tableID,
+    main::ClientContext* context) {
+    std::vector<std::string> indexedProperties;
+    for (auto indexEntry : context->getCatalog()->getIndexEntries(context->getTx(), tableID)) {
+        if (indexEntry->getType() == catalog::CatalogEntryType::PROPERTY_INDEX_ENTRY) {
+            indexedProperties.push_back(
+                indexEntry->constCast<catalog::PropertyIndexCatalogEntry>().getPropertyName());
+        }
+    }
+    if (indexedProperties.empty()) {
+        return nullptr;
+    }
+    auto isIndexedProperty = [&](const Expression& expression) {
+        if (expression.expressionType != ExpressionType::PROPERTY) {
+            return false;
+        }
+        auto& property = expression.constCast<PropertyExpression>();
+        return property.getVariableName() ==
+                   nodeID.constCast<PropertyExpression>().getVariableName() &&
+               std::find(indexedProperties.begin(), indexedProperties.end(),
+                   property.getPropertyName()) != indexedProperties.end();
+    };
+    for (auto& predicate : equalityPredicates) {
+        for (auto i = 0u; i < 2; ++i) {
+            auto property = predicate->getChild(i);
+            auto key = predicate->getChild(1 - i);
+            if (isIndexedProperty(*property) && isConstantExpression(key) &&
+                property->dataType == key->dataType) {
+                return std::make_unique<PropertyIndexScanInfo>(property, key);
+            }
+        }
+    }
+    return nullptr;
+}
+
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableReplace(
     const std::shared_ptr<LogicalOperator>& op) {
     auto& scan = op->cast<LogicalScanNodeTable>();
@@ -197,12 +242,25 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableRepl
             auto extraInfo = std::make_unique<PrimaryKeyScanInfo>(rhs);
             scan.setScanType(LogicalScanNodeTableType::PRIMARY_KEY_SCAN);
             scan.setExtraInfo(std::move(extraInfo));
+            scan.setCardinality(
+                cardinalityEstimator.estimateFilter(scan, *primaryKeyEqualityComparison));
             scan.computeFlatSchema();
         } else {
             // Cannot rewrite and add predicate back.
             predicateSet.addPredicate(primaryKeyEqualityComparison);
         }
     }
+    if (tableIDs.size() == 1 && scan.getScanType() == LogicalScanNodeTableType::SCAN &&
+        scan.getExtraInfo() == nullptr) {
+        auto extraInfo = getPropertyIndexScanInfo(predicateSet.equalityPredicates, *nodeID,
+            tableIDs[0], context);
+        if (extraInfo != nullptr) {
+            // The index only returns candidates, so the predicate is kept in the filter above.
+            scan.setScanType(LogicalScanNodeTableType::PROPERTY_INDEX_SCAN);
+            scan.setExtraInfo(std::move(extraInfo));
+            scan.computeFlatSchema();
+        }
+    }
     return finishPushDown(op);
 }
 
@@ -268,7 +326,9 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::appendFilters(
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::appendFilter(
     std::shared_ptr<Expression> predicate, std::shared_ptr<LogicalOperator> child) {
     auto printInfo = std::make_unique<OPPrintInfo>();
-    auto filter = std::make_shared<LogicalFilter>(std::move(predicate), std::move(child));
+    auto cardinality = cardinalityEstimator.estimateFilter(*child, *predicate);
+    auto filter =
+        std::make_shared<LogicalFilter>(std::move(predicate), std::move(child), cardinality);
     filter->computeFlatSchema();
     return filter;
 }
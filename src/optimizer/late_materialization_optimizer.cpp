@@ -0,0 +1,325 @@
+#include "optimizer/late_materialization_optimizer.h"
+
+#include "binder/expression/lambda_expression.h"
+#include "binder/expression/property_expression.h"
+#include "binder/expression_visitor.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_hash_join.h"
+#include "planner/operator/logical_order_by.h"
+#include "planner/operator/logical_projection.h"
+#include "planner/operator/scan/logical_property_lookup.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+// Writes could be seen by a lookup but not by the scan, so plans that write are not rewritten.
+static bool hasUpdate(const LogicalOperator* op) {
+    if (LogicalOperatorUtils::isUpdate(op->getOperatorType())) {
+        return true;
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        if (hasUpdate(op->getChild(i).get())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void collectScans(LogicalOperator* op, std::vector<LogicalOperator*>& scans) {
+    if (op->getOperatorType() == LogicalOperatorType::SCAN_NODE_TABLE) {
+        auto& scan = op->constCast<LogicalScanNodeTable>();
+        // Nodes of more than one label are not rewritten, their properties differ per label.
+        if (scan.getScanType() == LogicalScanNodeTableType::SCAN &&
+            scan.getExtraInfo() == nullptr && scan.getTableIDs().size() == 1 &&
+            !scan.getProperties().empty()) {
+            scans.push_back(op);
+        }
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        collectScans(op->getChild(i).get(), scans);
+    }
+}
+
+static void collectOperators(LogicalOperator* op, std::unordered_set<LogicalOperator*>& ops) {
+    ops.insert(op);
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        collectOperators(op->getChild(i).get(), ops);
+    }
+}
+
+// Lambdas are visited through their function, which ExpressionChildrenCollector skips.
+static expression_vector collectChildren(const Expression& expression) {
+    if (expression.expressionType == ExpressionType::LAMBDA) {
+        return {expression.constCast<LambdaExpression>().getFunctionExpr()};
+    }
+    return ExpressionChildrenCollector::collectChildren(expression);
+}
+
+// Whether the node is used as a whole, e.g. returned, collected or in a path. Such expressions are
+// evaluated from all properties of the node.
+static bool usesNode(const Expression& expression, const std::string& nodeName) {
+    if (expression.expressionType == ExpressionType::PATH ||
+        (expression.expressionType == ExpressionType::PATTERN &&
+            expression.getUniqueName() == nodeName)) {
+        return true;
+    }
+    for (auto& child : collectChildren(expression)) {
+        if (usesNode(*child, nodeName)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool usesNode(const std::unordered_set<LogicalOperator*>& ops, const std::string& nodeName) {
+    for (auto op : ops) {
+        for (auto& expression : op->getSchema()->getExpressionsInScope()) {
+            if (usesNode(*expression, nodeName)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool isInScope(const std::unordered_set<LogicalOperator*>& ops,
+    const Expression& property) {
+    for (auto op : ops) {
+        if (op->getSchema()->isExpressionInScope(property)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void computeFlatSchemas(LogicalOperator* op) {
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        computeFlatSchemas(op->getChild(i).get());
+    }
+    op->computeFlatSchema();
+}
+
+void LateMaterializationOptimizer::rewrite(LogicalPlan* plan) {
+    auto root = plan->getLastOperator().get();
+    if (hasUpdate(root)) {
+        return;
+    }
+    std::vector<LogicalOperator*> scans;
+    collectScans(root, scans);
+    for (auto scan : scans) {
+        rewriteScan(plan, scan);
+        // The next scan reads the schemas of all operators, including the lookup just added.
+        computeFlatSchemas(plan->getLastOperator().get());
+    }
+}
+
+bool LateMaterializationOptimizer::collectAncestors(LogicalOperator* op,
+    const LogicalOperator* target, std::vector<Ancestor>& ancestors) {
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        auto child = op->getChild(i).get();
+        if (child == target || collectAncestors(child, target, ancestors)) {
+            ancestors.push_back(Ancestor{op, i});
+            return true;
+        }
+    }
+    return false;
+}
+
+void LateMaterializationOptimizer::rewriteScan(LogicalPlan* plan, LogicalOperator* scan) {
+    auto& scanNodeTable = scan->cast<LogicalScanNodeTable>();
+    auto nodeID = scanNodeTable.getNodeID();
+    std::unordered_set<LogicalOperator*> ops;
+    collectOperators(plan->getLastOperator().get(), ops);
+    if (usesNode(ops, nodeID->constCast<PropertyExpression>().getVariableName())) {
+        return;
+    }
+    std::vector<Ancestor> ancestors;
+    collectAncestors(plan->getLastOperator().get(), scan, ancestors);
+    // Operators off the path from the scan to the root, e.g. the expressions scan of a correlated
+    // subquery, read the properties from an accumulated table before the lookup could run.
+    ops.erase(scan);
+    for (auto& ancestor : ancestors) {
+        ops.erase(ancestor.op);
+    }
+    // All properties are looked up together, below the first operator that uses any of them.
+    expression_vector properties;
+    idx_t numAncestorsToPass = ancestors.size();
+    for (auto& property : scanNodeTable.getProperties()) {
+        if (isInScope(ops, *property)) {
+            continue;
+        }
+        auto numAncestors = getNumAncestorsToPass(*property, ancestors);
+        if (numAncestors == 0) {
+            continue;
+        }
+        properties.push_back(property);
+        numAncestorsToPass = std::min(numAncestorsToPass, numAncestors);
+    }
+    if (properties.empty()) {
+        return;
+    }
+    auto lastPassed = ancestors[numAncestorsToPass - 1].op;
+    if (lastPassed->getCardinality() >= scan->getCardinality()) {
+        return;
+    }
+    auto propertySet = expression_set{properties.begin(), properties.end()};
+    // Projections pass the node ID instead of the properties. The top most one is restored above
+    // the lookup.
+    std::optional<expression_vector> expressionsToRestore;
+    for (auto i = 0u; i < numAncestorsToPass; ++i) {
+        if (ancestors[i].op->getOperatorType() != LogicalOperatorType::PROJECTION) {
+            continue;
+        }
+        auto& projection = ancestors[i].op->cast<LogicalProjection>();
+        expressionsToRestore = projection.getExpressionsToProject();
+        expression_vector expressions;
+        auto hasNodeID = false;
+        for (auto& expression : *expressionsToRestore) {
+            if (propertySet.contains(expression)) {
+                continue;
+            }
+            hasNodeID |= expression->getUniqueName() == nodeID->getUniqueName();
+            expressions.push_back(expression);
+        }
+        if (!hasNodeID) {
+            expressions.push_back(nodeID);
+        }
+        projection.setExpressionsToProject(std::move(expressions));
+    }
+    std::shared_ptr<LogicalOperator> lookup = std::make_shared<LogicalPropertyLookup>(nodeID,
+        scanNodeTable.getTableIDs(), properties,
+        numAncestorsToPass == ancestors.size() ?
+            plan->getLastOperator() :
+            ancestors[numAncestorsToPass].op->getChild(ancestors[numAncestorsToPass].childIdx));
+    if (expressionsToRestore.has_value()) {
+        lookup = std::make_shared<LogicalProjection>(std::move(*expressionsToRestore), lookup);
+    }
+    if (numAncestorsToPass == ancestors.size()) {
+        plan->setLastOperator(std::move(lookup));
+    } else {
+        ancestors[numAncestorsToPass].op->setChild(ancestors[numAncestorsToPass].childIdx,
+            std::move(lookup));
+    }
+    scanNodeTable.removeProperties(propertySet);
+}
+
+static bool references(const Expression& expression, const Expression& property) {
+    // Subqueries are not looked into.
+    if (expression.expressionType == ExpressionType::SUBQUERY ||
+        expression.getUniqueName() == property.getUniqueName()) {
+        return true;
+    }
+    for (auto& child : collectChildren(expression)) {
+        if (references(*child, property)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool references(const expression_vector& expressions, const Expression& property) {
+    for (auto& expression : expressions) {
+        if (references(*expression, property)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+enum class PassResult : uint8_t {
+    PASS = 0,
+    STOP = 1,
+    // The property is not used at all.
+    DROP = 2,
+};
+
+// Operators are passed if they do not use the property and keep the node ID in scope. Accumulates
+// are not passed, they start OPTIONAL MATCH and subqueries, whose plans read the accumulated table.
+static PassResult pass(const LogicalOperator& op, idx_t childIdx, const Expression& property) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::CROSS_PRODUCT:
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::LIMIT:
+    case LogicalOperatorType::MULTIPLICITY_REDUCER:
+    case LogicalOperatorType::NODE_LABEL_FILTER:
+    case LogicalOperatorType::PROPERTY_LOOKUP: {
+        return PassResult::PASS;
+    }
+    case LogicalOperatorType::FILTER: {
+        return references(*op.constCast<LogicalFilter>().getPredicate(), property) ?
+                   PassResult::STOP :
+                   PassResult::PASS;
+    }
+    case LogicalOperatorType::HASH_JOIN: {
+        auto& hashJoin = op.constCast<LogicalHashJoin>();
+        if (hashJoin.getJoinType() != JoinType::INNER && hashJoin.getJoinType() != JoinType::LEFT) {
+            return PassResult::STOP;
+        }
+        for (auto& [probeKey, buildKey] : hashJoin.getJoinConditions()) {
+            if (references(*probeKey, property) || references(*buildKey, property)) {
+                return PassResult::STOP;
+            }
+        }
+        return PassResult::PASS;
+    }
+    case LogicalOperatorType::INTERSECT: {
+        // Builds of intersect only keep the node IDs.
+        return childIdx == 0 ? PassResult::PASS : PassResult::STOP;
+    }
+    case LogicalOperatorType::ORDER_BY: {
+        return references(op.constCast<LogicalOrderBy>().getExpressionsToOrderBy(), property) ?
+                   PassResult::STOP :
+                   PassResult::PASS;
+    }
+    case LogicalOperatorType::PROJECTION: {
+        auto isProjected = false;
+        for (auto& expression : op.constCast<LogicalProjection>().getExpressionsToProject()) {
+            if (expression->getUniqueName() == property.getUniqueName()) {
+                isProjected = true;
+            } else if (references(*expression, property)) {
+                return PassResult::STOP;
+            }
+        }
+        return isProjected ? PassResult::PASS : PassResult::DROP;
+    }
+    default:
+        return PassResult::STOP;
+    }
+}
+
+idx_t LateMaterializationOptimizer::getNumAncestorsToPass(const Expression& property,
+    const std::vector<Ancestor>& ancestors) {
+    // Only the projection of RETURN is passed. The ones of WITH end a query part, and the next
+    // part may use the property in a way no ancestor shows, e.g. in a subquery.
+    auto returnProjectionIdx = INVALID_IDX;
+    for (auto i = 0u; i < ancestors.size(); ++i) {
+        if (ancestors[i].op->getOperatorType() == LogicalOperatorType::PROJECTION) {
+            returnProjectionIdx = i;
+        }
+    }
+    for (auto i = 0u; i < ancestors.size(); ++i) {
+        if (ancestors[i].op->getOperatorType() == LogicalOperatorType::PROJECTION &&
+            i != returnProjectionIdx) {
+            return i;
+        }
+        switch (pass(*ancestors[i].op, ancestors[i].childIdx, property)) {
+        case PassResult::PASS:
+            continue;
+        case PassResult::STOP:
+            return i;
+        case PassResult::DROP:
+            return 0;
+        default:
+            KU_UNREACHABLE;
+        }
+    }
+    return ancestors.size();
+}
+
+} // namespace optimizer
+} // namespace kuzu
@@ -33,7 +33,8 @@ void LimitPushDownOptimizer::visitOperator(planner::LogicalOperator* op) {
     case LogicalOperatorType::MULTIPLICITY_REDUCER:
     case LogicalOperatorType::EXPLAIN:
     case LogicalOperatorType::ACCUMULATE:
-    case LogicalOperatorType::PROJECTION: {
+    case LogicalOperatorType::PROJECTION:
+    case LogicalOperatorType::PROPERTY_LOOKUP: {
         visitOperator(op->getChild(0).get());
         return;
     }
@@ -14,7 +14,8 @@ void LogicalOperatorCollector::collect(planner::LogicalOperator* op) {
 
 void LogicalIndexScanNodeCollector::visitScanNodeTable(planner::LogicalOperator* op) {
     auto scan = op->constCast<planner::LogicalScanNodeTable>();
-    if (scan.getScanType() == planner::LogicalScanNodeTableType::PRIMARY_KEY_SCAN) {
+    if (scan.getScanType() == planner::LogicalScanNodeTableType::PRIMARY_KEY_SCAN ||
+        scan.getScanType() == planner::LogicalScanNodeTableType::PROPERTY_INDEX_SCAN) {
         ops.push_back(op);
     }
 }
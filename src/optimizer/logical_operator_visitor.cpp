@@ -70,6 +70,9 @@ void LogicalOperatorVisitor::visitOperatorSwitch(LogicalOperator* op) {
     case LogicalOperatorType::PROJECTION: {
         visitProjection(op);
     } break;
+    case LogicalOperatorType::PROPERTY_LOOKUP: {
+        visitPropertyLookup(op);
+    } break;
     case LogicalOperatorType::RECURSIVE_EXTEND: {
         visitRecursiveExtend(op);
     } break;
@@ -162,6 +165,9 @@ std::shared_ptr<LogicalOperator> LogicalOperatorVisitor::visitOperatorReplaceSwi
     case LogicalOperatorType::PROJECTION: {
         return visitProjectionReplace(op);
     }
+    case LogicalOperatorType::PROPERTY_LOOKUP: {
+        return visitPropertyLookupReplace(op);
+    }
     case LogicalOperatorType::RECURSIVE_EXTEND: {
         return visitRecursiveExtendReplace(op);
     }
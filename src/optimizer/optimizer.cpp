@@ -4,9 +4,11 @@
 #include "optimizer/acc_hash_join_optimizer.h"
 #include "optimizer/agg_key_dependency_optimizer.h"
 #include "optimizer/cardinality_updater.h"
+#include "optimizer/common_subplan_eliminator.h"
 #include "optimizer/correlated_subquery_unnest_solver.h"
 #include "optimizer/factorization_rewriter.h"
 #include "optimizer/filter_push_down_optimizer.h"
+#include "optimizer/late_materialization_optimizer.h"
 #include "optimizer/limit_push_down_optimizer.h"
 #include "optimizer/projection_push_down_optimizer.h"
 #include "optimizer/remove_factorization_rewriter.h"
@@ -32,9 +34,14 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
         auto removeUnnecessaryJoinOptimizer = RemoveUnnecessaryJoinOptimizer();
         removeUnnecessaryJoinOptimizer.rewrite(plan);
 
-        auto filterPushDownOptimizer = FilterPushDownOptimizer(context);
+        auto filterPushDownOptimizer = FilterPushDownOptimizer(context, cardinalityEstimator);
         filterPushDownOptimizer.rewrite(plan);
 
+        // Lookups read properties by node ID, so late materialization should be applied before
+        // projection push down prunes node IDs that are otherwise unused.
+        auto lateMaterializationOptimizer = LateMaterializationOptimizer();
+        lateMaterializationOptimizer.rewrite(plan);
+
         auto projectionPushDownOptimizer =
             ProjectionPushDownOptimizer(context->getClientConfig()->recursivePatternSemantic);
         projectionPushDownOptimizer.rewrite(plan);
@@ -42,6 +49,23 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
         auto limitPushDownOptimizer = LimitPushDownOptimizer();
         limitPushDownOptimizer.rewrite(plan);
 
+        // Shared subplans are not children of their scans, so the rewriters below are applied to
+        // each of them separately. They are rewritten before the plan, whose schemas depend on
+        // theirs.
+        auto commonSubplanEliminator = CommonSubplanEliminator();
+        commonSubplanEliminator.rewrite(plan);
+        for (auto& subplanRoot : commonSubplanEliminator.getSubplans()) {
+            auto subplan = planner::LogicalPlan();
+            subplan.setLastOperator(subplanRoot);
+            if (context->getClientConfig()->enableSemiMask) {
+                auto hashJoinSIPOptimizer = HashJoinSIPOptimizer();
+                hashJoinSIPOptimizer.rewrite(&subplan);
+            }
+            auto factorizationRewriter = FactorizationRewriter();
+            factorizationRewriter.rewrite(&subplan);
+            KU_ASSERT(subplan.getLastOperator() == subplanRoot);
+        }
+
         if (context->getClientConfig()->enableSemiMask) {
             // HashJoinSIPOptimizer should be applied after optimizers that manipulate hash join.
             auto hashJoinSIPOptimizer = HashJoinSIPOptimizer();
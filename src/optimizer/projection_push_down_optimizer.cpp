@@ -20,6 +20,7 @@
 #include "planner/operator/persistent/logical_insert.h"
 #include "planner/operator/persistent/logical_merge.h"
 #include "planner/operator/persistent/logical_set.h"
+#include "planner/operator/scan/logical_property_lookup.h"
 
 using namespace kuzu::common;
 using namespace kuzu::planner;
@@ -180,6 +181,11 @@ void ProjectionPushDownOptimizer::visitProjection(LogicalOperator* op) {
     optimizer.visitOperator(op->getChild(0).get());
 }
 
+void ProjectionPushDownOptimizer::visitPropertyLookup(LogicalOperator* op) {
+    auto& lookup = op->constCast<LogicalPropertyLookup>();
+    collectExpressionsInUse(lookup.getNodeID());
+}
+
 void ProjectionPushDownOptimizer::visitOrderBy(LogicalOperator* op) {
     auto& orderBy = op->constCast<LogicalOrderBy>();
     for (auto& expression : orderBy.getExpressionsToOrderBy()) {
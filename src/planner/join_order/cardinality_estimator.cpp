@@ -1,11 +1,16 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
+#include "common/type_utils.h"
+#include "function/hash/vector_hash_functions.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
+#include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/logical_aggregate.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
+#include "processor/adaptive_execution_state.h"
 #include "storage/storage_manager.h"
 #include "storage/store/node_table.h"
 #include "storage/store/rel_table.h"
@@ -91,6 +96,19 @@ uint64_t CardinalityEstimator::estimateAggregate(const LogicalAggregate& op) con
     return op.getKeys().empty() ? 1 : op.getChild(0)->getCardinality();
 }
 
+std::optional<cardinality_t> CardinalityEstimator::getObservedCardinality(
+    const SubqueryGraph& subgraph) const {
+    if (context == nullptr || context->getAdaptiveExecutionState() == nullptr) {
+        return std::nullopt;
+    }
+    auto adaptiveState = context->getAdaptiveExecutionState();
+    auto name = subgraph.getUniqueName();
+    if (!adaptiveState->hasObservedCardinality(name)) {
+        return std::nullopt;
+    }
+    return atLeastOne(adaptiveState->getObservedCardinality(name));
+}
+
 cardinality_t CardinalityEstimator::estimateExtend(double extensionRate,
     const LogicalOperator& childOp) const {
     return atLeastOne(extensionRate * childOp.getCardinality());
@@ -111,10 +129,12 @@ uint64_t CardinalityEstimator::estimateHashJoin(
                           JoinOrderUtil::getJoinKeysFlatCardinality(joinKeys, buildOp) /
                           atLeastOne(denominator));
     } else {
-        // Naively estimate the cardinality if the join is non-ID based
-        cardinality_t estCardinality = probeOp.getCardinality() * buildOp.getCardinality();
-        for (size_t i = 0; i < joinConditions.size(); ++i) {
-            estCardinality *= PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY;
+        // Estimate the selectivity of joins on node properties from their most common values and
+        // fall back to a fixed selectivity otherwise.
+        double estCardinality = probeOp.getCardinality() * buildOp.getCardinality();
+        for (auto& [left, right] : joinConditions) {
+            estCardinality *= estimateJoinSelectivity(*left, *right)
+                                  .value_or(PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
         }
         return atLeastOne(estCardinality);
     }
@@ -183,12 +203,223 @@ static std::optional<cardinality_t> getTableStatsIfPossible(main::ClientContext*
     return {};
 }
 
+const storage::TableStats* CardinalityEstimator::getTableStats(const Expression& property,
+    column_id_t& columnID) const {
+    if (!isSingleLabelledProperty(property)) {
+        return nullptr;
+    }
+    auto& propertyExpr = property.constCast<PropertyExpression>();
+    auto tableID = propertyExpr.getSingleTableID();
+    if (!nodeTableStats.contains(tableID)) {
+        return nullptr;
+    }
+    columnID = propertyExpr.getColumnID(
+        *context->getCatalog()->getTableCatalogEntry(context->getTx(), tableID));
+    if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID) {
+        return nullptr;
+    }
+    return &nodeTableStats.at(tableID);
+}
+
+static double getNonNullFraction(const storage::ColumnStats& columnStats) {
+    return 1 - columnStats.getNullFraction();
+}
+
+// Hashes the value the same way column stats hash the values of a column.
+static hash_t hashValue(const Value& value, storage::MemoryManager* memoryManager) {
+    auto state = DataChunkState::getSingleValueDataChunkState();
+    ValueVector vector{value.getDataType().copy(), memoryManager, state};
+    vector.copyFromValue(0 /* pos */, value);
+    ValueVector hashVector{LogicalType::HASH(), memoryManager, state};
+    function::VectorHashFunction::computeHash(vector, state->getSelVector(), hashVector,
+        state->getSelVector());
+    return hashVector.getValue<hash_t>(0 /* pos */);
+}
+
+std::optional<double> CardinalityEstimator::estimateEqualitySelectivity(const Expression& property,
+    const Expression& literal) const {
+    if (literal.expressionType != ExpressionType::LITERAL ||
+        property.dataType != literal.dataType) {
+        return {};
+    }
+    column_id_t columnID = INVALID_COLUMN_ID;
+    auto stats = getTableStats(property, columnID);
+    if (stats == nullptr) {
+        return {};
+    }
+    auto& columnStats = stats->getColumnStats(columnID);
+    auto mcv = columnStats.getMostCommonValues();
+    auto value = literal.constCast<LiteralExpression>().getValue();
+    if (mcv == nullptr || mcv->getNumValues() == 0 || value.isNull()) {
+        return {};
+    }
+    auto numValues = static_cast<double>(mcv->getNumValues());
+    // Counts are relative to the rows the stats were computed from, so the number of distinct
+    // values is not scaled to the whole table here.
+    auto numDistinctValues = static_cast<double>(atLeastOne(columnStats.getNumDistinctValues()));
+    double frequency = 0;
+    auto count = mcv->getCount(hashValue(value, context->getMemoryManager()));
+    if (count > 0) {
+        // Counts of most common values are lower bounds.
+        frequency = std::max(static_cast<double>(count), numValues / numDistinctValues);
+    } else {
+        // Values that are not tracked are spread evenly over the remaining distinct values, and
+        // none of them occurs more often than the tracked values could have been undercounted.
+        auto numUntrackedValues = numValues - static_cast<double>(mcv->getSumOfCounts());
+        auto numUntrackedDistinctValues =
+            std::max(numDistinctValues - static_cast<double>(mcv->getNumEntries()), 1.0);
+        frequency = std::min(numUntrackedValues / numUntrackedDistinctValues,
+            numValues / (storage::MostCommonValues::CAPACITY + 1));
+    }
+    return std::min(frequency / numValues, 1.0) * getNonNullFraction(columnStats);
+}
+
+static std::optional<double> getNumericValue(const Value& value) {
+    auto physicalType = value.getDataType().getPhysicalType();
+    if (value.isNull() || !storage::Histogram::isSupportedType(physicalType)) {
+        return {};
+    }
+    return TypeUtils::visit(
+        physicalType,
+        [&]<typename T>(T) -> std::optional<double>
+            requires(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+        { return static_cast<double>(value.getValue<T>()); },
+        [](auto) -> std::optional<double> { return {}; });
+}
+
+static ExpressionType flipComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+std::optional<double> CardinalityEstimator::estimateRangeSelectivity(
+    const Expression& predicate) const {
+    auto type = predicate.expressionType;
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS:
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+        break;
+    default:
+        return {};
+    }
+    auto property = predicate.getChild(0);
+    auto literal = predicate.getChild(1);
+    if (property->expressionType == ExpressionType::LITERAL) {
+        std::swap(property, literal);
+        type = flipComparison(type);
+    }
+    if (literal->expressionType != ExpressionType::LITERAL ||
+        property->dataType != literal->dataType) {
+        return {};
+    }
+    column_id_t columnID = INVALID_COLUMN_ID;
+    auto stats = getTableStats(*property, columnID);
+    if (stats == nullptr) {
+        return {};
+    }
+    auto histogram = stats->getColumnStats(columnID).getHistogram();
+    auto value = getNumericValue(literal->constCast<LiteralExpression>().getValue());
+    if (histogram == nullptr || histogram->getNumValues() == 0 || !value.has_value()) {
+        return {};
+    }
+    double fraction = 0;
+    switch (type) {
+    case ExpressionType::LESS_THAN:
+        fraction = histogram->estimateFractionBelow(*value, false /* inclusive */);
+        break;
+    case ExpressionType::LESS_THAN_EQUALS:
+        fraction = histogram->estimateFractionBelow(*value, true /* inclusive */);
+        break;
+    case ExpressionType::GREATER_THAN:
+        fraction = 1 - histogram->estimateFractionBelow(*value, true /* inclusive */);
+        break;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        fraction = 1 - histogram->estimateFractionBelow(*value, false /* inclusive */);
+        break;
+    default:
+        KU_UNREACHABLE;
+    }
+    return fraction * getNonNullFraction(stats->getColumnStats(columnID));
+}
+
+std::optional<double> CardinalityEstimator::estimateJoinSelectivity(const Expression& left,
+    const Expression& right) const {
+    if (left.dataType != right.dataType) {
+        return {};
+    }
+    column_id_t leftColumnID = INVALID_COLUMN_ID;
+    column_id_t rightColumnID = INVALID_COLUMN_ID;
+    auto leftStats = getTableStats(left, leftColumnID);
+    auto rightStats = getTableStats(right, rightColumnID);
+    if (leftStats == nullptr || rightStats == nullptr) {
+        return {};
+    }
+    auto& leftColumnStats = leftStats->getColumnStats(leftColumnID);
+    auto& rightColumnStats = rightStats->getColumnStats(rightColumnID);
+    auto leftMCV = leftColumnStats.getMostCommonValues();
+    auto rightMCV = rightColumnStats.getMostCommonValues();
+    if (leftMCV == nullptr || rightMCV == nullptr || leftMCV->getNumValues() == 0 ||
+        rightMCV->getNumValues() == 0) {
+        return {};
+    }
+    auto leftNumValues = static_cast<double>(leftMCV->getNumValues());
+    auto rightNumValues = static_cast<double>(rightMCV->getNumValues());
+    // Values common to both sides match with their own frequencies. The remaining values are
+    // assumed to be uniform, with the values of the side with fewer distinct values all matching.
+    double selectivity = 0;
+    double leftCommonFraction = 0;
+    double rightCommonFraction = 0;
+    uint64_t numCommonValues = 0;
+    for (auto& [hash, leftCount] : leftMCV->getEntries()) {
+        auto rightCount = rightMCV->getCount(hash);
+        if (rightCount == 0) {
+            continue;
+        }
+        auto leftFraction = static_cast<double>(leftCount) / leftNumValues;
+        auto rightFraction = static_cast<double>(rightCount) / rightNumValues;
+        selectivity += leftFraction * rightFraction;
+        leftCommonFraction += leftFraction;
+        rightCommonFraction += rightFraction;
+        numCommonValues++;
+    }
+    auto maxNumDistinctValues = std::max(leftStats->getNumDistinctValues(leftColumnID),
+        rightStats->getNumDistinctValues(rightColumnID));
+    auto numRemainingDistinctValues = std::max(
+        static_cast<double>(maxNumDistinctValues) - static_cast<double>(numCommonValues), 1.0);
+    selectivity +=
+        (1 - leftCommonFraction) * (1 - rightCommonFraction) / numRemainingDistinctValues;
+    // Nulls never match.
+    return selectivity * getNonNullFraction(leftColumnStats) *
+           getNonNullFraction(rightColumnStats);
+}
+
 uint64_t CardinalityEstimator::estimateFilter(const LogicalOperator& childPlan,
     const Expression& predicate) const {
     if (predicate.expressionType == ExpressionType::EQUALS) {
         if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
             return 1;
         } else {
+            auto selectivity =
+                estimateEqualitySelectivity(*predicate.getChild(0), *predicate.getChild(1));
+            if (!selectivity.has_value()) {
+                selectivity =
+                    estimateEqualitySelectivity(*predicate.getChild(1), *predicate.getChild(0));
+            }
+            if (selectivity.has_value()) {
+                return atLeastOne(childPlan.getCardinality() * selectivity.value());
+            }
             const auto numDistinctValues =
                 getTableStatsIfPossible(context, predicate, nodeTableStats);
             if (numDistinctValues.has_value()) {
@@ -198,8 +429,9 @@ uint64_t CardinalityEstimator::estimateFilter(const LogicalOperator& childPlan,
                 childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
         }
     } else {
-        return atLeastOne(
-            childPlan.getCardinality() * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
+        auto selectivity = estimateRangeSelectivity(predicate);
+        return atLeastOne(childPlan.getCardinality() *
+                          selectivity.value_or(PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY));
     }
 }
 
@@ -249,5 +481,65 @@ double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     }
 }
 
+// Returns the extend in the plan that reached the given node as its neighbour, if any.
+static const LogicalExtend* findExtendToNode(const LogicalOperator& op,
+    const std::string& nodeName) {
+    if (op.getOperatorType() == LogicalOperatorType::EXTEND) {
+        auto& extend = op.constCast<LogicalExtend>();
+        if (extend.getNbrNode()->getUniqueName() == nodeName) {
+            return &extend;
+        }
+    }
+    for (auto i = 0u; i < op.getNumChildren(); ++i) {
+        if (auto extend = findExtendToNode(*op.getChild(i), nodeName)) {
+            return extend;
+        }
+    }
+    return nullptr;
+}
+
+double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
+    const NodeExpression& boundNode, ExtendDirection direction, const LogicalOperator& boundSide,
+    const Transaction* transaction) const {
+    auto rate = getExtensionRate(rel, boundNode, transaction);
+    if (rel.getRelType() != QueryRelType::NON_RECURSIVE) {
+        return rate;
+    }
+    return rate * getDegreeSkewFactor(rel, boundNode, direction, boundSide, transaction);
+}
+
+double CardinalityEstimator::getDegreeSkewFactor(const RelExpression& rel,
+    const NodeExpression& boundNode, ExtendDirection direction, const LogicalOperator& boundSide,
+    const Transaction* transaction) const {
+    if (direction == ExtendDirection::BOTH || rel.getTableIDs().size() != 1 ||
+        boundNode.getTableIDs().size() != 1) {
+        return 1;
+    }
+    // A node reached by extending along rels is picked with a probability proportional to its
+    // degree in the opposite direction. Extending back in that direction over the same rels thus
+    // sees the size-biased mean degree sum(d^2) / sum(d) instead of the mean degree.
+    auto prevExtend = findExtendToNode(boundSide, boundNode.getUniqueName());
+    if (prevExtend == nullptr || prevExtend->getDirection() == ExtendDirection::BOTH ||
+        prevExtend->getDirection() == direction ||
+        prevExtend->getRel()->getTableIDs() != rel.getTableIDs()) {
+        return 1;
+    }
+    auto& relTable =
+        context->getStorageManager()->getTable(rel.getTableIDs()[0])->cast<storage::RelTable>();
+    auto degreeStats =
+        relTable.getDirectedTableData(ExtendDirectionUtil::getRelDataDirection(direction))
+            ->getDegreeStats();
+    if (degreeStats.getNumRels() == 0) {
+        return 1;
+    }
+    // Degree stats may not cover rels that have not been checkpointed yet, so the mean degree is
+    // computed from the total number of rels instead.
+    auto biasedDegree =
+        degreeStats.getSumOfSquares() / static_cast<double>(degreeStats.getNumRels());
+    auto meanDegree = static_cast<double>(getNumRels(transaction, rel.getTableIDs())) /
+                      static_cast<double>(getNumNodes(transaction, boundNode.getTableIDs()));
+    return std::max(biasedDegree / meanDegree, 1.0);
+}
+
 } // namespace planner
 } // namespace kuzu
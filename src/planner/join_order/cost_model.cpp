@@ -8,8 +8,12 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace planner {
 
-uint64_t CostModel::computeExtendCost(const LogicalPlan& childPlan) {
-    return childPlan.getCost() + childPlan.getCardinality();
+uint64_t CostModel::computeExtendCost(const LogicalPlan& childPlan,
+    const binder::Expression& boundNodeID) {
+    auto lookupCost = JoinOrderUtil::isNodeSequential(childPlan.getLastOperatorRef(), boundNodeID) ?
+                          1 :
+                          PlannerKnobs::RANDOM_LOOKUP_PENALTY;
+    return childPlan.getCost() + lookupCost * childPlan.getCardinality();
 }
 
 uint64_t CostModel::computeRecursiveExtendCost(uint8_t upperBound, double extensionRate,
@@ -56,16 +60,18 @@ uint64_t CostModel::computeMarkJoinCost(const binder::expression_vector& joinNod
     return computeHashJoinCost(joinNodeIDs, probe, build);
 }
 
-uint64_t CostModel::computeIntersectCost(const kuzu::planner::LogicalPlan& probePlan,
-    const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans) {
+uint64_t CostModel::computeIntersectCost(const binder::expression_vector& boundNodeIDs,
+    const LogicalPlan& probePlan, const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans) {
+    KU_ASSERT(boundNodeIDs.size() == buildPlans.size());
     uint64_t cost = 0ul;
     cost += probePlan.getCost();
-    // TODO(Xiyang): think of how to calculate intersect cost such that it will be picked in worst
-    // case.
-    cost += probePlan.getCardinality();
-    for (auto& buildPlan : buildPlans) {
-        KU_ASSERT(buildPlan->getCardinality() >= 1);
-        cost += buildPlan->getCost();
+    cost += probePlan.getCardinality() * buildPlans.size();
+    for (auto i = 0u; i < buildPlans.size(); ++i) {
+        KU_ASSERT(buildPlans[i]->getCardinality() >= 1);
+        cost += buildPlans[i]->getCost();
+        cost += PlannerKnobs::BUILD_PENALTY *
+                JoinOrderUtil::getJoinKeysFlatCardinality({boundNodeIDs[i]},
+                    buildPlans[i]->getLastOperatorRef());
     }
     return cost;
 }
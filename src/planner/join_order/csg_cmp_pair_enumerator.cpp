@@ -0,0 +1,160 @@
+#include "planner/join_order/csg_cmp_pair_enumerator.h"
+
+#include "common/assert.h"
+
+using namespace kuzu::binder;
+
+namespace kuzu {
+namespace planner {
+
+CsgCmpPairEnumerator::CsgCmpPairEnumerator(std::vector<SubqueryGraph> vertices,
+    uint64_t maxNumPairs)
+    : vertices{std::move(vertices)}, maxNumPairs{maxNumPairs}, numPairs{0} {
+    KU_ASSERT(this->vertices.size() <= 2 * MAX_NUM_QUERY_VARIABLES);
+    adjacency.resize(this->vertices.size());
+    for (auto i = 0u; i < this->vertices.size(); ++i) {
+        for (auto j = 0u; j < this->vertices.size(); ++j) {
+            if (i != j && !this->vertices[i].getConnectedNodePos(this->vertices[j]).empty()) {
+                adjacency[i][j] = true;
+            }
+        }
+    }
+}
+
+// Vertices are visited from the last one. Each csg is only extended with vertices after its
+// first vertex, which is why it is emitted once.
+bool CsgCmpPairEnumerator::enumerate() {
+    for (auto i = (int64_t)vertices.size() - 1; i >= 0; --i) {
+        vertex_set_t csg;
+        csg[i] = true;
+        vertex_set_t excluded;
+        for (auto j = 0; j <= i; ++j) {
+            excluded[j] = true;
+        }
+        if (!emitCsg(csg) || !enumerateCsgRec(csg, excluded)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const std::vector<csg_cmp_pair_t>& CsgCmpPairEnumerator::getPairs(uint32_t level) const {
+    static const std::vector<csg_cmp_pair_t> noPairs;
+    return level < pairsPerLevel.size() ? pairsPerLevel[level] : noPairs;
+}
+
+CsgCmpPairEnumerator::vertex_set_t CsgCmpPairEnumerator::getNbrs(const vertex_set_t& vertexSet,
+    const vertex_set_t& excluded) const {
+    vertex_set_t result;
+    for (auto i = 0u; i < vertices.size(); ++i) {
+        if (vertexSet[i]) {
+            result |= adjacency[i];
+        }
+    }
+    return result & ~vertexSet & ~excluded;
+}
+
+SubqueryGraph CsgCmpPairEnumerator::getSubgraph(const vertex_set_t& vertexSet) const {
+    auto result = SubqueryGraph(vertices[0].queryGraph);
+    for (auto i = 0u; i < vertices.size(); ++i) {
+        if (vertexSet[i]) {
+            result.addSubqueryGraph(vertices[i]);
+        }
+    }
+    return result;
+}
+
+template<typename Func>
+bool CsgCmpPairEnumerator::forEachSubset(const vertex_set_t& vertexSet, Func func) const {
+    std::vector<uint32_t> positions;
+    for (auto i = 0u; i < vertices.size(); ++i) {
+        if (vertexSet[i]) {
+            positions.push_back(i);
+        }
+    }
+    // More subsets than any budget.
+    if (positions.size() >= 64) {
+        return false;
+    }
+    for (uint64_t mask = 1; mask < (1ull << positions.size()); ++mask) {
+        vertex_set_t subset;
+        for (auto i = 0u; i < positions.size(); ++i) {
+            if (mask & (1ull << i)) {
+                subset[positions[i]] = true;
+            }
+        }
+        if (!func(subset)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A cmp only has vertices after the first vertex of the csg, and is built from its own first
+// vertex in the same way as a csg.
+bool CsgCmpPairEnumerator::emitCsg(const vertex_set_t& csg) {
+    auto excluded = csg;
+    for (auto i = 0u; i < vertices.size() && !csg[i]; ++i) {
+        excluded[i] = true;
+    }
+    auto nbrs = getNbrs(csg, excluded);
+    for (auto i = (int64_t)vertices.size() - 1; i >= 0; --i) {
+        if (!nbrs[i]) {
+            continue;
+        }
+        vertex_set_t cmp;
+        cmp[i] = true;
+        auto cmpExcluded = excluded;
+        for (auto j = 0; j <= i; ++j) {
+            cmpExcluded[j] = cmpExcluded[j] || nbrs[j];
+        }
+        if (!emitPair(csg, cmp) || !enumerateCmpRec(csg, cmp, cmpExcluded)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CsgCmpPairEnumerator::enumerateCsgRec(const vertex_set_t& csg, const vertex_set_t& excluded) {
+    auto nbrs = getNbrs(csg, excluded);
+    if (nbrs.none()) {
+        return true;
+    }
+    if (!forEachSubset(nbrs, [&](const vertex_set_t& subset) { return emitCsg(csg | subset); })) {
+        return false;
+    }
+    return forEachSubset(nbrs, [&](const vertex_set_t& subset) {
+        return enumerateCsgRec(csg | subset, excluded | nbrs);
+    });
+}
+
+bool CsgCmpPairEnumerator::enumerateCmpRec(const vertex_set_t& csg, const vertex_set_t& cmp,
+    const vertex_set_t& excluded) {
+    auto nbrs = getNbrs(cmp, excluded);
+    if (nbrs.none()) {
+        return true;
+    }
+    if (!forEachSubset(nbrs,
+            [&](const vertex_set_t& subset) { return emitPair(csg, cmp | subset); })) {
+        return false;
+    }
+    return forEachSubset(nbrs, [&](const vertex_set_t& subset) {
+        return enumerateCmpRec(csg, cmp | subset, excluded | nbrs);
+    });
+}
+
+bool CsgCmpPairEnumerator::emitPair(const vertex_set_t& csg, const vertex_set_t& cmp) {
+    if (++numPairs > maxNumPairs) {
+        return false;
+    }
+    auto pair = std::make_pair(getSubgraph(csg), getSubgraph(cmp));
+    auto level = pair.first.getTotalNumVariables() + pair.second.getTotalNumVariables();
+    if (level >= pairsPerLevel.size()) {
+        pairsPerLevel.resize(level + 1);
+    }
+    pairsPerLevel[level].push_back(std::move(pair));
+    return true;
+}
+
+} // namespace planner
+} // namespace kuzu
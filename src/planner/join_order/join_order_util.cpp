@@ -1,5 +1,7 @@
 #include "planner/join_order/join_order_util.h"
 
+#include "planner/operator/scan/logical_scan_node_table.h"
+
 namespace kuzu {
 namespace planner {
 
@@ -20,5 +22,31 @@ uint64_t JoinOrderUtil::getJoinKeysFlatCardinality(const binder::expression_vect
     return cardinality;
 }
 
+static const LogicalOperator* getSequentialScan(const LogicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::NODE_LABEL_FILTER:
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::PROJECTION: { // operators we directly search through
+        return getSequentialScan(op->getChild(0).get());
+    }
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        return op;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+bool JoinOrderUtil::isNodeSequential(const LogicalOperator& op, const binder::Expression& nodeID) {
+    const auto seqScan = getSequentialScan(&op);
+    if (seqScan == nullptr) {
+        return false;
+    }
+    return seqScan->constCast<LogicalScanNodeTable>().getNodeID()->getUniqueName() ==
+           nodeID.getUniqueName();
+}
+
 } // namespace planner
 } // namespace kuzu
@@ -138,6 +138,9 @@ std::unique_ptr<LogicalOperator> LogicalHashJoin::copy() {
     auto op = std::make_unique<LogicalHashJoin>(joinConditions, joinType, mark, children[0]->copy(),
         children[1]->copy(), cardinality);
     op->sipInfo = sipInfo;
+    op->buildSubgraphName = buildSubgraphName;
+    op->buildCardinality = buildCardinality;
+    // Join key filter targets point into the original children and are not carried over.
     return op;
 }
 
@@ -84,6 +84,8 @@ std::string LogicalOperatorUtils::logicalOperatorTypeToString(LogicalOperatorTyp
         return "PATH_PROPERTY_PROBE";
     case LogicalOperatorType::PROJECTION:
         return "PROJECTION";
+    case LogicalOperatorType::PROPERTY_LOOKUP:
+        return "PROPERTY_LOOKUP";
     case LogicalOperatorType::RECURSIVE_EXTEND:
         return "RECURSIVE_EXTEND";
     case LogicalOperatorType::SCAN_NODE_TABLE:
@@ -92,6 +94,8 @@ std::string LogicalOperatorUtils::logicalOperatorTypeToString(LogicalOperatorTyp
         return "SEMI_MASKER";
     case LogicalOperatorType::SET_PROPERTY:
         return "SET_PROPERTY";
+    case LogicalOperatorType::SHARED_SUBPLAN_SCAN:
+        return "SHARED_SUBPLAN_SCAN";
     case LogicalOperatorType::STANDALONE_CALL:
         return "STANDALONE_CALL";
     case LogicalOperatorType::TABLE_FUNCTION_CALL:
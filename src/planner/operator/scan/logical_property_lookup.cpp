@@ -0,0 +1,23 @@
+#include "planner/operator/scan/logical_property_lookup.h"
+
+namespace kuzu {
+namespace planner {
+
+// Properties are read into the data chunk of the node IDs.
+void LogicalPropertyLookup::computeFactorizedSchema() {
+    copyChildSchema(0);
+    const auto groupPos = schema->getGroupPos(*nodeID);
+    for (auto& property : properties) {
+        schema->insertToGroupAndScope(property, groupPos);
+    }
+}
+
+void LogicalPropertyLookup::computeFlatSchema() {
+    copyChildSchema(0);
+    for (auto& property : properties) {
+        schema->insertToGroupAndScope(property, 0);
+    }
+}
+
+} // namespace planner
+} // namespace kuzu
@@ -27,7 +27,8 @@ void LogicalScanNodeTable::computeFactorizedSchema() {
         auto recursiveJoinInfo = extraInfo->constCast<RecursiveJoinScanInfo>();
         schema->insertToGroupAndScope(recursiveJoinInfo.nodePredicateExecFlag, groupPos);
     } break;
-    case LogicalScanNodeTableType::PRIMARY_KEY_SCAN: {
+    case LogicalScanNodeTableType::PRIMARY_KEY_SCAN:
+    case LogicalScanNodeTableType::PROPERTY_INDEX_SCAN: {
         schema->setGroupAsSingleState(groupPos);
     } break;
     default:
@@ -48,6 +49,22 @@ void LogicalScanNodeTable::computeFlatSchema() {
     }
 }
 
+void LogicalScanNodeTable::removeProperties(const binder::expression_set& propertiesToRemove) {
+    binder::expression_vector propertiesToKeep;
+    std::vector<storage::ColumnPredicateSet> predicatesToKeep;
+    for (auto i = 0u; i < properties.size(); ++i) {
+        if (propertiesToRemove.contains(properties[i])) {
+            continue;
+        }
+        propertiesToKeep.push_back(properties[i]);
+        if (!propertyPredicates.empty()) {
+            predicatesToKeep.push_back(std::move(propertyPredicates[i]));
+        }
+    }
+    properties = std::move(propertiesToKeep);
+    propertyPredicates = std::move(predicatesToKeep);
+}
+
 std::unique_ptr<LogicalOperator> LogicalScanNodeTable::copy() {
     return std::make_unique<LogicalScanNodeTable>(*this);
 }
@@ -0,0 +1,37 @@
+#include "planner/operator/scan/logical_shared_subplan_scan.h"
+
+#include "planner/operator/factorization/sink_util.h"
+
+namespace kuzu {
+namespace planner {
+
+// Tuples are materialized the way an accumulate materializes them, so expressions are grouped as
+// SinkOperatorUtil groups the payloads. They are kept in scope in the same order, which e.g. union
+// relies on.
+void LogicalSharedSubplanScan::computeFactorizedSchema() {
+    createEmptySchema();
+    KU_ASSERT(payloads.size() == expressions.size());
+    Schema sinkSchema;
+    SinkOperatorUtil::recomputeSchema(*subplan->getSchema(), payloads, sinkSchema);
+    for (auto i = 0u; i < sinkSchema.getNumGroups(); ++i) {
+        auto groupPos = schema->createGroup();
+        if (sinkSchema.getGroup(i)->isSingleState()) {
+            schema->setGroupAsSingleState(groupPos);
+        }
+        schema->getGroup(groupPos)->setMultiplier(sinkSchema.getGroup(i)->getMultiplier());
+    }
+    for (auto i = 0u; i < payloads.size(); ++i) {
+        schema->insertToGroupAndScope(expressions[i], sinkSchema.getGroupPos(*payloads[i]));
+    }
+}
+
+void LogicalSharedSubplanScan::computeFlatSchema() {
+    createEmptySchema();
+    schema->createGroup();
+    for (auto& expression : expressions) {
+        schema->insertToGroupAndScope(expression, 0);
+    }
+}
+
+} // namespace planner
+} // namespace kuzu
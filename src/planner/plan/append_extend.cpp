@@ -92,11 +92,11 @@ void Planner::appendNonRecursiveExtend(const std::shared_ptr<NodeExpression>& bo
         properties_, plan.getLastOperator());
     extend->computeFactorizedSchema();
     // Update cost & cardinality. Note that extend does not change cardinality.
-    const auto extensionRate =
-        cardinalityEstimator.getExtensionRate(*rel, *boundNode, clientContext->getTx());
+    const auto extensionRate = cardinalityEstimator.getExtensionRate(*rel, *boundNode, direction,
+        plan.getLastOperatorRef(), clientContext->getTx());
     extend->setCardinality(
         cardinalityEstimator.estimateExtend(extensionRate, plan.getLastOperatorRef()));
-    plan.setCost(CostModel::computeExtendCost(plan));
+    plan.setCost(CostModel::computeExtendCost(plan, *boundNode->getInternalID()));
     auto group = extend->getSchema()->getGroup(nbrNode->getInternalID());
     group->setMultiplier(extensionRate);
     plan.setLastOperator(std::move(extend));
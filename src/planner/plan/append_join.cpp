@@ -116,7 +116,7 @@ void Planner::appendIntersect(const std::shared_ptr<Expression>& intersectNodeID
     }
     intersect->setCardinality(cardinalityEstimator.estimateIntersect(boundNodeIDs,
         probePlan.getLastOperatorRef(), buildOps));
-    probePlan.setCost(CostModel::computeIntersectCost(probePlan, buildPlans));
+    probePlan.setCost(CostModel::computeIntersectCost(boundNodeIDs, probePlan, buildPlans));
     probePlan.setLastOperator(std::move(intersect));
 }
 
@@ -4,9 +4,11 @@
 #include "common/enums/join_type.h"
 #include "main/client_context.h"
 #include "planner/join_order/cost_model.h"
+#include "planner/join_order/csg_cmp_pair_enumerator.h"
+#include "planner/join_order/join_order_util.h"
 #include "planner/join_order/join_plan_solver.h"
 #include "planner/join_order/join_tree_constructor.h"
-#include "planner/operator/scan/logical_scan_node_table.h"
+#include "planner/operator/logical_hash_join.h"
 #include "planner/planner.h"
 
 using namespace kuzu::binder;
@@ -144,10 +146,7 @@ std::vector<std::unique_ptr<LogicalPlan>> Planner::enumerateQueryGraph(const Que
         return result;
     }
     planBaseTableScans(info);
-    context.currentLevel++;
-    while (context.currentLevel < context.maxLevel) {
-        planLevel(context.currentLevel++);
-    }
+    planJoinOrder();
     auto plans = std::move(context.getPlans(context.getFullyMatchedSubqueryGraph()));
     if (queryGraph.isEmpty()) {
         for (auto& plan : plans) {
@@ -158,28 +157,146 @@ std::vector<std::unique_ptr<LogicalPlan>> Planner::enumerateQueryGraph(const Que
     return plans;
 }
 
-void Planner::planLevel(uint32_t level) {
-    KU_ASSERT(level > 1);
-    if (level > MAX_LEVEL_TO_PLAN_EXACTLY) {
-        planLevelApproximately(level);
-    } else {
-        planLevelExactly(level);
+void Planner::addPlan(const SubqueryGraph& subgraph, std::unique_ptr<LogicalPlan> plan) {
+    auto observedCardinality = cardinalityEstimator.getObservedCardinality(subgraph);
+    if (observedCardinality.has_value()) {
+        // The last operator is never shared with plans of other subgraphs.
+        plan->getLastOperator()->setCardinality(*observedCardinality);
     }
+    context.addPlan(subgraph, std::move(plan));
 }
 
-void Planner::planLevelExactly(uint32_t level) {
+void Planner::planJoinOrder() {
+    // Only base table scans are planned so far.
+    std::vector<SubqueryGraph> baseSubgraphs;
+    for (auto level = 1u; level < context.maxLevel; ++level) {
+        for (auto& subgraph : context.subPlansTable->getSubqueryGraphs(level)) {
+            baseSubgraphs.push_back(subgraph);
+        }
+    }
+    auto enumerator =
+        CsgCmpPairEnumerator(baseSubgraphs, clientContext->getClientConfig()->joinOrderBudget);
+    if (enumerator.enumerate()) {
+        context.currentLevel++;
+        while (context.currentLevel < context.maxLevel) {
+            planLevel(context.currentLevel++, enumerator);
+        }
+        if (context.containPlans(context.getFullyMatchedSubqueryGraph())) {
+            return;
+        }
+    }
+    planJoinOrderGreedily(baseSubgraphs);
+}
+
+void Planner::planLevel(uint32_t level, const CsgCmpPairEnumerator& enumerator) {
+    KU_ASSERT(level > 1);
     auto maxLeftLevel = floor(level / 2.0);
-    for (auto leftLevel = 1u; leftLevel <= maxLeftLevel; ++leftLevel) {
-        auto rightLevel = level - leftLevel;
-        if (leftLevel > 1) { // wcoj requires at least 2 rels
-            planWCOJoin(leftLevel, rightLevel);
+    // wcoj requires at least 2 rels
+    for (auto leftLevel = 2u; leftLevel <= maxLeftLevel; ++leftLevel) {
+        planWCOJoin(leftLevel, level - leftLevel);
+    }
+    for (auto& [subgraph, otherSubgraph] : enumerator.getPairs(level)) {
+        planInnerJoin(subgraph, otherSubgraph);
+    }
+}
+
+static const SubqueryGraph& getComponent(const std::vector<SubqueryGraph>& components,
+    idx_t nodePos) {
+    for (auto& component : components) {
+        if (component.queryNodesSelector[nodePos]) {
+            return component;
+        }
+    }
+    KU_UNREACHABLE;
+}
+
+// Greedy operator ordering (GOO). Components start as the scans of nodes. Each step picks the rel
+// whose join with the components of its end nodes has the cheapest plan, until one component
+// covers the query graph. Components only contain rels between their own nodes.
+// Joins stay in the dp table, so a candidate whose components did not change in a step is not
+// planned again.
+void Planner::planJoinOrderGreedily(const std::vector<SubqueryGraph>& baseSubgraphs) {
+    auto queryGraph = context.getQueryGraph();
+    std::vector<SubqueryGraph> components;
+    for (auto& subgraph : baseSubgraphs) {
+        if (subgraph.getNumQueryRels() == 0) {
+            components.push_back(subgraph);
+        }
+    }
+    std::vector<idx_t> relPositions;
+    for (auto relPos = 0u; relPos < queryGraph->getNumQueryRels(); ++relPos) {
+        relPositions.push_back(relPos);
+    }
+    subquery_graph_set_t plannedSubgraphs;
+    while (!relPositions.empty()) {
+        auto bestIdx = INVALID_IDX;
+        auto bestCost = UINT64_MAX;
+        for (auto i = 0u; i < relPositions.size(); ++i) {
+            auto rel = queryGraph->getQueryRel(relPositions[i]);
+            auto& srcComponent =
+                getComponent(components, queryGraph->getQueryNodeIdx(rel->getSrcNodeName()));
+            auto& dstComponent =
+                getComponent(components, queryGraph->getQueryNodeIdx(rel->getDstNodeName()));
+            auto relSubgraph = context.getEmptySubqueryGraph();
+            relSubgraph.addQueryRel(relPositions[i]);
+            planGreedyJoin(srcComponent, relSubgraph, dstComponent, plannedSubgraphs);
+            auto newSubgraph = srcComponent;
+            newSubgraph.addSubqueryGraph(relSubgraph);
+            newSubgraph.addSubqueryGraph(dstComponent);
+            if (!context.containPlans(newSubgraph)) {
+                continue;
+            }
+            for (auto& plan : context.getPlans(newSubgraph)) {
+                if (plan->getCost() < bestCost) {
+                    bestCost = plan->getCost();
+                    bestIdx = i;
+                }
+            }
+        }
+        if (bestIdx == INVALID_IDX) { // No rel can be joined.
+            return;
         }
-        planInnerJoin(leftLevel, rightLevel);
+        auto rel = queryGraph->getQueryRel(relPositions[bestIdx]);
+        auto srcNodePos = queryGraph->getQueryNodeIdx(rel->getSrcNodeName());
+        auto dstNodePos = queryGraph->getQueryNodeIdx(rel->getDstNodeName());
+        auto newComponent = getComponent(components, srcNodePos);
+        newComponent.addQueryRel(relPositions[bestIdx]);
+        newComponent.addSubqueryGraph(getComponent(components, dstNodePos));
+        std::vector<SubqueryGraph> newComponents;
+        newComponents.push_back(newComponent);
+        for (auto& component : components) {
+            if (!component.queryNodesSelector[srcNodePos] &&
+                !component.queryNodesSelector[dstNodePos]) {
+                newComponents.push_back(component);
+            }
+        }
+        components = std::move(newComponents);
+        relPositions.erase(relPositions.begin() + bestIdx);
     }
 }
 
-void Planner::planLevelApproximately(uint32_t level) {
-    planInnerJoin(1, level - 1);
+void Planner::planGreedyJoin(const SubqueryGraph& subgraph, const SubqueryGraph& relSubgraph,
+    const SubqueryGraph& otherSubgraph, subquery_graph_set_t& plannedSubgraphs) {
+    auto newSubgraph = subgraph;
+    newSubgraph.addSubqueryGraph(relSubgraph);
+    newSubgraph.addSubqueryGraph(otherSubgraph);
+    if (plannedSubgraphs.contains(newSubgraph)) {
+        return;
+    }
+    plannedSubgraphs.insert(newSubgraph);
+    if (subgraph == otherSubgraph) { // The rel closes a cycle.
+        planInnerJoin(subgraph, relSubgraph);
+        return;
+    }
+    // Join the rel with either component first.
+    auto extendedSubgraph = subgraph;
+    extendedSubgraph.addSubqueryGraph(relSubgraph);
+    planInnerJoin(subgraph, relSubgraph);
+    planInnerJoin(extendedSubgraph, otherSubgraph);
+    auto otherExtendedSubgraph = otherSubgraph;
+    otherExtendedSubgraph.addSubqueryGraph(relSubgraph);
+    planInnerJoin(otherSubgraph, relSubgraph);
+    planInnerJoin(otherExtendedSubgraph, subgraph);
 }
 
 void Planner::planBaseTableScans(const QueryGraphPlanningInfo& info) {
@@ -242,7 +359,7 @@ void Planner::planCorrelatedExpressionsScan(const QueryGraphPlanningInfo& info)
         context.getWhereExpressions());
     appendFilters(predicates, *plan);
     appendDistinct(corrExprs, *plan);
-    context.addPlan(newSubgraph, std::move(plan));
+    addPlan(newSubgraph, std::move(plan));
 }
 
 void Planner::planNodeScan(uint32_t nodePos) {
@@ -255,7 +372,7 @@ void Planner::planNodeScan(uint32_t nodePos) {
     auto predicates = getNewlyMatchedExprs(context.getEmptySubqueryGraph(), newSubgraph,
         context.getWhereExpressions());
     appendFilters(predicates, *plan);
-    context.addPlan(newSubgraph, std::move(plan));
+    addPlan(newSubgraph, std::move(plan));
 }
 
 void Planner::planNodeIDScan(uint32_t nodePos, const QueryGraphPlanningInfo& info) {
@@ -270,7 +387,7 @@ void Planner::planNodeIDScan(uint32_t nodePos, const QueryGraphPlanningInfo& inf
     cardinalityEstimator.addPerQueryGraphNodeIDDom(*node->getInternalID(), info.corrExprsCard);
 
     appendScanNodeTable(node->getInternalID(), node->getTableIDs(), {}, *plan);
-    context.addPlan(newSubgraph, std::move(plan));
+    addPlan(newSubgraph, std::move(plan));
 }
 
 static std::pair<std::shared_ptr<NodeExpression>, std::shared_ptr<NodeExpression>>
@@ -308,7 +425,7 @@ void Planner::planRelScan(uint32_t relPos) {
         appendScanNodeTable(boundNode->getInternalID(), boundNode->getTableIDs(), {}, *plan);
         appendExtend(boundNode, nbrNode, rel, extendDirection, getProperties(*rel), *plan);
         appendFilters(predicates, *plan);
-        context.addPlan(newSubgraph, std::move(plan));
+        addPlan(newSubgraph, std::move(plan));
     }
 }
 
@@ -380,38 +497,13 @@ void Planner::planWCOJoin(uint32_t leftLevel, uint32_t rightLevel) {
     }
 }
 
-static LogicalOperator* getSequentialScan(LogicalOperator* op) {
-    switch (op->getOperatorType()) {
-    case LogicalOperatorType::FLATTEN:
-    case LogicalOperatorType::FILTER:
-    case LogicalOperatorType::EXTEND:
-    case LogicalOperatorType::PROJECTION: { // operators we directly search through
-        return getSequentialScan(op->getChild(0).get());
-    }
-    case LogicalOperatorType::SCAN_NODE_TABLE: {
-        return op;
-    }
-    default:
-        return nullptr;
-    }
-}
-
-// Check whether given node ID has sequential guarantee on the plan.
-static bool isNodeSequentialOnPlan(const LogicalPlan& plan, const NodeExpression& node) {
-    const auto seqScan = getSequentialScan(plan.getLastOperator().get());
-    if (seqScan == nullptr) {
-        return false;
-    }
-    const auto sequentialScan = ku_dynamic_cast<LogicalScanNodeTable*>(seqScan);
-    return sequentialScan->getNodeID()->getUniqueName() == node.getInternalID()->getUniqueName();
-}
-
 // As a heuristic for wcoj, we always pick rel scan that starts from the bound node.
 static std::unique_ptr<LogicalPlan> getWCOJBuildPlanForRel(
     std::vector<std::unique_ptr<LogicalPlan>>& candidatePlans, const NodeExpression& boundNode) {
     std::unique_ptr<LogicalPlan> result;
     for (auto& candidatePlan : candidatePlans) {
-        if (isNodeSequentialOnPlan(*candidatePlan, boundNode)) {
+        if (JoinOrderUtil::isNodeSequential(*candidatePlan->getLastOperator(),
+                *boundNode.getInternalID())) {
             KU_ASSERT(result == nullptr);
             result = candidatePlan->shallowCopy();
         }
@@ -473,7 +565,7 @@ void Planner::planWCOJoin(const SubqueryGraph& subgraph,
         for (auto& predicate : predicates) {
             appendFilter(predicate, *leftPlanCopy);
         }
-        context.subPlansTable->addPlan(newSubgraph, std::move(leftPlanCopy));
+        addPlan(newSubgraph, std::move(leftPlanCopy));
     }
 }
 
@@ -496,41 +588,38 @@ static bool needPruneImplicitJoins(const SubqueryGraph& leftSubgraph,
     return intersectionSize != numJoinNodes;
 }
 
-void Planner::planInnerJoin(uint32_t leftLevel, uint32_t rightLevel) {
-    KU_ASSERT(leftLevel <= rightLevel);
-    for (auto& rightSubgraph : context.subPlansTable->getSubqueryGraphs(rightLevel)) {
-        for (auto& nbrSubgraph : rightSubgraph.getNbrSubgraphs(leftLevel)) {
-            // E.g. MATCH (a)->(b) MATCH (b)->(c)
-            // Since we merge query graph for multipart query, during enumeration for the second
-            // match, the query graph is (a)->(b)->(c). However, we omit plans corresponding to the
-            // first match (i.e. (a)->(b)).
-            if (!context.containPlans(nbrSubgraph)) {
-                continue;
-            }
-            auto joinNodePositions = rightSubgraph.getConnectedNodePos(nbrSubgraph);
-            auto joinNodes = context.queryGraph->getQueryNodes(joinNodePositions);
-            if (needPruneImplicitJoins(nbrSubgraph, rightSubgraph, joinNodes.size())) {
-                continue;
-            }
-            // If index nested loop (INL) join is possible, we prune hash join plans
-            if (tryPlanINLJoin(rightSubgraph, nbrSubgraph, joinNodes)) {
-                continue;
-            }
-            planInnerHashJoin(rightSubgraph, nbrSubgraph, joinNodes, leftLevel != rightLevel);
-        }
-    }
+void Planner::planInnerJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph) {
+    // E.g. MATCH (a)->(b) MATCH (b)->(c)
+    // Since we merge query graph for multipart query, during enumeration for the second
+    // match, the query graph is (a)->(b)->(c). However, we omit plans corresponding to the
+    // first match (i.e. (a)->(b)).
+    if (!context.containPlans(subgraph) || !context.containPlans(otherSubgraph)) {
+        return;
+    }
+    auto joinNodePositions = subgraph.getConnectedNodePos(otherSubgraph);
+    auto joinNodes = context.queryGraph->getQueryNodes(joinNodePositions);
+    if (needPruneImplicitJoins(subgraph, otherSubgraph, joinNodes.size())) {
+        return;
+    }
+    // Index nested loop (INL) join plans are added first so that hash join plans are only
+    // kept if they are cheaper.
+    planInnerINLJoin(subgraph, otherSubgraph, joinNodes);
+    planInnerHashJoin(subgraph, otherSubgraph, joinNodes);
 }
 
-bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
+// INL join extends the plans of subgraph that scan the join node sequentially, so that its CSR
+// adjacency lists are read in order. Hash join plans are still added and kept if cheaper.
+void Planner::planInnerINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
     const std::vector<std::shared_ptr<NodeExpression>>& joinNodes) {
     if (joinNodes.size() > 1) {
-        return false;
+        return;
     }
     if (!subgraph.isSingleRel() && !otherSubgraph.isSingleRel()) {
-        return false;
+        return;
     }
     if (subgraph.isSingleRel()) { // Always put single rel subgraph to right.
-        return tryPlanINLJoin(otherSubgraph, subgraph, joinNodes);
+        planInnerINLJoin(otherSubgraph, subgraph, joinNodes);
+        return;
     }
     auto relPos = UINT32_MAX;
     for (auto i = 0u; i < context.queryGraph->getNumQueryRels(); ++i) {
@@ -547,21 +636,27 @@ bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph&
     auto newSubgraph = subgraph;
     newSubgraph.addQueryRel(relPos);
     auto predicates = getNewlyMatchedExprs(subgraph, newSubgraph, context.getWhereExpressions());
-    bool hasAppliedINLJoin = false;
     for (auto& prevPlan : context.getPlans(subgraph)) {
-        if (isNodeSequentialOnPlan(*prevPlan, *boundNode)) {
-            auto plan = prevPlan->shallowCopy();
-            appendExtend(boundNode, nbrNode, rel, extendDirection, getProperties(*rel), *plan);
-            appendFilters(predicates, *plan);
-            context.addPlan(newSubgraph, std::move(plan));
-            hasAppliedINLJoin = true;
+        if (!JoinOrderUtil::isNodeSequential(*prevPlan->getLastOperator(),
+                *boundNode->getInternalID())) {
+            continue;
         }
+        auto plan = prevPlan->shallowCopy();
+        appendExtend(boundNode, nbrNode, rel, extendDirection, getProperties(*rel), *plan);
+        appendFilters(predicates, *plan);
+        addPlan(newSubgraph, std::move(plan));
     }
-    return hasAppliedINLJoin;
+}
+
+// Lets the build side of the hash join just appended to the plan check its estimate at runtime.
+static void setBuildSubgraph(LogicalPlan& plan, const SubqueryGraph& buildSubgraph) {
+    auto& hashJoin = plan.getLastOperator()->cast<LogicalHashJoin>();
+    hashJoin.setBuildSubgraph(buildSubgraph.getUniqueName(),
+        hashJoin.getChild(1)->getCardinality());
 }
 
 void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
-    const std::vector<std::shared_ptr<NodeExpression>>& joinNodes, bool flipPlan) {
+    const std::vector<std::shared_ptr<NodeExpression>>& joinNodes) {
     auto newSubgraph = subgraph;
     newSubgraph.addSubqueryGraph(otherSubgraph);
     auto maxCost = context.subPlansTable->getMaxCost(newSubgraph);
@@ -578,18 +673,19 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanBuildCopy = rightPlan->shallowCopy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, *leftPlanProbeCopy,
                     *rightPlanBuildCopy, *leftPlanProbeCopy);
+                setBuildSubgraph(*leftPlanProbeCopy, otherSubgraph);
                 appendFilters(predicates, *leftPlanProbeCopy);
-                context.addPlan(newSubgraph, std::move(leftPlanProbeCopy));
+                addPlan(newSubgraph, std::move(leftPlanProbeCopy));
             }
             // flip build and probe side to get another HashJoin plan
-            if (flipPlan &&
-                CostModel::computeHashJoinCost(joinNodeIDs, *rightPlan, *leftPlan) < maxCost) {
+            if (CostModel::computeHashJoinCost(joinNodeIDs, *rightPlan, *leftPlan) < maxCost) {
                 auto leftPlanBuildCopy = leftPlan->shallowCopy();
                 auto rightPlanProbeCopy = rightPlan->shallowCopy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, *rightPlanProbeCopy,
                     *leftPlanBuildCopy, *rightPlanProbeCopy);
+                setBuildSubgraph(*rightPlanProbeCopy, subgraph);
                 appendFilters(predicates, *rightPlanProbeCopy);
-                context.addPlan(newSubgraph, std::move(rightPlanProbeCopy));
+                addPlan(newSubgraph, std::move(rightPlanProbeCopy));
             }
         }
     }
@@ -61,9 +61,6 @@ std::vector<SubqueryGraph> DPLevel::getSubqueryGraphs() {
 
 void DPLevel::addPlan(const kuzu::binder::SubqueryGraph& subqueryGraph,
     std::unique_ptr<LogicalPlan> plan) {
-    if (subgraph2Plans.size() > MAX_NUM_SUBGRAPH) {
-        return;
-    }
     if (!contains(subqueryGraph)) {
         subgraph2Plans.insert({subqueryGraph, std::make_unique<SubgraphPlans>(subqueryGraph)});
     }
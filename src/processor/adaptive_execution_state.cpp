@@ -0,0 +1,58 @@
+#include "processor/adaptive_execution_state.h"
+
+#include <algorithm>
+
+#include "common/string_format.h"
+#include "processor/operator/hash_join/hash_join_build.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void AdaptiveExecutionState::observeCardinality(const std::string& subgraphName,
+    cardinality_t estimate, cardinality_t actual) {
+    std::unique_lock lck{mtx};
+    if (observedCardinalities.contains(subgraphName)) {
+        return;
+    }
+    observedCardinalities.emplace(subgraphName, actual);
+    auto larger = static_cast<double>(std::max<cardinality_t>(std::max(estimate, actual), 1));
+    auto smaller = static_cast<double>(std::max<cardinality_t>(std::min(estimate, actual), 1));
+    if (larger / smaller <= threshold || numReoptimizations >= MAX_NUM_REOPTIMIZATIONS) {
+        return;
+    }
+    numReoptimizations++;
+    throw ReoptimizationException(stringFormat(
+        "Observed {} tuples instead of the estimated {} for {}.", actual, estimate, subgraphName));
+}
+
+bool AdaptiveExecutionState::hasObservedCardinality(const std::string& subgraphName) const {
+    std::unique_lock lck{mtx};
+    return observedCardinalities.contains(subgraphName);
+}
+
+cardinality_t AdaptiveExecutionState::getObservedCardinality(
+    const std::string& subgraphName) const {
+    std::unique_lock lck{mtx};
+    return observedCardinalities.at(subgraphName);
+}
+
+void AdaptiveExecutionState::addHashJoinBuild(const std::string& buildName,
+    std::shared_ptr<HashJoinSharedState> sharedState) {
+    std::unique_lock lck{mtx};
+    hashJoinBuilds[buildName] = std::move(sharedState);
+}
+
+std::shared_ptr<HashJoinSharedState> AdaptiveExecutionState::getFinishedHashJoinBuild(
+    const std::string& buildName) const {
+    std::unique_lock lck{mtx};
+    if (!hashJoinBuilds.contains(buildName)) {
+        return nullptr;
+    }
+    auto sharedState = hashJoinBuilds.at(buildName);
+    return sharedState->isBuilt() ? sharedState : nullptr;
+}
+
+} // namespace processor
+} // namespace kuzu
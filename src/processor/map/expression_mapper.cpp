@@ -11,6 +11,7 @@
 #include "common/exception/not_implemented.h"
 #include "common/string_format.h"
 #include "expression_evaluator/case_evaluator.h"
+#include "expression_evaluator/comparison_conjunction_evaluator.h"
 #include "expression_evaluator/function_evaluator.h"
 #include "expression_evaluator/lambda_evaluator.h"
 #include "expression_evaluator/literal_evaluator.h"
@@ -69,6 +70,11 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getEvaluator(
     } else if (expressionType == ExpressionType::CASE_ELSE) {
         return getCaseEvaluator(expression);
     } else if (canEvaluateAsFunction(expressionType)) {
+        if (expressionType == ExpressionType::AND) {
+            if (auto evaluator = getComparisonConjunctionEvaluator(expression)) {
+                return evaluator;
+            }
+        }
         return getFunctionEvaluator(expression);
     } else if (parentEvaluator != nullptr) {
         return getLambdaParamEvaluator(expression);
@@ -159,6 +165,84 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getFunctionEvaluator(
         std::move(childrenEvaluators));
 }
 
+static void collectConjuncts(const std::shared_ptr<Expression>& expression,
+    expression_vector& conjuncts) {
+    if (expression->expressionType != ExpressionType::AND) {
+        conjuncts.push_back(expression);
+        return;
+    }
+    for (auto& child : expression->getChildren()) {
+        collectConjuncts(child, conjuncts);
+    }
+}
+
+// Swaps the sides of a comparison, e.g. 5 < a.x is a.x > 5.
+static ExpressionType swapComparison(ExpressionType comparisonType) {
+    switch (comparisonType) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return comparisonType;
+    }
+}
+
+static std::optional<Value> getConstantValue(const Expression& expression) {
+    switch (expression.expressionType) {
+    case ExpressionType::LITERAL:
+        return expression.constCast<LiteralExpression>().getValue();
+    case ExpressionType::PARAMETER:
+        return expression.constCast<ParameterExpression>().getValue();
+    default:
+        return std::nullopt;
+    }
+}
+
+std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getComparisonConjunctionEvaluator(
+    std::shared_ptr<Expression> expression) {
+    KU_ASSERT(schema != nullptr);
+    expression_vector conjuncts;
+    collectConjuncts(expression, conjuncts);
+    evaluator_vector_t children;
+    std::vector<ColumnComparison> comparisons;
+    std::optional<f_group_pos> groupPos;
+    for (auto& conjunct : conjuncts) {
+        if (!ExpressionTypeUtil::isComparison(conjunct->expressionType)) {
+            return nullptr;
+        }
+        auto column = conjunct->getChild(0);
+        auto constant = conjunct->getChild(1);
+        auto comparisonType = conjunct->expressionType;
+        if (!schema->isExpressionInScope(*column)) {
+            std::swap(column, constant);
+            comparisonType = swapComparison(comparisonType);
+        }
+        auto value = getConstantValue(*constant);
+        if (!schema->isExpressionInScope(*column) || !value.has_value() || value->isNull() ||
+            value->getDataType() != column->dataType) {
+            return nullptr;
+        }
+        auto selectFunc =
+            ComparisonConjunctionEvaluator::getSelectFunc(column->dataType, comparisonType);
+        auto columnGroupPos = schema->getGroupPos(*column);
+        if (selectFunc == nullptr || (groupPos.has_value() && *groupPos != columnGroupPos)) {
+            return nullptr;
+        }
+        groupPos = columnGroupPos;
+        comparisons.push_back(
+            ColumnComparison{(idx_t)children.size(), (idx_t)(children.size() + 1), selectFunc});
+        children.push_back(getReferenceEvaluator(column));
+        children.push_back(std::make_unique<LiteralExpressionEvaluator>(constant, *value));
+    }
+    return std::make_unique<ComparisonConjunctionEvaluator>(expression, std::move(children),
+        std::move(comparisons), getFunctionEvaluator(expression));
+}
+
 std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getNodeEvaluator(
     std::shared_ptr<Expression> expression) {
     auto node = expression->constPtrCast<NodeExpression>();
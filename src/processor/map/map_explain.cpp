@@ -20,6 +20,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapExplain(LogicalOperator* logica
     auto lastPhysicalOP = mapOperator(lastLogicalOP.get());
     lastPhysicalOP = createResultCollector(AccumulateType::REGULAR,
         logicalExplain.getOutputExpressionsToExplain(), inSchema, std::move(lastPhysicalOP));
+    appendSharedSubplans(lastPhysicalOP.get());
     auto outputExpression = logicalExplain.getOutputExpression();
     if (logicalExplain.getExplainType() == ExplainType::PROFILE) {
         auto outputPosition = getDataPos(*outputExpression, *outSchema);
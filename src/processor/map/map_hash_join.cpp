@@ -1,7 +1,13 @@
 #include "binder/expression/expression_util.h"
+#include "binder/expression/property_expression.h"
+#include "main/client_context.h"
 #include "planner/operator/logical_hash_join.h"
+#include "planner/operator/sip/logical_semi_masker.h"
+#include "processor/operator/empty_result.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
+#include "processor/operator/scan/scan_table.h"
+#include "processor/operator/table_function_call.h"
 #include "processor/plan_mapper.h"
 
 using namespace kuzu::binder;
@@ -11,8 +17,17 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace processor {
 
+static bool isSingleTableInternalID(const Expression& expression) {
+    if (expression.expressionType != ExpressionType::PROPERTY ||
+        expression.getDataType().getLogicalTypeID() != LogicalTypeID::INTERNAL_ID) {
+        return false;
+    }
+    auto& property = expression.constCast<PropertyExpression>();
+    return property.isInternalID() && property.isSingleLabel();
+}
+
 std::unique_ptr<HashJoinBuildInfo> PlanMapper::createHashBuildInfo(const Schema& buildSchema,
-    const expression_vector& keys, const expression_vector& payloads) {
+    const expression_vector& keys, const expression_vector& payloads, bool compactInternalIDs) {
     planner::f_group_pos_set keyGroupPosSet;
     std::vector<DataPos> keysPos;
     std::vector<FStateType> fStateTypes;
@@ -40,10 +55,18 @@ std::unique_ptr<HashJoinBuildInfo> PlanMapper::createHashBuildInfo(const Schema&
             // 2. payload is in flat chunk
             auto columnSchema = ColumnSchema(false /* isUnFlat */, pos.dataChunkPos,
                 LogicalTypeUtils::getRowLayoutSize(payload->dataType));
+            if (compactInternalIDs && isSingleTableInternalID(*payload)) {
+                columnSchema.setCompactInternalID(
+                    payload->constCast<PropertyExpression>().getSingleTableID());
+            }
             tableSchema.appendColumn(std::move(columnSchema));
         } else {
             auto columnSchema = ColumnSchema(true /* isUnFlat */, pos.dataChunkPos,
                 (uint32_t)sizeof(overflow_value_t));
+            if (compactInternalIDs && isSingleTableInternalID(*payload)) {
+                columnSchema.setCompactInternalID(
+                    payload->constCast<PropertyExpression>().getSingleTableID());
+            }
             tableSchema.appendColumn(std::move(columnSchema));
         }
         payloadsPos.push_back(pos);
@@ -58,20 +81,78 @@ std::unique_ptr<HashJoinBuildInfo> PlanMapper::createHashBuildInfo(const Schema&
         std::move(payloadsPos), std::move(tableSchema));
 }
 
+static void addJoinKeyFilter(PhysicalOperator* op, JoinKeyFilterInfo filterInfo) {
+    switch (op->getOperatorType()) {
+    case PhysicalOperatorType::SCAN_NODE_TABLE:
+    case PhysicalOperatorType::SCAN_REL_TABLE: {
+        op->ptrCast<ScanTable>()->addJoinKeyFilter(std::move(filterInfo));
+    } break;
+    case PhysicalOperatorType::TABLE_FUNCTION_CALL: {
+        op->ptrCast<TableFunctionCall>()->addJoinKeyFilter(std::move(filterInfo));
+    } break;
+    default:
+        // The filter is only an optimization, so other scans simply do not apply it.
+        break;
+    }
+}
+
+void PlanMapper::collectRuntimeFilteredScans(LogicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::SEMI_MASKER: {
+        for (auto target : op->cast<LogicalSemiMasker>().getTargetOperators()) {
+            runtimeFilteredScans.insert(target);
+        }
+    } break;
+    case LogicalOperatorType::HASH_JOIN: {
+        for (auto target : op->cast<LogicalHashJoin>().getJoinKeyFilterTargets()) {
+            runtimeFilteredScans.insert(target);
+        }
+    } break;
+    default:
+        break;
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        collectRuntimeFilteredScans(op->getChild(i).get());
+    }
+}
+
+bool PlanMapper::hasRuntimeFilters(LogicalOperator* op) const {
+    // Semi maskers are excluded too, since their masks are not populated if the plan is skipped.
+    if (runtimeFilteredScans.contains(op) ||
+        op->getOperatorType() == LogicalOperatorType::SEMI_MASKER) {
+        return true;
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        if (hasRuntimeFilters(op->getChild(i).get())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Identifies the hash table of a build side. The hash join of a re-optimized plan can probe it if
+// it builds the same subgraph with the same layout.
+static std::string getBuildName(const LogicalHashJoin& hashJoin, const expression_vector& keys,
+    const expression_vector& payloads, const FactorizedTableSchema& tableSchema) {
+    auto result = hashJoin.getBuildSubgraphName() + "|";
+    for (auto& key : keys) {
+        result += key->getUniqueName() + ",";
+    }
+    result += "|";
+    for (auto& payload : payloads) {
+        result += payload->getUniqueName() + ",";
+    }
+    result += "|";
+    for (auto i = 0u; i < tableSchema.getNumColumns(); ++i) {
+        result += tableSchema.getColumn(i)->isFlat() ? "f" : "u";
+    }
+    return result;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logicalOperator) {
     auto hashJoin = (LogicalHashJoin*)logicalOperator;
     auto outSchema = hashJoin->getSchema();
     auto buildSchema = hashJoin->getChild(1)->getSchema();
-    std::unique_ptr<PhysicalOperator> probeSidePrevOperator;
-    std::unique_ptr<PhysicalOperator> buildSidePrevOperator;
-    // Map the side into which semi mask is passed first.
-    if (hashJoin->getSIPInfo().dependency == SIPDependency::PROBE_DEPENDS_ON_BUILD) {
-        buildSidePrevOperator = mapOperator(hashJoin->getChild(1).get());
-        probeSidePrevOperator = mapOperator(hashJoin->getChild(0).get());
-    } else {
-        probeSidePrevOperator = mapOperator(hashJoin->getChild(0).get());
-        buildSidePrevOperator = mapOperator(hashJoin->getChild(1).get());
-    }
     expression_vector probeKeys;
     expression_vector buildKeys;
     for (auto& [probeKey, buildKey] : hashJoin->getJoinConditions()) {
@@ -81,16 +162,70 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
     auto buildKeyTypes = ExpressionUtil::getDataTypes(buildKeys);
     auto payloads =
         ExpressionUtil::excludeExpressions(hashJoin->getExpressionsToMaterialize(), probeKeys);
+    auto buildInfo = createHashBuildInfo(*buildSchema, buildKeys, payloads,
+        true /* compactInternalIDs */);
+    // Builds of a part of the query graph check their estimate once finished if the statement can
+    // be re-optimized. Their hash table can then be reused by the next plan of the statement.
+    auto adaptiveState = clientContext->getAdaptiveExecutionState();
+    auto isAdaptive = adaptiveState != nullptr && hashJoin->hasBuildSubgraph() &&
+                      !hasRuntimeFilters(hashJoin->getChild(1).get());
+    std::string buildName;
+    std::shared_ptr<HashJoinSharedState> sharedState;
+    if (isAdaptive) {
+        buildName = getBuildName(*hashJoin, buildKeys, payloads, *buildInfo->getTableSchema());
+        sharedState = adaptiveState->getFinishedHashJoinBuild(buildName);
+    }
+    auto reuseBuild = sharedState != nullptr;
+    std::unique_ptr<PhysicalOperator> probeSidePrevOperator;
+    std::unique_ptr<PhysicalOperator> buildSidePrevOperator;
+    if (reuseBuild) {
+        // The build pipeline has nothing left to do.
+        probeSidePrevOperator = mapOperator(hashJoin->getChild(0).get());
+        buildSidePrevOperator =
+            std::make_unique<EmptyResult>(getOperatorID(), std::make_unique<OPPrintInfo>());
+    } else if (hashJoin->getSIPInfo().dependency == SIPDependency::PROBE_DEPENDS_ON_BUILD) {
+        // Map the side into which semi mask is passed first.
+        buildSidePrevOperator = mapOperator(hashJoin->getChild(1).get());
+        probeSidePrevOperator = mapOperator(hashJoin->getChild(0).get());
+    } else {
+        probeSidePrevOperator = mapOperator(hashJoin->getChild(0).get());
+        buildSidePrevOperator = mapOperator(hashJoin->getChild(1).get());
+    }
     // Create build
-    auto buildInfo = createHashBuildInfo(*buildSchema, buildKeys, payloads);
-    auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
-        LogicalType::copy(buildKeyTypes), buildInfo->getTableSchema()->copy());
-    auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    if (!reuseBuild) {
+        auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
+            LogicalType::copy(buildKeyTypes), buildInfo->getTableSchema()->copy());
+        sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+        if (isAdaptive) {
+            adaptiveState->addHashJoinBuild(buildName, sharedState);
+        }
+    }
+    if (!hashJoin->getJoinKeyFilterTargets().empty()) {
+        KU_ASSERT(probeKeys.size() == 1);
+        auto filter = sharedState->getJoinKeyFilter();
+        if (!reuseBuild) {
+            filter =
+                std::make_shared<JoinKeyFilter>(buildKeys[0]->getDataType().getPhysicalType());
+            sharedState->setJoinKeyFilter(filter);
+        }
+        for (auto target : hashJoin->getJoinKeyFilterTargets()) {
+            auto it = logicalOpToPhysicalOpMap.find(target);
+            if (filter == nullptr || it == logicalOpToPhysicalOpMap.end()) {
+                continue;
+            }
+            auto keyPos = DataPos(target->getSchema()->getExpressionPos(*probeKeys[0]));
+            addJoinKeyFilter(it->second, JoinKeyFilterInfo(filter, keyPos));
+        }
+    }
     auto buildPrintInfo = std::make_unique<HashJoinBuildPrintInfo>(buildKeys, payloads);
     auto hashJoinBuild =
         make_unique<HashJoinBuild>(std::make_unique<ResultSetDescriptor>(buildSchema),
             PhysicalOperatorType::HASH_JOIN_BUILD, sharedState, std::move(buildInfo),
             std::move(buildSidePrevOperator), getOperatorID(), buildPrintInfo->copy());
+    if (isAdaptive && !reuseBuild) {
+        hashJoinBuild->setEstimate(HashJoinBuildEstimate{hashJoin->getBuildSubgraphName(),
+            hashJoin->getBuildCardinality()});
+    }
     // Create probe
     std::vector<DataPos> probeKeysDataPos;
     for (auto& probeKey : probeKeys) {
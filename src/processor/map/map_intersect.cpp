@@ -27,7 +27,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapIntersect(LogicalOperator* logi
         auto buildPrevOperator = mapOperator(logicalIntersect->getChild(i).get());
         auto payloadExpressions =
             binder::ExpressionUtil::excludeExpressions(buildSchema->getExpressionsInScope(), keys);
-        auto buildInfo = createHashBuildInfo(*buildSchema, keys, payloadExpressions);
+        auto buildInfo = createHashBuildInfo(*buildSchema, keys, payloadExpressions,
+            false /* compactInternalIDs */);
         auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
             ExpressionUtil::getDataTypes(keys), buildInfo->getTableSchema()->copy());
         auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
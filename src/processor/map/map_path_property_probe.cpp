@@ -59,7 +59,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapPathPropertyProbe(
         auto nodeKeyTypes = ExpressionUtil::getDataTypes(nodeKeys);
         auto nodePayloads =
             ExpressionUtil::excludeExpressions(nodeBuildSchema->getExpressionsInScope(), nodeKeys);
-        auto nodeBuildInfo = createHashBuildInfo(*nodeBuildSchema, nodeKeys, nodePayloads);
+        auto nodeBuildInfo = createHashBuildInfo(*nodeBuildSchema, nodeKeys, nodePayloads,
+            false /* compactInternalIDs */);
         auto nodeHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
             std::move(nodeKeyTypes), nodeBuildInfo->getTableSchema()->copy());
         nodeBuildSharedState = std::make_shared<HashJoinSharedState>(std::move(nodeHashTable));
@@ -85,7 +86,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapPathPropertyProbe(
         auto relKeyTypes = ExpressionUtil::getDataTypes(relKeys);
         auto relPayloads =
             ExpressionUtil::excludeExpressions(relBuildSchema->getExpressionsInScope(), relKeys);
-        auto relBuildInfo = createHashBuildInfo(*relBuildSchema, relKeys, relPayloads);
+        auto relBuildInfo = createHashBuildInfo(*relBuildSchema, relKeys, relPayloads,
+            false /* compactInternalIDs */);
         auto relHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
             std::move(relKeyTypes), relBuildInfo->getTableSchema()->copy());
         relBuildSharedState = std::make_shared<HashJoinSharedState>(std::move(relHashTable));
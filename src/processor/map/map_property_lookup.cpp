@@ -0,0 +1,55 @@
+#include "binder/expression/property_expression.h"
+#include "planner/operator/scan/logical_property_lookup.h"
+#include "processor/operator/scan/property_lookup.h"
+#include "processor/plan_mapper.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapPropertyLookup(LogicalOperator* logicalOperator) {
+    auto catalog = clientContext->getCatalog();
+    auto storageManager = clientContext->getStorageManager();
+    auto transaction = clientContext->getTx();
+    auto& lookup = logicalOperator->constCast<LogicalPropertyLookup>();
+    const auto outSchema = lookup.getSchema();
+    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
+    auto nodeIDPos = getDataPos(*lookup.getNodeID(), *outSchema);
+    std::vector<DataPos> outVectorsPos;
+    for (auto& expression : lookup.getProperties()) {
+        outVectorsPos.emplace_back(getDataPos(*expression, *outSchema));
+    }
+    table_id_map_t<PropertyLookupTableInfo> tableIDToInfo;
+    std::vector<std::string> tableNames;
+    for (auto& tableID : lookup.getTableIDs()) {
+        auto tableEntry = catalog->getTableCatalogEntry(transaction, tableID);
+        std::vector<column_id_t> columnIDs;
+        std::vector<idx_t> outVectorIdxs;
+        auto properties = lookup.getProperties();
+        for (auto i = 0u; i < properties.size(); ++i) {
+            auto columnID = properties[i]->constCast<PropertyExpression>().getColumnID(*tableEntry);
+            if (columnID == INVALID_COLUMN_ID) {
+                continue;
+            }
+            columnIDs.push_back(columnID);
+            outVectorIdxs.push_back(i);
+        }
+        auto table = storageManager->getTable(tableID)->ptrCast<storage::NodeTable>();
+        tableIDToInfo.insert({tableID,
+            PropertyLookupTableInfo(ScanNodeTableInfo(table, std::move(columnIDs), {}),
+                std::move(outVectorIdxs))});
+        tableNames.push_back(table->getTableName());
+    }
+    auto alias = lookup.getNodeID()->constCast<PropertyExpression>().getRawVariableName();
+    auto printInfo =
+        std::make_unique<ScanNodeTablePrintInfo>(tableNames, alias, lookup.getProperties());
+    return std::make_unique<PropertyLookup>(ScanTableInfo(nodeIDPos, std::move(outVectorsPos)),
+        std::move(tableIDToInfo), std::move(prevOperator), getOperatorID(), std::move(printInfo));
+}
+
+} // namespace processor
+} // namespace kuzu
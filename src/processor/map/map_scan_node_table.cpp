@@ -2,6 +2,7 @@
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "processor/operator/scan/offset_scan_node_table.h"
 #include "processor/operator/scan/primary_key_scan_node_table.h"
+#include "processor/operator/scan/property_index_scan_node_table.h"
 #include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
 #include "storage/storage_manager.h"
@@ -74,6 +75,22 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(LogicalOperator*
         return std::make_unique<PrimaryKeyScanNodeTable>(std::move(scanInfo), std::move(tableInfos),
             std::move(evaluator), std::move(sharedState), getOperatorID(), std::move(printInfo));
     }
+    case LogicalScanNodeTableType::PROPERTY_INDEX_SCAN: {
+        KU_ASSERT(tableInfos.size() == 1);
+        auto& propertyIndexScanInfo = scan.getExtraInfo()->constCast<PropertyIndexScanInfo>();
+        auto tableEntry = catalog->getTableCatalogEntry(transaction, tableIDs[0]);
+        auto indexedColumnID =
+            propertyIndexScanInfo.property->constCast<PropertyExpression>().getColumnID(
+                *tableEntry);
+        auto exprMapper = ExpressionMapper(outSchema);
+        auto evaluator = exprMapper.getEvaluator(propertyIndexScanInfo.key);
+        auto printInfo = std::make_unique<PropertyIndexScanPrintInfo>(scan.getProperties(),
+            propertyIndexScanInfo.property->toString(), propertyIndexScanInfo.key->toString(),
+            alias);
+        return std::make_unique<PropertyIndexScanNodeTable>(std::move(scanInfo),
+            std::move(tableInfos[0]), indexedColumnID, std::move(evaluator), getOperatorID(),
+            std::move(printInfo));
+    }
     default:
         KU_UNREACHABLE;
     }
@@ -0,0 +1,38 @@
+#include "planner/operator/scan/logical_shared_subplan_scan.h"
+#include "processor/plan_mapper.h"
+
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapSharedSubplanScan(
+    LogicalOperator* logicalOperator) {
+    auto& scan = logicalOperator->constCast<LogicalSharedSubplanScan>();
+    auto subplan = scan.getSubplan().get();
+    // The subplan is mapped by its first scan only. All scans read the same payloads. The result
+    // collector is not a child of any scan, see appendSharedSubplans.
+    if (!sharedSubplanTables.contains(subplan)) {
+        auto prevOperator = mapOperator(subplan);
+        auto resultCollector = createResultCollector(AccumulateType::REGULAR, scan.getPayloads(),
+            subplan->getSchema(), std::move(prevOperator));
+        sharedSubplanTables.insert({subplan, resultCollector->getResultFactorizedTable()});
+        sharedSubplanCollectors.push_back(std::move(resultCollector));
+    }
+    auto table = sharedSubplanTables.at(subplan);
+    auto maxMorselSize = table->hasUnflatCol() ? 1 : DEFAULT_VECTOR_CAPACITY;
+    return createFTableScanAligned(scan.getExpressions(), scan.getSchema(), table, maxMorselSize);
+}
+
+// Sinks schedule their right most children first. A subplan mapped while mapping another one is
+// collected first, so it is appended last.
+void PlanMapper::appendSharedSubplans(PhysicalOperator* resultCollector) {
+    for (auto it = sharedSubplanCollectors.rbegin(); it != sharedSubplanCollectors.rend(); ++it) {
+        resultCollector->addChild(std::move(*it));
+    }
+    sharedSubplanCollectors.clear();
+}
+
+} // namespace processor
+} // namespace kuzu
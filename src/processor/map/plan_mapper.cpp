@@ -1,5 +1,6 @@
 #include "processor/plan_mapper.h"
 
+#include "main/client_context.h"
 #include "processor/operator/profile.h"
 
 using namespace kuzu::common;
@@ -17,9 +18,13 @@ static void setPhysicalPlanIfProfile(const LogicalPlan* logicalPlan, PhysicalPla
 
 std::unique_ptr<PhysicalPlan> PlanMapper::mapLogicalPlanToPhysical(const LogicalPlan* logicalPlan,
     const binder::expression_vector& expressionsToCollect) {
+    if (clientContext->getAdaptiveExecutionState() != nullptr) {
+        collectRuntimeFilteredScans(logicalPlan->getLastOperator().get());
+    }
     auto lastOperator = mapOperator(logicalPlan->getLastOperator().get());
     lastOperator = createResultCollector(AccumulateType::REGULAR, expressionsToCollect,
         logicalPlan->getSchema(), std::move(lastOperator));
+    appendSharedSubplans(lastOperator.get());
     auto physicalPlan = make_unique<PhysicalPlan>(std::move(lastOperator));
     setPhysicalPlanIfProfile(logicalPlan, physicalPlan.get());
     return physicalPlan;
@@ -142,6 +147,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(LogicalOperator* logic
     case LogicalOperatorType::PROJECTION: {
         physicalOperator = mapProjection(logicalOperator);
     } break;
+    case LogicalOperatorType::PROPERTY_LOOKUP: {
+        physicalOperator = mapPropertyLookup(logicalOperator);
+    } break;
     case LogicalOperatorType::RECURSIVE_EXTEND: {
         physicalOperator = mapRecursiveExtend(logicalOperator);
     } break;
@@ -154,6 +162,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(LogicalOperator* logic
     case LogicalOperatorType::SET_PROPERTY: {
         physicalOperator = mapSetProperty(logicalOperator);
     } break;
+    case LogicalOperatorType::SHARED_SUBPLAN_SCAN: {
+        physicalOperator = mapSharedSubplanScan(logicalOperator);
+    } break;
     case LogicalOperatorType::STANDALONE_CALL: {
         physicalOperator = mapStandaloneCall(logicalOperator);
     } break;
@@ -1,6 +1,8 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
 #include "binder/expression/expression_util.h"
+#include "main/client_context.h"
+#include "main/settings.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -36,8 +38,15 @@ void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     if (keyState == nullptr) {
         setKeyState(keyVectors[0]->state.get());
     }
-    for (auto& pos : info->payloadsPos) {
-        payloadVectors.push_back(resultSet->getValueVector(pos).get());
+    for (auto i = 0u; i < info->payloadsPos.size(); ++i) {
+        auto vector = resultSet->getValueVector(info->payloadsPos[i]).get();
+        payloadVectors.push_back(vector);
+        auto state = vector->state.get();
+        if (estimate && !info->tableSchema.getColumn(info->keysPos.size() + i)->isFlat() &&
+            std::find(unFlatPayloadStates.begin(), unFlatPayloadStates.end(), state) ==
+                unFlatPayloadStates.end()) {
+            unFlatPayloadStates.push_back(state);
+        }
     }
     hashTable = std::make_unique<JoinHashTable>(*context->clientContext->getMemoryManager(),
         std::move(keyTypes), info->tableSchema.copy());
@@ -51,13 +60,56 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
     }
 }
 
+void HashJoinBuildSlotsTask::run() {
+    auto hashTable = sharedState->getHashTable();
+    auto numTupleBlocks = hashTable->getNumTupleBlocks();
+    // A single block can only be claimed by one thread.
+    auto concurrent = numTupleBlocks > 1 && maxNumThreads > 1;
+    while (true) {
+        auto blockIdx = nextTupleBlockIdx.fetch_add(1, std::memory_order_relaxed);
+        if (blockIdx >= numTupleBlocks) {
+            break;
+        }
+        hashTable->buildHashSlots(blockIdx, concurrent);
+    }
+}
+
+void HashJoinBuildSlotsTask::finalizeIfNecessary() {
+    if (auto joinKeyFilter = sharedState->getJoinKeyFilter()) {
+        joinKeyFilter->build(*sharedState->getHashTable());
+    }
+    sharedState->setBuilt();
+    if (adaptiveState != nullptr && estimate) {
+        adaptiveState->observeCardinality(estimate->subgraphName, estimate->cardinality,
+            sharedState->getNumFlatTuples());
+    }
+}
+
 void HashJoinBuild::finalizeInternal(ExecutionContext* /*context*/) {
+    if (sharedState->isBuilt()) {
+        return;
+    }
+    // Slots are filled by the HashJoinBuildSlotsTask scheduled after this pipeline.
     auto numTuples = sharedState->getHashTable()->getNumTuples();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
-    sharedState->getHashTable()->buildHashSlots();
+}
+
+std::unique_ptr<Task> HashJoinBuild::createFinalizeTask(ExecutionContext* context) {
+    if (sharedState->isBuilt()) {
+        return nullptr;
+    }
+    auto maxNumThreads =
+        context->clientContext->getCurrentSetting(main::ThreadsSetting::name).getValue<uint64_t>();
+    return std::make_unique<HashJoinBuildSlotsTask>(maxNumThreads, sharedState,
+        context->clientContext->getAdaptiveExecutionState(), estimate);
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
+    if (sharedState->isBuilt()) {
+        // The hash table is reused from an earlier plan of the statement.
+        return;
+    }
+    uint64_t numFlatTuples = 0;
     // Append thread-local tuples
     while (children[0]->getNextTuple(context)) {
         uint64_t numAppended = 0u;
@@ -65,9 +117,17 @@ void HashJoinBuild::executeInternal(ExecutionContext* context) {
             numAppended += appendVectors();
         }
         metrics->numOutputTuple.increase(numAppended);
+        if (estimate) {
+            auto numFlatAppended = numAppended;
+            for (auto state : unFlatPayloadStates) {
+                numFlatAppended *= state->getSelVector().getSelSize();
+            }
+            numFlatTuples += numFlatAppended;
+        }
     }
     // Merge with global hash table once local tuples are all appended.
     sharedState->mergeLocalHashTable(*hashTable);
+    sharedState->addNumFlatTuples(numFlatTuples);
 }
 
 } // namespace processor
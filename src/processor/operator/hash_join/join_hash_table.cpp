@@ -1,5 +1,9 @@
 #include "processor/operator/hash_join/join_hash_table.h"
 
+#include <array>
+#include <atomic>
+
+#include "common/type_utils.h"
 #include "common/utils.h"
 #include "function/hash/vector_hash_functions.h"
 
@@ -10,6 +14,14 @@ using namespace kuzu::function;
 namespace kuzu {
 namespace processor {
 
+static inline void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
 JoinHashTable::JoinHashTable(MemoryManager& memoryManager, logical_type_vec_t keyTypes,
     FactorizedTableSchema tableSchema)
     : BaseHashTable{memoryManager, std::move(keyTypes)} {
@@ -104,25 +116,47 @@ uint64_t JoinHashTable::appendVectorWithSorting(ValueVector* keyVector,
     return numTuplesToAppend;
 }
 
+bool JoinHashTable::canUseSlotTags() const {
+#if KUZU_HASH_SLOT_TAGS
+    for (auto& block : factorizedTable->getTupleDataBlocks()) {
+        // Tuples end where the free space of the block starts.
+        if ((reinterpret_cast<uintptr_t>(block->getWritableData()) & ~SLOT_POINTER_MASK) != 0) {
+            return false;
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
 void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
+    useSlotTags = canUseSlotTags();
     setMaxNumHashSlots(nextPowerOfTwo(numTuples * 2));
     auto numSlotsPerBlock = (uint64_t)1 << numSlotsPerBlockLog2;
     auto numBlocksNeeded = (maxNumHashSlots + numSlotsPerBlock - 1) / numSlotsPerBlock;
     while (hashSlotsBlocks.size() < numBlocksNeeded) {
         hashSlotsBlocks.emplace_back(std::make_unique<DataBlock>(&memoryManager, HASH_BLOCK_SIZE));
+        slotBlocksData.push_back(reinterpret_cast<uint8_t**>(hashSlotsBlocks.back()->getData()));
     }
 }
 
 void JoinHashTable::buildHashSlots() {
-    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
-        uint8_t* tuple = tupleBlock->getData();
-        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
-            auto lastSlotEntryInHT = insertEntry(tuple);
-            auto prevPtr = getPrevTuple(tuple);
-            memcpy(reinterpret_cast<void*>(prevPtr), reinterpret_cast<void*>(&lastSlotEntryInHT),
-                sizeof(uint8_t*));
-            tuple += factorizedTable->getTableSchema()->getNumBytesPerTuple();
-        }
+    for (auto blockIdx = 0u; blockIdx < getNumTupleBlocks(); blockIdx++) {
+        buildHashSlots(blockIdx, false /* concurrent */);
+    }
+}
+
+void JoinHashTable::buildHashSlots(uint64_t tupleBlockIdx, bool concurrent) {
+    auto& tupleBlock = factorizedTable->getTupleDataBlocks()[tupleBlockIdx];
+    auto numBytesPerTuple = factorizedTable->getTableSchema()->getNumBytesPerTuple();
+    uint8_t* tuple = tupleBlock->getData();
+    for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+        auto lastSlotEntryInHT = concurrent ? insertEntry<true>(tuple) : insertEntry<false>(tuple);
+        auto prevPtr = getPrevTuple(tuple);
+        memcpy(reinterpret_cast<void*>(prevPtr), reinterpret_cast<void*>(&lastSlotEntryInHT),
+            sizeof(uint8_t*));
+        tuple += numBytesPerTuple;
     }
 }
 
@@ -145,9 +179,22 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
         function::VectorHashFunction::combineHash(hashVector, hashSelVec, tmpHashResultVector,
             hashSelVec, hashVector, hashSelVec);
     }
-    for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
-        KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
-        probedTuples[i] = getTupleForHash(hashVector.getValue<hash_t>(hashSelVec[i]));
+    auto numKeys = hashSelVec.getSelSize();
+    KU_ASSERT(numKeys <= DEFAULT_VECTOR_CAPACITY);
+    auto hashes = (hash_t*)hashVector.getData();
+    // Slots are prefetched a fixed distance ahead of the key being looked up, so that several cache
+    // misses are in flight at any time without evicting slots before they are read.
+    for (auto i = 0u; i < std::min<sel_t>(numKeys, PROBE_PREFETCH_DISTANCE); i++) {
+        prefetch(getSlotForHash(hashes[hashSelVec[i]]));
+    }
+    for (auto i = 0u; i < numKeys; i++) {
+        if (i + PROBE_PREFETCH_DISTANCE < numKeys) {
+            prefetch(getSlotForHash(hashes[hashSelVec[i + PROBE_PREFETCH_DISTANCE]]));
+        }
+        auto hash = hashes[hashSelVec[i]];
+        probedTuples[i] = getTupleFromSlot(*getSlotForHash(hash), hash);
+        // Prefetching nullptr is harmless and cheaper than a mispredicted branch.
+        prefetch(probedTuples[i]);
     }
 }
 
@@ -168,36 +215,104 @@ sel_t JoinHashTable::matchFlatKeys(const std::vector<ValueVector*>& keyVectors,
 
 sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTuples,
     uint8_t** matchedTuples, SelectionVector& matchedTuplesSelVector) {
-    auto numMatchedTuples = 0;
-    for (auto i = 0u; i < keyVector->state->getSelVector().getSelSize(); ++i) {
-        auto pos = keyVector->state->getSelVector()[i];
-        while (probedTuples[i]) {
+    sel_t numMatchedTuples = 0;
+    TypeUtils::visit(
+        keyVector->dataType.getPhysicalType(),
+        [&]<typename T>(T)
+            requires(std::integral<T> || std::is_same_v<T, internalID_t>)
+        {
+            // Keys are the first column of the table, so they can be compared inline.
+            auto keys = (T*)keyVector->getData();
+            numMatchedTuples = matchUnFlatKey(keyVector, probedTuples, matchedTuples,
+                matchedTuplesSelVector,
+                [keys](sel_t pos, const uint8_t* tuple) { return *(T*)tuple == keys[pos]; });
+        },
+        [&](auto) {
+            numMatchedTuples = matchUnFlatKey(keyVector, probedTuples, matchedTuples,
+                matchedTuplesSelVector, [&](sel_t pos, const uint8_t* tuple) {
+                    return compareEntryFuncs[0](keyVector, pos, tuple);
+                });
+        });
+    return numMatchedTuples;
+}
+
+template<typename FUNC>
+sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTuples,
+    uint8_t** matchedTuples, SelectionVector& matchedTuplesSelVector, FUNC compareEntry) {
+    auto& selVector = keyVector->state->getSelVector();
+    auto numKeys = selVector.getSelSize();
+    std::array<sel_t, DEFAULT_VECTOR_CAPACITY> activeKeyIdxes{};
+    auto numActiveKeys = 0u;
+    for (auto i = 0u; i < numKeys; ++i) {
+        matchedTuples[i] = nullptr;
+        activeKeyIdxes[numActiveKeys] = i;
+        numActiveKeys += probedTuples[i] != nullptr;
+    }
+    while (numActiveKeys > 0) {
+        auto numStillActiveKeys = 0u;
+        for (auto j = 0u; j < numActiveKeys; ++j) {
+            auto i = activeKeyIdxes[j];
             auto currentTuple = probedTuples[i];
-            auto entryCompareResult = compareEntryFuncs[0](keyVector, pos, currentTuple);
-            if (entryCompareResult) {
-                matchedTuples[numMatchedTuples] = currentTuple;
-                matchedTuplesSelVector[numMatchedTuples] = pos;
-                numMatchedTuples++;
-                break;
+            if (compareEntry(selVector[i], currentTuple)) {
+                matchedTuples[i] = currentTuple;
+                continue;
             }
             probedTuples[i] = *getPrevTuple(currentTuple);
+            prefetch(probedTuples[i]);
+            activeKeyIdxes[numStillActiveKeys] = i;
+            numStillActiveKeys += probedTuples[i] != nullptr;
         }
+        numActiveKeys = numStillActiveKeys;
+    }
+    // Matches are compacted in key order, which is the order of the selected positions.
+    sel_t numMatchedTuples = 0;
+    for (auto i = 0u; i < numKeys; ++i) {
+        matchedTuples[numMatchedTuples] = matchedTuples[i];
+        matchedTuplesSelVector[numMatchedTuples] = selVector[i];
+        numMatchedTuples += matchedTuples[i] != nullptr;
     }
     return numMatchedTuples;
 }
 
 uint8_t** JoinHashTable::findHashSlot(const uint8_t* tuple) const {
-    auto hash = *(hash_t*)(tuple + getHashValueColOffset());
-    auto slotIdx = getSlotIdxForHash(hash);
-    return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
-                       (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
+    return getSlotForHash(*(hash_t*)(tuple + getHashValueColOffset()));
+}
+
+uint64_t JoinHashTable::getSlotValueToInsert(const uint8_t* tuple, uint64_t slotValue) const {
+    auto newSlotValue = reinterpret_cast<uintptr_t>(tuple);
+    if (useSlotTags) {
+        KU_ASSERT((newSlotValue & ~SLOT_POINTER_MASK) == 0);
+        auto hash = *(hash_t*)(tuple + getHashValueColOffset());
+        newSlotValue |= (slotValue & ~SLOT_POINTER_MASK) | getSlotTag(hash);
+    }
+    return newSlotValue;
 }
 
+template<bool CONCURRENT>
 uint8_t* JoinHashTable::insertEntry(uint8_t* tuple) const {
+    static_assert(sizeof(std::atomic<uint8_t*>) == sizeof(uint8_t*) &&
+                  std::atomic<uint8_t*>::is_always_lock_free);
     auto slot = findHashSlot(tuple);
-    auto prevPtr = *slot;
-    *slot = tuple;
-    return prevPtr;
+    uintptr_t slotValue = 0;
+    if constexpr (CONCURRENT) {
+        // Other threads may insert into the same slot. The order of tuples within a chain does
+        // not matter, so whichever thread wins the exchange links to the previous head.
+        auto atomicSlot = reinterpret_cast<std::atomic<uint8_t*>*>(slot);
+        auto expected = atomicSlot->load(std::memory_order_relaxed);
+        while (!atomicSlot->compare_exchange_weak(expected,
+            reinterpret_cast<uint8_t*>(
+                getSlotValueToInsert(tuple, reinterpret_cast<uintptr_t>(expected))),
+            std::memory_order_relaxed)) {}
+        slotValue = reinterpret_cast<uintptr_t>(expected);
+    } else {
+        slotValue = reinterpret_cast<uintptr_t>(*slot);
+        *slot = reinterpret_cast<uint8_t*>(getSlotValueToInsert(tuple, slotValue));
+    }
+    if (useSlotTags) {
+        // Prev pointers inside tuples are never tagged.
+        slotValue &= SLOT_POINTER_MASK;
+    }
+    return reinterpret_cast<uint8_t*>(slotValue);
 }
 
 void JoinHashTable::computeVectorHashes(std::vector<common::ValueVector*> keyVectors) {
@@ -0,0 +1,157 @@
+#include "processor/operator/hash_join/join_key_filter.h"
+
+#include "common/type_utils.h"
+#include "common/utils.h"
+#include "function/hash/vector_hash_functions.h"
+#include "processor/operator/hash_join/join_hash_table.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace processor {
+
+template<typename T>
+concept RangeKeyType = std::integral<T> && !std::is_same_v<T, bool>;
+
+// Keeps the selected positions for which pred returns true.
+template<typename PRED>
+static void compactSelVector(SelectionVector& selVector, PRED pred) {
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+        auto pos = selVector[i];
+        buffer[numSelected] = pos;
+        numSelected += pred(pos);
+    }
+    selVector.setToFiltered(numSelected);
+}
+
+bool JoinKeyFilter::isSupportedKeyType(const LogicalType& type) {
+    switch (type.getPhysicalType()) {
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::INTERVAL:
+    case PhysicalTypeID::STRING:
+        return true;
+    default:
+        // Joins on node IDs are already covered by semi masks.
+        return false;
+    }
+}
+
+void JoinKeyFilter::build(JoinHashTable& hashTable) {
+    auto numKeys = hashTable.getNumTuples();
+    if (numKeys > MAX_NUM_KEYS) {
+        // Stays disabled.
+        return;
+    }
+    auto numBlocks = nextPowerOfTwo(std::max<uint64_t>(numKeys * NUM_BITS_PER_KEY / 64, 1));
+    blocks.assign(numBlocks, 0);
+    blockMask = numBlocks - 1;
+    auto table = hashTable.getFactorizedTable();
+    auto schema = table->getTableSchema();
+    auto hashColOffset = hashTable.getHashValueColOffset();
+    auto nullMapOffset = schema->getNullMapOffset();
+    for (auto& block : table->getTupleDataBlocks()) {
+        auto tuple = block->getData();
+        for (auto i = 0u; i < block->numTuples; ++i) {
+            if (!table->isNonOverflowColNull(tuple + nullMapOffset, 0 /* colIdx */)) {
+                insertHash(*(hash_t*)(tuple + hashColOffset));
+            }
+            tuple += schema->getNumBytesPerTuple();
+        }
+    }
+    TypeUtils::visit(
+        keyType, [&]<RangeKeyType T>(T) { buildRange<T>(hashTable); }, [](auto) {});
+    enabled.store(true, std::memory_order_release);
+}
+
+template<typename T>
+void JoinKeyFilter::buildRange(JoinHashTable& hashTable) {
+    auto table = hashTable.getFactorizedTable();
+    auto schema = table->getTableSchema();
+    auto keyColOffset = schema->getColOffset(0 /* colIdx */);
+    auto nullMapOffset = schema->getNullMapOffset();
+    auto min = std::numeric_limits<T>::max();
+    auto max = std::numeric_limits<T>::min();
+    auto hasKey = false;
+    for (auto& block : table->getTupleDataBlocks()) {
+        auto tuple = block->getData();
+        for (auto i = 0u; i < block->numTuples; ++i) {
+            if (!table->isNonOverflowColNull(tuple + nullMapOffset, 0 /* colIdx */)) {
+                auto key = *(T*)(tuple + keyColOffset);
+                min = std::min(min, key);
+                max = std::max(max, key);
+                hasKey = true;
+            }
+            tuple += schema->getNumBytesPerTuple();
+        }
+    }
+    if (!hasKey) {
+        // The bloom filter is empty and drops every key anyway.
+        return;
+    }
+    minKey = static_cast<int64_t>(min);
+    maxKey = static_cast<int64_t>(max);
+    hasRange = true;
+}
+
+void JoinKeyFilter::filter(ValueVector& keyVector, ValueVector& hashVector) const {
+    KU_ASSERT(keyVector.dataType.getPhysicalType() == keyType);
+    auto& selVector = keyVector.state->getSelVectorUnsafe();
+    if (hasRange) {
+        TypeUtils::visit(
+            keyType,
+            [&]<RangeKeyType T>(T) {
+                auto keys = (T*)keyVector.getData();
+                compactSelVector(selVector,
+                    [&](sel_t pos) { return !keyVector.isNull(pos) && isInRange(keys[pos]); });
+            },
+            [](auto) { KU_UNREACHABLE; });
+        if (selVector.getSelSize() == 0) {
+            return;
+        }
+    }
+    VectorHashFunction::computeHash(keyVector, selVector, hashVector, selVector);
+    auto hashes = (hash_t*)hashVector.getData();
+    compactSelVector(selVector,
+        [&](sel_t pos) { return !keyVector.isNull(pos) && mayContainHash(hashes[pos]); });
+}
+
+void JoinKeyFilterApplier::init(const std::vector<JoinKeyFilterInfo>& infos,
+    const ResultSet& resultSet) {
+    for (auto& info : infos) {
+        filters.emplace_back(info.filter.get(), resultSet.getValueVector(info.keyPos).get());
+    }
+    if (!filters.empty()) {
+        hashVector = std::make_unique<ValueVector>(LogicalType::HASH());
+    }
+}
+
+bool JoinKeyFilterApplier::apply() {
+    for (auto& [filter, keyVector] : filters) {
+        // Filters of join builds that have not finished yet are skipped, and so are flat keys,
+        // whose selection vector is not owned by the scan.
+        if (!filter->isEnabled() || keyVector->state->isFlat()) {
+            continue;
+        }
+        filter->filter(*keyVector, *hashVector);
+        if (keyVector->state->getSelVector().getSelSize() == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -62,75 +62,46 @@ void BlockPtrInfo::updateTuplePtrIfNecessary() {
     }
 }
 
-uint64_t KeyBlockMergeTask::findRightKeyBlockIdx(uint8_t* leftEndTuplePtr) const {
-    // Find a tuple in the right memory block such that:
-    // 1. The value of the current tuple is smaller than the value in leftEndTuple.
-    // 2. Either the value of next tuple is larger than the value in leftEndTuple or
-    // the current tuple is the last tuple in the right memory block.
-    int64_t startIdx = rightKeyBlockNextIdx;
-    int64_t endIdx = rightKeyBlock->getNumTuples() - 1;
-
-    while (startIdx <= endIdx) {
-        uint64_t curTupleIdx = (startIdx + endIdx) / 2;
-        uint8_t* curTuplePtr = rightKeyBlock->getTuple(curTupleIdx);
-
-        if (keyBlockMerger.compareTuplePtr(leftEndTuplePtr, curTuplePtr)) {
-            if (curTupleIdx == rightKeyBlock->getNumTuples() - 1 ||
-                !keyBlockMerger.compareTuplePtr(leftEndTuplePtr,
-                    rightKeyBlock->getTuple(curTupleIdx + 1))) {
-                // If the current tuple is the last tuple or the value of next tuple is larger than
-                // the value of leftEndTuple, return the curTupleIdx.
-                return curTupleIdx;
-            } else {
-                startIdx = curTupleIdx + 1;
-            }
+uint64_t KeyBlockMergeTask::findMergePathSplit(uint64_t numOutputTuples) const {
+    // Returns the number of left tuples among the first numOutputTuples tuples of the merged
+    // result, i.e. where the merge path crosses the diagonal of length numOutputTuples. Merging
+    // takes the left tuple on ties, so the split is the smallest leftIdx for which
+    // left[leftIdx] sorts after right[numOutputTuples - leftIdx - 1]. The predicate is monotonic in
+    // leftIdx, and the split never moves backwards along the path, so the search is restricted to
+    // tuples that have not been handed out yet.
+    auto startIdx = std::max(leftKeyBlockNextIdx,
+        numOutputTuples - std::min(numOutputTuples, rightKeyBlock->getNumTuples()));
+    auto endIdx =
+        std::min(leftKeyBlock->getNumTuples(), numOutputTuples - rightKeyBlockNextIdx);
+    while (startIdx < endIdx) {
+        auto leftIdx = (startIdx + endIdx) / 2;
+        auto rightIdx = numOutputTuples - leftIdx - 1;
+        if (keyBlockMerger.compareTuplePtr(leftKeyBlock->getTuple(leftIdx),
+                rightKeyBlock->getTuple(rightIdx))) {
+            endIdx = leftIdx;
         } else {
-            endIdx = curTupleIdx - 1;
+            startIdx = leftIdx + 1;
         }
     }
-    // If such tuple doesn't exist, return -1.
-    return -1;
+    return startIdx;
 }
 
 std::unique_ptr<KeyBlockMergeMorsel> KeyBlockMergeTask::getMorsel() {
-    // We grab a batch of tuples from the left memory block, then do a binary search on the
-    // right memory block to find the range of tuples to merge.
+    // Morsels are cut along the merge path, so that each of them writes the next batch_size tuples
+    // of the result, no matter how the left and right tuples interleave. This keeps the morsels of
+    // a merge balanced, so the last merges, which cover most of the tuples, are spread over all
+    // threads instead of being bound by a few morsels that happen to cover long runs of one side.
     activeMorsels++;
-    if (rightKeyBlockNextIdx >= rightKeyBlock->getNumTuples()) {
-        // If there is no more tuples left in the right key block,
-        // just append all tuples in the left key block to the result key block.
-        auto keyBlockMergeMorsel =
-            std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples(),
-                rightKeyBlock->getNumTuples(), rightKeyBlock->getNumTuples());
-        leftKeyBlockNextIdx = leftKeyBlock->getNumTuples();
-        return keyBlockMergeMorsel;
-    }
-
-    auto leftKeyBlockStartIdx = leftKeyBlockNextIdx;
-    leftKeyBlockNextIdx += batch_size;
-
-    if (leftKeyBlockNextIdx >= leftKeyBlock->getNumTuples()) {
-        // This is the last batch of tuples in the left key block to merge, so just merge it with
-        // remaining tuples of the right key block.
-        auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockStartIdx,
-            std::min(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples()), rightKeyBlockNextIdx,
-            rightKeyBlock->getNumTuples());
-        rightKeyBlockNextIdx = rightKeyBlock->getNumTuples();
-        return keyBlockMergeMorsel;
-    } else {
-        // Conduct a binary search to find the ending index in the right memory block.
-        auto leftEndIdxPtr = leftKeyBlock->getTuple(leftKeyBlockNextIdx - 1);
-        auto rightEndIdx = findRightKeyBlockIdx(leftEndIdxPtr);
-
-        auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockStartIdx,
-            std::min(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples()), rightKeyBlockNextIdx,
-            rightEndIdx == (uint64_t)-1 ? rightKeyBlockNextIdx : ++rightEndIdx);
-
-        if (rightEndIdx != (uint64_t)-1) {
-            rightKeyBlockNextIdx = rightEndIdx;
-        }
-        return keyBlockMergeMorsel;
-    }
+    auto numOutputTuples =
+        std::min(leftKeyBlockNextIdx + rightKeyBlockNextIdx + batch_size,
+            leftKeyBlock->getNumTuples() + rightKeyBlock->getNumTuples());
+    auto leftEndIdx = findMergePathSplit(numOutputTuples);
+    auto rightEndIdx = numOutputTuples - leftEndIdx;
+    auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockNextIdx,
+        leftEndIdx, rightKeyBlockNextIdx, rightEndIdx);
+    leftKeyBlockNextIdx = leftEndIdx;
+    rightKeyBlockNextIdx = rightEndIdx;
+    return keyBlockMergeMorsel;
 }
 
 void KeyBlockMerger::mergeKeyBlocks(KeyBlockMergeMorsel& keyBlockMergeMorsel) const {
@@ -77,11 +77,11 @@ void TopKBuffer::append(const std::vector<common::ValueVector*>& keyVectors,
     keyVectors[0]->state->setSelVector(originalSelState);
 }
 
-void TopKBuffer::reduce() {
+bool TopKBuffer::reduce() {
     auto reduceThreshold = std::max(OrderByConstants::MIN_SIZE_TO_REDUCE,
         OrderByConstants::MIN_LIMIT_RATIO_TO_REDUCE * (limit + skip));
     if (sortState->getNumTuples() < reduceThreshold) {
-        return;
+        return false;
     }
     sortState->finalize();
     auto newSortState = std::make_unique<TopKSortState>();
@@ -98,6 +98,7 @@ void TopKBuffer::reduce() {
         std::swap(keyVecsToScan, lastKeyVecsToScan);
     }
     sortState = std::move(newSortState);
+    return true;
 }
 
 void TopKBuffer::merge(TopKBuffer* other) {
@@ -112,6 +113,32 @@ void TopKBuffer::merge(TopKBuffer* other) {
     reduce();
 }
 
+bool TopKBuffer::hasTighterBoundaryValue(TopKBuffer& other) {
+    if (!hasBoundaryValue) {
+        return false;
+    }
+    if (!other.hasBoundaryValue) {
+        return true;
+    }
+    std::vector<ValueVector*> keyVectors;
+    for (auto& boundaryVec : boundaryVecs) {
+        keyVectors.push_back(boundaryVec.get());
+    }
+    return other.compareFlatKeys(0 /* startKeyVectorIdxToCompare */, std::move(keyVectors));
+}
+
+void TopKBuffer::copyBoundaryValue(const TopKBuffer& other) {
+    KU_ASSERT(other.hasBoundaryValue);
+    for (auto i = 0u; i < boundaryVecs.size(); i++) {
+        auto boundaryVec = boundaryVecs[i].get();
+        auto dstPos = boundaryVec->state->getSelVector()[0];
+        auto srcVector = other.boundaryVecs[i].get();
+        auto srcPos = srcVector->state->getSelVector()[0];
+        boundaryVec->copyFromVectorData(dstPos, srcVector, srcPos);
+    }
+    hasBoundaryValue = true;
+}
+
 void TopKBuffer::initVectors() {
     auto payloadUnflatState = std::make_shared<common::DataChunkState>();
     auto payloadFlatState = common::DataChunkState::getSingleValueDataChunkState();
@@ -247,11 +274,37 @@ void TopKLocalState::init(const OrderByDataInfo& orderByDataInfo,
     buffer->init(memoryManager, skipNumber, limitNumber);
 }
 
-// NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+void TopKSharedState::exchangeBoundaryValue(TopKBuffer& localBuffer,
+    uint64_t& seenBoundaryVersion) {
+    std::unique_lock lck{mtx};
+    if (localBuffer.hasTighterBoundaryValue(*boundaryBuffer)) {
+        boundaryBuffer->copyBoundaryValue(localBuffer);
+        boundaryVersion.fetch_add(1, std::memory_order_release);
+    } else if (boundaryBuffer->hasTighterBoundaryValue(localBuffer)) {
+        localBuffer.copyBoundaryValue(*boundaryBuffer);
+    }
+    seenBoundaryVersion = boundaryVersion.load(std::memory_order_relaxed);
+}
+
+void TopKSharedState::tightenBoundaryValue(TopKBuffer& localBuffer,
+    uint64_t& seenBoundaryVersion) {
+    if (boundaryVersion.load(std::memory_order_acquire) == seenBoundaryVersion) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    if (boundaryBuffer->hasTighterBoundaryValue(localBuffer)) {
+        localBuffer.copyBoundaryValue(*boundaryBuffer);
+    }
+    seenBoundaryVersion = boundaryVersion.load(std::memory_order_relaxed);
+}
+
 void TopKLocalState::append(const std::vector<common::ValueVector*>& keyVectors,
-    const std::vector<common::ValueVector*>& payloadVectors) {
+    const std::vector<common::ValueVector*>& payloadVectors, TopKSharedState& sharedState) {
+    sharedState.tightenBoundaryValue(*buffer, seenBoundaryVersion);
     buffer->append(keyVectors, payloadVectors);
-    buffer->reduce();
+    if (buffer->reduce()) {
+        sharedState.exchangeBoundaryValue(*buffer, seenBoundaryVersion);
+    }
 }
 
 void TopK::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
@@ -269,7 +322,7 @@ void TopK::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* contex
 void TopK::executeInternal(ExecutionContext* context) {
     while (children[0]->getNextTuple(context)) {
         for (auto i = 0u; i < resultSet->multiplicity; i++) {
-            localState->append(orderByVectors, payloadVectors);
+            localState->append(orderByVectors, payloadVectors, *sharedState);
         }
     }
     localState->finalize();
@@ -31,6 +31,7 @@ void NodeBatchInsertSharedState::initPKIndex(const ExecutionContext* context) {
         numRows = scanSharedState->getNumRows();
     }
     auto* nodeTable = ku_dynamic_cast<NodeTable*>(table);
+    startNodeOffset = nodeTable->getNumTotalRows(context->clientContext->getTx());
     nodeTable->getPKIndex()->bulkReserve(numRows);
     globalIndexBuilder = IndexBuilder(
         std::make_shared<IndexBuilderSharedState>(context->clientContext->getTx(), nodeTable));
@@ -229,6 +230,10 @@ void NodeBatchInsert::finalize(ExecutionContext* context) {
         nodeSharedState->globalIndexBuilder->finalize(context, errorHandler);
         errorHandler.flushStoredErrors();
     }
+    auto transaction = context->clientContext->getTx();
+    const auto nodeTable = ku_dynamic_cast<NodeTable*>(sharedState->table);
+    nodeTable->notifyBulkAppend(transaction, nodeSharedState->startNodeOffset,
+        nodeTable->getNumTotalRows(transaction));
 
     // we want to flush all index errors before children call finalize
     // as the children are resposible for populating the errors and sending it to the warning
@@ -121,6 +121,15 @@ void RelBatchInsert::appendNodeGroup(transaction::Transaction* transaction, CSRN
         leaveGaps);
     const auto& csrHeader = localState.chunkedGroup->cast<ChunkedCSRNodeGroup>().getCSRHeader();
     const auto maxSize = csrHeader.getEndCSROffset(numNodes - 1);
+    auto* relTable = sharedState.table->ptrCast<RelTable>();
+    DegreeStats degreeStats;
+    for (auto i = 0u; i < numNodes; i++) {
+        degreeStats.insert(startNodeOffset + i, csrHeader.getCSRLength(i));
+    }
+    // Only new node groups are replaced. For node groups with existing rels the copied degrees are
+    // merged as if they belonged to other nodes, until the next checkpoint recomputes them.
+    relTable->getDirectedTableData(relInfo.direction)
+        ->updateDegreeStats(nodeGroupIdx, degreeStats, leaveGaps /* replace */);
     for (auto& chunkedGroup : partitioningBuffer->getChunkedGroups()) {
         sharedState.incrementNumRows(chunkedGroup->getNumRows());
         localState.chunkedGroup->write(*chunkedGroup, relInfo.boundNodeOffsetColumnID);
@@ -143,7 +152,6 @@ void RelBatchInsert::appendNodeGroup(transaction::Transaction* transaction, CSRN
     KU_ASSERT(localState.chunkedGroup->getNumRows() == maxSize);
     localState.chunkedGroup->finalize();
 
-    auto* relTable = sharedState.table->ptrCast<RelTable>();
     appendNewChunkedGroup(transaction, localState.chunkedGroup->cast<ChunkedCSRNodeGroup>(),
         *relTable, nodeGroup, relInfo.direction);
 
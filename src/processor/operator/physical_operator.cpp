@@ -83,8 +83,12 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "PATH_PROPERTY_PROBE";
     case PhysicalOperatorType::PRIMARY_KEY_SCAN_NODE_TABLE:
         return "PRIMARY_KEY_SCAN_NODE_TABLE";
+    case PhysicalOperatorType::PROPERTY_INDEX_SCAN_NODE_TABLE:
+        return "PROPERTY_INDEX_SCAN_NODE_TABLE";
     case PhysicalOperatorType::PROJECTION:
         return "PROJECTION";
+    case PhysicalOperatorType::PROPERTY_LOOKUP:
+        return "PROPERTY_LOOKUP";
     case PhysicalOperatorType::PROFILE:
         return "PROFILE";
     case PhysicalOperatorType::RECURSIVE_JOIN:
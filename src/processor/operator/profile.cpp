@@ -1,5 +1,6 @@
 #include "processor/operator/profile.h"
 
+#include "main/client_context.h"
 #include "main/plan_printer.h"
 
 using namespace kuzu::common;
@@ -18,7 +19,10 @@ bool Profile::getNextTuplesInternal(ExecutionContext* context) {
     localState.hasExecuted = true;
     ku_string_t profileStr;
     const auto planInString =
-        main::PlanPrinter::printPlanToOstream(info.physicalPlan, context->profiler).str();
+        context->clientContext->getClientConfig()->profileJson ?
+            main::PlanPrinter::printProfileToJson(info.physicalPlan, context->profiler,
+                4 /* indent */) :
+            main::PlanPrinter::printPlanToOstream(info.physicalPlan, context->profiler).str();
     StringVector::addString(outputVector, profileStr, planInString.c_str(), planInString.length());
     auto& selVector = outputVector->state->getSelVectorUnsafe();
     selVector.setSelSize(1);
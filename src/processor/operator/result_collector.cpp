@@ -42,6 +42,10 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
 }
 
 void ResultCollector::executeInternal(ExecutionContext* context) {
+    if (auto queue = sharedState->getResultQueue(); queue != nullptr && !payloadVectors.empty()) {
+        executeStreaming(context, *queue);
+        return;
+    }
     while (children[0]->getNextTuple(context)) {
         if (!payloadVectors.empty()) {
             for (auto i = 0u; i < resultSet->multiplicity; i++) {
@@ -55,6 +59,28 @@ void ResultCollector::executeInternal(ExecutionContext* context) {
     }
 }
 
+void ResultCollector::executeStreaming(ExecutionContext* context, ResultQueue& queue) {
+    auto pushLocalTable = [&]() {
+        metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
+        auto table = std::shared_ptr<FactorizedTable>(std::move(localTable));
+        localTable = std::make_unique<FactorizedTable>(context->clientContext->getMemoryManager(),
+            info.tableSchema.copy());
+        return queue.push(std::move(table));
+    };
+    while (children[0]->getNextTuple(context)) {
+        for (auto i = 0u; i < resultSet->multiplicity; i++) {
+            localTable->append(payloadAndMarkVectors);
+        }
+        if (localTable->getNumTuples() >= ResultQueue::CHUNK_SIZE && !pushLocalTable()) {
+            // The result has been closed by its reader.
+            return;
+        }
+    }
+    if (!localTable->isEmpty()) {
+        pushLocalTable();
+    }
+}
+
 void ResultCollector::finalizeInternal(ExecutionContext* context) {
     switch (info.accumulateType) {
     case AccumulateType::OPTIONAL_: {
@@ -0,0 +1,79 @@
+#include "processor/operator/scan/property_index_scan_node_table.h"
+
+#include "binder/expression/expression_util.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+std::string PropertyIndexScanPrintInfo::toString() const {
+    std::string result = "Property: ";
+    result += property;
+    result += ", Key: ";
+    result += key;
+    if (!alias.empty()) {
+        result += ",Alias: ";
+        result += alias;
+    }
+    result += ", Expressions: ";
+    result += binder::ExpressionUtil::toString(expressions);
+    return result;
+}
+
+void PropertyIndexScanNodeTable::initLocalStateInternal(ResultSet* resultSet,
+    ExecutionContext* context) {
+    std::vector<const Column*> columns;
+    columns.reserve(nodeInfo.columnIDs.size());
+    for (const auto columnID : nodeInfo.columnIDs) {
+        if (columnID == INVALID_COLUMN_ID) {
+            columns.push_back(nullptr);
+        } else {
+            columns.push_back(&nodeInfo.table->getColumn(columnID));
+        }
+    }
+    nodeInfo.localScanState = std::make_unique<NodeTableScanState>(nodeInfo.table->getTableID(),
+        nodeInfo.columnIDs, columns);
+    initVectors(*nodeInfo.localScanState, *resultSet);
+    keyEvaluator->init(*resultSet, context->clientContext);
+}
+
+void PropertyIndexScanNodeTable::initVectors(TableScanState& state,
+    const ResultSet& resultSet) const {
+    ScanTable::initVectors(state, resultSet);
+    state.rowIdxVector->state = state.nodeIDVector->state;
+    state.outState = state.rowIdxVector->state.get();
+}
+
+bool PropertyIndexScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
+    auto transaction = context->clientContext->getTx();
+    if (!initialized) {
+        initialized = true;
+        keyEvaluator->evaluate();
+        auto keyVector = keyEvaluator->resultVector.get();
+        KU_ASSERT(keyVector->state->getSelVector().getSelSize() == 1);
+        candidates = nodeInfo.table->lookupPropertyIndex(transaction, indexedColumnID, *keyVector,
+            keyVector->state->getSelVector()[0]);
+    }
+    auto& scanState = *nodeInfo.localScanState;
+    const auto pos = scanState.nodeIDVector->state->getSelVector()[0];
+    while (candidateIdx < candidates.size()) {
+        const auto nodeID = nodeID_t{candidates[candidateIdx++], nodeInfo.table->getTableID()};
+        scanState.nodeIDVector->setValue<nodeID_t>(pos, nodeID);
+        // Lookups append lists and strings to the output vectors.
+        for (auto& vector : scanState.outputVectors) {
+            vector->resetAuxiliaryBuffer();
+        }
+        nodeInfo.table->initScanState(transaction, scanState, nodeID.tableID, nodeID.offset);
+        // Candidates that are deleted or not yet visible to the transaction are skipped.
+        if (nodeInfo.table->lookup(transaction, scanState)) {
+            metrics->numOutputTuple.incrementByOne();
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,120 @@
+#include "processor/operator/scan/property_lookup.h"
+
+#include "storage/storage_utils.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace processor {
+
+void PropertyLookup::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    ScanTable::initLocalStateInternal(resultSet, context);
+    nodeIDVector = resultSet->getValueVector(info.nodeIDPos).get();
+    for (auto& pos : info.outVectorsPos) {
+        outVectors.push_back(resultSet->getValueVector(pos).get());
+    }
+    for (auto& [_, tableInfo] : tableIDToInfo) {
+        auto& nodeInfo = tableInfo.nodeInfo;
+        nodeInfo.initScanState(nullptr);
+        auto& state = *nodeInfo.localScanState;
+        state.nodeIDVector = nodeIDVector;
+        for (auto idx : tableInfo.outVectorIdxs) {
+            state.outputVectors.push_back(outVectors[idx]);
+        }
+        state.rowIdxVector->state = nodeIDVector->state;
+        state.outState = state.rowIdxVector->state.get();
+    }
+    lookupSelVector = std::make_shared<SelectionVector>(DEFAULT_VECTOR_CAPACITY);
+    positions.reserve(DEFAULT_VECTOR_CAPACITY);
+}
+
+// Uncommitted nodes are stored in the local table, whose node groups are indexed by local row idx.
+static std::pair<bool, node_group_idx_t> getNodeGroup(const Transaction* transaction,
+    nodeID_t nodeID) {
+    if (transaction->isUnCommitted(nodeID.tableID, nodeID.offset)) {
+        return {true, StorageUtils::getNodeGroupIdx(
+                          transaction->getLocalRowIdx(nodeID.tableID, nodeID.offset))};
+    }
+    return {false, StorageUtils::getNodeGroupIdx(nodeID.offset)};
+}
+
+bool PropertyLookup::getNextTuplesInternal(ExecutionContext* context) {
+    if (!children[0]->getNextTuple(context)) {
+        return false;
+    }
+    const auto transaction = context->clientContext->getTx();
+    for (auto& vector : outVectors) {
+        vector->resetAuxiliaryBuffer();
+    }
+    positions.clear();
+    for (auto pos : nodeIDVector->state->getSelVector().getSelectedPositions()) {
+        if (nodeIDVector->isNull(pos)) {
+            for (auto& vector : outVectors) {
+                vector->setNull(pos, true);
+            }
+            continue;
+        }
+        positions.push_back(pos);
+    }
+    // Sorting groups the nodes by table and node group, and reads each node group in offset order.
+    auto nodeIDs = reinterpret_cast<const nodeID_t*>(nodeIDVector->getData());
+    std::sort(positions.begin(), positions.end(), [&](sel_t a, sel_t b) {
+        return nodeIDs[a].tableID == nodeIDs[b].tableID ? nodeIDs[a].offset < nodeIDs[b].offset :
+                                                          nodeIDs[a].tableID < nodeIDs[b].tableID;
+    });
+    auto originalSelVector = nodeIDVector->state->getSelVectorShared();
+    nodeIDVector->state->setSelVector(lookupSelVector);
+    auto start = 0u;
+    while (start < positions.size()) {
+        const auto first = nodeIDs[positions[start]];
+        const auto nodeGroup = getNodeGroup(transaction, first);
+        auto end = start + 1;
+        while (end < positions.size() && nodeIDs[positions[end]].tableID == first.tableID &&
+               getNodeGroup(transaction, nodeIDs[positions[end]]) == nodeGroup) {
+            end++;
+        }
+        lookup(transaction, first, std::span(positions.data() + start, end - start));
+        start = end;
+    }
+    nodeIDVector->state->setSelVector(std::move(originalSelVector));
+    metrics->numOutputTuple.increase(nodeIDVector->state->getSelVector().getSelSize());
+    return true;
+}
+
+void PropertyLookup::lookup(Transaction* transaction, nodeID_t firstNodeID,
+    std::span<const sel_t> nodePositions) {
+    auto buffer = lookupSelVector->getMutableBuffer();
+    std::copy(nodePositions.begin(), nodePositions.end(), buffer.begin());
+    lookupSelVector->setToFiltered(nodePositions.size());
+    KU_ASSERT(tableIDToInfo.contains(firstNodeID.tableID));
+    auto& tableInfo = tableIDToInfo.at(firstNodeID.tableID);
+    // Properties the table does not have are null.
+    auto outVectorIdx = 0u;
+    for (auto i = 0u; i < outVectors.size(); ++i) {
+        if (outVectorIdx < tableInfo.outVectorIdxs.size() &&
+            tableInfo.outVectorIdxs[outVectorIdx] == i) {
+            outVectorIdx++;
+            continue;
+        }
+        for (auto pos : nodePositions) {
+            outVectors[i]->setNull(pos, true);
+        }
+    }
+    if (tableInfo.outVectorIdxs.empty()) {
+        return;
+    }
+    auto& nodeInfo = tableInfo.nodeInfo;
+    nodeInfo.table->initScanState(transaction, *nodeInfo.localScanState, firstNodeID.tableID,
+        firstNodeID.offset);
+    if (!nodeInfo.table->lookup(transaction, *nodeInfo.localScanState)) {
+        // LCOV_EXCL_START
+        throw RuntimeException(stringFormat("Cannot perform lookup on {}. This should not happen.",
+            TypeUtils::toString(firstNodeID)));
+        // LCOV_EXCL_STOP
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
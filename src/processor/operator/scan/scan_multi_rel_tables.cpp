@@ -26,8 +26,10 @@ bool RelTableCollectionScanner::scan(Transaction* transaction) {
         auto& scanState = *relInfo.scanState;
         if (relInfo.table->scan(transaction, scanState)) {
             if (directionVector != nullptr) {
-                for (auto i = 0u; i < scanState.outState->getSelVector().getSelSize(); ++i) {
-                    directionVector->setValue<bool>(i, directionValues[currentTableIdx]);
+                // Rels filtered by property predicates are not selected contiguously.
+                auto& selVector = scanState.outState->getSelVector();
+                for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+                    directionVector->setValue<bool>(selVector[i], directionValues[currentTableIdx]);
                 }
             }
             if (scanState.outState->getSelVector().getSelSize() > 0) {
@@ -50,6 +52,7 @@ bool RelTableCollectionScanner::scan(Transaction* transaction) {
 }
 
 void ScanMultiRelTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    ScanTable::initLocalStateInternal(resultSet, context);
     boundNodeIDVector = resultSet->getValueVector(info.nodeIDPos).get();
     KU_ASSERT(!info.outVectorsPos.empty());
     outState = resultSet->getValueVector(info.outVectorsPos[0])->state.get();
@@ -89,6 +92,9 @@ void ScanMultiRelTable::initVectors(TableScanState& state, const ResultSet& resu
 bool ScanMultiRelTable::getNextTuplesInternal(ExecutionContext* context) {
     while (true) {
         if (currentScanner != nullptr && currentScanner->scan(context->clientContext->getTx())) {
+            if (!joinKeyFilterApplier.apply()) {
+                continue;
+            }
             metrics->numOutputTuple.increase(outState->getSelVector().getSelSize());
             return true;
         }
@@ -87,6 +87,8 @@ std::vector<RoaringBitmapSemiMask*> ScanNodeTable::getSemiMasks() const {
 
 void ScanNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     ScanTable::initLocalStateInternal(resultSet, context);
+    numRowsSkippedByZoneMap =
+        context->profiler->registerNumericMetric(getNumRowsSkippedByZoneMapMetricKey());
     for (auto i = 0u; i < nodeInfos.size(); ++i) {
         auto& nodeInfo = nodeInfos[i];
         nodeInfo.initScanState(sharedStates[i]->getSemiMask());
@@ -114,10 +116,14 @@ bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
         const auto& info = nodeInfos[currentTableIdx];
         auto& scanState = *info.localScanState;
         while (info.table->scan(transaction, scanState)) {
-            const auto outputSize = scanState.outState->getSelVector().getSelSize();
-            if (outputSize > 0) {
-                scanState.outState->setToUnflat();
-                metrics->numOutputTuple.increase(outputSize);
+            numRowsSkippedByZoneMap->increase(scanState.numRowsSkippedByZoneMap);
+            scanState.numRowsSkippedByZoneMap = 0;
+            if (scanState.outState->getSelVector().getSelSize() == 0) {
+                continue;
+            }
+            scanState.outState->setToUnflat();
+            if (joinKeyFilterApplier.apply()) {
+                metrics->numOutputTuple.increase(scanState.outState->getSelVector().getSelSize());
                 return true;
             }
         }
@@ -131,6 +137,15 @@ bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
     return false;
 }
 
+std::unordered_map<std::string, std::string> ScanNodeTable::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    const auto numRowsSkipped =
+        profiler.sumAllNumericMetricsWithKey(getNumRowsSkippedByZoneMapMetricKey());
+    result.insert({"NumRowsSkippedByZoneMap", std::to_string(numRowsSkipped)});
+    return result;
+}
+
 std::unique_ptr<PhysicalOperator> ScanNodeTable::clone() {
     return make_unique<ScanNodeTable>(info.copy(), copyVector(nodeInfos), sharedStates, id,
         printInfo->copy(), progressSharedState);
@@ -71,6 +71,7 @@ void ScanRelTableInfo::initScanState(const ExecutionContext* context) {
 }
 
 void ScanRelTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    ScanTable::initLocalStateInternal(resultSet, context);
     relInfo.initScanState(context);
     initVectors(*relInfo.scanState, *resultSet);
     if (const auto localRelTable =
@@ -95,7 +96,8 @@ bool ScanRelTable::getNextTuplesInternal(ExecutionContext* context) {
     auto& scanState = *relInfo.scanState;
     while (true) {
         while (relInfo.table->scan(transaction, scanState)) {
-            if (relInfo.scanState->outState->getSelVector().getSelSize() > 0) {
+            if (relInfo.scanState->outState->getSelVector().getSelSize() > 0 &&
+                joinKeyFilterApplier.apply()) {
                 metrics->numOutputTuple.increase(
                     relInfo.scanState->outState->getSelVector().getSelSize());
                 return true;
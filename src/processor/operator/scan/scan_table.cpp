@@ -3,6 +3,10 @@
 namespace kuzu {
 namespace processor {
 
+void ScanTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* /*context*/) {
+    joinKeyFilterApplier.init(info.joinKeyFilterInfos, *resultSet);
+}
+
 void ScanTable::initVectors(storage::TableScanState& state, const ResultSet& resultSet) const {
     state.nodeIDVector = resultSet.getValueVector(info.nodeIDPos).get();
     for (auto& pos : info.outVectorsPos) {
@@ -4,6 +4,7 @@
 
 #include "catalog/catalog.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "catalog/catalog_entry/rel_table_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
@@ -90,6 +91,13 @@ std::string getSchemaCypher(ClientContext* clientContext, Transaction* tx) {
     for (auto macroName : catalog->getMacroNames(tx)) {
         ss << catalog->getScalarMacroFunction(tx, macroName)->toCypher(macroName) << std::endl;
     }
+    for (const auto& nodeTableEntry : catalog->getNodeTableEntries(tx)) {
+        for (const auto indexEntry : catalog->getIndexEntries(tx, nodeTableEntry->getTableID())) {
+            if (indexEntry->getType() == CatalogEntryType::PROPERTY_INDEX_ENTRY) {
+                ss << indexEntry->toCypher(clientContext) << std::endl;
+            }
+        }
+    }
     return ss.str();
 }
 
@@ -39,6 +39,7 @@ void TableFunctionCall::initLocalStateInternal(ResultSet* resultSet, ExecutionCo
             localState.funcOutput.vectors.push_back(
                 resultSet->getValueVector(info.outPosV[i]).get());
         }
+        localState.joinKeyFilterApplier.init(info.joinKeyFilterInfos, *resultSet);
     } break;
     case TableScanOutputType::MULTI_DATA_CHUNK: {
         for (auto& pos : info.outPosV) {
@@ -62,15 +63,25 @@ void TableFunctionCall::initGlobalStateInternal(ExecutionContext* ctx) {
 }
 
 bool TableFunctionCall::getNextTuplesInternal(ExecutionContext*) {
-    localState.funcOutput.dataChunk.state->getSelVectorUnsafe().setSelSize(0);
-    localState.funcOutput.dataChunk.resetAuxiliaryBuffer();
-    for (auto i = 0u; i < localState.funcOutput.dataChunk.getNumValueVectors(); i++) {
-        localState.funcOutput.dataChunk.getValueVectorMutable(i).setAllNonNull();
+    auto& selVector = localState.funcOutput.dataChunk.state->getSelVectorUnsafe();
+    while (true) {
+        selVector.setSelSize(0);
+        localState.funcOutput.dataChunk.resetAuxiliaryBuffer();
+        for (auto i = 0u; i < localState.funcOutput.dataChunk.getNumValueVectors(); i++) {
+            localState.funcOutput.dataChunk.getValueVectorMutable(i).setAllNonNull();
+        }
+        auto numTuplesScanned =
+            info.function.tableFunc(localState.funcInput, localState.funcOutput);
+        selVector.setToUnfiltered(numTuplesScanned);
+        if (numTuplesScanned == 0) {
+            return false;
+        }
+        // A batch whose rows are all filtered out is not the end of the output.
+        if (localState.joinKeyFilterApplier.apply()) {
+            metrics->numOutputTuple.increase(selVector.getSelSize());
+            return true;
+        }
     }
-    auto numTuplesScanned = info.function.tableFunc(localState.funcInput, localState.funcOutput);
-    localState.funcOutput.dataChunk.state->getSelVectorUnsafe().setToUnfiltered(numTuplesScanned);
-    metrics->numOutputTuple.increase(numTuplesScanned);
-    return numTuplesScanned != 0;
 }
 
 void TableFunctionCall::finalizeInternal(ExecutionContext* context) {
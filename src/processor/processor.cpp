@@ -22,9 +22,11 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(PhysicalPlan* physicalP
     // The root pipeline(task) consists of operators and its prevOperator only, because we
     // expect to have linear plans. For binary operators, e.g., HashJoin, we  keep probe and its
     // prevOperator in the same pipeline, and decompose build and its prevOperator into another
-    // one.
+    // one. Children after the first one are shared subplans, which are materialized first.
     auto task = std::make_shared<ProcessorTask>(resultCollector, context);
-    decomposePlanIntoTask(lastOperator->getChild(0), task.get(), context);
+    for (auto i = (int64_t)lastOperator->getNumChildren() - 1; i >= 0; --i) {
+        decomposePlanIntoTask(lastOperator->getChild(i), task.get(), context);
+    }
     initTask(task.get());
     context->clientContext->getProgressBar()->startProgress(context->queryID);
     taskScheduler->scheduleTaskAndWaitOrError(task, context);
@@ -38,11 +40,17 @@ void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
         context->clientContext->getProgressBar()->addPipeline();
     }
     if (op->isSink()) {
-        auto childTask = std::make_unique<ProcessorTask>(ku_dynamic_cast<Sink*>(op), context);
+        auto sink = ku_dynamic_cast<Sink*>(op);
+        auto childTask = std::make_unique<ProcessorTask>(sink, context);
         for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
             decomposePlanIntoTask(op->getChild(i), childTask.get(), context);
         }
-        task->addChildTask(std::move(childTask));
+        if (auto finalizeTask = sink->createFinalizeTask(context)) {
+            finalizeTask->addChildTask(std::move(childTask));
+            task->addChildTask(std::move(finalizeTask));
+        } else {
+            task->addChildTask(std::move(childTask));
+        }
     } else {
         // Schedule the right most side (e.g., build side of the hash join) first.
         for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
@@ -52,7 +60,14 @@ void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
 }
 
 void QueryProcessor::initTask(Task* task) {
-    auto processorTask = ku_dynamic_cast<ProcessorTask*>(task);
+    auto processorTask = dynamic_cast<ProcessorTask*>(task);
+    if (processorTask == nullptr) {
+        // Finalize tasks of sinks decide their own parallelism.
+        for (auto& child : task->children) {
+            initTask(child.get());
+        }
+        return;
+    }
     PhysicalOperator* op = processorTask->sink;
     while (!op->isSource()) {
         if (!op->isParallel()) {
@@ -16,7 +16,11 @@ void ProcessorTask::run() {
     // We need the lock when cloning because multiple threads can be accessing to clone,
     // which is not thread safe
     lock_t lck{taskMtx};
+    auto profiler = executionContext->profiler;
     if (!sharedStateInitialized) {
+        if (profiler->enabled) {
+            pipelineTimer.start();
+        }
         sink->initGlobalState(executionContext);
         sharedStateInitialized = true;
     }
@@ -25,12 +29,23 @@ void ProcessorTask::run() {
     auto currentSink = (Sink*)clonedPipelineRoot.get();
     auto resultSet =
         populateResultSet(currentSink, executionContext->clientContext->getMemoryManager());
+    if (!profiler->enabled) {
+        currentSink->execute(resultSet.get(), executionContext);
+        return;
+    }
+    PipelineThreadTimer threadTimer;
     currentSink->execute(resultSet.get(), executionContext);
+    profiler->addPipelineThreadMetrics(sink->getOperatorID(), threadTimer.finish());
 }
 
 void ProcessorTask::finalizeIfNecessary() {
     executionContext->clientContext->getProgressBar()->finishPipeline(executionContext->queryID);
     sink->finalize(executionContext);
+    if (executionContext->profiler->enabled && sharedStateInitialized) {
+        pipelineTimer.stop();
+        executionContext->profiler->addPipelineWallTime(sink->getOperatorID(),
+            pipelineTimer.getDuration() / 1000);
+    }
 }
 
 std::unique_ptr<ResultSet> ProcessorTask::populateResultSet(Sink* op,
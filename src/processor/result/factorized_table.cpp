@@ -401,7 +401,9 @@ void FactorizedTable::copyVectorToUnflatColumn(const ValueVector& vector,
 
 void FactorizedTable::copyVectorToColumn(const ValueVector& vector,
     const BlockAppendingInfo& blockAppendInfo, uint64_t numAppendedTuples, ft_col_idx_t colIdx) {
-    if (tableSchema.getColumn(colIdx)->isFlat()) {
+    if (tableSchema.getColumn(colIdx)->isCompactInternalID()) {
+        copyVectorToCompactInternalIDColumn(vector, blockAppendInfo, numAppendedTuples, colIdx);
+    } else if (tableSchema.getColumn(colIdx)->isFlat()) {
         copyVectorToFlatColumn(vector, blockAppendInfo, numAppendedTuples, colIdx);
     } else {
         copyVectorToUnflatColumn(vector, blockAppendInfo, colIdx);
@@ -460,6 +462,10 @@ overflow_value_t FactorizedTable::appendVectorToUnflatTupleBlocks(const ValueVec
 
 void FactorizedTable::readUnflatCol(uint8_t** tuplesToRead, ft_col_idx_t colIdx,
     ValueVector& vector) const {
+    if (tableSchema.getColumn(colIdx)->isCompactInternalID()) {
+        readCompactInternalIDUnflatCol(tuplesToRead[0], nullptr /* selVector */, colIdx, vector);
+        return;
+    }
     auto overflowColValue =
         *(overflow_value_t*)(tuplesToRead[0] + tableSchema.getColOffset(colIdx));
     KU_ASSERT(vector.state->getSelVector().isUnfiltered());
@@ -490,6 +496,10 @@ void FactorizedTable::readUnflatCol(uint8_t** tuplesToRead, ft_col_idx_t colIdx,
 
 void FactorizedTable::readUnflatCol(const uint8_t* tupleToRead, const SelectionVector& selVector,
     ft_col_idx_t colIdx, ValueVector& vector) const {
+    if (tableSchema.getColumn(colIdx)->isCompactInternalID()) {
+        readCompactInternalIDUnflatCol(tupleToRead, &selVector, colIdx, vector);
+        return;
+    }
     auto vectorOverflowValue = *(overflow_value_t*)(tupleToRead + tableSchema.getColOffset(colIdx));
     KU_ASSERT(vector.state->getSelVector().isUnfiltered());
     if (hasNoNullGuarantee(colIdx)) {
@@ -520,6 +530,11 @@ void FactorizedTable::readFlatColToFlatVector(uint8_t* tupleToRead, ft_col_idx_t
     ValueVector& vector, sel_t pos) const {
     if (isNonOverflowColNull(tupleToRead + tableSchema.getNullMapOffset(), colIdx)) {
         vector.setNull(pos, true);
+    } else if (tableSchema.getColumn(colIdx)->isCompactInternalID()) {
+        vector.setNull(pos, false);
+        auto offset = *(offset_t*)(tupleToRead + tableSchema.getColOffset(colIdx));
+        vector.setValue(pos,
+            internalID_t{offset, tableSchema.getColumn(colIdx)->getCompactTableID()});
     } else {
         vector.setNull(pos, false);
         vector.copyFromRowData(pos, tupleToRead + tableSchema.getColOffset(colIdx));
@@ -538,6 +553,10 @@ void FactorizedTable::readFlatCol(uint8_t** tuplesToRead, ft_col_idx_t colIdx, V
 
 void FactorizedTable::readFlatColToUnflatVector(uint8_t** tuplesToRead, ft_col_idx_t colIdx,
     ValueVector& vector, uint64_t numTuplesToRead) const {
+    if (tableSchema.getColumn(colIdx)->isCompactInternalID()) {
+        readCompactInternalIDFlatCol(tuplesToRead, colIdx, vector, numTuplesToRead);
+        return;
+    }
     vector.state->getSelVectorUnsafe().setSelSize(numTuplesToRead);
     if (hasNoNullGuarantee(colIdx)) {
         vector.setAllNonNull();
@@ -561,6 +580,87 @@ void FactorizedTable::readFlatColToUnflatVector(uint8_t** tuplesToRead, ft_col_i
     }
 }
 
+void FactorizedTable::copyVectorToCompactInternalIDColumn(const ValueVector& vector,
+    const BlockAppendingInfo& blockAppendInfo, uint64_t numAppendedTuples, ft_col_idx_t colIdx) {
+    auto column = tableSchema.getColumn(colIdx);
+    auto ids = reinterpret_cast<const internalID_t*>(vector.getData());
+    auto& selVector = vector.state->getSelVector();
+    if (column->isFlat()) {
+        auto colOffset = tableSchema.getColOffset(colIdx);
+        auto dstTuple = blockAppendInfo.data;
+        for (auto i = 0u; i < blockAppendInfo.numTuplesToAppend; i++) {
+            auto pos = vector.state->isFlat() ? selVector[0] : selVector[numAppendedTuples + i];
+            if (vector.isNull(pos)) {
+                setNonOverflowColNull(dstTuple + tableSchema.getNullMapOffset(), colIdx);
+            } else {
+                KU_ASSERT(ids[pos].tableID == column->getCompactTableID());
+                *(offset_t*)(dstTuple + colOffset) = ids[pos].offset;
+            }
+            dstTuple += tableSchema.getNumBytesPerTuple();
+        }
+        return;
+    }
+    KU_ASSERT(!vector.state->isFlat());
+    auto numValues = selVector.getSelSize();
+    auto numBytesForData = sizeof(offset_t) * numValues;
+    auto overflowBlockBuffer =
+        allocateUnflatTupleBlock(numBytesForData + NullBuffer::getNumBytesForNullValues(numValues));
+    auto offsets = reinterpret_cast<offset_t*>(overflowBlockBuffer);
+    for (auto i = 0u; i < numValues; i++) {
+        auto pos = selVector[i];
+        if (vector.isNull(pos)) {
+            setOverflowColNull(overflowBlockBuffer + numBytesForData, colIdx, i);
+        } else {
+            KU_ASSERT(ids[pos].tableID == column->getCompactTableID());
+            offsets[i] = ids[pos].offset;
+        }
+    }
+    auto unflatTupleValue = overflow_value_t{numValues, overflowBlockBuffer};
+    auto blockPtr = blockAppendInfo.data + tableSchema.getColOffset(colIdx);
+    for (auto i = 0u; i < blockAppendInfo.numTuplesToAppend; i++) {
+        memcpy(blockPtr, (uint8_t*)&unflatTupleValue, sizeof(overflow_value_t));
+        blockPtr += tableSchema.getNumBytesPerTuple();
+    }
+}
+
+void FactorizedTable::readCompactInternalIDFlatCol(uint8_t** tuplesToRead, ft_col_idx_t colIdx,
+    ValueVector& vector, uint64_t numTuplesToRead) const {
+    auto tableID = tableSchema.getColumn(colIdx)->getCompactTableID();
+    auto colOffset = tableSchema.getColOffset(colIdx);
+    auto ids = reinterpret_cast<internalID_t*>(vector.getData());
+    vector.state->getSelVectorUnsafe().setSelSize(numTuplesToRead);
+    for (auto i = 0u; i < numTuplesToRead; i++) {
+        auto pos = vector.state->getSelVector()[i];
+        if (isNonOverflowColNull(tuplesToRead[i] + tableSchema.getNullMapOffset(), colIdx)) {
+            vector.setNull(pos, true);
+        } else {
+            vector.setNull(pos, false);
+            ids[pos] = internalID_t{*(offset_t*)(tuplesToRead[i] + colOffset), tableID};
+        }
+    }
+}
+
+void FactorizedTable::readCompactInternalIDUnflatCol(const uint8_t* tupleToRead,
+    const SelectionVector* selVector, ft_col_idx_t colIdx, ValueVector& vector) const {
+    KU_ASSERT(vector.state->getSelVector().isUnfiltered());
+    auto tableID = tableSchema.getColumn(colIdx)->getCompactTableID();
+    auto overflowColValue = *(overflow_value_t*)(tupleToRead + tableSchema.getColOffset(colIdx));
+    auto offsets = reinterpret_cast<const offset_t*>(overflowColValue.value);
+    auto nullData = overflowColValue.value + overflowColValue.numElements * sizeof(offset_t);
+    auto ids = reinterpret_cast<internalID_t*>(vector.getData());
+    for (auto i = 0u; i < overflowColValue.numElements; i++) {
+        auto pos = selVector == nullptr ? i : (*selVector)[i];
+        if (isOverflowColNull(nullData, pos, colIdx)) {
+            vector.setNull(i, true);
+        } else {
+            vector.setNull(i, false);
+            ids[i] = internalID_t{offsets[pos], tableID};
+        }
+    }
+    vector.state->getSelVectorUnsafe().setSelSize(
+        selVector == nullptr ? overflowColValue.numElements : selVector->getSelSize());
+}
+
 FlatTupleIterator::FlatTupleIterator(FactorizedTable& factorizedTable, std::vector<Value*> values)
     : factorizedTable{factorizedTable}, currentTupleBuffer{nullptr}, numFlatTuples{0},
       nextFlatTupleIdx{0}, nextTupleIdx{1}, values{std::move(values)} {
@@ -601,6 +701,18 @@ void FlatTupleIterator::resetState() {
     }
 }
 
+void FlatTupleIterator::skipTuples(uint64_t numTuples) {
+    KU_ASSERT(isAtTupleBoundary() && numTuples > 0);
+    auto lastTupleIdx = getNextTupleIdx() + numTuples - 1;
+    KU_ASSERT(lastTupleIdx < factorizedTable.getNumTuples());
+    // Mark all flat tuples of the last skipped tuple as read, so the next read moves on to the tuple
+    // after it.
+    currentTupleBuffer = factorizedTable.getTuple(lastTupleIdx);
+    numFlatTuples = factorizedTable.getNumFlatTuples(lastTupleIdx);
+    nextFlatTupleIdx = numFlatTuples;
+    nextTupleIdx = lastTupleIdx + 1;
+}
+
 void FlatTupleIterator::readUnflatColToFlatTuple(ft_col_idx_t colIdx, uint8_t* valueBuffer) {
     auto overflowValue =
         (overflow_value_t*)(valueBuffer + factorizedTable.getTableSchema()->getColOffset(colIdx));
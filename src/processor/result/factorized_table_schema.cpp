@@ -12,6 +12,7 @@ ColumnSchema::ColumnSchema(const ColumnSchema& other) {
     groupID = other.groupID;
     numBytes = other.numBytes;
     mayContainNulls = other.mayContainNulls;
+    compactTableID = other.compactTableID;
 }
 
 FactorizedTableSchema::FactorizedTableSchema(const FactorizedTableSchema& other) {
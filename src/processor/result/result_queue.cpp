@@ -0,0 +1,47 @@
+#include "processor/result/result_queue.h"
+
+namespace kuzu {
+namespace processor {
+
+bool ResultQueue::push(std::shared_ptr<FactorizedTable> table) {
+    std::unique_lock lck{mtx};
+    notFull.wait(lck, [&] { return closed || tables.size() < CAPACITY; });
+    if (closed) {
+        return false;
+    }
+    tables.push_back(std::move(table));
+    notEmpty.notify_one();
+    return true;
+}
+
+std::shared_ptr<FactorizedTable> ResultQueue::pop() {
+    std::unique_lock lck{mtx};
+    notEmpty.wait(lck, [&] { return finished || !tables.empty(); });
+    if (!tables.empty()) {
+        auto table = std::move(tables.front());
+        tables.pop_front();
+        notFull.notify_one();
+        return table;
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    return nullptr;
+}
+
+void ResultQueue::finish(std::exception_ptr exception_) {
+    std::unique_lock lck{mtx};
+    finished = true;
+    exception = std::move(exception_);
+    notEmpty.notify_all();
+}
+
+void ResultQueue::close() {
+    std::unique_lock lck{mtx};
+    closed = true;
+    tables.clear();
+    notFull.notify_all();
+}
+
+} // namespace processor
+} // namespace kuzu
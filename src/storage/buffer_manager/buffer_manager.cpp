@@ -10,6 +10,7 @@
 #include "common/exception/buffer_manager.h"
 #include "common/file_system/local_file_system.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/metric.h"
 #include "common/types/types.h"
 #include "main/db_config.h"
 #include "storage/buffer_manager/spiller.h"
@@ -127,6 +128,7 @@ void BufferManager::verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize
 // both get access to the same piece of memory.
 uint8_t* BufferManager::pin(FileHandle& fileHandle, page_idx_t pageIdx,
     PageReadPolicy pageReadPolicy) {
+    ThreadMetrics::get().numPins++;
     auto pageState = fileHandle.getPageState(pageIdx);
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
@@ -410,6 +412,7 @@ uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate)
     releaseFrameForPage(fileHandle, candidate.pageIdx);
     pageState.resetToEvicted();
     evictionQueue.clear(_candidate);
+    ThreadMetrics::get().numEvictions++;
     return numBytesFreed;
 }
 
@@ -421,10 +424,12 @@ void BufferManager::cachePageIntoFrame(FileHandle& fileHandle, page_idx_t pageId
     pageState->allocatePage(fileHandle.getPageSize());
     if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
         fileHandle.readPageFromDisk(pageState->getPage(), pageIdx);
+        ThreadMetrics::get().numBytesRead += fileHandle.getPageSize();
     }
 #else
     if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
         fileHandle.readPageFromDisk(getFrame(fileHandle, pageIdx), pageIdx);
+        ThreadMetrics::get().numBytesRead += fileHandle.getPageSize();
     }
 #endif
 }
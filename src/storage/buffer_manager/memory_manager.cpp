@@ -7,6 +7,7 @@
 #include "common/constants.h"
 #include "common/exception/buffer_manager.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/metric.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/file_handle.h"
 
@@ -27,6 +28,7 @@ MemoryBuffer::~MemoryBuffer() {
 
 void MemoryBuffer::setSpilledToDisk(uint64_t filePosition) {
     std::free(buffer.data());
+    ThreadMetrics::get().freeMemory(buffer.size());
     // reinterpret_cast isn't allowed here, but we shouldn't leave the invalid pointer and
     // still want to store the size
     buffer = std::span<uint8_t>((uint8_t*)nullptr, buffer.size());
@@ -53,6 +55,7 @@ std::span<uint8_t> MemoryManager::mallocBufferInternal(bool initializeToZero, ui
     }
     void* buffer = nullptr;
     bm->nonEvictableMemory += size;
+    ThreadMetrics::get().allocateMemory(size);
     if (initializeToZero) {
         buffer = calloc(size, 1);
     } else {
@@ -81,6 +84,7 @@ std::unique_ptr<MemoryBuffer> MemoryManager::allocateBuffer(bool initializeToZer
         }
     }
     auto buffer = bm->pin(*fh, pageIdx, PageReadPolicy::DONT_READ_PAGE);
+    ThreadMetrics::get().allocateMemory(pageSize);
     auto memoryBuffer = std::make_unique<MemoryBuffer>(this, pageIdx, buffer);
     if (initializeToZero) {
         memset(memoryBuffer->getBuffer().data(), 0, pageSize);
@@ -89,6 +93,7 @@ std::unique_ptr<MemoryBuffer> MemoryManager::allocateBuffer(bool initializeToZer
 }
 
 void MemoryManager::freeBlock(page_idx_t pageIdx, std::span<uint8_t> buffer) {
+    ThreadMetrics::get().freeMemory(buffer.size());
     if (pageIdx == INVALID_PAGE_IDX) {
         std::free(buffer.data());
         bm->freeUsedMemory(buffer.size());
@@ -5,6 +5,7 @@
 
 #include "common/assert.h"
 #include "common/exception/io.h"
+#include "common/metric.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/types/types.h"
 #include "storage/file_handle.h"
@@ -66,6 +67,7 @@ uint64_t Spiller::spillToDisk(ColumnChunkData& chunk) const {
     auto startPage = dataFH->addNewPages(numPages);
     dataFH->writePagesToFile(buffer.buffer.data(), buffer.buffer.size_bytes(), startPage);
     buffer.setSpilledToDisk(startPage * pageSize);
+    common::ThreadMetrics::get().numBytesSpilled += buffer.buffer.size();
     return buffer.buffer.size();
 }
 
@@ -75,6 +77,7 @@ void Spiller::loadFromDisk(ColumnChunkData& chunk) const {
         buffer.prepareLoadFromDisk();
         dataFH->getFileInfo()->readFromFile(buffer.buffer.data(), buffer.buffer.size(),
             buffer.filePosition);
+        common::ThreadMetrics::get().numBytesRead += buffer.buffer.size();
     }
 }
 
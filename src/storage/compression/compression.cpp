@@ -832,6 +832,89 @@ void IntegerBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t
     }
 }
 
+// Sets selected[i] to whether values[i] is in [lower, upper], which must not be empty. Values are
+// compared as unsigned distances from lower, so each value is checked without branches.
+template<std::integral T>
+static void selectInRange(const T* values, uint64_t numValues, T lower, T upper,
+    uint8_t* selected) {
+    using U = std::make_unsigned_t<T>;
+    KU_ASSERT(lower <= upper);
+    const auto range = static_cast<U>(static_cast<U>(upper) - static_cast<U>(lower));
+    for (auto i = 0u; i < numValues; i++) {
+        selected[i] = static_cast<U>(static_cast<U>(values[i]) - static_cast<U>(lower)) <= range;
+    }
+}
+
+template<IntegerBitpackingType T>
+void IntegerBitpacking<T>::selectFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata, T lower, T upper, uint8_t* selected) const
+    requires std::integral<T>
+{
+    auto info = getPackingInfo(metadata);
+    auto values = reinterpret_cast<T*>(dstBuffer);
+    // Without negative values, unpacked values are unsigned offsets from info.offset, so the range
+    // is shifted by the offset instead of adding the offset to values before comparing them.
+    const auto comparePacked = !info.hasNegative;
+    auto isPackedRangeEmpty = false;
+    U packedLower = 0, packedUpper = 0;
+    if (comparePacked) {
+        if (upper < info.offset) {
+            isPackedRangeEmpty = true;
+        } else {
+            packedLower = lower <= info.offset ? 0 : static_cast<U>(lower - info.offset);
+            packedUpper = static_cast<U>(upper - info.offset);
+        }
+    }
+
+    auto srcCursor = getChunkStart(srcBuffer, srcOffset, info.bitWidth);
+    auto valuesInFirstChunk = std::min(CHUNK_SIZE - (srcOffset % CHUNK_SIZE), numValues);
+    auto bytesPerChunk = CHUNK_SIZE / 8 * info.bitWidth;
+    auto dstIndex = dstOffset;
+
+    // Values which aren't aligned to the start of the chunk are compared after decompressing them.
+    if (valuesInFirstChunk < CHUNK_SIZE) {
+        getValues(srcCursor, srcOffset % CHUNK_SIZE, dstBuffer + dstIndex * sizeof(U),
+            valuesInFirstChunk, info);
+        selectInRange(values + dstIndex, valuesInFirstChunk, lower, upper, selected);
+        if (numValues == valuesInFirstChunk) {
+            return;
+        }
+        srcCursor += bytesPerChunk;
+        dstIndex += valuesInFirstChunk;
+    }
+
+    for (; dstIndex + CHUNK_SIZE <= dstOffset + numValues; dstIndex += CHUNK_SIZE) {
+        auto selectedInChunk = selected + (dstIndex - dstOffset);
+        fastunpack(srcCursor, (U*)dstBuffer + dstIndex, info.bitWidth);
+        if (comparePacked) {
+            if (isPackedRangeEmpty) {
+                memset(selectedInChunk, 0, CHUNK_SIZE);
+            } else {
+                selectInRange((U*)dstBuffer + dstIndex, CHUNK_SIZE, packedLower, packedUpper,
+                    selectedInChunk);
+            }
+        } else if (info.bitWidth > 0) {
+            SignExtend<T, U, CHUNK_SIZE>(dstBuffer + dstIndex * sizeof(U), info.bitWidth);
+        }
+        if (info.offset != 0) {
+            for (auto i = 0u; i < CHUNK_SIZE; i++) {
+                values[dstIndex + i] += info.offset;
+            }
+        }
+        if (!comparePacked) {
+            selectInRange(values + dstIndex, CHUNK_SIZE, lower, upper, selectedInChunk);
+        }
+        srcCursor += bytesPerChunk;
+    }
+    if (dstIndex < dstOffset + numValues) {
+        getValues(srcCursor, 0, dstBuffer + dstIndex * sizeof(U), dstOffset + numValues - dstIndex,
+            info);
+        selectInRange(values + dstIndex, dstOffset + numValues - dstIndex, lower, upper,
+            selected + (dstIndex - dstOffset));
+    }
+}
+
 template class IntegerBitpacking<int8_t>;
 template class IntegerBitpacking<int16_t>;
 template class IntegerBitpacking<int32_t>;
@@ -957,6 +1040,42 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
     }
 }
 
+void SelectCompressedValuesFromPageToVector::operator()(const uint8_t* frame,
+    PageCursor& pageCursor, common::ValueVector* resultVector, uint32_t posInVector,
+    uint64_t numValuesToRead, const CompressionMetadata& metadata) {
+    TypeUtils::visit(
+        physicalType,
+        [&]<std::integral T>(T)
+            requires(!std::same_as<T, bool>)
+        {
+            const auto typedLower = lower.get<T>();
+            const auto typedUpper = upper.get<T>();
+            switch (metadata.compression) {
+            case CompressionType::CONSTANT: {
+                constant.decompressFromPage(frame, pageCursor.elemPosInPage,
+                    resultVector->getData(), posInVector, numValuesToRead, metadata);
+                const auto value = metadata.min.get<T>();
+                memset(selected + posInVector, value >= typedLower && value <= typedUpper,
+                    numValuesToRead);
+            } break;
+            case CompressionType::UNCOMPRESSED: {
+                uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage,
+                    resultVector->getData(), posInVector, numValuesToRead, metadata);
+                selectInRange(reinterpret_cast<const T*>(resultVector->getData()) + posInVector,
+                    numValuesToRead, typedLower, typedUpper, selected + posInVector);
+            } break;
+            case CompressionType::INTEGER_BITPACKING: {
+                IntegerBitpacking<T>().selectFromPage(frame, pageCursor.elemPosInPage,
+                    resultVector->getData(), posInVector, numValuesToRead, metadata, typedLower,
+                    typedUpper, selected + posInVector);
+            } break;
+            default:
+                KU_UNREACHABLE;
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
 void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor& pageCursor,
     uint8_t* result, uint32_t startPosInResult, uint64_t numValuesToRead,
     const CompressionMetadata& metadata) {
@@ -3,6 +3,7 @@
 #include <cmath>
 
 #include "common/file_system/virtual_file_system.h"
+#include "common/metric.h"
 #include "storage/buffer_manager/buffer_manager.h"
 
 using namespace kuzu::common;
@@ -154,6 +155,7 @@ void FileHandle::flushPageIfDirtyWithoutLock(page_idx_t pageIdx) {
     auto pageState = getPageState(pageIdx);
     if (!isInMemoryMode() && pageState->isDirty()) {
         fileInfo->writeFile(getFrame(pageIdx), getPageSize(), pageIdx * getPageSize());
+        ThreadMetrics::get().numBytesWritten += getPageSize();
         pageState->clearDirtyWithoutLock();
     }
 }
@@ -0,0 +1,170 @@
+#include "storage/index/property_index.h"
+
+#include <algorithm>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/type_utils.h"
+#include "common/vector/value_vector.h"
+#include "function/hash/hash_functions.h"
+#include "storage/store/column_chunk_data.h"
+#include "storage/store/string_chunk_data.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace storage {
+
+template<typename T>
+concept notIndexHashable = !IndexHashable<T>;
+
+static hash_t hashKey(const ValueVector& vector, sel_t pos) {
+    hash_t hash = 0;
+    TypeUtils::visit(
+        vector.dataType.getPhysicalType(),
+        [&]<IndexHashable T>(T) { Hash::operation(vector.getValue<T>(pos), hash); },
+        []<notIndexHashable T>(T) { KU_UNREACHABLE; });
+    return hash;
+}
+
+static hash_t hashKey(const ColumnChunkData& chunkData, offset_t pos) {
+    hash_t hash = 0;
+    TypeUtils::visit(
+        chunkData.getDataType().getPhysicalType(),
+        [&](ku_string_t) {
+            Hash::operation(chunkData.cast<StringChunkData>().getValue<std::string_view>(pos),
+                hash);
+        },
+        [&]<IndexHashable T>(T) { Hash::operation(chunkData.getValue<T>(pos), hash); },
+        []<notIndexHashable T>(T) { KU_UNREACHABLE; });
+    return hash;
+}
+
+uint64_t PropertyIndex::getNumEntries() const {
+    std::unique_lock lck{mtx};
+    return numEntries;
+}
+
+void PropertyIndex::insert(const ValueVector& keyVector, offset_t startOffset) {
+    KU_ASSERT(keyVector.dataType.getPhysicalType() == keyType);
+    auto& selVector = keyVector.state->getSelVector();
+    std::unique_lock lck{mtx};
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (keyVector.isNull(pos)) {
+            continue;
+        }
+        insertNoLock(hashKey(keyVector, pos), startOffset + pos);
+    }
+}
+
+void PropertyIndex::insert(const ValueVector& keyVector, sel_t pos, offset_t offset) {
+    KU_ASSERT(keyVector.dataType.getPhysicalType() == keyType);
+    if (keyVector.isNull(pos)) {
+        return;
+    }
+    const auto hash = hashKey(keyVector, pos);
+    std::unique_lock lck{mtx};
+    insertNoLock(hash, offset);
+}
+
+void PropertyIndex::insert(const ColumnChunkData& chunkData, offset_t startOffset,
+    uint64_t numValues) {
+    KU_ASSERT(chunkData.getDataType().getPhysicalType() == keyType);
+    KU_ASSERT(numValues <= chunkData.getNumValues());
+    std::unique_lock lck{mtx};
+    for (auto i = 0u; i < numValues; i++) {
+        if (chunkData.isNull(i)) {
+            continue;
+        }
+        insertNoLock(hashKey(chunkData, i), startOffset + i);
+    }
+}
+
+std::vector<offset_t> PropertyIndex::lookup(const ValueVector& keyVector, sel_t pos) const {
+    KU_ASSERT(keyVector.dataType.getPhysicalType() == keyType);
+    if (keyVector.isNull(pos)) {
+        return {};
+    }
+    const auto hash = hashKey(keyVector, pos);
+    std::vector<offset_t> result;
+    {
+        std::unique_lock lck{mtx};
+        const auto it = offsets.find(hash);
+        if (it == offsets.end()) {
+            return result;
+        }
+        result = it->second;
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+void PropertyIndex::clear() {
+    std::unique_lock lck{mtx};
+    offsets.clear();
+    numEntries = 0;
+}
+
+void PropertyIndex::serialize(Serializer& serializer) const {
+    std::unique_lock lck{mtx};
+    serializer.writeDebuggingInfo("key_type");
+    serializer.write<PhysicalTypeID>(keyType);
+    serializer.writeDebuggingInfo("offsets");
+    serializer.write<uint64_t>(offsets.size());
+    for (auto& [hash, hashOffsets] : offsets) {
+        serializer.write<hash_t>(hash);
+        serializer.serializeVector(hashOffsets);
+    }
+}
+
+std::unique_ptr<PropertyIndex> PropertyIndex::deserialize(Deserializer& deSer) {
+    std::string key;
+    auto keyType = PhysicalTypeID::ANY;
+    uint64_t numHashes = 0;
+    deSer.validateDebuggingInfo(key, "key_type");
+    deSer.deserializeValue<PhysicalTypeID>(keyType);
+    auto propertyIndex = std::make_unique<PropertyIndex>(keyType);
+    deSer.validateDebuggingInfo(key, "offsets");
+    deSer.deserializeValue<uint64_t>(numHashes);
+    propertyIndex->offsets.reserve(numHashes);
+    for (auto i = 0u; i < numHashes; i++) {
+        hash_t hash = 0;
+        std::vector<offset_t> hashOffsets;
+        deSer.deserializeValue<hash_t>(hash);
+        deSer.deserializeVector(hashOffsets);
+        propertyIndex->numEntries += hashOffsets.size();
+        propertyIndex->offsets.emplace(hash, std::move(hashOffsets));
+    }
+    return propertyIndex;
+}
+
+bool PropertyIndex::isSupported(PhysicalTypeID keyType) {
+    switch (keyType) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void PropertyIndex::insertNoLock(hash_t hash, offset_t offset) {
+    offsets[hash].push_back(offset);
+    numEntries++;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -1,5 +1,7 @@
 #include "storage/local_storage/local_storage.h"
 
+#include <algorithm>
+
 #include "main/client_context.h"
 #include "storage/local_storage/local_node_table.h"
 #include "storage/local_storage/local_rel_table.h"
@@ -39,6 +41,12 @@ LocalTable* LocalStorage::getLocalTable(table_id_t tableID, NotExistAction actio
     return tables.at(tableID).get();
 }
 
+void LocalStorage::addWriteListener(std::shared_ptr<NodeTableWriteListener> listener) {
+    if (std::find(writeListeners.begin(), writeListeners.end(), listener) == writeListeners.end()) {
+        writeListeners.push_back(std::move(listener));
+    }
+}
+
 void LocalStorage::commit() {
     for (auto& [tableID, localTable] : tables) {
         if (localTable->getTableType() == TableType::NODE) {
@@ -52,12 +60,18 @@ void LocalStorage::commit() {
             table->commit(clientContext.getTx(), localTable.get());
         }
     }
+    for (auto& listener : writeListeners) {
+        listener->onCommit(clientContext.getTx());
+    }
 }
 
 void LocalStorage::rollback() {
     for (auto& [tableID, localTable] : tables) {
         localTable->clear();
     }
+    for (auto& listener : writeListeners) {
+        listener->onRollback(clientContext.getTx());
+    }
 }
 
 uint64_t LocalStorage::getEstimatedMemUsage() const {
@@ -1,9 +1,18 @@
 #include "storage/predicate/column_predicate.h"
 
 #include "binder/expression/literal_expression.h"
+#include "binder/expression/parameter_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "common/type_utils.h"
+#include "common/types/value/nested.h"
+#include "function/list/vector_list_functions.h"
+#include "function/string/vector_string_functions.h"
+#include "storage/compression/compression.h"
 #include "storage/predicate/constant_predicate.h"
+#include "storage/predicate/equality_predicate.h"
+#include "storage/predicate/in_list_predicate.h"
 #include "storage/predicate/null_predicate.h"
+#include "storage/predicate/prefix_predicate.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -20,6 +29,46 @@ ZoneMapCheckResult ColumnPredicateSet::checkZoneMap(const MergedColumnChunkStats
     return ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
+bool ColumnPredicateSet::canSelectString() const {
+    for (auto& predicate : predicates) {
+        if (predicate->canSelectString()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ColumnPredicateSet::selectString(std::string_view value) const {
+    for (auto& predicate : predicates) {
+        if (predicate->canSelectString() && !predicate->selectString(value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ColumnPredicateSet::getIntegerRange(const LogicalType& columnType, StorageValue& lower,
+    StorageValue& upper) const {
+    auto hasRange = TypeUtils::visit(
+        columnType.getPhysicalType(),
+        [&]<std::integral T>(T)
+            requires(!std::same_as<T, bool>)
+        {
+            lower = StorageValue(std::numeric_limits<T>::min());
+            upper = StorageValue(std::numeric_limits<T>::max());
+            return true;
+        },
+        [](auto) { return false; });
+    if (!hasRange) {
+        return false;
+    }
+    auto isNarrowed = false;
+    for (auto& predicate : predicates) {
+        isNarrowed |= predicate->narrowIntegerRange(columnType, lower, upper);
+    }
+    return isNarrowed;
+}
+
 std::string ColumnPredicateSet::toString() const {
     if (predicates.empty()) {
         return {};
@@ -50,8 +99,39 @@ static bool isColumnOrCastedColumnRef(const Expression& expr) {
     return isColumnRef(expr.expressionType) || isCastedColumnRef(expr);
 }
 
+// Parameters are bound to their values before planning, so they can be treated as literals.
+static bool isConstant(const Expression& expr) {
+    switch (expr.expressionType) {
+    case ExpressionType::LITERAL:
+        return true;
+    case ExpressionType::PARAMETER:
+        return !expr.constCast<ParameterExpression>().getValue().isNull();
+    default:
+        return false;
+    }
+}
+
+static Value getConstantValue(const Expression& expr) {
+    if (expr.expressionType == ExpressionType::PARAMETER) {
+        return expr.constCast<ParameterExpression>().getValue();
+    }
+    return expr.constCast<LiteralExpression>().getValue();
+}
+
 static bool isColumnRefConstantPair(const Expression& left, const Expression& right) {
-    return isColumnOrCastedColumnRef(left) && right.expressionType == ExpressionType::LITERAL;
+    return isColumnOrCastedColumnRef(left) && isConstant(right);
+}
+
+static std::unique_ptr<ColumnPredicate> createConstColumnPredicate(const Expression& column,
+    const Expression& columnRef, ExpressionType expressionType, Value value) {
+    // Bloom filters are built over the stored values, so they only apply if the column is not
+    // casted.
+    if (expressionType == ExpressionType::EQUALS && isColumnRef(columnRef.expressionType) &&
+        !value.isNull()) {
+        return std::make_unique<ColumnEqualityPredicate>(column.toString(), std::move(value));
+    }
+    return std::make_unique<ColumnConstantPredicate>(column.toString(), expressionType,
+        std::move(value));
 }
 
 static bool columnMatchesExprChild(const Expression& column, const Expression& expr) {
@@ -65,23 +145,81 @@ static std::unique_ptr<ColumnPredicate> tryConvertToConstColumnPredicate(const E
             !columnMatchesExprChild(column, *predicate.getChild(0))) {
             return nullptr;
         }
-        auto value = predicate.getChild(1)->constCast<LiteralExpression>().getValue();
-        return std::make_unique<ColumnConstantPredicate>(column.toString(),
-            predicate.expressionType, value);
+        return createConstColumnPredicate(column, *predicate.getChild(0),
+            predicate.expressionType, getConstantValue(*predicate.getChild(1)));
     } else if (isColumnRefConstantPair(*predicate.getChild(1), *predicate.getChild(0))) {
         if (column != *predicate.getChild(1) &&
             !columnMatchesExprChild(column, *predicate.getChild(1))) {
             return nullptr;
         }
-        auto value = predicate.getChild(0)->constCast<LiteralExpression>().getValue();
         auto expressionType =
             ExpressionTypeUtil::reverseComparisonDirection(predicate.expressionType);
-        return std::make_unique<ColumnConstantPredicate>(column.toString(), expressionType, value);
+        return createConstColumnPredicate(column, *predicate.getChild(1), expressionType,
+            getConstantValue(*predicate.getChild(0)));
     }
     // Not a predicate that runs on this property.
     return nullptr;
 }
 
+// x IN [...] is bound as LIST_CONTAINS([...], x).
+static std::unique_ptr<ColumnPredicate> tryConvertToInListPredicate(const Expression& column,
+    const Expression& predicate) {
+    if (predicate.getNumChildren() != 2) {
+        return nullptr;
+    }
+    const auto& list = *predicate.getChild(0);
+    const auto& columnRef = *predicate.getChild(1);
+    if (!isColumnRefConstantPair(columnRef, list)) {
+        return nullptr;
+    }
+    if (column != columnRef && !columnMatchesExprChild(column, columnRef)) {
+        return nullptr;
+    }
+    auto listValue = getConstantValue(list);
+    if (listValue.isNull()) {
+        return nullptr;
+    }
+    std::vector<Value> values;
+    for (auto i = 0u; i < NestedVal::getChildrenSize(&listValue); i++) {
+        values.push_back(*NestedVal::getChildVal(&listValue, i));
+    }
+    return std::make_unique<ColumnInListPredicate>(column.toString(), std::move(values),
+        isColumnRef(columnRef.expressionType));
+}
+
+// x STARTS WITH 'prefix' is bound as STARTS_WITH(x, 'prefix'). Only uncasted columns are converted,
+// since the prefix is matched against the stored strings.
+static std::unique_ptr<ColumnPredicate> tryConvertToPrefixPredicate(const Expression& column,
+    const Expression& predicate) {
+    if (predicate.getNumChildren() != 2) {
+        return nullptr;
+    }
+    const auto& columnRef = *predicate.getChild(0);
+    const auto& prefix = *predicate.getChild(1);
+    if (!isColumnRef(columnRef.expressionType) || !isConstant(prefix) || column != columnRef) {
+        return nullptr;
+    }
+    auto prefixValue = getConstantValue(prefix);
+    if (prefixValue.isNull() ||
+        prefixValue.getDataType().getLogicalTypeID() != LogicalTypeID::STRING) {
+        return nullptr;
+    }
+    return std::make_unique<ColumnPrefixPredicate>(column.toString(),
+        prefixValue.getValue<std::string>());
+}
+
+static std::unique_ptr<ColumnPredicate> tryConvertFunction(const Expression& column,
+    const Expression& predicate) {
+    const auto& functionName = predicate.constCast<ScalarFunctionExpression>().getFunction().name;
+    if (functionName == function::ListContainsFunction::name) {
+        return tryConvertToInListPredicate(column, predicate);
+    }
+    if (functionName == function::StartsWithFunction::name) {
+        return tryConvertToPrefixPredicate(column, predicate);
+    }
+    return nullptr;
+}
+
 static std::unique_ptr<ColumnPredicate> tryConvertToIsNull(const Expression& column,
     const Expression& predicate) {
     // we only convert simple predicates
@@ -110,6 +248,8 @@ std::unique_ptr<ColumnPredicate> ColumnPredicateUtil::tryConvert(const Expressio
         return tryConvertToIsNull(property, predicate);
     case common::ExpressionType::IS_NOT_NULL:
         return tryConvertToIsNotNull(property, predicate);
+    case common::ExpressionType::FUNCTION:
+        return tryConvertFunction(property, predicate);
     default:
         return nullptr;
     }
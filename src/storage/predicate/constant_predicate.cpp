@@ -64,6 +64,11 @@ ZoneMapCheckResult checkZoneMapSwitch(const MergedColumnChunkStats& mergedStats,
 
 ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(
     const MergedColumnChunkStats& stats) const {
+    return checkZoneMap(stats, expressionType, value);
+}
+
+ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(const MergedColumnChunkStats& stats,
+    ExpressionType expressionType, const Value& value) {
     auto physicalType = value.getDataType().getPhysicalType();
     return TypeUtils::visit(
         physicalType,
@@ -71,7 +76,73 @@ ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(
         [&](auto) { return ZoneMapCheckResult::ALWAYS_SCAN; });
 }
 
+template<std::integral T>
+static bool narrowIntegerRangeSwitch(ExpressionType expressionType, T constant, T& lower,
+    T& upper) {
+    static constexpr auto MIN = std::numeric_limits<T>::min();
+    static constexpr auto MAX = std::numeric_limits<T>::max();
+    switch (expressionType) {
+    case ExpressionType::EQUALS: {
+        lower = std::max(lower, constant);
+        upper = std::min(upper, constant);
+    } break;
+    case ExpressionType::GREATER_THAN: {
+        if (constant == MAX) {
+            lower = MAX;
+            upper = MIN;
+        } else {
+            lower = std::max(lower, static_cast<T>(constant + 1));
+        }
+    } break;
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        lower = std::max(lower, constant);
+    } break;
+    case ExpressionType::LESS_THAN: {
+        if (constant == MIN) {
+            lower = MAX;
+            upper = MIN;
+        } else {
+            upper = std::min(upper, static_cast<T>(constant - 1));
+        }
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        upper = std::min(upper, constant);
+    } break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+bool ColumnConstantPredicate::narrowIntegerRange(const LogicalType& columnType,
+    StorageValue& lower, StorageValue& upper) const {
+    // The constant is compared with the stored values, so the column must not be casted.
+    if (value.isNull() || value.getDataType() != columnType) {
+        return false;
+    }
+    return TypeUtils::visit(
+        columnType.getPhysicalType(),
+        [&]<std::integral T>(T)
+            requires(!std::same_as<T, bool>)
+        {
+            auto typedLower = lower.get<T>();
+            auto typedUpper = upper.get<T>();
+            if (!narrowIntegerRangeSwitch<T>(expressionType, value.getValue<T>(), typedLower,
+                    typedUpper)) {
+                return false;
+            }
+            lower = StorageValue(typedLower);
+            upper = StorageValue(typedUpper);
+            return true;
+        },
+        [](auto) { return false; });
+}
+
 std::string ColumnConstantPredicate::toString() {
+    return stringFormat("{} {}", ColumnPredicate::toString(), valueToString(value));
+}
+
+std::string ColumnConstantPredicate::valueToString(const Value& value) {
     std::string valStr;
     if (value.getDataType().getPhysicalType() == PhysicalTypeID::STRING ||
         value.getDataType().getPhysicalType() == PhysicalTypeID::LIST ||
@@ -85,7 +156,7 @@ std::string ColumnConstantPredicate::toString() {
     } else {
         valStr = value.toString();
     }
-    return stringFormat("{} {}", ColumnPredicate::toString(), valStr);
+    return valStr;
 }
 
 } // namespace storage
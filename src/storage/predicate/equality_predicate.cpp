@@ -0,0 +1,22 @@
+#include "storage/predicate/equality_predicate.h"
+
+#include "storage/store/column_chunk_stats.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+ZoneMapCheckResult ColumnEqualityPredicate::checkZoneMap(
+    const MergedColumnChunkStats& stats) const {
+    if (ColumnConstantPredicate::checkZoneMap(stats) == ZoneMapCheckResult::SKIP_SCAN) {
+        return ZoneMapCheckResult::SKIP_SCAN;
+    }
+    if (stats.bloomFilter && !stats.bloomFilter->mayContain(value)) {
+        return ZoneMapCheckResult::SKIP_SCAN;
+    }
+    return ZoneMapCheckResult::ALWAYS_SCAN;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,63 @@
+#include "storage/predicate/in_list_predicate.h"
+
+#include "storage/predicate/constant_predicate.h"
+#include "storage/store/column_chunk_stats.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+ZoneMapCheckResult ColumnInListPredicate::checkZoneMap(const MergedColumnChunkStats& stats) const {
+    for (auto& value : values) {
+        // NULL never matches.
+        if (value.isNull()) {
+            continue;
+        }
+        if (ColumnConstantPredicate::checkZoneMap(stats, ExpressionType::EQUALS, value) ==
+            ZoneMapCheckResult::SKIP_SCAN) {
+            continue;
+        }
+        if (useBloomFilter && stats.bloomFilter && !stats.bloomFilter->mayContain(value)) {
+            continue;
+        }
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    return ZoneMapCheckResult::SKIP_SCAN;
+}
+
+bool ColumnInListPredicate::canSelectString() const {
+    // Like bloom filters, the constants are compared with the stored values.
+    if (!useBloomFilter) {
+        return false;
+    }
+    for (auto& value : values) {
+        if (!value.isNull() && value.getDataType().getLogicalTypeID() != LogicalTypeID::STRING) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ColumnInListPredicate::selectString(std::string_view value) const {
+    for (auto& constant : values) {
+        if (!constant.isNull() && constant.strVal == value) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string ColumnInListPredicate::toString() {
+    std::string result = stringFormat("{} IN [", columnName);
+    for (auto i = 0u; i < values.size(); i++) {
+        if (i > 0) {
+            result += ",";
+        }
+        result += ColumnConstantPredicate::valueToString(values[i]);
+    }
+    return result + "]";
+}
+
+} // namespace storage
+} // namespace kuzu
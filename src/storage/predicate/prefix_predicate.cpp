@@ -0,0 +1,15 @@
+#include "storage/predicate/prefix_predicate.h"
+
+#include "common/string_format.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+std::string ColumnPrefixPredicate::toString() {
+    return stringFormat("{} STARTS WITH '{}'", columnName, prefix);
+}
+
+} // namespace storage
+} // namespace kuzu
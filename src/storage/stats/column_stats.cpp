@@ -1,5 +1,6 @@
 #include "storage/stats/column_stats.h"
 
+#include "common/type_utils.h"
 #include "function/hash/vector_hash_functions.h"
 
 namespace kuzu {
@@ -9,9 +10,23 @@ ColumnStats::ColumnStats(const common::LogicalType& dataType) : hashes{nullptr}
     if (!common::LogicalTypeUtils::isNested(dataType)) {
         hll.emplace();
     }
+    if (Histogram::isSupportedType(dataType.getPhysicalType())) {
+        histogram.emplace();
+    }
 }
 
 void ColumnStats::update(const common::ValueVector* vector) {
+    common::cardinality_t numNonNull = 0;
+    if (vector->dataType.getPhysicalType() == common::PhysicalTypeID::STRING) {
+        vector->forEachNonNull([&](auto pos) {
+            totalStringLength += vector->getValue<common::ku_string_t>(pos).len;
+            numNonNull++;
+        });
+    } else {
+        vector->forEachNonNull([&](auto) { numNonNull++; });
+    }
+    numNonNullValues += numNonNull;
+    numNullValues += vector->state->getSelVector().getSelSize() - numNonNull;
     if (hll) {
         if (!hashes) {
             hashes = std::make_unique<common::ValueVector>(common::LogicalTypeID::UINT64);
@@ -20,12 +35,29 @@ void ColumnStats::update(const common::ValueVector* vector) {
         function::VectorHashFunction::computeHash(*vector, vector->state->getSelVector(), *hashes,
             hashes->state->getSelVector());
         KU_ASSERT(hashes->hasNoNullsGuarantee());
-        for (auto i = 0u; i < hashes->state->getSelVector().getSelSize(); i++) {
-            hll->insertElement(hashes->getValue<common::hash_t>(i));
-        }
+        hashes->state->getSelVector().forEach(
+            [&](auto pos) { hll->insertElement(hashes->getValue<common::hash_t>(pos)); });
+        vector->forEachNonNull(
+            [&](auto pos) { mcv.insert(hashes->getValue<common::hash_t>(pos)); });
         hashes->state = nullptr;
         hashes->setAllNonNull();
     }
+    if (histogram) {
+        updateHistogram(vector);
+    }
+}
+
+void ColumnStats::updateHistogram(const common::ValueVector* vector) {
+    common::TypeUtils::visit(
+        vector->dataType.getPhysicalType(),
+        [&]<typename T>(T)
+            requires(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+        {
+            vector->forEachNonNull([&](auto pos) {
+                histogram->insert(static_cast<double>(vector->getValue<T>(pos)));
+            });
+        },
+        [](auto) { KU_UNREACHABLE; });
 }
 
 } // namespace storage
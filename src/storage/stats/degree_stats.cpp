@@ -0,0 +1,85 @@
+#include "storage/stats/degree_stats.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+void DegreeStats::insert(offset_t boundNodeOffset, uint64_t degree) {
+    if (degree == 0) {
+        return;
+    }
+    numBoundNodes++;
+    numRels += degree;
+    sumOfSquares += static_cast<double>(degree) * static_cast<double>(degree);
+    maxDegree = std::max(maxDegree, degree);
+    buckets[std::min<uint64_t>(std::bit_width(degree) - 1, NUM_BUCKETS - 1)]++;
+    addHeavyHitter(boundNodeOffset, degree);
+}
+
+void DegreeStats::addHeavyHitter(offset_t boundNodeOffset, uint64_t degree) {
+    if (heavyHitters.size() == NUM_HEAVY_HITTERS && heavyHitters.back().second >= degree) {
+        return;
+    }
+    auto it = std::upper_bound(heavyHitters.begin(), heavyHitters.end(), degree,
+        [](uint64_t value, const auto& heavyHitter) { return value > heavyHitter.second; });
+    heavyHitters.insert(it, {boundNodeOffset, degree});
+    if (heavyHitters.size() > NUM_HEAVY_HITTERS) {
+        heavyHitters.pop_back();
+    }
+}
+
+void DegreeStats::merge(const DegreeStats& other) {
+    numBoundNodes += other.numBoundNodes;
+    numRels += other.numRels;
+    sumOfSquares += other.sumOfSquares;
+    maxDegree = std::max(maxDegree, other.maxDegree);
+    for (auto i = 0u; i < NUM_BUCKETS; ++i) {
+        buckets[i] += other.buckets[i];
+    }
+    for (auto& [boundNodeOffset, degree] : other.heavyHitters) {
+        addHeavyHitter(boundNodeOffset, degree);
+    }
+}
+
+void DegreeStats::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("num_bound_nodes");
+    serializer.serializeValue(numBoundNodes);
+    serializer.writeDebuggingInfo("num_rels");
+    serializer.serializeValue(numRels);
+    serializer.writeDebuggingInfo("sum_of_squares");
+    serializer.serializeValue(sumOfSquares);
+    serializer.writeDebuggingInfo("max_degree");
+    serializer.serializeValue(maxDegree);
+    serializer.writeDebuggingInfo("buckets");
+    serializer.serializeArray<uint64_t, NUM_BUCKETS>(buckets);
+    serializer.writeDebuggingInfo("heavy_hitters");
+    serializer.serializeVector(heavyHitters);
+}
+
+DegreeStats DegreeStats::deserialize(Deserializer& deserializer) {
+    DegreeStats result;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "num_bound_nodes");
+    deserializer.deserializeValue(result.numBoundNodes);
+    deserializer.validateDebuggingInfo(info, "num_rels");
+    deserializer.deserializeValue(result.numRels);
+    deserializer.validateDebuggingInfo(info, "sum_of_squares");
+    deserializer.deserializeValue(result.sumOfSquares);
+    deserializer.validateDebuggingInfo(info, "max_degree");
+    deserializer.deserializeValue(result.maxDegree);
+    deserializer.validateDebuggingInfo(info, "buckets");
+    deserializer.deserializeArray<uint64_t, NUM_BUCKETS>(result.buckets);
+    deserializer.validateDebuggingInfo(info, "heavy_hitters");
+    deserializer.deserializeVector(result.heavyHitters);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
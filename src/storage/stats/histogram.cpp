@@ -0,0 +1,119 @@
+#include "storage/stats/histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+bool Histogram::isSupportedType(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::DOUBLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void Histogram::merge(const Histogram& other) {
+    if (other.numValues == 0) {
+        return;
+    }
+    auto totalNumValues = numValues + other.numValues;
+    if (sample.size() + other.sample.size() <= SAMPLE_CAPACITY) {
+        sample.insert(sample.end(), other.sample.begin(), other.sample.end());
+        numValues = totalNumValues;
+        return;
+    }
+    // Both samples are uniform over their own values, so the merged sample takes from each in
+    // proportion to the number of values it represents.
+    auto numFromThis = std::min<uint64_t>(sample.size(),
+        std::llround(static_cast<double>(SAMPLE_CAPACITY) * static_cast<double>(numValues) /
+                     static_cast<double>(totalNumValues)));
+    auto numFromOther = std::min<uint64_t>(other.sample.size(), SAMPLE_CAPACITY - numFromThis);
+    // Partial Fisher-Yates shuffles pick the values to keep.
+    auto otherSample = other.sample;
+    for (auto i = 0u; i < numFromThis; ++i) {
+        std::swap(sample[i], sample[i + nextRandom() % (sample.size() - i)]);
+    }
+    for (auto i = 0u; i < numFromOther; ++i) {
+        std::swap(otherSample[i], otherSample[i + nextRandom() % (otherSample.size() - i)]);
+    }
+    sample.resize(numFromThis);
+    sample.insert(sample.end(), otherSample.begin(), otherSample.begin() + numFromOther);
+    numValues = totalNumValues;
+}
+
+std::vector<double> Histogram::getBoundaries() const {
+    if (sample.empty()) {
+        return {};
+    }
+    auto sorted = sample;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<double> boundaries;
+    boundaries.reserve(NUM_BUCKETS + 1);
+    for (auto i = 0u; i <= NUM_BUCKETS; ++i) {
+        boundaries.push_back(sorted[(sorted.size() - 1) * i / NUM_BUCKETS]);
+    }
+    return boundaries;
+}
+
+double Histogram::estimateFractionBelow(double value, bool inclusive) const {
+    auto boundaries = getBoundaries();
+    if (boundaries.empty()) {
+        return 0;
+    }
+    // Boundaries up to idx are below the value. Values are assumed to be spread uniformly within
+    // the bucket containing the value.
+    auto it = inclusive ? std::upper_bound(boundaries.begin(), boundaries.end(), value) :
+                          std::lower_bound(boundaries.begin(), boundaries.end(), value);
+    auto idx = it - boundaries.begin();
+    if (idx == 0) {
+        return 0;
+    }
+    if (idx == (int64_t)boundaries.size()) {
+        return 1;
+    }
+    auto low = boundaries[idx - 1];
+    auto high = boundaries[idx];
+    auto fractionInBucket = high > low ? (value - low) / (high - low) : 0;
+    return (static_cast<double>(idx - 1) + fractionInBucket) / NUM_BUCKETS;
+}
+
+void Histogram::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("num_values");
+    serializer.serializeValue(numValues);
+    serializer.writeDebuggingInfo("random_state");
+    serializer.serializeValue(randomState);
+    serializer.writeDebuggingInfo("sample");
+    serializer.serializeVector(sample);
+}
+
+Histogram Histogram::deserialize(Deserializer& deserializer) {
+    Histogram result;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "num_values");
+    deserializer.deserializeValue(result.numValues);
+    deserializer.validateDebuggingInfo(info, "random_state");
+    deserializer.deserializeValue(result.randomState);
+    deserializer.validateDebuggingInfo(info, "sample");
+    deserializer.deserializeVector(result.sample);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,87 @@
+#include "storage/stats/most_common_values.h"
+
+#include <algorithm>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+namespace kuzu {
+namespace storage {
+
+void MostCommonValues::decrementAll(uint64_t count) {
+    for (auto it = counts.begin(); it != counts.end();) {
+        if (it->second <= count) {
+            it = counts.erase(it);
+        } else {
+            it->second -= count;
+            ++it;
+        }
+    }
+}
+
+void MostCommonValues::merge(const MostCommonValues& other) {
+    numValues += other.numValues;
+    for (auto& [hash, count] : other.counts) {
+        counts[hash] += count;
+    }
+    if (counts.size() <= CAPACITY) {
+        return;
+    }
+    // Subtracting the (CAPACITY + 1)-th largest count keeps at most CAPACITY entries.
+    auto sortedCounts = getCounts();
+    decrementAll(sortedCounts[CAPACITY]);
+}
+
+std::vector<uint64_t> MostCommonValues::getCounts() const {
+    std::vector<uint64_t> result;
+    result.reserve(counts.size());
+    for (auto& [_, count] : counts) {
+        result.push_back(count);
+    }
+    std::sort(result.begin(), result.end(), std::greater{});
+    return result;
+}
+
+uint64_t MostCommonValues::getSumOfCounts() const {
+    uint64_t sum = 0;
+    for (auto& [_, count] : counts) {
+        sum += count;
+    }
+    return sum;
+}
+
+void MostCommonValues::serialize(common::Serializer& serializer) const {
+    serializer.writeDebuggingInfo("num_values");
+    serializer.serializeValue(numValues);
+    std::vector<common::hash_t> hashes;
+    std::vector<uint64_t> hashCounts;
+    for (auto& [hash, count] : counts) {
+        hashes.push_back(hash);
+        hashCounts.push_back(count);
+    }
+    serializer.writeDebuggingInfo("hashes");
+    serializer.serializeVector(hashes);
+    serializer.writeDebuggingInfo("counts");
+    serializer.serializeVector(hashCounts);
+}
+
+MostCommonValues MostCommonValues::deserialize(common::Deserializer& deserializer) {
+    MostCommonValues result;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "num_values");
+    deserializer.deserializeValue(result.numValues);
+    std::vector<common::hash_t> hashes;
+    std::vector<uint64_t> hashCounts;
+    deserializer.validateDebuggingInfo(info, "hashes");
+    deserializer.deserializeVector(hashes);
+    deserializer.validateDebuggingInfo(info, "counts");
+    deserializer.deserializeVector(hashCounts);
+    KU_ASSERT(hashes.size() == hashCounts.size());
+    for (auto i = 0u; i < hashes.size(); ++i) {
+        result.counts.emplace(hashes[i], hashCounts[i]);
+    }
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -6,13 +6,15 @@
 namespace kuzu {
 namespace storage {
 
-TableStats::TableStats(std::span<const common::LogicalType> dataTypes) : cardinality{0} {
+TableStats::TableStats(std::span<const common::LogicalType> dataTypes)
+    : cardinality{0}, numSampledRows{0} {
     for (const auto& dataType : dataTypes) {
         columnStats.emplace_back(dataType);
     }
 }
 
-TableStats::TableStats(const TableStats& other) : cardinality{other.cardinality} {
+TableStats::TableStats(const TableStats& other)
+    : cardinality{other.cardinality}, numSampledRows{other.numSampledRows} {
     columnStats.reserve(other.columnStats.size());
     for (auto i = 0u; i < other.columnStats.size(); ++i) {
         columnStats.emplace_back(other.columnStats[i].copy());
@@ -31,11 +33,31 @@ void TableStats::update(const std::vector<common::ValueVector*>& vectors, size_t
         KU_ASSERT(vectors[i]->state->getSelVector().getSelSize() == numValues);
     }
     incrementCardinality(numValues);
+    numSampledRows += numValues;
+}
+
+common::cardinality_t TableStats::getNumDistinctValues(common::column_id_t columnID) const {
+    KU_ASSERT(columnID < columnStats.size());
+    auto numDistinctValues = columnStats[columnID].getNumDistinctValues();
+    if (numSampledRows == 0 || numSampledRows >= cardinality) {
+        return numDistinctValues;
+    }
+    // Columns whose values were (almost) all distinct in the sample are assumed to stay distinct
+    // in the rest of the table, while the values of other columns are assumed to have all been
+    // seen already.
+    if (static_cast<double>(numDistinctValues) >= 0.9 * static_cast<double>(numSampledRows)) {
+        return static_cast<common::cardinality_t>(static_cast<double>(numDistinctValues) *
+                                                  static_cast<double>(cardinality) /
+                                                  static_cast<double>(numSampledRows));
+    }
+    return numDistinctValues;
 }
 
 void TableStats::serialize(common::Serializer& serializer) const {
     serializer.writeDebuggingInfo("cardinality");
     serializer.write(cardinality);
+    serializer.writeDebuggingInfo("num_sampled_rows");
+    serializer.write(numSampledRows);
     serializer.writeDebuggingInfo("column_stats");
     serializer.serializeVector(columnStats);
 }
@@ -44,6 +66,8 @@ TableStats TableStats::deserialize(common::Deserializer& deserializer) {
     std::string info;
     deserializer.validateDebuggingInfo(info, "cardinality");
     deserializer.deserializeValue<common::cardinality_t>(cardinality);
+    deserializer.validateDebuggingInfo(info, "num_sampled_rows");
+    deserializer.deserializeValue<common::cardinality_t>(numSampledRows);
     deserializer.validateDebuggingInfo(info, "column_stats");
     deserializer.deserializeVector(columnStats);
     return *this;
@@ -1,6 +1,7 @@
 #include "storage/storage_manager.h"
 
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "common/file_system/virtual_file_system.h"
 #include "main/client_context.h"
@@ -66,6 +67,20 @@ void StorageManager::loadTables(const Catalog& catalog, VirtualFileSystem* vfs,
             }
         }
     }
+    // Property indexes are serialized with their tables. Indexes missing from the table data are
+    // built from the loaded tables.
+    for (const auto tableEntry : catalog.getNodeTableEntries(&DUMMY_TRANSACTION)) {
+        if (!tables.contains(tableEntry->getTableID())) {
+            continue;
+        }
+        for (const auto indexEntry :
+            catalog.getIndexEntries(&DUMMY_TRANSACTION, tableEntry->getTableID())) {
+            if (indexEntry->getType() == CatalogEntryType::PROPERTY_INDEX_ENTRY) {
+                createPropertyIndex(catalog, &DUMMY_TRANSACTION,
+                    indexEntry->constCast<PropertyIndexCatalogEntry>());
+            }
+        }
+    }
 }
 
 void StorageManager::recover(main::ClientContext& clientContext) {
@@ -133,6 +148,14 @@ void StorageManager::createTable(table_id_t tableID, const Catalog* catalog,
     }
 }
 
+void StorageManager::createPropertyIndex(const Catalog& catalog, const Transaction* transaction,
+    const PropertyIndexCatalogEntry& indexEntry) {
+    const auto tableEntry = catalog.getTableCatalogEntry(transaction, indexEntry.getTableID());
+    KU_ASSERT(tables.contains(indexEntry.getTableID()));
+    auto& nodeTable = tables.at(indexEntry.getTableID())->cast<NodeTable>();
+    nodeTable.addPropertyIndex(tableEntry->getColumnID(indexEntry.getPropertyName()));
+}
+
 PrimaryKeyIndex* StorageManager::getPKIndex(table_id_t tableID) {
     std::lock_guard lck{mtx};
     KU_ASSERT(tables.contains(tableID));
@@ -175,7 +198,17 @@ void StorageManager::checkpoint(main::ClientContext& clientContext) {
                 stringFormat("Checkpoint failed: table {} not found in storage manager.",
                     tableEntry->getName()));
         }
-        tables.at(tableEntry->getTableID())->checkpoint(ser, tableEntry);
+        auto& nodeTable = tables.at(tableEntry->getTableID())->cast<NodeTable>();
+        std::vector<column_id_t> indexedColumnIDs;
+        for (const auto indexEntry : clientContext.getCatalog()->getIndexEntries(
+                 &DUMMY_CHECKPOINT_TRANSACTION, tableEntry->getTableID())) {
+            if (indexEntry->getType() == CatalogEntryType::PROPERTY_INDEX_ENTRY) {
+                indexedColumnIDs.push_back(tableEntry->getColumnID(
+                    indexEntry->constCast<PropertyIndexCatalogEntry>().getPropertyName()));
+            }
+        }
+        nodeTable.checkpointPropertyIndexes(indexedColumnIDs);
+        nodeTable.checkpoint(ser, tableEntry);
     }
     for (const auto tableEntry : relTableEntries) {
         if (!tables.contains(tableEntry->getTableID())) {
@@ -215,13 +215,14 @@ static ZoneMapCheckResult getZoneMapResult(const Transaction* transaction,
     return common::ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
-void ChunkedNodeGroup::scan(const Transaction* transaction, const TableScanState& scanState,
+void ChunkedNodeGroup::scan(const Transaction* transaction, TableScanState& scanState,
     const NodeGroupScanState& nodeGroupScanState, offset_t rowIdxInGroup,
     length_t numRowsToScan) const {
     KU_ASSERT(rowIdxInGroup + numRowsToScan <= numRows);
     auto& anchorSelVector = scanState.outState->getSelVectorUnsafe();
     if (getZoneMapResult(transaction, scanState, chunks) == common::ZoneMapCheckResult::SKIP_SCAN) {
         anchorSelVector.setToFiltered(0);
+        scanState.numRowsSkippedByZoneMap += numRowsToScan;
         return;
     }
 
@@ -232,9 +233,31 @@ void ChunkedNodeGroup::scan(const Transaction* transaction, const TableScanState
         anchorSelVector.setToUnfiltered(numRowsToScan);
     }
 
+    // Columns with predicates are scanned first, so that rows they filter out are not scanned from
+    // the other columns.
+    std::vector<bool> isScanned(scanState.columnIDs.size(), false);
+    for (auto i = 0u; i < scanState.columnPredicateSets.size(); i++) {
+        if (anchorSelVector.getSelSize() == 0) {
+            return;
+        }
+        KU_ASSERT(i < scanState.columnIDs.size());
+        const auto columnID = scanState.columnIDs[i];
+        if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID ||
+            scanState.columnPredicateSets[i].isEmpty()) {
+            continue;
+        }
+        KU_ASSERT(columnID < chunks.size());
+        chunks[columnID]->scanAndSelect(transaction, nodeGroupScanState.chunkStates[i],
+            *scanState.outputVectors[i], rowIdxInGroup, numRowsToScan,
+            scanState.columnPredicateSets[i]);
+        isScanned[i] = true;
+    }
     if (anchorSelVector.getSelSize() > 0) {
         for (auto i = 0u; i < scanState.columnIDs.size(); i++) {
             const auto columnID = scanState.columnIDs[i];
+            if (isScanned[i]) {
+                continue;
+            }
             if (columnID == INVALID_COLUMN_ID) {
                 scanState.outputVectors[i]->setAllNull();
                 continue;
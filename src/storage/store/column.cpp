@@ -10,6 +10,7 @@
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/compression/compression.h"
 #include "storage/file_handle.h"
+#include "storage/predicate/column_predicate.h"
 #include "storage/storage_utils.h"
 #include "storage/store/column_chunk.h"
 #include "storage/store/column_chunk_data.h"
@@ -240,42 +241,86 @@ void Column::scan(const Transaction* transaction, const ChunkState& state,
         endOffsetInGroup, readToPageFunc);
 }
 
+namespace {
+
+// Skips pages without selected positions.
+struct Filterer {
+    explicit Filterer(const SelectionVector& selVector) : selVector(selVector), posInSelVector(0) {}
+    bool operator()(offset_t startIdx, offset_t endIdx) {
+        while (posInSelVector < selVector.getSelSize() && selVector[posInSelVector] < startIdx) {
+            posInSelVector++;
+        }
+        return posInSelVector < selVector.getSelSize() && selVector[posInSelVector] < endIdx;
+    }
+
+    const SelectionVector& selVector;
+    offset_t posInSelVector;
+};
+
+} // namespace
+
 void Column::scanInternal(Transaction* transaction, const ChunkState& state,
     offset_t startOffsetInChunk, row_idx_t numValuesToScan, ValueVector* resultVector) const {
     if (resultVector->state->getSelVector().isUnfiltered()) {
         columnReadWriter->readCompressedValuesToVector(transaction, state, resultVector, 0,
             startOffsetInChunk, startOffsetInChunk + numValuesToScan, readToVectorFunc);
     } else {
-        struct Filterer {
-            explicit Filterer(const SelectionVector& selVector)
-                : selVector(selVector), posInSelVector(0) {}
-            bool operator()(offset_t startIdx, offset_t endIdx) {
-                while (posInSelVector < selVector.getSelSize() &&
-                       selVector[posInSelVector] < startIdx) {
-                    posInSelVector++;
-                }
-                return (posInSelVector < selVector.getSelSize() &&
-                        isInRange(selVector[posInSelVector], startIdx, endIdx));
-            }
-
-            const SelectionVector& selVector;
-            offset_t posInSelVector;
-        };
-
         columnReadWriter->readCompressedValuesToVector(transaction, state, resultVector, 0,
             startOffsetInChunk, startOffsetInChunk + numValuesToScan, readToVectorFunc,
             Filterer{resultVector->state->getSelVector()});
     }
 }
 
+void Column::scanAndSelect(Transaction* transaction, const ChunkState& state,
+    offset_t startOffsetInChunk, row_idx_t numValuesToScan, ValueVector* resultVector,
+    const ColumnPredicateSet& predicates) const {
+    StorageValue lower{}, upper{};
+    if (!predicates.getIntegerRange(dataType, lower, upper)) {
+        scan(transaction, state, startOffsetInChunk, numValuesToScan, resultVector);
+        return;
+    }
+    auto& selVector = resultVector->state->getSelVectorUnsafe();
+    if (lower.gt(upper, dataType.getPhysicalType())) {
+        selVector.setToFiltered(0);
+        return;
+    }
+    if (nullColumn) {
+        KU_ASSERT(state.nullState);
+        nullColumn->scan(transaction, *state.nullState, startOffsetInChunk, numValuesToScan,
+            resultVector);
+    }
+    // Values are compared with the range while they are decompressed. selected is indexed by
+    // position in the result vector.
+    std::vector<uint8_t> selected(numValuesToScan);
+    const read_values_to_vector_func_t selectFunc =
+        SelectCompressedValuesFromPageToVector(dataType, lower, upper, selected.data());
+    std::optional<filter_func_t> filterFunc;
+    if (!selVector.isUnfiltered()) {
+        filterFunc = Filterer{selVector};
+    }
+    columnReadWriter->readCompressedValuesToVector(transaction, state, resultVector, 0,
+        startOffsetInChunk, startOffsetInChunk + numValuesToScan, selectFunc, filterFunc);
+    // Positions are narrowed in place, since each one is read before it can be overwritten.
+    const auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        buffer[numSelected] = pos;
+        numSelected += selected[pos] && !resultVector->isNull(pos);
+    }
+    if (numSelected < selVector.getSelSize()) {
+        selVector.setToFiltered(numSelected);
+    }
+}
+
 void Column::lookupValue(const Transaction* transaction, const ChunkState& state,
     offset_t nodeOffset, ValueVector* resultVector, uint32_t posInVector) const {
     if (nullColumn) {
         nullColumn->lookupValue(transaction, *state.nullState, nodeOffset, resultVector,
             posInVector);
-    }
-    if (resultVector->isNull(posInVector)) {
-        return;
+        if (resultVector->isNull(posInVector)) {
+            return;
+        }
     }
     lookupInternal(transaction, state, nodeOffset, resultVector, posInVector);
 }
@@ -309,6 +354,9 @@ void Column::updateStatistics(ColumnChunkMetadata& metadata, offset_t maxIndex,
         metadata.numValues = maxIndex + 1;
         KU_ASSERT(sanityCheckForWrites(metadata, dataType));
     }
+    // In-place writes can introduce values the bloom filter doesn't cover. It is rebuilt the next
+    // time the chunk is checkpointed out of place.
+    metadata.bloomFilter.reset();
     // Either both or neither should be provided
     KU_ASSERT((!min && !max) || (min && max));
     if (min && max) {
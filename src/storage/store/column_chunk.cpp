@@ -82,6 +82,18 @@ void ColumnChunk::scan(const Transaction* transaction, const ChunkState& state,
     }
 }
 
+void ColumnChunk::scanAndSelect(const Transaction* transaction, const ChunkState& state,
+    ValueVector& output, offset_t offsetInChunk, length_t length,
+    const ColumnPredicateSet& predicates) const {
+    // Updated values are not in the column on disk, so they can't be checked while scanning it.
+    if (getResidencyState() != ResidencyState::ON_DISK || updateInfo) {
+        scan(transaction, state, output, offsetInChunk, length);
+        return;
+    }
+    state.column->scanAndSelect(&DUMMY_TRANSACTION, state, offsetInChunk, length, &output,
+        predicates);
+}
+
 template<ResidencyState SCAN_RESIDENCY_STATE>
 void ColumnChunk::scanCommitted(const Transaction* transaction, ChunkState& chunkState,
     ColumnChunk& output, row_idx_t startRow, row_idx_t numRows) const {
@@ -0,0 +1,117 @@
+#include "storage/store/column_chunk_bloom_filter.h"
+
+#include <bit>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/types/value/value.h"
+#include "function/hash/hash_functions.h"
+#include "storage/store/column_chunk_data.h"
+#include "storage/store/string_chunk_data.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace storage {
+
+static uint64_t getNumWordsForValues(uint64_t numValues) {
+    const auto numBits =
+        std::max<uint64_t>(numValues, 1) * ColumnChunkBloomFilter::NUM_BITS_PER_VALUE;
+    return std::bit_ceil((numBits + 63) / 64);
+}
+
+ColumnChunkBloomFilter::ColumnChunkBloomFilter(PhysicalTypeID physicalType, uint64_t numValues)
+    : physicalType{physicalType} {
+    KU_ASSERT(isSupported(physicalType));
+    words.resize(getNumWordsForValues(numValues), 0);
+}
+
+void ColumnChunkBloomFilter::insert(hash_t hash) {
+    words[getWordIdx(hash)] |= getMask(hash);
+}
+
+bool ColumnChunkBloomFilter::mayContain(hash_t hash) const {
+    const auto mask = getMask(hash);
+    return (words[getWordIdx(hash)] & mask) == mask;
+}
+
+bool ColumnChunkBloomFilter::mayContain(const Value& value) const {
+    if (value.isNull() || value.getDataType().getPhysicalType() != physicalType) {
+        return true;
+    }
+    hash_t hash = 0;
+    switch (physicalType) {
+    case PhysicalTypeID::STRING: {
+        Hash::operation(std::string_view(value.getValue<std::string>()), hash);
+    } break;
+    case PhysicalTypeID::INT128: {
+        Hash::operation(value.getValue<int128_t>(), hash);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    return mayContain(hash);
+}
+
+void ColumnChunkBloomFilter::serialize(Serializer& serializer) const {
+    serializer.write(physicalType);
+    serializer.write<uint64_t>(words.size());
+    serializer.write(reinterpret_cast<const uint8_t*>(words.data()),
+        words.size() * sizeof(uint64_t));
+}
+
+std::shared_ptr<const ColumnChunkBloomFilter> ColumnChunkBloomFilter::deserialize(
+    Deserializer& deserializer) {
+    PhysicalTypeID physicalType{};
+    uint64_t numWords = 0;
+    deserializer.deserializeValue(physicalType);
+    deserializer.deserializeValue(numWords);
+    std::vector<uint64_t> words(numWords);
+    deserializer.read(reinterpret_cast<uint8_t*>(words.data()), numWords * sizeof(uint64_t));
+    return std::shared_ptr<const ColumnChunkBloomFilter>(
+        new ColumnChunkBloomFilter(physicalType, std::move(words)));
+}
+
+bool ColumnChunkBloomFilter::isSupported(PhysicalTypeID physicalType) {
+    // Integers and floats are well served by min/max zone maps, so we only build bloom filters for
+    // types whose values are typically not clustered.
+    switch (physicalType) {
+    case PhysicalTypeID::STRING:
+    case PhysicalTypeID::INT128:
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::shared_ptr<const ColumnChunkBloomFilter> ColumnChunkBloomFilter::build(
+    const ColumnChunkData& chunkData) {
+    const auto physicalType = chunkData.getDataType().getPhysicalType();
+    const auto numValues = chunkData.getNumValues();
+    if (!isSupported(physicalType) || numValues == 0) {
+        return nullptr;
+    }
+    auto bloomFilter = std::make_shared<ColumnChunkBloomFilter>(physicalType, numValues);
+    hash_t hash = 0;
+    for (auto i = 0u; i < numValues; i++) {
+        if (chunkData.isNull(i)) {
+            continue;
+        }
+        switch (physicalType) {
+        case PhysicalTypeID::STRING: {
+            Hash::operation(chunkData.cast<StringChunkData>().getValue<std::string_view>(i), hash);
+        } break;
+        case PhysicalTypeID::INT128: {
+            Hash::operation(chunkData.getValue<int128_t>(i), hash);
+        } break;
+        default:
+            KU_UNREACHABLE;
+        }
+        bloomFilter->insert(hash);
+    }
+    return bloomFilter;
+}
+
+} // namespace storage
+} // namespace kuzu
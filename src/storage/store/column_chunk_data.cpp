@@ -202,8 +202,12 @@ MergedColumnChunkStats ColumnChunkData::getMergedColumnChunkStats() const {
     if (isStorageValueType) {
         stats.update(onDiskMetadata.min, onDiskMetadata.max, physicalType);
     }
-    return MergedColumnChunkStats{stats, !nullData || nullData->haveNoNullsGuaranteed(),
+    MergedColumnChunkStats mergedStats{stats, !nullData || nullData->haveNoNullsGuaranteed(),
         nullData && nullData->haveAllNullsGuaranteed()};
+    if (residencyState == ResidencyState::ON_DISK) {
+        mergedStats.bloomFilter = metadata.bloomFilter;
+    }
+    return mergedStats;
 }
 
 void ColumnChunkData::updateStats(const common::ValueVector* vector,
@@ -290,11 +294,14 @@ void ColumnChunkData::setToOnDisk(const ColumnChunkMetadata& otherMetadata) {
 
 ColumnChunkMetadata ColumnChunkData::flushBuffer(FileHandle* dataFH, page_idx_t startPageIdx,
     const ColumnChunkMetadata& otherMetadata) const {
+    auto flushedMetadata = otherMetadata;
     if (!otherMetadata.compMeta.isConstant() && getBufferSize() != 0) {
         KU_ASSERT(getBufferSize() == getBufferSize(capacity));
-        return flushBufferFunction(buffer->getBuffer(), dataFH, startPageIdx, otherMetadata);
+        flushedMetadata =
+            flushBufferFunction(buffer->getBuffer(), dataFH, startPageIdx, otherMetadata);
     }
-    return otherMetadata;
+    flushedMetadata.bloomFilter = ColumnChunkBloomFilter::build(*this);
+    return flushedMetadata;
 }
 
 uint64_t ColumnChunkData::getBufferSize(uint64_t capacity_) const {
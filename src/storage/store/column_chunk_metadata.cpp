@@ -78,6 +78,10 @@ void ColumnChunkMetadata::serialize(common::Serializer& serializer) const {
     serializer.write(numPages);
     serializer.write(numValues);
     compMeta.serialize(serializer);
+    serializer.write<bool>(bloomFilter != nullptr);
+    if (bloomFilter) {
+        bloomFilter->serialize(serializer);
+    }
 }
 
 ColumnChunkMetadata ColumnChunkMetadata::deserialize(common::Deserializer& deserializer) {
@@ -86,6 +90,11 @@ ColumnChunkMetadata ColumnChunkMetadata::deserialize(common::Deserializer& deser
     deserializer.deserializeValue(ret.numPages);
     deserializer.deserializeValue(ret.numValues);
     ret.compMeta = decltype(ret.compMeta)::deserialize(deserializer);
+    bool hasBloomFilter = false;
+    deserializer.deserializeValue(hasBloomFilter);
+    if (hasBloomFilter) {
+        ret.bloomFilter = ColumnChunkBloomFilter::deserialize(deserializer);
+    }
 
     return ret;
 }
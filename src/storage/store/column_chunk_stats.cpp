@@ -39,6 +39,8 @@ void MergedColumnChunkStats::merge(const MergedColumnChunkStats& o,
     stats.update(o.stats.min, o.stats.max, dataType);
     guaranteedNoNulls = guaranteedNoNulls && o.guaranteedNoNulls;
     guaranteedAllNulls = guaranteedAllNulls && o.guaranteedAllNulls;
+    // Values merged in from other chunks are not covered by our bloom filter.
+    bloomFilter.reset();
 }
 
 } // namespace storage
@@ -256,7 +256,7 @@ NodeGroupScanResult CSRNodeGroup::scanCommittedInMem(const Transaction* transact
 }
 
 NodeGroupScanResult CSRNodeGroup::scanCommittedInMemSequential(const Transaction* transaction,
-    const RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const {
+    RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const {
     const auto startRow =
         nodeGroupScanState.inMemCSRList.rowIndices[0] + nodeGroupScanState.nextRowToScan;
     auto numRows =
@@ -492,6 +492,7 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
         }
     }
     KU_ASSERT(csrState.newHeader->sanityCheck());
+    collectDegreeStats(csrState);
     for (const auto columnID : csrState.columnIDs) {
         checkpointColumn(lock, columnID, csrState, regionsToCheckpoint);
     }
@@ -628,6 +629,47 @@ ChunkCheckpointState CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock
     return ChunkCheckpointState(newChunk->moveData(), leftCSROffset, numRowsInRegion);
 }
 
+void CSRNodeGroup::collectDegreeStats(CSRNodeGroupCheckpointState& csrState) const {
+    DegreeStats degreeStats;
+    const auto& header = *csrState.newHeader;
+    const auto startNodeOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+    for (auto offset = 0u; offset < header.length->getNumValues(); offset++) {
+        degreeStats.insert(startNodeOffset + offset, header.getCSRLength(offset));
+    }
+    csrState.degreeStats[nodeGroupIdx] = std::move(degreeStats);
+}
+
+DegreeStats CSRNodeGroup::computeDegreeStats(CSRNodeGroupCheckpointState& csrState) const {
+    const auto lock = chunkedGroups.lock();
+    std::vector<uint64_t> degrees(StorageConstants::NODE_GROUP_SIZE, 0);
+    if (persistentChunkGroup) {
+        persistentChunkGroup->cast<ChunkedCSRNodeGroup>().scanCSRHeader(*csrState.mm, csrState);
+        const auto& header = *csrState.oldHeader;
+        for (auto offset = 0u; offset < header.length->getNumValues(); offset++) {
+            degrees[offset] = header.getCSRLength(offset);
+        }
+    }
+    if (csrIndex) {
+        for (auto offset = 0u; offset < StorageConstants::NODE_GROUP_SIZE; offset++) {
+            for (const auto row : csrIndex->indices[offset].getRows()) {
+                if (row == INVALID_ROW_IDX) {
+                    continue;
+                }
+                auto [chunkIdx, rowInChunk] =
+                    StorageUtils::getQuotientRemainder(row, ChunkedNodeGroup::CHUNK_CAPACITY);
+                degrees[offset] += !chunkedGroups.getGroup(lock, chunkIdx)
+                                        ->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, rowInChunk);
+            }
+        }
+    }
+    DegreeStats degreeStats;
+    const auto startNodeOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+    for (auto offset = 0u; offset < degrees.size(); offset++) {
+        degreeStats.insert(startNodeOffset + offset, degrees[offset]);
+    }
+    return degreeStats;
+}
+
 void CSRNodeGroup::checkpointCSRHeaderColumns(const CSRNodeGroupCheckpointState& csrState) const {
     std::vector<ChunkCheckpointState> csrOffsetChunkCheckpointStates;
     const auto numNodes = csrState.newHeader->offset->getNumValues();
@@ -759,6 +801,7 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     const auto numNodes = csrIndex->getMaxOffsetWithRels() + 1;
     csrState.newHeader->setNumValues(numNodes);
     populateCSRLengthInMemOnly(lock, numNodes, csrState);
+    collectDegreeStats(csrState);
     const auto rightCSROffsetsOfRegions =
         csrState.newHeader->populateStartCSROffsetsFromLength(true /* leaveGap */);
     csrState.newHeader->populateEndCSROffsetFromStartAndLength();
@@ -5,6 +5,7 @@
 #include "common/types/ku_string.h"
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/predicate/column_predicate.h"
 #include "storage/storage_structure/disk_array_collection.h"
 #include "storage/store/string_column.h"
 #include <bit>
@@ -53,13 +54,14 @@ void DictionaryColumn::scan(const Transaction* transaction, const ChunkState& st
 
 void DictionaryColumn::scan(const Transaction* transaction, const ChunkState& offsetState,
     const ChunkState& dataState, std::vector<std::pair<string_index_t, uint64_t>>& offsetsToScan,
-    ValueVector* resultVector, const ColumnChunkMetadata& indexMeta) const {
+    ValueVector* resultVector, const ColumnChunkMetadata& indexMeta,
+    const ColumnPredicateSet* predicates) const {
     string_index_t firstOffsetToScan = 0, lastOffsetToScan = 0;
     auto comp = [](auto pair1, auto pair2) { return pair1.first < pair2.first; };
     auto duplicationFactor = (double)offsetState.metadata.numValues / indexMeta.numValues;
-    if (duplicationFactor <= 0.5) {
+    if (duplicationFactor <= 0.5 || predicates) {
         // If at least 50% of strings are duplicated, sort the offsets so we can re-use scanned
-        // strings
+        // strings. With predicates, this also evaluates them once per distinct string
         std::sort(offsetsToScan.begin(), offsetsToScan.end(), comp);
         firstOffsetToScan = offsetsToScan.front().first;
         lastOffsetToScan = offsetsToScan.back().first;
@@ -82,20 +84,30 @@ void DictionaryColumn::scan(const Transaction* transaction, const ChunkState& of
     scanOffsets(transaction, offsetState, offsets.data(), firstOffsetToScan, numOffsetsToScan,
         dataState.metadata.numValues);
 
+    uint64_t numSelected = 0;
     for (auto pos = 0u; pos < offsetsToScan.size(); pos++) {
         auto startOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan];
         auto endOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan + 1];
         scanValueToVector(transaction, dataState, startOffset, endOffset, resultVector,
             offsetsToScan[pos].second);
         auto& scannedString = resultVector->getValue<ku_string_t>(offsetsToScan[pos].second);
+        const auto isSelected =
+            !predicates || predicates->selectString(scannedString.getAsStringView());
+        if (isSelected) {
+            offsetsToScan[numSelected++] = offsetsToScan[pos];
+        }
         // For each string which has the same index in the dictionary as the one we scanned,
         // copy the scanned string to its position in the result vector
         while (pos + 1 < offsetsToScan.size() &&
                offsetsToScan[pos + 1].first == offsetsToScan[pos].first) {
             pos++;
-            resultVector->setValue<ku_string_t>(offsetsToScan[pos].second, scannedString);
+            if (isSelected) {
+                resultVector->setValue<ku_string_t>(offsetsToScan[pos].second, scannedString);
+                offsetsToScan[numSelected++] = offsetsToScan[pos];
+            }
         }
     }
+    offsetsToScan.resize(numSelected);
 }
 
 string_index_t DictionaryColumn::append(const DictionaryChunk& dictChunk, ChunkState& state,
@@ -196,8 +196,8 @@ void ListColumn::lookupInternal(const Transaction* transaction, const ChunkState
     const auto listEndOffset = readOffset(transaction, state, offsetInChunk);
     const auto size = readSize(transaction, state, offsetInChunk);
     const auto listStartOffset = listEndOffset - size;
-    const auto offsetInVector =
-        posInVector == 0 ? 0 : resultVector->getValue<offset_t>(posInVector - 1);
+    // Lists are appended to the data vector, positions may be looked up in any order.
+    const auto offsetInVector = ListVector::getDataVectorSize(resultVector);
     resultVector->setValue(posInVector, list_entry_t{offsetInVector, size});
     ListVector::resizeDataVector(resultVector, offsetInVector + size);
     const auto dataVector = ListVector::getDataVector(resultVector);
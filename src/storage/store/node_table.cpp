@@ -214,6 +214,11 @@ NodeTable::NodeTable(const StorageManager* storageManager,
     nodeGroups =
         std::make_unique<NodeGroupCollection>(*memoryManager, getNodeTableColumnTypes(*this),
             enableCompression, storageManager->getDataFH(), deSer, &versionRecordHandler);
+    if (deSer) {
+        std::string key;
+        deSer->validateDebuggingInfo(key, "property_indexes");
+        deSer->deserializeUnorderedMap(propertyIndexes);
+    }
     initializePKIndex(storageManager->getDatabasePath(), nodeTableEntry,
         storageManager->isReadOnly(), vfs, context);
 }
@@ -298,18 +303,20 @@ bool NodeTable::scanInternal(Transaction* transaction, TableScanState& scanState
 }
 
 bool NodeTable::lookup(Transaction* transaction, const TableScanState& scanState) const {
-    KU_ASSERT(scanState.nodeIDVector->state->getSelVector().getSelSize() == 1);
-    const auto nodeIDPos = scanState.nodeIDVector->state->getSelVector()[0];
-    if (scanState.nodeIDVector->isNull(nodeIDPos)) {
-        return false;
+    const auto& selVector = scanState.nodeIDVector->state->getSelVector();
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto nodeIDPos = selVector[i];
+        if (scanState.nodeIDVector->isNull(nodeIDPos)) {
+            return false;
+        }
+        const auto nodeOffset = scanState.nodeIDVector->readNodeOffset(nodeIDPos);
+        offset_t rowIdxInGroup =
+            transaction->isUnCommitted(tableID, nodeOffset) ?
+                transaction->getLocalRowIdx(tableID, nodeOffset) -
+                    StorageUtils::getStartOffsetOfNodeGroup(scanState.nodeGroupIdx) :
+                nodeOffset - StorageUtils::getStartOffsetOfNodeGroup(scanState.nodeGroupIdx);
+        scanState.rowIdxVector->setValue<row_idx_t>(nodeIDPos, rowIdxInGroup);
     }
-    const auto nodeOffset = scanState.nodeIDVector->readNodeOffset(nodeIDPos);
-    offset_t rowIdxInGroup =
-        transaction->isUnCommitted(tableID, nodeOffset) ?
-            transaction->getLocalRowIdx(tableID, nodeOffset) -
-                StorageUtils::getStartOffsetOfNodeGroup(scanState.nodeGroupIdx) :
-            nodeOffset - StorageUtils::getStartOffsetOfNodeGroup(scanState.nodeGroupIdx);
-    scanState.rowIdxVector->setValue<row_idx_t>(nodeIDPos, rowIdxInGroup);
     return scanState.nodeGroup->lookup(transaction, scanState);
 }
 
@@ -357,6 +364,10 @@ void NodeTable::insert(Transaction* transaction, TableInsertState& insertState)
         LocalStorage::NotExistAction::CREATE);
     validatePkNotExists(transaction, (ValueVector*)&nodeInsertState.pkVector);
     localTable->insert(transaction, insertState);
+    for (auto& listener : getWriteListeners(transaction)) {
+        listener->onInsert(transaction,
+            nodeInsertState.nodeIDVector.readNodeOffset(nodeIDSelVector[0]));
+    }
     if (transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
         KU_ASSERT(transaction->getClientContext());
@@ -399,6 +410,14 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
         nodeGroups->getNodeGroup(nodeGroupIdx)
             ->update(transaction, rowIdxInGroup, nodeUpdateState.columnID,
                 nodeUpdateState.propertyVector);
+        // The entry of the previous value is kept, as older transactions may still read it.
+        if (const auto propertyIndex = getPropertyIndex(nodeUpdateState.columnID)) {
+            propertyIndex->insert(nodeUpdateState.propertyVector,
+                nodeUpdateState.propertyVector.state->getSelVector()[0], nodeOffset);
+        }
+    }
+    for (auto& listener : getWriteListeners(transaction)) {
+        listener->onUpdate(transaction, nodeOffset, nodeUpdateState.columnID);
     }
     if (transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
@@ -435,6 +454,9 @@ bool NodeTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
     }
     if (isDeleted) {
         hasChanges = true;
+        for (auto& listener : getWriteListeners(transaction)) {
+            listener->onDelete(transaction, nodeOffset);
+        }
         if (transaction->shouldLogToWAL()) {
             KU_ASSERT(transaction->isWriteTransaction());
             KU_ASSERT(transaction->getClientContext());
@@ -464,7 +486,13 @@ void NodeTable::addColumn(Transaction* transaction, TableAddColumnState& addColu
 std::pair<offset_t, offset_t> NodeTable::appendToLastNodeGroup(Transaction* transaction,
     ChunkedNodeGroup& chunkedGroup) {
     hasChanges = true;
-    return nodeGroups->appendToLastNodeGroupAndFlushWhenFull(transaction, chunkedGroup);
+    const auto [startOffset, numRowsAppended] =
+        nodeGroups->appendToLastNodeGroupAndFlushWhenFull(transaction, chunkedGroup);
+    for (auto& [columnID, propertyIndex] : getPropertyIndexes()) {
+        propertyIndex->insert(chunkedGroup.getColumnChunk(columnID).getData(), startOffset,
+            numRowsAppended);
+    }
+    return {startOffset, numRowsAppended};
 }
 
 common::DataChunk NodeTable::constructDataChunkForPKColumn() const {
@@ -517,7 +545,14 @@ void NodeTable::commit(Transaction* transaction, LocalTable* localTable) {
     // have been deleted.
     scanPKColumn(transaction, pkInserter, localNodeTable.getNodeGroups());
 
-    // 4. Clear local table.
+    // 4. Insert newly inserted tuples into property indexes.
+    const auto indexes = getPropertyIndexes();
+    if (!indexes.empty()) {
+        insertIntoPropertyIndexes(transaction, localNodeTable.getNodeGroups(),
+            TableScanSource::UNCOMMITTED, startNodeOffset, indexes);
+    }
+
+    // 5. Clear local table.
     localTable->clear();
 }
 
@@ -543,6 +578,19 @@ void NodeTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
             checkpointColumnPtrs.push_back(column.get());
         }
 
+        // Property indexes are keyed by column ID, which is vacuumed below.
+        {
+            std::unique_lock lck{propertyIndexesMtx};
+            std::unordered_map<column_id_t, std::unique_ptr<PropertyIndex>>
+                checkpointPropertyIndexes;
+            for (auto i = 0u; i < columnIDs.size(); i++) {
+                if (propertyIndexes.contains(columnIDs[i])) {
+                    checkpointPropertyIndexes[i] = std::move(propertyIndexes.at(columnIDs[i]));
+                }
+            }
+            propertyIndexes = std::move(checkpointPropertyIndexes);
+        }
+
         NodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), *dataFH,
             memoryManager};
         nodeGroups->checkpoint(*memoryManager, state);
@@ -553,6 +601,161 @@ void NodeTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
     serialize(ser);
 }
 
+void NodeTable::addPropertyIndex(column_id_t columnID) {
+    KU_ASSERT(columnID < columns.size());
+    if (hasPropertyIndex(columnID)) {
+        // The index is still maintained, e.g., it was dropped and recreated before a checkpoint.
+        return;
+    }
+    auto propertyIndex =
+        std::make_unique<PropertyIndex>(columns[columnID]->getDataType().getPhysicalType());
+    insertIntoPropertyIndexes(&DUMMY_CHECKPOINT_TRANSACTION, *nodeGroups,
+        TableScanSource::COMMITTED, 0 /* startNodeOffset */, {{columnID, propertyIndex.get()}});
+    std::unique_lock lck{propertyIndexesMtx};
+    propertyIndexes.emplace(columnID, std::move(propertyIndex));
+}
+
+bool NodeTable::hasPropertyIndex(column_id_t columnID) const {
+    return getPropertyIndex(columnID) != nullptr;
+}
+
+std::vector<offset_t> NodeTable::lookupPropertyIndex(const Transaction* transaction,
+    column_id_t columnID, const ValueVector& keyVector, sel_t pos) const {
+    const auto propertyIndex = getPropertyIndex(columnID);
+    if (!propertyIndex) {
+        throw RuntimeException(stringFormat("Column {} of table {} has no property index.",
+            columns[columnID]->getName(), getTableName()));
+    }
+    auto result = propertyIndex->lookup(keyVector, pos);
+    // Nodes appended after the transaction started are not visible to it.
+    const auto minUncommittedOffset = transaction->getMinUncommittedNodeOffset(tableID);
+    std::erase_if(result, [&](offset_t offset) { return offset >= minUncommittedOffset; });
+    if (transaction->getLocalStorage()) {
+        // Nodes in local storage are not indexed until commit, so all of them are candidates.
+        if (const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID,
+                LocalStorage::NotExistAction::RETURN_NULL)) {
+            for (auto i = 0u; i < localTable->getNumTotalRows(); i++) {
+                result.push_back(transaction->getUncommittedOffset(tableID, i));
+            }
+        }
+    }
+    return result;
+}
+
+void NodeTable::checkpointPropertyIndexes(const std::vector<column_id_t>& indexedColumnIDs) {
+    std::unique_lock lck{propertyIndexesMtx};
+    std::erase_if(propertyIndexes, [&](const auto& entry) {
+        return std::find(indexedColumnIDs.begin(), indexedColumnIDs.end(), entry.first) ==
+               indexedColumnIDs.end();
+    });
+    const auto numRows = nodeGroups->getNumTotalRows();
+    for (auto& [columnID, propertyIndex] : propertyIndexes) {
+        // Entries of overwritten, deleted and rolled back values are never removed. Rebuild the
+        // index once they make up the majority of it.
+        if (propertyIndex->getNumEntries() <= 2 * numRows) {
+            continue;
+        }
+        propertyIndex->clear();
+        insertIntoPropertyIndexes(&DUMMY_CHECKPOINT_TRANSACTION, *nodeGroups,
+            TableScanSource::COMMITTED, 0 /* startNodeOffset */, {{columnID, propertyIndex.get()}});
+    }
+}
+
+void NodeTable::addWriteListener(const std::string& name,
+    std::shared_ptr<NodeTableWriteListener> listener) {
+    std::unique_lock lck{writeListenersMtx};
+    std::erase_if(writeListeners, [&](const auto& entry) { return entry.first == name; });
+    writeListeners.emplace_back(name, std::move(listener));
+}
+
+void NodeTable::removeWriteListener(const std::string& name) {
+    std::unique_lock lck{writeListenersMtx};
+    std::erase_if(writeListeners, [&](const auto& entry) { return entry.first == name; });
+}
+
+void NodeTable::notifyBulkAppend(Transaction* transaction, offset_t startOffset,
+    offset_t endOffset) const {
+    if (startOffset == endOffset) {
+        return;
+    }
+    for (auto& listener : getWriteListeners(transaction)) {
+        listener->onBulkAppend(transaction, startOffset, endOffset);
+    }
+}
+
+std::vector<std::shared_ptr<NodeTableWriteListener>> NodeTable::getWriteListeners(
+    const Transaction* transaction) const {
+    std::vector<std::shared_ptr<NodeTableWriteListener>> result;
+    {
+        std::unique_lock lck{writeListenersMtx};
+        for (auto& [_, listener] : writeListeners) {
+            result.push_back(listener);
+        }
+    }
+    // Listeners are notified on commit or rollback through the local storage, so transactions
+    // without one (e.g., dummy ones) cannot notify them.
+    if (!transaction->getLocalStorage()) {
+        return {};
+    }
+    for (auto& listener : result) {
+        transaction->getLocalStorage()->addWriteListener(listener);
+    }
+    return result;
+}
+
+PropertyIndex* NodeTable::getPropertyIndex(column_id_t columnID) const {
+    std::unique_lock lck{propertyIndexesMtx};
+    const auto it = propertyIndexes.find(columnID);
+    return it == propertyIndexes.end() ? nullptr : it->second.get();
+}
+
+std::vector<std::pair<column_id_t, PropertyIndex*>> NodeTable::getPropertyIndexes() const {
+    std::unique_lock lck{propertyIndexesMtx};
+    std::vector<std::pair<column_id_t, PropertyIndex*>> result;
+    for (auto& [columnID, propertyIndex] : propertyIndexes) {
+        result.emplace_back(columnID, propertyIndex.get());
+    }
+    return result;
+}
+
+void NodeTable::insertIntoPropertyIndexes(Transaction* transaction,
+    NodeGroupCollection& nodeGroups_, TableScanSource source, offset_t startNodeOffset,
+    const std::vector<std::pair<column_id_t, PropertyIndex*>>& indexes) {
+    std::vector<column_id_t> columnIDs;
+    std::vector<const Column*> indexedColumns;
+    std::vector<LogicalType> types;
+    for (auto& [columnID, _] : indexes) {
+        columnIDs.push_back(columnID);
+        indexedColumns.push_back(columns[columnID].get());
+        types.push_back(columns[columnID]->getDataType().copy());
+    }
+    auto dataChunk = constructDataChunk(std::move(types));
+    NodeTableScanState scanState{tableID, std::move(columnIDs), std::move(indexedColumns)};
+    for (auto& vector : dataChunk.valueVectors) {
+        scanState.outputVectors.push_back(vector.get());
+    }
+    scanState.outState = dataChunk.state.get();
+    scanState.source = source;
+    auto nodeGroupStartOffset = startNodeOffset;
+    for (auto nodeGroupIdx = 0u; nodeGroupIdx < nodeGroups_.getNumNodeGroups(); nodeGroupIdx++) {
+        const auto nodeGroup = nodeGroups_.getNodeGroup(nodeGroupIdx);
+        scanState.nodeGroup = nodeGroup;
+        scanState.nodeGroupIdx = nodeGroupIdx;
+        nodeGroup->initializeScanState(transaction, scanState);
+        while (true) {
+            const auto scanResult = nodeGroup->scan(transaction, scanState);
+            if (scanResult == NODE_GROUP_SCAN_EMMPTY_RESULT) {
+                break;
+            }
+            for (auto i = 0u; i < indexes.size(); i++) {
+                indexes[i].second->insert(*scanState.outputVectors[i],
+                    nodeGroupStartOffset + scanResult.startRow);
+            }
+        }
+        nodeGroupStartOffset += nodeGroup->getNumRows();
+    }
+}
+
 void NodeTable::rollbackPKIndexInsert(const transaction::Transaction* transaction,
     common::row_idx_t startRow, common::row_idx_t numRows_,
     common::node_group_idx_t nodeGroupIdx_) {
@@ -584,9 +787,47 @@ TableStats NodeTable::getStats(const Transaction* transaction) const {
     return stats;
 }
 
+TableStats NodeTable::computeNodeGroupStats(Transaction* transaction,
+    node_group_idx_t nodeGroupIdx) const {
+    auto types = getNodeTableColumnTypes(*this);
+    TableStats stats{types};
+    std::vector<column_id_t> columnIDs;
+    std::vector<const Column*> scannedColumns;
+    for (auto i = 0u; i < columns.size(); i++) {
+        columnIDs.push_back(i);
+        scannedColumns.push_back(columns[i].get());
+    }
+    auto dataChunk = constructDataChunk(std::move(types));
+    NodeTableScanState scanState{tableID, std::move(columnIDs), std::move(scannedColumns)};
+    std::vector<ValueVector*> vectors;
+    for (auto& vector : dataChunk.valueVectors) {
+        scanState.outputVectors.push_back(vector.get());
+        vectors.push_back(vector.get());
+    }
+    scanState.outState = dataChunk.state.get();
+    scanState.source = TableScanSource::COMMITTED;
+    const auto nodeGroup = nodeGroups->getNodeGroup(nodeGroupIdx);
+    scanState.nodeGroup = nodeGroup;
+    scanState.nodeGroupIdx = nodeGroupIdx;
+    nodeGroup->initializeScanState(transaction, scanState);
+    while (true) {
+        const auto scanResult = nodeGroup->scan(transaction, scanState);
+        if (scanResult == NODE_GROUP_SCAN_EMMPTY_RESULT) {
+            break;
+        }
+        if (dataChunk.state->getSelVector().getSelSize() > 0) {
+            stats.update(vectors);
+        }
+    }
+    return stats;
+}
+
 void NodeTable::serialize(Serializer& serializer) const {
     Table::serialize(serializer);
     nodeGroups->serialize(serializer);
+    std::unique_lock lck{propertyIndexesMtx};
+    serializer.writeDebuggingInfo("property_indexes");
+    serializer.serializeUnorderedMap(propertyIndexes);
 }
 
 bool NodeTable::isVisible(const Transaction* transaction, offset_t offset) const {
@@ -74,6 +74,11 @@ RelTableData::RelTableData(FileHandle* dataFH, MemoryManager* mm, ShadowFile* sh
     // nodeGroups.pushInsertInfo()
     nodeGroups = std::make_unique<NodeGroupCollection>(*mm, getColumnTypes(), enableCompression,
         dataFH, deSer, &persistentVersionRecordHandler);
+    if (deSer) {
+        std::string info;
+        deSer->validateDebuggingInfo(info, "degree_stats");
+        deSer->deserializeVector(degreeStats);
+    }
 }
 
 void RelTableData::initCSRHeaderColumns() {
@@ -270,10 +275,48 @@ void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs) {
     CSRNodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), *dataFH,
         memoryManager, csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
     nodeGroups->checkpoint(*memoryManager, state);
+    for (auto& [nodeGroupIdx, stats] : state.degreeStats) {
+        updateDegreeStats(nodeGroupIdx, stats, true /* replace */);
+    }
+}
+
+DegreeStats RelTableData::computeDegreeStats(node_group_idx_t nodeGroupIdx) const {
+    const auto nodeGroup = getNodeGroup(nodeGroupIdx);
+    if (nodeGroup == nullptr) {
+        return DegreeStats{};
+    }
+    CSRNodeGroupCheckpointState state{{}, {}, *dataFH, memoryManager,
+        csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
+    return nodeGroup->cast<CSRNodeGroup>().computeDegreeStats(state);
+}
+
+DegreeStats RelTableData::getDegreeStats() const {
+    std::unique_lock lck{degreeStatsMtx};
+    DegreeStats result;
+    for (auto& stats : degreeStats) {
+        result.merge(stats);
+    }
+    return result;
+}
+
+void RelTableData::updateDegreeStats(node_group_idx_t nodeGroupIdx, const DegreeStats& stats,
+    bool replace) {
+    std::unique_lock lck{degreeStatsMtx};
+    if (nodeGroupIdx >= degreeStats.size()) {
+        degreeStats.resize(nodeGroupIdx + 1);
+    }
+    if (replace) {
+        degreeStats[nodeGroupIdx] = stats;
+    } else {
+        degreeStats[nodeGroupIdx].merge(stats);
+    }
 }
 
 void RelTableData::serialize(Serializer& serializer) const {
     nodeGroups->serialize(serializer);
+    std::unique_lock lck{degreeStatsMtx};
+    serializer.writeDebuggingInfo("degree_stats");
+    serializer.serializeVector(degreeStats);
 }
 
 const VersionRecordHandler* RelTableData::getVersionRecordHandler(CSRNodeGroupScanSource source) {
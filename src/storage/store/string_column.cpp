@@ -6,6 +6,7 @@
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/compression/compression.h"
+#include "storage/predicate/column_predicate.h"
 #include "storage/store/column.h"
 #include "storage/store/column_chunk.h"
 #include "storage/store/null_column.h"
@@ -88,7 +89,7 @@ void StringColumn::lookupInternal(const Transaction* transaction, const ChunkSta
     string_index_t index = 0;
     indexColumn->scan(transaction, getChildState(state, ChildStateIndex::INDEX), offsetInChunk,
         offsetInChunk + 1, reinterpret_cast<uint8_t*>(&index));
-    std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan(1);
+    std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan;
     offsetsToScan.emplace_back(index, posInVector);
     dictionary.scan(transaction, getChildState(state, ChildStateIndex::OFFSET),
         getChildState(state, ChildStateIndex::DATA), offsetsToScan, resultVector,
@@ -168,16 +169,22 @@ void StringColumn::scanUnfiltered(const Transaction* transaction, const ChunkSta
 
 void StringColumn::scanFiltered(Transaction* transaction, const ChunkState& state,
     offset_t startOffsetInChunk, ValueVector* resultVector) const {
+    const auto& selVector = resultVector->state->getSelVector();
+    if (selVector.getSelSize() == 0) {
+        return;
+    }
+    // Indices are read at once for the range of selected positions, which are sorted.
+    const auto firstPos = selVector[0];
+    const auto numIndices = selVector[selVector.getSelSize() - 1] - firstPos + 1;
+    auto indices = std::make_unique<string_index_t[]>(numIndices);
+    indexColumn->scan(transaction, getChildState(state, ChildStateIndex::INDEX),
+        startOffsetInChunk + firstPos, startOffsetInChunk + firstPos + numIndices,
+        reinterpret_cast<uint8_t*>(indices.get()));
     std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan;
-    for (auto i = 0u; i < resultVector->state->getSelVector().getSelSize(); i++) {
-        const auto pos = resultVector->state->getSelVector()[i];
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
         if (!resultVector->isNull(pos)) {
-            // TODO(bmwinger): optimize index scans by grouping them when adjacent
-            const auto offsetInGroup = startOffsetInChunk + pos;
-            string_index_t index = 0;
-            indexColumn->scan(transaction, getChildState(state, ChildStateIndex::INDEX),
-                offsetInGroup, offsetInGroup + 1, reinterpret_cast<uint8_t*>(&index));
-            offsetsToScan.emplace_back(index, pos);
+            offsetsToScan.emplace_back(indices[pos - firstPos], pos);
         }
     }
 
@@ -190,6 +197,46 @@ void StringColumn::scanFiltered(Transaction* transaction, const ChunkState& stat
         getChildState(state, ChildStateIndex::INDEX).metadata);
 }
 
+void StringColumn::scanAndSelect(Transaction* transaction, const ChunkState& state,
+    offset_t startOffsetInChunk, row_idx_t numValuesToScan, ValueVector* resultVector,
+    const ColumnPredicateSet& predicates) const {
+    if (!predicates.canSelectString()) {
+        Column::scan(transaction, state, startOffsetInChunk, numValuesToScan, resultVector);
+        return;
+    }
+    nullColumn->scan(transaction, *state.nullState, startOffsetInChunk, numValuesToScan,
+        resultVector);
+    auto indices = std::make_unique<string_index_t[]>(numValuesToScan);
+    indexColumn->scan(transaction, getChildState(state, ChildStateIndex::INDEX), startOffsetInChunk,
+        startOffsetInChunk + numValuesToScan, reinterpret_cast<uint8_t*>(indices.get()));
+    auto& selVector = resultVector->state->getSelVectorUnsafe();
+    std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        // Null values don't satisfy any predicate on strings.
+        if (!resultVector->isNull(pos)) {
+            offsetsToScan.emplace_back(indices[pos], pos);
+        }
+    }
+    if (!offsetsToScan.empty()) {
+        // Predicates are evaluated once per dictionary entry, and only strings of selected rows are
+        // written to the result vector.
+        dictionary.scan(transaction, getChildState(state, ChildStateIndex::OFFSET),
+            getChildState(state, ChildStateIndex::DATA), offsetsToScan, resultVector,
+            getChildState(state, ChildStateIndex::INDEX).metadata, &predicates);
+    }
+    if (offsetsToScan.size() == selVector.getSelSize()) {
+        return;
+    }
+    std::sort(offsetsToScan.begin(), offsetsToScan.end(),
+        [](const auto& a, const auto& b) { return a.second < b.second; });
+    auto buffer = selVector.getMutableBuffer();
+    for (auto i = 0u; i < offsetsToScan.size(); i++) {
+        buffer[i] = offsetsToScan[i].second;
+    }
+    selVector.setToFiltered(offsetsToScan.size());
+}
+
 bool StringColumn::canCheckpointInPlace(const ChunkState& state,
     const ColumnCheckpointState& checkpointState) {
     row_idx_t strLenToAdd = 0u;
@@ -1,6 +1,7 @@
 #include "storage/wal_replayer.h"
 
 #include "binder/binder.h"
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
@@ -153,6 +154,17 @@ void WALReplayer::replayCreateCatalogEntryRecord(const WALRecord& walRecord) con
         clientContext.getCatalog()->createType(clientContext.getTx(), typeEntry.getName(),
             typeEntry.getLogicalType().copy());
     } break;
+    case CatalogEntryType::PROPERTY_INDEX_ENTRY: {
+        auto& indexEntry =
+            createEntryRecord.ownedCatalogEntry->constCast<PropertyIndexCatalogEntry>();
+        clientContext.getCatalog()->createIndex(clientContext.getTx(), indexEntry.copy());
+        clientContext.getStorageManager()->createPropertyIndex(*clientContext.getCatalog(),
+            clientContext.getTx(), indexEntry);
+    } break;
+    case CatalogEntryType::INDEX_ENTRY: {
+        auto& indexEntry = createEntryRecord.ownedCatalogEntry->constCast<IndexCatalogEntry>();
+        clientContext.getCatalog()->createIndex(clientContext.getTx(), indexEntry.copy());
+    } break;
     default: {
         KU_UNREACHABLE;
     }
@@ -173,6 +185,10 @@ void WALReplayer::replayDropCatalogEntryRecord(const WALRecord& walRecord) const
     case CatalogEntryType::SEQUENCE_ENTRY: {
         clientContext.getCatalog()->dropSequence(clientContext.getTx(), entryID);
     } break;
+    case CatalogEntryType::INDEX_ENTRY:
+    case CatalogEntryType::PROPERTY_INDEX_ENTRY: {
+        clientContext.getCatalog()->dropIndex(clientContext.getTx(), entryID);
+    } break;
     default: {
         KU_UNREACHABLE;
     }
@@ -1,5 +1,6 @@
 #include "transaction/transaction.h"
 
+#include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/exception/runtime.h"
 #include "main/client_context.h"
@@ -112,7 +113,8 @@ void Transaction::pushCatalogEntry(CatalogSet& catalogSet, CatalogEntry& catalog
         wal->logCreateCatalogEntryRecord(newCatalogEntry);
     } break;
     case CatalogEntryType::SCALAR_MACRO_ENTRY:
-    case CatalogEntryType::TYPE_ENTRY: {
+    case CatalogEntryType::TYPE_ENTRY:
+    case CatalogEntryType::PROPERTY_INDEX_ENTRY: {
         KU_ASSERT(
             catalogEntry.getType() == CatalogEntryType::DUMMY_ENTRY && catalogEntry.isDeleted());
         wal->logCreateCatalogEntryRecord(newCatalogEntry);
@@ -140,9 +142,16 @@ void Transaction::pushCatalogEntry(CatalogSet& catalogSet, CatalogEntry& catalog
             const auto sequenceCatalogEntry = catalogEntry.constPtrCast<SequenceCatalogEntry>();
             wal->logDropCatalogEntryRecord(sequenceCatalogEntry->getOID(), catalogEntry.getType());
         } break;
-        case CatalogEntryType::INDEX_ENTRY:
+        case CatalogEntryType::PROPERTY_INDEX_ENTRY: {
+            wal->logDropCatalogEntryRecord(catalogEntry.getOID(), catalogEntry.getType());
+        } break;
+        case CatalogEntryType::INDEX_ENTRY: {
+            if (catalogEntry.constCast<IndexCatalogEntry>().isPersistent()) {
+                wal->logDropCatalogEntryRecord(catalogEntry.getOID(), catalogEntry.getType());
+            }
+        } break;
         case CatalogEntryType::SCALAR_FUNCTION_ENTRY: {
-            // DO NOTHING. We don't persistent index/function entries.
+            // DO NOTHING. We don't persistent function entries.
         } break;
         case CatalogEntryType::SCALAR_MACRO_ENTRY:
         case CatalogEntryType::TYPE_ENTRY:
@@ -153,9 +162,15 @@ void Transaction::pushCatalogEntry(CatalogSet& catalogSet, CatalogEntry& catalog
         }
         }
     } break;
-    case CatalogEntryType::SCALAR_FUNCTION_ENTRY:
     case CatalogEntryType::INDEX_ENTRY: {
-        // DO NOTHING. We don't persistent function/index entries.
+        KU_ASSERT(
+            catalogEntry.getType() == CatalogEntryType::DUMMY_ENTRY && catalogEntry.isDeleted());
+        if (newCatalogEntry->constCast<IndexCatalogEntry>().isPersistent()) {
+            wal->logCreateCatalogEntryRecord(newCatalogEntry);
+        }
+    } break;
+    case CatalogEntryType::SCALAR_FUNCTION_ENTRY: {
+        // DO NOTHING. We don't persistent function entries.
     } break;
     default: {
         throw common::RuntimeException(
@@ -157,6 +157,35 @@ TEST_F(CApiConnectionTest, QueryTimeout) {
     ASSERT_EQ(kuzu_connection_set_query_timeout(&badConnection, 1), KuzuError);
 }
 
+#ifndef __SINGLE_THREADED__
+TEST_F(CApiConnectionTest, StreamingResults) {
+    kuzu_query_result result;
+    kuzu_flat_tuple tuple;
+    kuzu_value value;
+    auto connection = getConnection();
+    ASSERT_EQ(kuzu_connection_set_streaming_results(connection, true), KuzuSuccess);
+    auto state = kuzu_connection_query(connection, "UNWIND RANGE(1, 10000) AS x RETURN x;", &result);
+    ASSERT_EQ(state, KuzuSuccess);
+    int64_t numTuples = 0, sum = 0;
+    while (kuzu_query_result_has_next(&result)) {
+        ASSERT_EQ(kuzu_query_result_get_next(&result, &tuple), KuzuSuccess);
+        ASSERT_EQ(kuzu_flat_tuple_get_value(&tuple, 0, &value), KuzuSuccess);
+        int64_t x = 0;
+        ASSERT_EQ(kuzu_value_get_int64(&value, &x), KuzuSuccess);
+        sum += x;
+        numTuples++;
+        kuzu_value_destroy(&value);
+        kuzu_flat_tuple_destroy(&tuple);
+    }
+    ASSERT_EQ(numTuples, 10000);
+    ASSERT_EQ(sum, 50005000);
+    kuzu_query_result_destroy(&result);
+    kuzu_connection badConnection;
+    ASSERT_EQ(kuzu_connection_init(nullptr, &badConnection), KuzuError);
+    ASSERT_EQ(kuzu_connection_set_streaming_results(&badConnection, true), KuzuError);
+}
+#endif
+
 #ifndef __SINGLE_THREADED__
 // The following test is disabled in single-threaded mode because it requires
 // a separate thread to run.
@@ -0,0 +1,67 @@
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "function/array/array_distance_kernels.h"
+#include "gtest/gtest.h"
+
+using namespace kuzu::function;
+
+template<typename T>
+static void checkKernelsMatchScalar(T tolerance) {
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<T> distribution{-1, 1};
+    auto& scalarKernels = ArrayDistanceKernels::getKernels<T>(SIMDLevel::SCALAR);
+    for (auto level : {SIMDLevel::NEON, SIMDLevel::AVX2, SIMDLevel::AVX512}) {
+        if (!ArrayDistanceKernels::isSupported(level)) {
+            continue;
+        }
+        auto& kernels = ArrayDistanceKernels::getKernels<T>(level);
+        // Cover empty arrays, arrays shorter than one register and every possible tail length.
+        for (uint64_t numElements : {0, 1, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1537}) {
+            std::vector<T> left(numElements), right(numElements);
+            for (auto i = 0u; i < numElements; i++) {
+                left[i] = distribution(generator);
+                right[i] = distribution(generator);
+            }
+            const auto maxError = tolerance * std::max<T>(1, numElements);
+            EXPECT_NEAR(scalarKernels.innerProduct(left.data(), right.data(), numElements),
+                kernels.innerProduct(left.data(), right.data(), numElements), maxError);
+            EXPECT_NEAR(scalarKernels.squaredDistance(left.data(), right.data(), numElements),
+                kernels.squaredDistance(left.data(), right.data(), numElements), maxError);
+            T expectedProduct = 0, expectedLeftNorm = 0, expectedRightNorm = 0;
+            scalarKernels.cosineTerms(left.data(), right.data(), numElements, expectedProduct,
+                expectedLeftNorm, expectedRightNorm);
+            T product = 0, leftNorm = 0, rightNorm = 0;
+            kernels.cosineTerms(left.data(), right.data(), numElements, product, leftNorm,
+                rightNorm);
+            EXPECT_NEAR(expectedProduct, product, maxError);
+            EXPECT_NEAR(expectedLeftNorm, leftNorm, maxError);
+            EXPECT_NEAR(expectedRightNorm, rightNorm, maxError);
+        }
+    }
+}
+
+TEST(ArrayDistanceKernelsTest, FloatKernelsMatchScalar) {
+    checkKernelsMatchScalar<float>(1e-5);
+}
+
+TEST(ArrayDistanceKernelsTest, DoubleKernelsMatchScalar) {
+    checkKernelsMatchScalar<double>(1e-12);
+}
+
+TEST(ArrayDistanceKernelsTest, ExactOnIntegerValues) {
+    std::vector<double> left, right;
+    for (auto i = 1; i <= 19; i++) {
+        left.push_back(i);
+        right.push_back(20 - i);
+    }
+    auto& kernels = ArrayDistanceKernels::getKernels<double>();
+    EXPECT_EQ(kernels.innerProduct(left.data(), right.data(), left.size()), 1330);
+    EXPECT_EQ(kernels.squaredDistance(left.data(), right.data(), left.size()), 2280);
+    double product = 0, leftNorm = 0, rightNorm = 0;
+    kernels.cosineTerms(left.data(), right.data(), left.size(), product, leftNorm, rightNorm);
+    EXPECT_EQ(product, 1330);
+    EXPECT_EQ(leftNorm, 2470);
+    EXPECT_EQ(rightNorm, 2470);
+}
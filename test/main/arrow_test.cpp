@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "common/exception/runtime.h"
 #include "main_test_helper/main_test_helper.h"
 
@@ -26,3 +28,61 @@ TEST_F(ArrowTest, getArrowSchema) {
     ASSERT_EQ(std::string(schema->children[0]->name), "NAME");
     schema->release(schema.get());
 }
+
+static bool isArrowValueNull(const ArrowArray* array, int64_t idx) {
+    auto validity = (const uint8_t*)array->buffers[0];
+    return validity != nullptr && !(validity[idx >> 3] & (1 << (idx & 7)));
+}
+
+static std::string arrowValueToString(const ArrowArray* array, LogicalTypeID typeID, int64_t idx) {
+    if (isArrowValueNull(array, idx)) {
+        return "";
+    }
+    switch (typeID) {
+    case LogicalTypeID::BOOL: {
+        auto data = (const uint8_t*)array->buffers[1];
+        return (data[idx >> 3] & (1 << (idx & 7))) ? "True" : "False";
+    }
+    case LogicalTypeID::INT64:
+        return std::to_string(((const int64_t*)array->buffers[1])[idx]);
+    case LogicalTypeID::STRING: {
+        auto offsets = (const uint32_t*)array->buffers[1];
+        return std::string((const char*)array->buffers[2] + offsets[idx],
+            offsets[idx + 1] - offsets[idx]);
+    }
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+TEST_F(ArrowTest, getArrowResultColumnByColumn) {
+    // b is scanned unflat, so the tuples of the result have both flat and unflat columns.
+    auto query = "MATCH (a:person)-[:knows]->(b:person) RETURN a.ID, a.fName, a.isStudent, b.ID, "
+                 "CASE WHEN b.ID > 3 THEN b.fName ELSE NULL END";
+    std::vector<LogicalTypeID> typeIDs = {LogicalTypeID::INT64, LogicalTypeID::STRING,
+        LogicalTypeID::BOOL, LogicalTypeID::INT64, LogicalTypeID::STRING};
+    std::vector<std::string> expectedRows;
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess());
+    while (result->hasNext()) {
+        expectedRows.push_back(result->getNext()->toString());
+    }
+    std::vector<std::string> arrowRows;
+    result = conn->query(query);
+    while (result->hasNext()) {
+        auto arrowArray = result->getNextArrowChunk(4);
+        ASSERT_LE(arrowArray->length, 4);
+        for (auto i = 0; i < arrowArray->length; i++) {
+            std::string row;
+            for (auto j = 0u; j < typeIDs.size(); j++) {
+                row += arrowValueToString(arrowArray->children[j], typeIDs[j], i);
+                row += j + 1 < typeIDs.size() ? "|" : "\n";
+            }
+            arrowRows.push_back(row);
+        }
+        arrowArray->release(arrowArray.get());
+    }
+    std::sort(expectedRows.begin(), expectedRows.end());
+    std::sort(arrowRows.begin(), arrowRows.end());
+    ASSERT_EQ(arrowRows, expectedRows);
+}
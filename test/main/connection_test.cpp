@@ -1,6 +1,8 @@
 #include <memory>
 #include <thread>
 
+#include "common/exception/interrupt.h"
+#include "common/exception/runtime.h"
 #include "main/connection.h"
 #include "main/database.h"
 
@@ -96,6 +98,31 @@ TEST_F(ApiTest, Profile) {
     ASSERT_TRUE(result->isSuccess());
 }
 
+TEST_F(ApiTest, ProfileJson) {
+    auto query = "MATCH (a:person)-[:knows]->(b:person) RETURN a.fName, b.fName ORDER BY a.ID";
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_FALSE(result->getQuerySummary()->isProfiled());
+    ASSERT_TRUE(result->getQuerySummary()->getProfileJson().empty());
+    result = conn->query(std::string("PROFILE ") + query);
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_TRUE(result->getQuerySummary()->isProfiled());
+    ASSERT_NE(result->getQuerySummary()->getProfileJson().find("\"Pipelines\""),
+        std::string::npos);
+    ASSERT_TRUE(conn->query("CALL profile_json=true")->isSuccess());
+    result = conn->query(std::string("PROFILE ") + query);
+    ASSERT_TRUE(result->isSuccess());
+    auto profile = result->getNext()->getValue(0)->getValue<std::string>();
+    ASSERT_NE(profile.find("\"PeakMemoryUsage\""), std::string::npos);
+    ASSERT_TRUE(conn->query("CALL profile_sample_rate=1.0")->isSuccess());
+    result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNumTuples(), 14);
+    ASSERT_NE(result->getQuerySummary()->getProfileJson().find("\"NumPins\""),
+        std::string::npos);
+    ASSERT_FALSE(conn->query("CALL profile_sample_rate=2.0")->isSuccess());
+}
+
 TEST_F(ApiTest, TimeOut) {
     conn->setQueryTimeOut(1000 /* timeoutInMS */);
     auto result = conn->query(
@@ -171,3 +198,53 @@ TEST_F(ApiTest, QueryWithHeadingNewline) {
     createDBAndConn();
     ASSERT_TRUE(conn->query("\n PROFILE RETURN 5; \n")->isSuccess());
 }
+
+#ifndef __SINGLE_THREADED__
+TEST_F(ApiTest, StreamingResults) {
+    conn->setStreamingResults(true);
+    auto result = conn->query("UNWIND RANGE(1, 100000) AS x RETURN x;");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_TRUE(result->isStreaming());
+    EXPECT_THROW(result->getNumTuples(), RuntimeException);
+    EXPECT_THROW(result->resetIterator(), RuntimeException);
+    int64_t numTuples = 0, sum = 0;
+    while (result->hasNext()) {
+        sum += result->getNext()->getValue(0)->getValue<int64_t>();
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, 100000);
+    ASSERT_EQ(sum, 5000050000);
+    // Only the last statement of a query is streamed, and only if it is read-only.
+    result = conn->query("MATCH (a:person) RETURN COUNT(*); MATCH (a:person) RETURN a.ID;");
+    ASSERT_FALSE(result->isStreaming());
+    ASSERT_TRUE(result->getNextQueryResult()->isStreaming());
+    result = conn->query("CREATE NODE TABLE Test(ID INT64, PRIMARY KEY(ID));");
+    ASSERT_FALSE(result->isStreaming());
+    ApiTest::assertMatchPersonCountStar(conn.get());
+}
+
+TEST_F(ApiTest, StreamingResultClosedByNextQuery) {
+    conn->setStreamingResults(true);
+    auto result = conn->query("UNWIND RANGE(1, 100000) AS x RETURN x;");
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+    ApiTest::assertMatchPersonCountStar(conn.get());
+    EXPECT_THROW(result->hasNext(), RuntimeException);
+    // An abandoned result ends its transaction when it is destroyed.
+    result = conn->query("UNWIND RANGE(1, 100000) AS x RETURN x;");
+    ASSERT_TRUE(result->hasNext());
+    result.reset();
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE Test(ID INT64, PRIMARY KEY(ID));")->isSuccess());
+}
+
+TEST_F(ApiTest, StreamingResultTimeOut) {
+    conn->setStreamingResults(true);
+    conn->setQueryTimeOut(1000 /* timeoutInMS */);
+    auto result =
+        conn->query("UNWIND RANGE(1,100000) AS x UNWIND RANGE(1, 100000) AS y RETURN x + y;");
+    ASSERT_TRUE(result->isSuccess());
+    EXPECT_THROW(
+        while (result->hasNext()) { result->getNext(); }, InterruptException);
+    ApiTest::assertMatchPersonCountStar(conn.get());
+}
+#endif
@@ -1,5 +1,7 @@
 #include "graph_test/graph_test.h"
+#include "optimizer/logical_operator_collector.h"
 #include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_plan_util.h"
 #include "test_runner/test_runner.h"
 
@@ -18,6 +20,19 @@ public:
     std::unique_ptr<planner::LogicalPlan> getRoot(const std::string& query) {
         return TestRunner::getLogicalPlan(query, *conn);
     }
+    // Returns the operator types of the targets, which do not outlive the plan.
+    std::vector<planner::LogicalOperatorType> getJoinKeyFilterTargets(const std::string& query) {
+        auto plan = getRoot(query);
+        auto collector = optimizer::LogicalHashJoinCollector();
+        collector.collect(plan->getLastOperator().get());
+        std::vector<planner::LogicalOperatorType> targets;
+        for (auto op : collector.getOperators()) {
+            for (auto target : op->constCast<planner::LogicalHashJoin>().getJoinKeyFilterTargets()) {
+                targets.push_back(target->getOperatorType());
+            }
+        }
+        return targets;
+    }
 };
 
 TEST_F(OptimizerTest, JoinHint) {
@@ -144,6 +159,58 @@ TEST_F(OptimizerTest, FilterDifferentPropertiesTest) {
     ASSERT_STREQ(ans.c_str(), "HJ(a._ID){E(a)Filter()S(b)}{Filter()S(a)}");
 }
 
+TEST_F(OptimizerTest, JoinKeyFilterTest) {
+    // Most of the probe side does not match the single person on the build side.
+    auto q1 = "MATCH (a:person), (b:person) WHERE a.age = b.age AND b.ID = 0 RETURN a.fName;";
+    auto targets = getJoinKeyFilterTargets(q1);
+    ASSERT_EQ(targets.size(), 1);
+    ASSERT_EQ(targets[0], planner::LogicalOperatorType::SCAN_NODE_TABLE);
+    auto result = conn->query(q1);
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNumTuples(), 1);
+    // Every probe row is expected to match, so the filter would not drop any.
+    auto q2 = "MATCH (a:person), (b:person) WHERE a.ID = b.ID RETURN a.fName;";
+    ASSERT_TRUE(getJoinKeyFilterTargets(q2).empty());
+    // Node ID joins are left to semi masks.
+    auto q3 = "MATCH (a:person)-[:knows]->(b:person) WHERE b.ID = 0 RETURN a.fName;";
+    ASSERT_TRUE(getJoinKeyFilterTargets(q3).empty());
+}
+
+TEST_F(OptimizerTest, TriangleIntersectTest) {
+    // A worst-case optimal join avoids materializing all 2-paths of the triangle.
+    auto q1 = "MATCH (a:person)-[:knows]->(b:person), (a)-[:knows]->(c:person), (b)-[:knows]->(c) "
+              "RETURN COUNT(*);";
+    ASSERT_STREQ(getEncodedPlan(q1).c_str(), "I(c._ID){E(a)S(b)}{E(c)S(b)}{E(c)S(a)}");
+    // From a single node, extending along the triangle is cheaper than intersecting.
+    auto q2 = "MATCH (a:person)-[:knows]->(b:person)-[:knows]->(c:person), (a)-[:knows]->(c) "
+              "WHERE a.ID = 0 RETURN COUNT(*);";
+    ASSERT_STREQ(getEncodedPlan(q2).c_str(),
+        "HJ(b._ID,c._ID){E(b)S(c)}{E(c)E(b)IndexScan(a)}");
+}
+
+TEST_F(OptimizerTest, TinyProbeExtendTest) {
+    // A few bound nodes are extended directly instead of building a hash table on the rels.
+    auto q1 = "MATCH (a:person)-[:knows]->(b:person) WHERE a.ID = 0 RETURN COUNT(*);";
+    ASSERT_STREQ(getEncodedPlan(q1).c_str(), "E(b)IndexScan(a)");
+    auto q2 = "MATCH (a:person)-[:knows]->(b:person) WHERE a.fName = 'Alice' RETURN COUNT(*);";
+    ASSERT_STREQ(getEncodedPlan(q2).c_str(), "E(b)Filter()S(a)");
+    // Only the extended side is built if properties of the neighbours are needed.
+    auto q3 = "MATCH (a:person)-[:knows]->(b:person) WHERE a.ID = 0 RETURN a.fName, b.fName;";
+    ASSERT_STREQ(getEncodedPlan(q3).c_str(), "HJ(b._ID){S(b)}{E(b)IndexScan(a)}");
+}
+
+TEST_F(OptimizerTest, INLJoinVsHashJoinTest) {
+    // b is scanned sequentially, so both hops look up its adjacency lists in order.
+    auto q1 = "MATCH (a:person)-[:knows]->(b:person)-[:studyAt]->(o:organisation) "
+              "RETURN COUNT(*);";
+    ASSERT_STREQ(getEncodedPlan(q1).c_str(), "E(a)E(o)S(b)");
+    // The join node of the second hop comes out of an extend, so it is scanned again and joined
+    // by hash instead of being looked up at random.
+    auto q2 = "MATCH (a:person)-[:knows]->(b:person)-[:knows]->(c:person) WHERE a.ID = 0 "
+              "RETURN COUNT(*);";
+    ASSERT_STREQ(getEncodedPlan(q2).c_str(), "HJ(b._ID){E(c)S(b)}{E(b)IndexScan(a)}");
+}
+
 TEST_F(OptimizerTest, SingleNodeTwoHopJoins) {
 #if defined(WIN32)
     // Skip on windows as we don't generate consistent plan as on other platforms.
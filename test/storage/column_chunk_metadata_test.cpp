@@ -1,6 +1,7 @@
 #include "common/serializer/buffered_serializer.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
+#include "function/hash/hash_functions.h"
 #include "gmock/gmock-matchers.h"
 #include "gtest/gtest.h"
 #include "storage/store/column_chunk_metadata.h"
@@ -43,7 +44,8 @@ bool operator==(const CompressionMetadata& a, const CompressionMetadata& b) {
 
 bool operator==(const ColumnChunkMetadata& a, const ColumnChunkMetadata& b) {
     return (a.compMeta == b.compMeta) && (a.numPages == b.numPages) &&
-           (a.numValues == b.numValues) && (a.pageIdx == b.pageIdx);
+           (a.numValues == b.numValues) && (a.pageIdx == b.pageIdx) &&
+           ((a.bloomFilter == nullptr) == (b.bloomFilter == nullptr));
 }
 
 struct BufferReader : Reader {
@@ -61,14 +63,15 @@ struct BufferReader : Reader {
     size_t readSize;
 };
 
-void testSerializeThenDeserialize(const ColumnChunkMetadata& orig) {
+ColumnChunkMetadata testSerializeThenDeserialize(const ColumnChunkMetadata& orig) {
     const auto writer = std::make_shared<BufferedSerializer>();
     Serializer ser{writer};
     orig.serialize(ser);
 
     Deserializer deser{std::make_unique<BufferReader>(writer->getBlobData(), writer->getSize())};
-    const auto deserialized = ColumnChunkMetadata::deserialize(deser);
+    auto deserialized = ColumnChunkMetadata::deserialize(deser);
     EXPECT_TRUE(orig == deserialized);
+    return deserialized;
 }
 
 TEST(ColumnChunkMetadataTests, DoubleChunkMetadataSerializeThenDeserialize) {
@@ -83,3 +86,26 @@ TEST(ColumnChunkMetadataTests, DoubleChunkMetadataSerializeThenDeserialize) {
 
     testSerializeThenDeserialize(orig);
 }
+
+TEST(ColumnChunkMetadataTests, BloomFilterSerializeThenDeserialize) {
+    constexpr uint64_t numValues = 1000;
+    auto bloomFilter = std::make_shared<ColumnChunkBloomFilter>(PhysicalTypeID::STRING, numValues);
+    for (auto i = 0u; i < numValues; i++) {
+        bloomFilter->insert(kuzu::function::murmurhash64(i));
+    }
+    ColumnChunkMetadata orig{1, 2, numValues,
+        CompressionMetadata{StorageValue{0}, StorageValue{1}, CompressionType::UNCOMPRESSED}};
+    orig.bloomFilter = bloomFilter;
+
+    const auto deserialized = testSerializeThenDeserialize(orig);
+    ASSERT_NE(deserialized.bloomFilter, nullptr);
+    EXPECT_EQ(deserialized.bloomFilter->getPhysicalType(), PhysicalTypeID::STRING);
+    EXPECT_EQ(deserialized.bloomFilter->getNumWords(), bloomFilter->getNumWords());
+    auto numFalsePositives = 0u;
+    for (auto i = 0u; i < numValues; i++) {
+        EXPECT_TRUE(deserialized.bloomFilter->mayContain(kuzu::function::murmurhash64(i)));
+        numFalsePositives +=
+            deserialized.bloomFilter->mayContain(kuzu::function::murmurhash64(i + numValues));
+    }
+    EXPECT_LT(numFalsePositives, numValues / 5);
+}
@@ -0,0 +1,119 @@
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "common/string_utils.h"
+#include "function/array/array_distance_kernels.h"
+#include "spdlog/spdlog.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+// Microbenchmark of the array distance kernels. Every supported SIMD level is compared against the
+// scalar kernels, which accumulate in element order like the original array functions did.
+// Usage: kuzu_array_distance_benchmark [--dim=768] [--num-arrays=2048] [--run=20]
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+struct ArrayDistanceBenchmarkConfig {
+    std::vector<uint64_t> dims = {128, 768, 1536};
+    uint64_t numArrays = 2048;
+    uint64_t numRuns = 20;
+};
+
+template<typename T, typename FUNC>
+static double timeKernel(const std::vector<T>& arrays, const std::vector<T>& query, uint64_t dim,
+    uint64_t numRuns, FUNC func) {
+    const auto numArrays = arrays.size() / dim;
+    // Accumulate the results so the calls cannot be optimized away.
+    volatile T sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (auto run = 0u; run < numRuns; run++) {
+        T sum = 0;
+        for (auto i = 0u; i < numArrays; i++) {
+            sum += func(arrays.data() + i * dim, query.data(), dim);
+        }
+        sink = sink + sum;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           static_cast<double>(numRuns * numArrays);
+}
+
+template<typename T>
+static void benchmarkType(const std::string& typeName, const ArrayDistanceBenchmarkConfig& config) {
+    std::mt19937 generator{0};
+    std::uniform_real_distribution<T> distribution{-1, 1};
+    std::vector<SIMDLevel> levels;
+    for (auto level :
+        {SIMDLevel::SCALAR, SIMDLevel::NEON, SIMDLevel::AVX2, SIMDLevel::AVX512}) {
+        if (ArrayDistanceKernels::isSupported(level)) {
+            levels.push_back(level);
+        }
+    }
+    for (auto dim : config.dims) {
+        std::vector<T> arrays(dim * config.numArrays);
+        std::vector<T> query(dim);
+        for (auto& value : arrays) {
+            value = distribution(generator);
+        }
+        for (auto& value : query) {
+            value = distribution(generator);
+        }
+        double scalarTimes[3] = {0, 0, 0};
+        for (auto level : levels) {
+            auto& kernels = ArrayDistanceKernels::getKernels<T>(level);
+            double times[3];
+            times[0] = timeKernel(arrays, query, dim, config.numRuns,
+                [&](const T* left, const T* right, uint64_t n) {
+                    return kernels.squaredDistance(left, right, n);
+                });
+            times[1] = timeKernel(arrays, query, dim, config.numRuns,
+                [&](const T* left, const T* right, uint64_t n) {
+                    return kernels.innerProduct(left, right, n);
+                });
+            times[2] = timeKernel(arrays, query, dim, config.numRuns,
+                [&](const T* left, const T* right, uint64_t n) {
+                    T product = 0, leftNorm = 0, rightNorm = 0;
+                    kernels.cosineTerms(left, right, n, product, leftNorm, rightNorm);
+                    return product + leftNorm + rightNorm;
+                });
+            if (level == SIMDLevel::SCALAR) {
+                std::copy(times, times + 3, scalarTimes);
+            }
+            spdlog::info("{}[{}] {:>7}: distance {:.1f}ns ({:.2f}x) inner_product {:.1f}ns ({:.2f}x) "
+                         "cosine_similarity {:.1f}ns ({:.2f}x)",
+                typeName, dim, ArrayDistanceKernels::toString(level), times[0],
+                scalarTimes[0] / times[0], times[1], scalarTimes[1] / times[1], times[2],
+                scalarTimes[2] / times[2]);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    ArrayDistanceBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--dim")) {
+            config.dims = {stoul(getArgumentValue(arg))};
+        } else if (arg.starts_with("--num-arrays")) {
+            config.numArrays = stoul(getArgumentValue(arg));
+        } else if (arg.starts_with("--run")) {
+            config.numRuns = stoul(getArgumentValue(arg));
+        } else {
+            spdlog::error("Unrecognized argument: {}", arg);
+            return 1;
+        }
+    }
+    spdlog::info("Best supported SIMD level: {}",
+        ArrayDistanceKernels::toString(ArrayDistanceKernels::getBestSupportedLevel()));
+    benchmarkType<float>("FLOAT", config);
+    benchmarkType<double>("DOUBLE", config);
+    return 0;
+}
@@ -0,0 +1,202 @@
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "binder/binder.h"
+#include "common/string_utils.h"
+#include "expression_evaluator/function_evaluator.h"
+#include "main/client_context.h"
+#include "main/kuzu.h"
+#include "planner/operator/schema.h"
+#include "processor/expression_mapper.h"
+#include "spdlog/spdlog.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::evaluator;
+using namespace kuzu::main;
+using namespace kuzu::processor;
+
+// Microbenchmark of filters on a conjunction of column and constant comparisons,
+// x > 50 AND y < 0.5 AND z = 'foo', over random vectors. The ComparisonConjunctionEvaluator chosen
+// by ExpressionMapper is compared against evaluating the same conjunction through
+// FunctionExpressionEvaluators. Each comparison selects about half of the tuples, except the string
+// equality which selects a quarter.
+// Usage: kuzu_filter_benchmark [--num-tuples=100000000] [--null-rate=0]
+//     [--database=/tmp/kuzu_filter_benchmark]
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+struct FilterBenchmarkConfig {
+    uint64_t numTuples = 100000000;
+    double nullRate = 0;
+    std::string databasePath = "/tmp/kuzu_filter_benchmark";
+};
+
+// Vectors are refilled from a few pre-generated batches, so that selections are not learnt by the
+// branch predictor.
+static constexpr uint64_t NUM_BATCHES = 64;
+
+struct FilterBenchmarkBatch {
+    std::vector<int64_t> xs;
+    std::vector<double> ys;
+    std::vector<ku_string_t> zs;
+    std::vector<bool> isNull;
+};
+
+static std::vector<FilterBenchmarkBatch> generateBatches(const FilterBenchmarkConfig& config) {
+    // All strings are inlined in ku_string_t, so batches can be copied into vectors as they are.
+    std::vector<ku_string_t> strings(4);
+    strings[0].set("foo");
+    strings[1].set("bar");
+    strings[2].set("baz");
+    strings[3].set("qux");
+    std::mt19937_64 generator{0};
+    std::uniform_int_distribution<int64_t> xDistribution{0, 99};
+    std::uniform_real_distribution<double> yDistribution{0, 1};
+    std::uniform_int_distribution<uint64_t> zDistribution{0, strings.size() - 1};
+    std::bernoulli_distribution nullDistribution{config.nullRate};
+    std::vector<FilterBenchmarkBatch> batches(NUM_BATCHES);
+    for (auto& batch : batches) {
+        for (auto i = 0u; i < DEFAULT_VECTOR_CAPACITY; ++i) {
+            batch.xs.push_back(xDistribution(generator));
+            batch.ys.push_back(yDistribution(generator));
+            batch.zs.push_back(strings[zDistribution(generator)]);
+            batch.isNull.push_back(nullDistribution(generator));
+        }
+    }
+    return batches;
+}
+
+static void fillVectors(const FilterBenchmarkBatch& batch, const DataChunk& dataChunk) {
+    auto& xVector = dataChunk.getValueVectorMutable(0);
+    auto& yVector = dataChunk.getValueVectorMutable(1);
+    auto& zVector = dataChunk.getValueVectorMutable(2);
+    memcpy(xVector.getData(), batch.xs.data(), DEFAULT_VECTOR_CAPACITY * sizeof(int64_t));
+    memcpy(yVector.getData(), batch.ys.data(), DEFAULT_VECTOR_CAPACITY * sizeof(double));
+    memcpy(zVector.getData(), batch.zs.data(), DEFAULT_VECTOR_CAPACITY * sizeof(ku_string_t));
+    for (auto& vector : dataChunk.valueVectors) {
+        vector->setAllNonNull();
+    }
+    for (auto i = 0u; i < DEFAULT_VECTOR_CAPACITY; ++i) {
+        if (batch.isNull[i]) {
+            xVector.setNull(i, true);
+        }
+    }
+    dataChunk.state->getSelVectorUnsafe().setToUnfiltered(DEFAULT_VECTOR_CAPACITY);
+}
+
+// Evaluates the conjunction the way ExpressionMapper did before comparison conjunctions were
+// recognized.
+static std::unique_ptr<ExpressionEvaluator> getFunctionEvaluator(ExpressionMapper& mapper,
+    const std::shared_ptr<Expression>& expression) {
+    if (expression->expressionType != ExpressionType::AND) {
+        return mapper.getEvaluator(expression);
+    }
+    evaluator_vector_t children;
+    for (auto& child : expression->getChildren()) {
+        children.push_back(getFunctionEvaluator(mapper, child));
+    }
+    return std::make_unique<FunctionExpressionEvaluator>(expression, std::move(children));
+}
+
+static double runFilter(ExpressionEvaluator& evaluator, const DataChunk& dataChunk,
+    const FilterBenchmarkConfig& config, const std::vector<FilterBenchmarkBatch>& batches,
+    uint64_t& numSelected) {
+    std::chrono::duration<double, std::nano> time{0};
+    numSelected = 0;
+    for (uint64_t i = 0; i * DEFAULT_VECTOR_CAPACITY < config.numTuples; ++i) {
+        fillVectors(batches[i % NUM_BATCHES], dataChunk);
+        auto start = std::chrono::steady_clock::now();
+        if (evaluator.select(dataChunk.state->getSelVectorUnsafe())) {
+            numSelected += dataChunk.state->getSelVector().getSelSize();
+        }
+        time += std::chrono::steady_clock::now() - start;
+    }
+    return time.count();
+}
+
+int main(int argc, char** argv) {
+    FilterBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--num-tuples")) {
+            config.numTuples = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--null-rate")) {
+            config.nullRate = stod(getArgumentValue(arg));
+        } else if (arg.starts_with("--database")) {
+            config.databasePath = getArgumentValue(arg);
+        } else {
+            spdlog::error("Unrecognized argument: {}", arg);
+            return 1;
+        }
+    }
+    if (config.nullRate < 0 || config.nullRate > 1) {
+        spdlog::error("Null rate must be in [0, 1].");
+        return 1;
+    }
+    // The database provides the memory manager and the functions to bind the predicate.
+    auto database = std::make_unique<Database>(config.databasePath);
+    auto connection = std::make_unique<Connection>(database.get());
+    auto context = connection->getClientContext();
+    connection->query("BEGIN TRANSACTION READ ONLY");
+    Binder binder(context);
+    auto expressionBinder = binder.getExpressionBinder();
+    auto x = expressionBinder->createVariableExpression(LogicalType::INT64(), std::string("x"));
+    auto y = expressionBinder->createVariableExpression(LogicalType::DOUBLE(), std::string("y"));
+    auto z = expressionBinder->createVariableExpression(LogicalType::STRING(), std::string("z"));
+    auto predicate = expressionBinder->bindBooleanExpression(ExpressionType::AND,
+        {expressionBinder->bindBooleanExpression(ExpressionType::AND,
+             {expressionBinder->bindComparisonExpression(ExpressionType::GREATER_THAN,
+                  {x, expressionBinder->createLiteralExpression(Value((int64_t)50))}),
+                 expressionBinder->bindComparisonExpression(ExpressionType::LESS_THAN,
+                     {y, expressionBinder->createLiteralExpression(Value(0.5))})}),
+            expressionBinder->bindComparisonExpression(ExpressionType::EQUALS,
+                {z, expressionBinder->createLiteralExpression(std::string("foo"))})});
+    connection->query("COMMIT");
+
+    kuzu::planner::Schema schema;
+    auto groupPos = schema.createGroup();
+    schema.insertToGroupAndScope(expression_vector{x, y, z}, groupPos);
+    ResultSet resultSet(1);
+    auto dataChunk = std::make_shared<DataChunk>(3);
+    auto mm = context->getMemoryManager();
+    dataChunk->insert(0, std::make_shared<ValueVector>(LogicalType::INT64(), mm));
+    dataChunk->insert(1, std::make_shared<ValueVector>(LogicalType::DOUBLE(), mm));
+    dataChunk->insert(2, std::make_shared<ValueVector>(LogicalType::STRING(), mm));
+    resultSet.insert(groupPos, dataChunk);
+
+    auto mapper = ExpressionMapper(&schema);
+    auto conjunctionEvaluator = mapper.getEvaluator(predicate);
+    if (conjunctionEvaluator->getEvaluatorType() != EvaluatorType::COMPARISON_CONJUNCTION) {
+        spdlog::error("The predicate is not evaluated as a comparison conjunction.");
+        return 1;
+    }
+    auto functionEvaluator = getFunctionEvaluator(mapper, predicate);
+    conjunctionEvaluator->init(resultSet, context);
+    functionEvaluator->init(resultSet, context);
+
+    auto batches = generateBatches(config);
+    uint64_t numConjunctionSelected = 0;
+    uint64_t numFunctionSelected = 0;
+    auto conjunctionTime =
+        runFilter(*conjunctionEvaluator, *dataChunk, config, batches, numConjunctionSelected);
+    auto functionTime =
+        runFilter(*functionEvaluator, *dataChunk, config, batches, numFunctionSelected);
+    if (numConjunctionSelected != numFunctionSelected) {
+        spdlog::error("Comparison conjunction selected {} tuples but function evaluator selected {}",
+            numConjunctionSelected, numFunctionSelected);
+    }
+    auto numTuples = static_cast<double>(config.numTuples);
+    spdlog::info("{} tuples, null rate {}: comparison conjunction {:.2f}ns/tuple, function "
+                 "evaluator {:.2f}ns/tuple ({:.2f}x), {} selected",
+        config.numTuples, config.nullRate, conjunctionTime / numTuples, functionTime / numTuples,
+        functionTime / conjunctionTime, numConjunctionSelected);
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "common/string_utils.h"
+#include "function/hash/hash_functions.h"
+#include "main/client_context.h"
+#include "main/kuzu.h"
+#include "processor/data_pos.h"
+#include "processor/operator/hash_join/join_hash_table.h"
+#include "spdlog/spdlog.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::processor;
+
+// Microbenchmark of the hash join probe on unique INT64 keys. The batched probe used by
+// HashJoinProbe is compared against walking the chain of one key at a time. Build sides beyond a
+// few hundred million rows need tens of GB of memory, e.g. 1B rows take about 40GB.
+// Usage: kuzu_hash_join_benchmark [--build-size=1000000] [--num-probes=10000000]
+//     [--hit-rate=0.5] [--database=/tmp/kuzu_hash_join_benchmark]
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+struct HashJoinBenchmarkConfig {
+    std::vector<uint64_t> buildSizes = {1000000, 10000000, 100000000};
+    uint64_t numProbes = 10000000;
+    double hitRate = 0.5;
+    std::string databasePath = "/tmp/kuzu_hash_join_benchmark";
+};
+
+static std::unique_ptr<JoinHashTable> buildHashTable(kuzu::storage::MemoryManager* mm,
+    uint64_t buildSize) {
+    auto tableSchema = FactorizedTableSchema();
+    tableSchema.appendColumn(
+        ColumnSchema(false /* isUnFlat */, 0 /* dataChunkPos */, sizeof(int64_t)));
+    tableSchema.appendColumn(
+        ColumnSchema(false /* isUnFlat */, INVALID_DATA_CHUNK_POS, sizeof(hash_t)));
+    tableSchema.appendColumn(
+        ColumnSchema(false /* isUnFlat */, INVALID_DATA_CHUNK_POS, sizeof(uint8_t*)));
+    logical_type_vec_t keyTypes;
+    keyTypes.push_back(LogicalType::INT64());
+    auto hashTable =
+        std::make_unique<JoinHashTable>(*mm, std::move(keyTypes), std::move(tableSchema));
+    auto state = std::make_shared<DataChunkState>();
+    auto keyVector = std::make_unique<ValueVector>(LogicalType::INT64(), mm);
+    keyVector->setState(state);
+    std::vector<ValueVector*> keyVectors{keyVector.get()};
+    for (uint64_t start = 0; start < buildSize; start += DEFAULT_VECTOR_CAPACITY) {
+        auto numKeys = std::min<uint64_t>(DEFAULT_VECTOR_CAPACITY, buildSize - start);
+        state->getSelVectorUnsafe().setSelSize(numKeys);
+        for (auto i = 0u; i < numKeys; i++) {
+            keyVector->setValue<int64_t>(i, start + i);
+        }
+        hashTable->appendVectors(keyVectors, {} /* payloadVectors */, state.get());
+    }
+    hashTable->allocateHashSlots(buildSize);
+    hashTable->buildHashSlots();
+    return hashTable;
+}
+
+static void benchmarkBuildSize(kuzu::storage::MemoryManager* mm,
+    const HashJoinBenchmarkConfig& config, uint64_t buildSize) {
+    auto buildStart = std::chrono::steady_clock::now();
+    auto hashTable = buildHashTable(mm, buildSize);
+    auto buildTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - buildStart);
+    // Keys beyond the build side never match.
+    std::mt19937_64 generator{0};
+    std::uniform_int_distribution<int64_t> distribution{0,
+        static_cast<int64_t>(static_cast<double>(buildSize) / config.hitRate) - 1};
+    std::vector<int64_t> probeKeys(config.numProbes);
+    for (auto& key : probeKeys) {
+        key = distribution(generator);
+    }
+
+    auto state = std::make_shared<DataChunkState>();
+    auto keyVector = std::make_unique<ValueVector>(LogicalType::INT64(), mm);
+    keyVector->setState(state);
+    std::vector<ValueVector*> keyVectors{keyVector.get()};
+    auto hashVector = std::make_unique<ValueVector>(LogicalType::HASH(), mm);
+    auto tmpHashVector = std::make_unique<ValueVector>(LogicalType::HASH(), mm);
+    SelectionVector hashSelVec;
+    SelectionVector matchedSelVec;
+    matchedSelVec.setToFiltered();
+    std::vector<uint8_t*> probedTuples(DEFAULT_VECTOR_CAPACITY);
+    std::vector<uint8_t*> matchedTuples(DEFAULT_VECTOR_CAPACITY);
+    uint64_t numBatchedMatches = 0;
+    auto batchedStart = std::chrono::steady_clock::now();
+    for (uint64_t start = 0; start < config.numProbes; start += DEFAULT_VECTOR_CAPACITY) {
+        auto numKeys = std::min<uint64_t>(DEFAULT_VECTOR_CAPACITY, config.numProbes - start);
+        state->getSelVectorUnsafe().setSelSize(numKeys);
+        for (auto i = 0u; i < numKeys; i++) {
+            keyVector->setValue<int64_t>(i, probeKeys[start + i]);
+        }
+        hashTable->probe(keyVectors, *hashVector, hashSelVec, *tmpHashVector,
+            probedTuples.data());
+        numBatchedMatches += hashTable->matchUnFlatKey(keyVector.get(), probedTuples.data(),
+            matchedTuples.data(), matchedSelVec);
+    }
+    auto batchedTime =
+        std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - batchedStart);
+
+    uint64_t numSingleMatches = 0;
+    auto singleStart = std::chrono::steady_clock::now();
+    for (auto key : probeKeys) {
+        hash_t hash = 0;
+        kuzu::function::Hash::operation(key, hash);
+        auto tuple = hashTable->getTupleForHash(hash);
+        while (tuple != nullptr) {
+            if (*(int64_t*)tuple == key) {
+                numSingleMatches++;
+                break;
+            }
+            tuple = *hashTable->getPrevTuple(tuple);
+        }
+    }
+    auto singleTime =
+        std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - singleStart);
+
+    if (numBatchedMatches != numSingleMatches) {
+        spdlog::error("Batched probe found {} matches but single key probe found {}",
+            numBatchedMatches, numSingleMatches);
+    }
+    auto numProbes = static_cast<double>(config.numProbes);
+    spdlog::info("build size {}: build {:.2f}s, batched probe {:.1f}ns/key, single key probe "
+                 "{:.1f}ns/key ({:.2f}x), {} matches",
+        buildSize, buildTime.count(), batchedTime.count() / numProbes,
+        singleTime.count() / numProbes, singleTime.count() / batchedTime.count(),
+        numBatchedMatches);
+}
+
+int main(int argc, char** argv) {
+    HashJoinBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--build-size")) {
+            config.buildSizes = {stoull(getArgumentValue(arg))};
+        } else if (arg.starts_with("--num-probes")) {
+            config.numProbes = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--hit-rate")) {
+            config.hitRate = stod(getArgumentValue(arg));
+        } else if (arg.starts_with("--database")) {
+            config.databasePath = getArgumentValue(arg);
+        } else {
+            spdlog::error("Unrecognized argument: {}", arg);
+            return 1;
+        }
+    }
+    if (config.hitRate <= 0 || config.hitRate > 1) {
+        spdlog::error("Hit rate must be in (0, 1].");
+        return 1;
+    }
+    // The database only provides the memory manager of the hash tables.
+    auto database = std::make_unique<Database>(config.databasePath);
+    auto connection = std::make_unique<Connection>(database.get());
+    auto mm = connection->getClientContext()->getMemoryManager();
+    for (auto buildSize : config.buildSizes) {
+        benchmarkBuildSize(mm, config, buildSize);
+    }
+    return 0;
+}
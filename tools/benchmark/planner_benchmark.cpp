@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+
+#include "binder/binder.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+#include "main/client_context.h"
+#include "main/kuzu.h"
+#include "planner/planner.h"
+#include "spdlog/spdlog.h"
+#include "test_helper.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+// Benchmark of join order planning on the LDBC (.benchmark) and LSQB (.cypher) queries under
+// benchmark/. Each query is bound once and then planned --runs times against the statistics of a
+// serialized dataset. The average planning time and the cost of the best plan are reported, so
+// --join-order-budget=0 compares greedy planning against exact planning.
+// Usage: kuzu_planner_benchmark --database=/path/to/serialized/dataset
+//     --queries=benchmark/queries/ldbc-sf100,benchmark/lsqb/queries [--runs=5]
+//     [--join-order-budget=4096]
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+struct PlannerBenchmarkConfig {
+    std::string databasePath;
+    std::vector<std::string> queryPaths;
+    uint64_t numRuns = 5;
+    std::optional<uint64_t> joinOrderBudget;
+};
+
+struct PlannerBenchmarkQuery {
+    std::string name;
+    std::string query;
+};
+
+static void loadQueries(const std::filesystem::path& path,
+    std::vector<PlannerBenchmarkQuery>& queries) {
+    if (std::filesystem::is_directory(path)) {
+        std::vector<std::filesystem::path> children;
+        for (auto& entry : std::filesystem::directory_iterator(path)) {
+            children.push_back(entry.path());
+        }
+        std::sort(children.begin(), children.end());
+        for (auto& child : children) {
+            loadQueries(child, queries);
+        }
+    } else if (path.extension() == ".benchmark") {
+        for (auto& queryConfig : kuzu::testing::TestHelper::parseTestFile(path.string())) {
+            queries.push_back({queryConfig->name, queryConfig->query});
+        }
+    } else if (path.extension() == ".cypher") {
+        std::ifstream file(path);
+        std::stringstream query;
+        query << file.rdbuf();
+        queries.push_back({path.parent_path().parent_path().filename().string() + "/" +
+                               path.stem().string(),
+            query.str()});
+    }
+}
+
+static void benchmarkQuery(ClientContext* context, const PlannerBenchmarkConfig& config,
+    const PlannerBenchmarkQuery& query) {
+    try {
+        auto statements = context->parseQuery(query.query);
+        auto boundStatement = kuzu::binder::Binder(context).bind(*statements[0]);
+        uint64_t cost = 0;
+        std::chrono::duration<double, std::milli> planningTime{0};
+        for (auto i = 0u; i < config.numRuns; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            auto plan = kuzu::planner::Planner(context).getBestPlan(*boundStatement);
+            planningTime += std::chrono::steady_clock::now() - start;
+            cost = plan->getCost();
+        }
+        spdlog::info("{}: planning {:.3f}ms, cost {}", query.name,
+            planningTime.count() / config.numRuns, cost);
+    } catch (std::exception& e) {
+        spdlog::error("{}: {}", query.name, e.what());
+    }
+}
+
+int main(int argc, char** argv) {
+    PlannerBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--database")) {
+            config.databasePath = getArgumentValue(arg);
+        } else if (arg.starts_with("--queries")) {
+            config.queryPaths = StringUtils::split(getArgumentValue(arg), ",");
+        } else if (arg.starts_with("--runs")) {
+            config.numRuns = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--join-order-budget")) {
+            config.joinOrderBudget = stoull(getArgumentValue(arg));
+        } else {
+            spdlog::error("Unrecognized argument: {}", arg);
+            return 1;
+        }
+    }
+    if (config.databasePath.empty() || config.queryPaths.empty() || config.numRuns == 0) {
+        spdlog::error("Expect --database, --queries and a positive number of runs.");
+        return 1;
+    }
+    std::vector<PlannerBenchmarkQuery> queries;
+    for (auto& path : config.queryPaths) {
+        loadQueries(path, queries);
+    }
+    auto database = std::make_unique<Database>(config.databasePath);
+    auto connection = std::make_unique<Connection>(database.get());
+    if (config.joinOrderBudget.has_value()) {
+        connection->query(stringFormat("CALL join_order_budget={}", *config.joinOrderBudget));
+    }
+    // Binding and planning read the catalog and statistics within a transaction.
+    connection->query("BEGIN TRANSACTION READ ONLY");
+    for (auto& query : queries) {
+        benchmarkQuery(connection->getClientContext(), config, query);
+    }
+    connection->query("COMMIT");
+    return 0;
+}
@@ -27,6 +27,7 @@ private:
     Napi::Value HasNextQueryResult(const Napi::CallbackInfo& info);
     Napi::Value GetNextQueryResultAsync(const Napi::CallbackInfo& info);
     Napi::Value GetNumTuples(const Napi::CallbackInfo& info);
+    Napi::Value IsStreaming(const Napi::CallbackInfo& info);
     Napi::Value GetNextAsync(const Napi::CallbackInfo& info);
     Napi::Value GetColumnDataTypesAsync(const Napi::CallbackInfo& info);
     Napi::Value GetColumnNamesAsync(const Napi::CallbackInfo& info);
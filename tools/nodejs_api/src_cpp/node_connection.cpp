@@ -16,6 +16,7 @@ Napi::Object NodeConnection::Init(Napi::Env env, Napi::Object exports) {
             InstanceMethod("queryAsync", &NodeConnection::QueryAsync),
             InstanceMethod("setMaxNumThreadForExec", &NodeConnection::SetMaxNumThreadForExec),
             InstanceMethod("setQueryTimeout", &NodeConnection::SetQueryTimeout),
+            InstanceMethod("setStreamingResults", &NodeConnection::SetStreamingResults),
             InstanceMethod("close", &NodeConnection::Close)});
 
     exports.Set("NodeConnection", t);
@@ -69,6 +70,17 @@ void NodeConnection::SetQueryTimeout(const Napi::CallbackInfo& info) {
     }
 }
 
+void NodeConnection::SetStreamingResults(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::HandleScope scope(env);
+    bool enable = info[0].ToBoolean().Value();
+    try {
+        this->connection->setStreamingResults(enable);
+    } catch (const std::exception& exc) {
+        Napi::Error::New(env, std::string(exc.what())).ThrowAsJavaScriptException();
+    }
+}
+
 void NodeConnection::Close(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     Napi::HandleScope scope(env);
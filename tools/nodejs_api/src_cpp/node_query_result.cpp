@@ -16,6 +16,7 @@ Napi::Object NodeQueryResult::Init(Napi::Env env, Napi::Object exports) {
             InstanceMethod("hasNextQueryResult", &NodeQueryResult::HasNextQueryResult),
             InstanceMethod("getNextQueryResultAsync", &NodeQueryResult::GetNextQueryResultAsync),
             InstanceMethod("getNumTuples", &NodeQueryResult::GetNumTuples),
+            InstanceMethod("isStreaming", &NodeQueryResult::IsStreaming),
             InstanceMethod("getNextAsync", &NodeQueryResult::GetNextAsync),
             InstanceMethod("getColumnDataTypesAsync", &NodeQueryResult::GetColumnDataTypesAsync),
             InstanceMethod("getColumnNamesAsync", &NodeQueryResult::GetColumnNamesAsync),
@@ -91,6 +92,12 @@ Napi::Value NodeQueryResult::GetNumTuples(const Napi::CallbackInfo& info) {
     return info.Env().Undefined();
 }
 
+Napi::Value NodeQueryResult::IsStreaming(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::HandleScope scope(env);
+    return Napi::Boolean::New(env, this->queryResult->isStreaming());
+}
+
 Napi::Value NodeQueryResult::GetNextAsync(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     Napi::HandleScope scope(env);
@@ -58,6 +58,9 @@ class Connection {
               if (this._queryTimeout) {
                 this._connection.setQueryTimeout(this._queryTimeout);
               }
+              if (this._streamingResults !== undefined) {
+                this._connection.setStreamingResults(this._streamingResults);
+              }
               resolve();
             }
           });
@@ -309,6 +312,25 @@ class Connection {
     }
   }
 
+  /**
+   * Set whether the results of read-only queries are streamed. A streamed
+   * query result is produced in bounded chunks while the query is executing
+   * instead of being materialized before the query returns. It cannot be
+   * reset, does not know its number of rows, and is closed once another query
+   * is executed on the connection.
+   * @param {Boolean} enable whether to stream query results.
+   */
+  setStreamingResults(enable) {
+    if (typeof enable !== "boolean") {
+      throw new Error("enable must be a boolean.");
+    }
+    if (this._isInitialized) {
+      this._connection.setStreamingResults(enable);
+    } else {
+      this._streamingResults = enable;
+    }
+  }
+
   /**
    * Close the connection. 
    * 
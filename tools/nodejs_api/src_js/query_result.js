@@ -50,6 +50,17 @@ class QueryResult {
     return this._queryResult.getNumTuples();
   }
 
+  /**
+   * Check if the rows of the query result are streamed while the query is
+   * executing. A streamed query result cannot be reset and does not know its
+   * number of rows.
+   * @returns {Boolean} true if the query result is streamed.
+   */
+  isStreaming() {
+    this._checkClosed();
+    return this._queryResult.isStreaming();
+  }
+
   /**
    * Get the next row of the query result.
    * @returns {Promise<Object>} a promise that resolves to the next row of the query result. The promise is rejected if there is an error.
@@ -93,7 +104,9 @@ class QueryResult {
    */
   async getAll() {
     this._checkClosed();
-    this._queryResult.resetIterator();
+    if (!this._queryResult.isStreaming()) {
+      this._queryResult.resetIterator();
+    }
     const result = [];
     while (this.hasNext()) {
       result.push(await this.getNext());
@@ -257,6 +257,39 @@ describe("Timeout", function () {
   });
 });
 
+describe("Streaming results", function () {
+  it("should stream the results of a read-only query", async function () {
+    const newConn = new kuzu.Connection(db);
+    newConn.setStreamingResults(true);
+    const result = await newConn.query("UNWIND RANGE(1, 10000) AS x RETURN x;");
+    assert.isTrue(result.isStreaming());
+    const rows = await result.getAll();
+    assert.equal(rows.length, 10000);
+    assert.equal(rows[0].x, 1);
+    assert.equal(rows[9999].x, 10000);
+    try {
+      result.getNumTuples();
+      assert.fail("No error thrown when getting the number of tuples.");
+    } catch (err) {
+      assert.equal(
+        err.message,
+        "Runtime exception: getNumTuples is not supported for streaming query results."
+      );
+    }
+    await newConn.close();
+  });
+
+  it("should throw an error if enable is not a boolean", async function () {
+    const newConn = new kuzu.Connection(db);
+    try {
+      newConn.setStreamingResults(1);
+      assert.fail("No error thrown when enable is not a boolean.");
+    } catch (err) {
+      assert.equal(err.message, "enable must be a boolean.");
+    }
+  });
+});
+
 describe("Close", function () {
   it("should close the connection", async function () {
     const newConn = new kuzu.Connection(db);
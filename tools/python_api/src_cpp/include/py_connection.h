@@ -22,6 +22,8 @@ public:
 
     void setQueryTimeout(uint64_t timeoutInMS);
 
+    void setStreamingResults(bool enable);
+
     std::unique_ptr<PyQueryResult> execute(PyPreparedStatement* preparedStatement,
         const py::dict& params);
 
@@ -12,6 +12,18 @@ public:
     NPArrayWrapper(const LogicalType& type, uint64_t numFlatTuple);
 
     void appendElement(Value* value);
+    // Appends the value stored in the row layout of a factorized table cell, where a nullptr cell
+    // is a null value. Only valid for types with a native dtype, so the GIL does not need to be
+    // held.
+    void appendNativeElement(const uint8_t* cell);
+    // Appends the value of a cell as a python object. The scratch value is only used for types
+    // that are converted through a Value.
+    void appendObjectElement(const uint8_t* cell, Value& scratchValue);
+    // Resizes the arrays to hold numFlatTuple elements. Used to grow the arrays of results whose
+    // number of tuples is not known upfront.
+    void resize(uint64_t numFlatTuple);
+
+    static bool hasNativeDType(const LogicalType& type);
 
 private:
     py::dtype convertToArrayType(const LogicalType& type);
@@ -20,6 +32,7 @@ public:
     py::array data;
     uint8_t* dataBuffer;
     py::array mask;
+    uint8_t* maskBuffer;
     LogicalType type;
     uint64_t numElements;
 };
@@ -30,6 +43,16 @@ public:
 
     py::object toDF();
 
+private:
+    // Converts the factorized table of the result one column at a time, reading the values from
+    // its row layout. The columns with a native dtype are converted with the GIL released.
+    void convertColumnByColumn(const kuzu::processor::FactorizedTable& table,
+        kuzu::common::column_id_t unflatColIdx);
+    void convertRowByRow();
+    // Converts the tuples of a streaming result that have not been read yet. The number of tuples
+    // is unknown until the stream ends, so the arrays grow as the tuples are read.
+    void convertStreaming();
+
 private:
     kuzu::main::QueryResult* queryResult;
     std::vector<std::unique_ptr<NPArrayWrapper>> columns;
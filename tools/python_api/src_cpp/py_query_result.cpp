@@ -47,6 +47,12 @@ PyQueryResult::~PyQueryResult() {
 }
 
 bool PyQueryResult::hasNext() {
+    if (queryResult->isStreaming()) {
+        // Waiting for the next chunk of a streamed result must not block threads that need the GIL,
+        // e.g., to evaluate Python UDFs.
+        py::gil_scoped_release release;
+        return queryResult->hasNext();
+    }
     return queryResult->hasNext();
 }
 
@@ -3,8 +3,10 @@
 #include "cached_import/py_cached_import.h"
 #include "common/types/value/value.h"
 #include "include/py_query_result.h"
+#include "processor/result/factorized_table.h"
 
 using namespace kuzu::common;
+using namespace kuzu::processor;
 using namespace kuzu;
 
 NPArrayWrapper::NPArrayWrapper(const LogicalType& type, uint64_t numFlatTuple)
@@ -12,10 +14,11 @@ NPArrayWrapper::NPArrayWrapper(const LogicalType& type, uint64_t numFlatTuple)
     data = py::array(convertToArrayType(type), numFlatTuple);
     dataBuffer = (uint8_t*)data.mutable_data();
     mask = py::array(py::dtype("bool"), numFlatTuple);
+    maskBuffer = (uint8_t*)mask.mutable_data();
 }
 
 void NPArrayWrapper::appendElement(Value* value) {
-    ((uint8_t*)mask.mutable_data())[numElements] = value->isNull();
+    maskBuffer[numElements] = value->isNull();
     if (!value->isNull()) {
         switch (type.getLogicalTypeID()) {
         case LogicalTypeID::BOOL: {
@@ -110,6 +113,84 @@ void NPArrayWrapper::appendElement(Value* value) {
     numElements++;
 }
 
+void NPArrayWrapper::appendNativeElement(const uint8_t* cell) {
+    maskBuffer[numElements] = cell == nullptr;
+    if (cell != nullptr) {
+        switch (type.getLogicalTypeID()) {
+        case LogicalTypeID::BOOL: {
+            ((uint8_t*)dataBuffer)[numElements] = *(bool*)cell;
+        } break;
+        case LogicalTypeID::INT128: {
+            Int128_t::tryCast(*(int128_t*)cell, ((double*)dataBuffer)[numElements]);
+        } break;
+        case LogicalTypeID::DATE: {
+            ((int64_t*)dataBuffer)[numElements] =
+                Date::getEpochNanoSeconds(*(date_t*)cell) / Interval::NANOS_PER_MICRO;
+        } break;
+        case LogicalTypeID::INTERVAL: {
+            ((int64_t*)dataBuffer)[numElements] = Interval::getNanoseconds(*(interval_t*)cell);
+        } break;
+        default: {
+            // The dtype of the remaining types has the same layout as their row layout.
+            auto numBytes = LogicalTypeUtils::getRowLayoutSize(type);
+            memcpy(dataBuffer + numElements * numBytes, cell, numBytes);
+        }
+        }
+    }
+    numElements++;
+}
+
+void NPArrayWrapper::appendObjectElement(const uint8_t* cell, Value& scratchValue) {
+    if (cell != nullptr && type.getLogicalTypeID() == LogicalTypeID::STRING) {
+        auto str = (ku_string_t*)cell;
+        maskBuffer[numElements] = false;
+        ((py::str*)dataBuffer)[numElements] = py::str((const char*)str->getData(), str->len);
+        numElements++;
+        return;
+    }
+    scratchValue.setNull(cell == nullptr);
+    if (cell != nullptr) {
+        scratchValue.copyFromRowLayout(cell);
+    }
+    appendElement(&scratchValue);
+}
+
+void NPArrayWrapper::resize(uint64_t numFlatTuple) {
+    auto shape = std::vector<py::ssize_t>{static_cast<py::ssize_t>(numFlatTuple)};
+    data.resize(shape, false /* refcheck */);
+    dataBuffer = (uint8_t*)data.mutable_data();
+    mask.resize(shape, false /* refcheck */);
+    maskBuffer = (uint8_t*)mask.mutable_data();
+}
+
+bool NPArrayWrapper::hasNativeDType(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL:
+    case LogicalTypeID::INT128:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::INTERVAL:
+        return true;
+    default:
+        return false;
+    }
+}
+
 py::dtype NPArrayWrapper::convertToArrayType(const LogicalType& type) {
     std::string dtype;
     switch (type.getLogicalTypeID()) {
@@ -189,12 +270,87 @@ py::dtype NPArrayWrapper::convertToArrayType(const LogicalType& type) {
 }
 
 QueryResultConverter::QueryResultConverter(QueryResult* queryResult) : queryResult{queryResult} {
+    // The number of tuples of a streaming result is unknown, so its arrays start empty.
+    auto numTuples = queryResult->isStreaming() ? 0 : queryResult->getNumTuples();
     for (auto& type : queryResult->getColumnDataTypes()) {
-        columns.emplace_back(std::make_unique<NPArrayWrapper>(type, queryResult->getNumTuples()));
+        columns.emplace_back(std::make_unique<NPArrayWrapper>(type, numTuples));
     }
 }
 
-py::object QueryResultConverter::toDF() {
+// Finds a column of the only unflat group of the table, or sets unflatColIdx to INVALID_COLUMN_ID
+// if all columns are flat. Returns false if the table has more than one unflat group.
+static bool getUnflatColumn(const FactorizedTable& table, column_id_t& unflatColIdx) {
+    auto schema = table.getTableSchema();
+    unflatColIdx = INVALID_COLUMN_ID;
+    for (auto i = 0u; i < schema->getNumColumns(); i++) {
+        auto column = schema->getColumn(i);
+        if (column->isFlat()) {
+            continue;
+        }
+        if (unflatColIdx == INVALID_COLUMN_ID) {
+            unflatColIdx = i;
+        } else if (schema->getColumn(unflatColIdx)->getGroupID() != column->getGroupID()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Calls func with the cell of the column in each flat tuple of the table, in the order the
+// tuple iterator returns them, or with nullptr if the value is null.
+template<typename FUNC>
+static void scanColumn(const FactorizedTable& table, ft_col_idx_t colIdx, const LogicalType& type,
+    column_id_t unflatColIdx, FUNC&& func) {
+    auto schema = table.getTableSchema();
+    auto column = schema->getColumn(colIdx);
+    auto numBytesPerValue = LogicalTypeUtils::getRowLayoutSize(type);
+    for (auto tupleIdx = 0u; tupleIdx < table.getNumTuples(); tupleIdx++) {
+        auto tuple = table.getTuple(tupleIdx);
+        if (column->isFlat()) {
+            uint64_t numFlatTuples = 1;
+            if (unflatColIdx != INVALID_COLUMN_ID) {
+                numFlatTuples =
+                    ((overflow_value_t*)(tuple + schema->getColOffset(unflatColIdx)))->numElements;
+            }
+            auto isNull = table.isNonOverflowColNull(tuple + schema->getNullMapOffset(), colIdx);
+            auto cell = isNull ? nullptr : tuple + schema->getColOffset(colIdx);
+            for (auto i = 0u; i < numFlatTuples; i++) {
+                func(cell);
+            }
+        } else {
+            auto overflowValue = (overflow_value_t*)(tuple + schema->getColOffset(colIdx));
+            auto nullBuffer = overflowValue->value + overflowValue->numElements * numBytesPerValue;
+            for (auto i = 0u; i < overflowValue->numElements; i++) {
+                auto isNull = table.isOverflowColNull(nullBuffer, i, colIdx);
+                func(isNull ? nullptr : overflowValue->value + i * numBytesPerValue);
+            }
+        }
+    }
+}
+
+void QueryResultConverter::convertColumnByColumn(const FactorizedTable& table,
+    column_id_t unflatColIdx) {
+    {
+        py::gil_scoped_release release;
+        for (auto i = 0u; i < columns.size(); i++) {
+            auto& column = *columns[i];
+            if (NPArrayWrapper::hasNativeDType(column.type)) {
+                scanColumn(table, i, column.type, unflatColIdx,
+                    [&](const uint8_t* cell) { column.appendNativeElement(cell); });
+            }
+        }
+    }
+    for (auto i = 0u; i < columns.size(); i++) {
+        auto& column = *columns[i];
+        if (!NPArrayWrapper::hasNativeDType(column.type)) {
+            auto scratchValue = Value::createDefaultValue(column.type.copy());
+            scanColumn(table, i, column.type, unflatColIdx,
+                [&](const uint8_t* cell) { column.appendObjectElement(cell, scratchValue); });
+        }
+    }
+}
+
+void QueryResultConverter::convertRowByRow() {
     queryResult->resetIterator();
     while (queryResult->hasNext()) {
         auto flatTuple = queryResult->getNext();
@@ -202,6 +358,41 @@ py::object QueryResultConverter::toDF() {
             columns[i]->appendElement(flatTuple->getValue(i));
         }
     }
+}
+
+void QueryResultConverter::convertStreaming() {
+    uint64_t capacity = 0;
+    uint64_t numTuples = 0;
+    while (queryResult->hasNext()) {
+        if (numTuples == capacity) {
+            capacity = std::max<uint64_t>(capacity * 2, DEFAULT_VECTOR_CAPACITY);
+            for (auto& column : columns) {
+                column->resize(capacity);
+            }
+        }
+        auto flatTuple = queryResult->getNext();
+        for (auto i = 0u; i < columns.size(); i++) {
+            columns[i]->appendElement(flatTuple->getValue(i));
+        }
+        numTuples++;
+    }
+    for (auto& column : columns) {
+        column->resize(numTuples);
+    }
+}
+
+py::object QueryResultConverter::toDF() {
+    auto table = queryResult->getTable();
+    auto unflatColIdx = INVALID_COLUMN_ID;
+    if (queryResult->isStreaming()) {
+        convertStreaming();
+    } else if (table != nullptr && getUnflatColumn(*table, unflatColIdx)) {
+        convertColumnByColumn(*table, unflatColIdx);
+    } else {
+        // Results whose flat tuples are the cross product of several unflat groups are rare
+        // enough to be converted one flat tuple at a time.
+        convertRowByRow();
+    }
     py::dict result;
     auto colNames = queryResult->getColumnNames();
 
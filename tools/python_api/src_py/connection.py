@@ -229,6 +229,23 @@ class Connection:
         self.init_connection()
         self._connection.set_query_timeout(timeout_in_ms)
 
+    def set_streaming_results(self, enable: bool) -> None:
+        """
+        Set whether the results of read-only queries are streamed. A streamed result is produced in
+        bounded chunks while the query is executing instead of being materialized before the query
+        returns. It can be read with `get_next` and chunked `get_as_arrow`, but not with
+        `get_num_tuples`, `reset_iterator` or the DataFrame conversions, and it is closed once
+        another query is executed on the connection.
+
+        Parameters
+        ----------
+        enable : bool
+            whether to stream query results.
+
+        """
+        self.init_connection()
+        self._connection.set_streaming_results(enable)
+
     def create_function(
         self,
         name: str,
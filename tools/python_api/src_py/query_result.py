@@ -108,6 +108,8 @@ class QueryResult:
         """
         Get the query result as a Pandas DataFrame.
 
+        For a streaming query result, the tuples that have not been read yet are converted.
+
         See Also
         --------
         get_as_pl : Get the query result as a Polars DataFrame.
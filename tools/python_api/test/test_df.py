@@ -562,3 +562,26 @@ def test_get_df_decimal(conn_db_readonly: ConnDB) -> None:
         Decimal("24.9"),
         Decimal("8.7"),
     ])
+
+
+def test_get_df_unflat_with_nulls(conn_db_readonly: ConnDB) -> None:
+    conn, _ = conn_db_readonly
+    # b is scanned unflat, so each tuple of the result holds several rows.
+    query = (
+        "MATCH (a:person)-[:knows]->(b:person) "
+        "RETURN a.ID, a.fName, b.ID, CASE WHEN b.ID > 3 THEN b.eyeSight ELSE NULL END AS eyeSight"
+    )
+    result = conn.execute(query)
+    expected = []
+    while result.has_next():
+        expected.append(tuple(result.get_next()))
+    df = conn.execute(query).get_as_df()
+    assert str(df["a.ID"].dtype) == "int64"
+    assert str(df["b.ID"].dtype) == "int64"
+    assert str(df["a.fName"].dtype) == "object"
+    assert str(df["eyeSight"].dtype) == "float64"
+    rows = [
+        (aID, fName, bID, None if math.isnan(eyeSight) else eyeSight)
+        for aID, fName, bID, eyeSight in df.itertuples(index=False)
+    ]
+    assert sorted(rows) == sorted(expected)
@@ -0,0 +1,53 @@
+from __future__ import annotations
+
+import kuzu
+import pytest
+from type_aliases import ConnDB
+
+
+def test_streaming_results(conn_db_readonly: ConnDB) -> None:
+    _, db = conn_db_readonly
+    conn = kuzu.Connection(db)
+    conn.set_streaming_results(True)
+    result = conn.execute("UNWIND RANGE(1, 100000) AS x RETURN x;")
+    values = []
+    while result.has_next():
+        values.append(result.get_next()[0])
+    assert values == list(range(1, 100001))
+    with pytest.raises(RuntimeError, match="getNumTuples is not supported for streaming query results."):
+        result.get_num_tuples()
+    result.close()
+
+
+def test_streaming_results_arrow(conn_db_readonly: ConnDB) -> None:
+    _, db = conn_db_readonly
+    conn = kuzu.Connection(db)
+    conn.set_streaming_results(True)
+    table = conn.execute("UNWIND RANGE(1, 100000) AS x RETURN x;").get_as_arrow(10000)
+    assert table.num_rows == 100000
+    assert table["x"].to_pylist() == list(range(1, 100001))
+
+
+def test_streaming_results_closed_by_next_query(conn_db_readonly: ConnDB) -> None:
+    _, db = conn_db_readonly
+    conn = kuzu.Connection(db)
+    conn.set_streaming_results(True)
+    result = conn.execute("UNWIND RANGE(1, 100000) AS x RETURN x;")
+    assert result.get_next() == [1]
+    count = conn.execute("MATCH (a:person) RETURN COUNT(*);")
+    assert count.get_next() == [8]
+    with pytest.raises(RuntimeError, match="The streaming query result has been closed"):
+        result.has_next()
+
+
+def test_streaming_results_df(conn_db_readonly: ConnDB) -> None:
+    _, db = conn_db_readonly
+    conn = kuzu.Connection(db)
+    conn.set_streaming_results(True)
+    result = conn.execute("UNWIND RANGE(1, 100000) AS x RETURN x, CAST(x AS STRING) AS s;")
+    assert result.get_next() == [1, "1"]
+    df = result.get_as_df()
+    assert len(df) == 99999
+    assert df["x"].tolist() == list(range(2, 100001))
+    assert df["s"].tolist() == [str(x) for x in range(2, 100001)]
+    assert df["x"].dtype == "int64"